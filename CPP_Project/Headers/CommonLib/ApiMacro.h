@@ -7,3 +7,10 @@
 #else
 #define COMMONLIB_API
 #endif
+
+// MSVC applies the empty base optimization to one base only unless asked to do it for all.
+#if defined(_MSC_VER)
+#define COMMONLIB_EMPTY_BASES __declspec(empty_bases)
+#else
+#define COMMONLIB_EMPTY_BASES
+#endif
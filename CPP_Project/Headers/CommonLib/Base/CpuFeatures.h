@@ -0,0 +1,72 @@
+/** @file
+ *  @brief This file contains the definition of the CpuFeatures class.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "CommonLib/ApiMacro.h"
+
+namespace CommonLib
+{
+/**
+ * @brief The instruction set extensions a SIMD kernel may be dispatched to.
+ */
+enum class SimdLevel : std::uint8_t
+{
+    Scalar,  ///< Portable C++ only
+    Ssse3,   ///< x86 SSE up to SSSE3 (128-bit)
+    Avx2     ///< x86 AVX2 (256-bit)
+};
+
+/**
+ * @class CpuFeatures
+ * @brief Runtime detection of the CPU features (SIMD extensions, time stamp counter) usable on
+ *        this machine.
+ *
+ * The detection runs once and is cached, so the accessors are cheap enough to be called on
+ * every dispatch.
+ */
+class COMMONLIB_API CpuFeatures
+{
+    public:
+        /**
+         * @brief Returns whether SSSE3 instructions can be used.
+         * @return True if supported.
+         */
+        static auto has_ssse3() noexcept -> bool;
+
+        /**
+         * @brief Returns whether AVX2 instructions can be used (CPU and OS support).
+         * @return True if supported.
+         */
+        static auto has_avx2() noexcept -> bool;
+
+        /**
+         * @brief Returns whether the time stamp counter runs at a constant rate in all ACPI
+         *        power states, so that it can be used as a wall-clock time source.
+         * @return True if the CPU reports an invariant TSC.
+         */
+        static auto has_invariant_tsc() noexcept -> bool;
+
+        /**
+         * @brief Returns whether the RDTSCP instruction is available.
+         * @return True if supported.
+         */
+        static auto has_rdtscp() noexcept -> bool;
+
+        /**
+         * @brief Returns the best SIMD level supported on this machine.
+         * @return The highest usable SimdLevel.
+         */
+        static auto simd_level() noexcept -> SimdLevel;
+
+        /**
+         * @brief Returns whether the given level can be used on this machine.
+         * @param level The SIMD level.
+         * @return True if supported.
+         */
+        static auto supports(SimdLevel level) noexcept -> bool;
+};
+}  // namespace CommonLib
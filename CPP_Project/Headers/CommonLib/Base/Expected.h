@@ -0,0 +1,157 @@
+/** @file
+ *  @brief This file contains the definition of the Expected and Unexpected classes.
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace CommonLib
+{
+/**
+ * @class Unexpected
+ * @brief Wraps an error value so that it can be used to construct an Expected.
+ */
+template<typename E>
+class Unexpected
+{
+    public:
+        /**
+         * @brief Constructs the wrapper.
+         * @param error The error value.
+         */
+        constexpr explicit Unexpected(E error) noexcept(std::is_nothrow_move_constructible_v<E>)
+            : m_error(std::move(error))
+        {}
+
+        /**
+         * @brief Returns the wrapped error.
+         * @return The error value.
+         */
+        [[nodiscard]] constexpr auto error() const& noexcept -> const E&
+        {
+            return m_error;
+        }
+
+        /**
+         * @brief Returns the wrapped error.
+         * @return The error value.
+         */
+        [[nodiscard]] constexpr auto error() && noexcept -> E&&
+        {
+            return std::move(m_error);
+        }
+
+    private:
+        E m_error;
+};
+
+/**
+ * @class Expected
+ * @brief Holds either a value or an error, in the spirit of C++23 std::expected.
+ *
+ * Used by APIs that must report failures without throwing, e.g. when parsing untrusted input on
+ * a hot path. Only value() throws (std::logic_error) when called on an error; check has_value()
+ * or use operator* / value_or() to stay exception free.
+ */
+template<typename T, typename E>
+class Expected
+{
+    public:
+        using value_type = T;
+        using error_type = E;
+
+        /**
+         * @brief Constructs an Expected holding a value.
+         * @param value The value.
+         */
+        constexpr Expected(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : m_storage(std::in_place_index<0>, std::move(value))
+        {}
+
+        /**
+         * @brief Constructs an Expected holding an error.
+         * @param error The error.
+         */
+        constexpr Expected(Unexpected<E> error) noexcept(std::is_nothrow_move_constructible_v<E>)
+            : m_storage(std::in_place_index<1>, std::move(error).error())
+        {}
+
+        /**
+         * @brief Returns whether a value is held.
+         * @return True if a value is held, false if an error is held.
+         */
+        [[nodiscard]] constexpr auto has_value() const noexcept -> bool
+        {
+            return m_storage.index() == 0;
+        }
+
+        /**
+         * @brief Returns whether a value is held.
+         * @return True if a value is held, false if an error is held.
+         */
+        constexpr explicit operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        /**
+         * @brief Returns the value.
+         * @return The held value.
+         * @throws std::logic_error if an error is held.
+         */
+        [[nodiscard]] constexpr auto value() const& -> const T&
+        {
+            if (!has_value())
+            {
+                throw std::logic_error("Expected does not hold a value");
+            }
+            return *std::get_if<0>(&m_storage);
+        }
+
+        /**
+         * @brief Returns the value, or the given fallback if an error is held.
+         * @param fallback The value returned on error.
+         * @return The held value or the fallback.
+         */
+        template<typename U>
+        [[nodiscard]] constexpr auto value_or(U&& fallback) const& -> T
+        {
+            return has_value() ? *std::get_if<0>(&m_storage)
+                               : static_cast<T>(std::forward<U>(fallback));
+        }
+
+        /**
+         * @brief Returns the error. The behavior is undefined if a value is held.
+         * @return The held error.
+         */
+        [[nodiscard]] constexpr auto error() const& noexcept -> const E&
+        {
+            return *std::get_if<1>(&m_storage);
+        }
+
+        /**
+         * @brief Returns the value. The behavior is undefined if an error is held.
+         * @return The held value.
+         */
+        constexpr auto operator*() const& noexcept -> const T&
+        {
+            return *std::get_if<0>(&m_storage);
+        }
+
+        /**
+         * @brief Accesses the value. The behavior is undefined if an error is held.
+         * @return A pointer to the held value.
+         */
+        constexpr auto operator->() const noexcept -> const T*
+        {
+            return std::get_if<0>(&m_storage);
+        }
+
+    private:
+        std::variant<T, E> m_storage;
+};
+}  // namespace CommonLib
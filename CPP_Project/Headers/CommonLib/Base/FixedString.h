@@ -0,0 +1,59 @@
+/** @file
+ *  @brief This file contains the definition of the FixedString class template.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace CommonLib
+{
+/**
+ * @struct FixedString
+ * @brief A string literal that can be passed as a template argument.
+ * @tparam N The size of the literal including its terminating null character.
+ *
+ * Lets APIs take compile-time strings such as format patterns as non-type template parameters,
+ * e.g. StaticDateTimeFormat<"%F %T">, so that they can be validated and specialized at compile
+ * time. The characters are a public member because structural types require it.
+ */
+template<std::size_t N>
+struct FixedString {
+        char value[N]{};
+
+        /**
+         * @brief Copies a string literal; implicit so that a literal converts to a template
+         *        argument.
+         * @param text The string literal.
+         */
+        constexpr FixedString(const char (&text)[N]) noexcept
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                value[i] = text[i];
+            }
+        }
+
+        /**
+         * @brief Returns the number of characters, excluding the terminating null character.
+         * @return The length.
+         */
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return N - 1;
+        }
+
+        /**
+         * @brief Returns the characters as a string view.
+         * @return The view, excluding the terminating null character.
+         */
+        [[nodiscard]] constexpr auto view() const noexcept -> std::string_view
+        {
+            return {value, N - 1};
+        }
+};
+
+template<std::size_t N>
+FixedString(const char (&)[N]) -> FixedString<N>;
+}  // namespace CommonLib
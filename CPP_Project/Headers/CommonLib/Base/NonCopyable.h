@@ -15,6 +15,10 @@ namespace CommonLib
  * This class is used to prevent copying of derived classes by deleting
  * the copy constructor and copy assignment operator. Move operations are
  * explicitly defaulted to allow moving.
+ *
+ * The class is empty and has no virtual functions, so deriving from it adds nothing to the size
+ * or layout of a class: it occupies no storage through the empty base optimization, and a
+ * derived class stays standard-layout and trivially destructible if its members are.
  */
 class COMMONLIB_API NonCopyable
 {
@@ -29,9 +33,19 @@ class COMMONLIB_API NonCopyable
         /**
          * @brief Destroys the NonCopyable object.
          *
-         * The destructor is virtual to ensure proper cleanup of derived classes.
+         * The destructor is protected instead of virtual: a derived object cannot be deleted
+         * through a NonCopyable pointer, so the class needs no vtable and stays empty. Define
+         * COMMONLIB_VIRTUAL_POLICY_BASES to make it virtual again while migrating code that
+         * declares its destructor 'override'. The macro changes the layout of exported classes,
+         * so the library and all its clients must agree on it: configure with the CMake option
+         * <project>_VIRTUAL_POLICY_BASES, which defines it for the library and its dependents,
+         * rather than defining it in client code.
          */
+#if defined(COMMONLIB_VIRTUAL_POLICY_BASES)
         virtual ~NonCopyable() = default;
+#else
+        ~NonCopyable() = default;
+#endif
 
     public:
         /**
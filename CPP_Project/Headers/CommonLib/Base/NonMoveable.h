@@ -14,6 +14,10 @@ namespace CommonLib
  *
  * This class is used to prevent moving of derived classes by deleting
  * the move constructor and move assignment operator.
+ *
+ * Like NonCopyable, the class is empty and has no virtual functions, so it adds nothing to the
+ * size or layout of a derived class. Classes deriving from both should be declared
+ * COMMONLIB_EMPTY_BASES so that MSVC lays out both bases at offset 0 as well.
  */
 class COMMONLIB_API NonMoveable
 {
@@ -28,9 +32,19 @@ class COMMONLIB_API NonMoveable
         /**
          * @brief Destroys the NonMoveable object.
          *
-         * The destructor is virtual to ensure proper cleanup of derived classes.
+         * The destructor is protected instead of virtual: a derived object cannot be deleted
+         * through a NonMoveable pointer, so the class needs no vtable and stays empty. Define
+         * COMMONLIB_VIRTUAL_POLICY_BASES to make it virtual again while migrating code that
+         * declares its destructor 'override'. The macro changes the layout of exported classes,
+         * so the library and all its clients must agree on it: configure with the CMake option
+         * <project>_VIRTUAL_POLICY_BASES, which defines it for the library and its dependents,
+         * rather than defining it in client code.
          */
+#if defined(COMMONLIB_VIRTUAL_POLICY_BASES)
         virtual ~NonMoveable() = default;
+#else
+        ~NonMoveable() = default;
+#endif
 
     public:
         /**
@@ -0,0 +1,395 @@
+/** @file
+ *  @brief This file contains the definition of the TokenBucketRule and SlidingWindowRule
+ *         classes and the RateLimiter and ShardedRateLimiter class templates.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Utils/ClockSource.h"
+
+namespace CommonLib
+{
+/**
+ * @class TokenBucketRule
+ * @brief A token bucket, implemented as the generic cell rate algorithm (GCRA).
+ *
+ * Instead of a token count and a refill timestamp, the state is the single 64-bit "theoretical
+ * arrival time" (TAT): the time at which the bucket would be full again. Acquiring n tokens
+ * moves it n emission intervals further into the future and succeeds if it stays within
+ * burst intervals of now. This is exactly a token bucket of size burst refilled at rate tokens
+ * per second, but it fits into one word that is updated with a single compare-exchange, and a
+ * denied request does not write at all. The rate is rounded to a whole number of nanoseconds per
+ * token.
+ *
+ * An idle state (TAT not in the future) is indistinguishable from a fresh one, including the
+ * initial state 0.
+ */
+class COMMONLIB_API TokenBucketRule
+{
+    public:
+        /**
+         * @brief Creates the rule.
+         * @param tokens_per_second The refill rate, at most 1e9.
+         * @param burst The bucket size: the number of tokens available after a long pause.
+         * @throws std::invalid_argument if a parameter is out of range.
+         */
+        TokenBucketRule(double tokens_per_second, std::uint64_t burst);
+
+        /**
+         * @brief Takes tokens from a bucket state if enough are available.
+         * @param state The packed state of the bucket.
+         * @param now_ns The current steady_clock time in nanoseconds since its epoch.
+         * @param tokens The number of tokens to take.
+         * @return True if the tokens were taken.
+         */
+        auto try_acquire(std::atomic<std::uint64_t>& state, std::int64_t now_ns,
+                         std::uint64_t tokens) const noexcept -> bool
+        {
+            if (tokens > m_burst)
+            {
+                return false;
+            }
+            const auto now = static_cast<std::uint64_t>(now_ns);
+            const std::uint64_t limit = now + m_burst_ns;
+            std::uint64_t tat = state.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                const std::uint64_t next = (tat > now ? tat : now) + tokens * m_interval_ns;
+                if (next > limit)
+                {
+                    return false;
+                }
+                if (state.compare_exchange_weak(tat, next, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+        }
+
+        /**
+         * @brief Returns whether a state is equivalent to a full bucket.
+         * @param state The packed state.
+         * @param now_ns The current steady_clock time in nanoseconds since its epoch.
+         * @return True if the bucket is full.
+         */
+        [[nodiscard]] auto is_idle(std::uint64_t state, std::int64_t now_ns) const noexcept -> bool
+        {
+            return state <= static_cast<std::uint64_t>(now_ns);
+        }
+
+        /**
+         * @brief Returns the number of tokens a state currently holds.
+         * @param state The packed state.
+         * @param now_ns The current steady_clock time in nanoseconds since its epoch.
+         * @return The available tokens.
+         */
+        [[nodiscard]] auto available(std::uint64_t state, std::int64_t now_ns) const noexcept
+            -> std::uint64_t;
+
+    private:
+        std::uint64_t m_burst;
+        std::uint64_t m_interval_ns;  ///< Time to refill one token
+        std::uint64_t m_burst_ns;     ///< Time to refill the whole bucket
+};
+
+/**
+ * @class SlidingWindowRule
+ * @brief A sliding-window counter: at most limit tokens in any window of the given length.
+ *
+ * The state packs the index of the current fixed window (24 bits) with the counts of the current
+ * and the previous window (20 bits each) into one word. The number of tokens in the sliding
+ * window is estimated as the current count plus the previous count weighted by how much of the
+ * previous window still overlaps it, the approximation popularized by large API gateways. A
+ * denied request does not write.
+ */
+class COMMONLIB_API SlidingWindowRule
+{
+    public:
+        /// The largest supported limit per window.
+        static constexpr std::uint64_t k_max_limit = (std::uint64_t{1} << 20) - 1;
+
+        /**
+         * @brief Creates the rule.
+         * @param limit The number of tokens allowed per window, from 1 to k_max_limit.
+         * @param window The length of the window.
+         * @throws std::invalid_argument if a parameter is out of range.
+         */
+        SlidingWindowRule(std::uint64_t limit, std::chrono::nanoseconds window);
+
+        /**
+         * @brief Counts tokens against a window state if the limit allows it.
+         * @param state The packed state of the window.
+         * @param now_ns The current steady_clock time in nanoseconds since its epoch.
+         * @param tokens The number of tokens to count.
+         * @return True if the tokens were counted.
+         */
+        auto try_acquire(std::atomic<std::uint64_t>& state, std::int64_t now_ns,
+                         std::uint64_t tokens) const noexcept -> bool;
+
+        /**
+         * @brief Returns whether a state has no tokens left in the sliding window.
+         * @param state The packed state.
+         * @param now_ns The current steady_clock time in nanoseconds since its epoch.
+         * @return True if the state is equivalent to a fresh one.
+         */
+        [[nodiscard]] auto is_idle(std::uint64_t state, std::int64_t now_ns) const noexcept
+            -> bool;
+
+        /**
+         * @brief Returns the number of tokens that may currently be acquired.
+         * @param state The packed state.
+         * @param now_ns The current steady_clock time in nanoseconds since its epoch.
+         * @return The available tokens.
+         */
+        [[nodiscard]] auto available(std::uint64_t state, std::int64_t now_ns) const noexcept
+            -> std::uint64_t;
+
+    private:
+        std::uint64_t m_limit;
+        std::int64_t m_window_ns;
+};
+
+/**
+ * @class RateLimiter
+ * @brief A single rate limiter whose acquire path is one compare-exchange loop.
+ * @tparam Rule TokenBucketRule or SlidingWindowRule.
+ *
+ * The packed state lives alone on a cache line; the current time is read from SteadyClock or
+ * injected through try_acquire_at().
+ */
+template<typename Rule>
+class RateLimiter
+{
+    public:
+        /**
+         * @brief Creates a limiter in its fresh state.
+         * @param rule The limit to enforce.
+         */
+        explicit RateLimiter(const Rule& rule) noexcept : m_rule(rule) {}
+
+        /**
+         * @brief Acquires tokens at the current time.
+         * @param tokens The number of tokens.
+         * @return True if the request is within the limit.
+         */
+        auto try_acquire(std::uint64_t tokens = 1) noexcept -> bool
+        {
+            return try_acquire_at(SteadyClock::now(), tokens);
+        }
+
+        /**
+         * @brief Acquires tokens at a given time.
+         * @param now The current time.
+         * @param tokens The number of tokens.
+         * @return True if the request is within the limit.
+         */
+        auto try_acquire_at(std::chrono::steady_clock::time_point now,
+                            std::uint64_t tokens = 1) noexcept -> bool
+        {
+            return m_rule.try_acquire(m_state, to_ns(now), tokens);
+        }
+
+        /**
+         * @brief Returns the number of tokens that could be acquired at a given time.
+         * @param now The time.
+         * @return The available tokens.
+         */
+        [[nodiscard]] auto available(std::chrono::steady_clock::time_point now) const noexcept
+            -> std::uint64_t
+        {
+            return m_rule.available(m_state.load(std::memory_order_relaxed), to_ns(now));
+        }
+
+        /**
+         * @brief Converts a time point to the nanosecond count the rules work with.
+         * @param time The time point.
+         * @return Nanoseconds since the steady_clock epoch.
+         */
+        static auto to_ns(std::chrono::steady_clock::time_point time) noexcept -> std::int64_t
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch())
+                .count();
+        }
+
+    private:
+        Rule m_rule;
+        alignas(64) std::atomic<std::uint64_t> m_state{0};
+};
+
+using TokenBucketLimiter = RateLimiter<TokenBucketRule>;
+using SlidingWindowLimiter = RateLimiter<SlidingWindowRule>;
+
+/**
+ * @class ShardedRateLimiter
+ * @brief Applies one rule independently to millions of keys, e.g. hashed client ids.
+ * @tparam Rule TokenBucketRule or SlidingWindowRule.
+ *
+ * The keys live in a fixed-capacity open-addressing table that is split into shards by the high
+ * bits of the key's hash; each slot holds the key and the packed state of its limiter. Looking
+ * up a known key and acquiring are lock-free. A new key claims an empty slot with a
+ * compare-exchange, or, when its probe window is full, the first slot whose limiter is idle;
+ * that loses nothing, because an idle state equals a fresh one. A request that races with the
+ * eviction of its idle key may be counted against the key that replaced it.
+ *
+ * If every slot of a probe window belongs to a key that is not idle, the request is denied and
+ * counted by untracked(). Size the table to about twice the number of keys that are active at
+ * the same time.
+ */
+template<typename Rule>
+class ShardedRateLimiter
+{
+    public:
+        /// The number of consecutive slots searched for a key.
+        static constexpr std::size_t k_probe_limit = 16;
+
+        /**
+         * @brief Creates an empty table.
+         * @param rule The limit to enforce per key.
+         * @param capacity The number of keys the table can track, rounded up to a power of two.
+         * @param shards The number of shards, rounded up to a power of two.
+         * @throws std::invalid_argument if capacity is smaller than shards * k_probe_limit.
+         */
+        explicit ShardedRateLimiter(const Rule& rule, std::size_t capacity = 1 << 20,
+                                    std::size_t shards = 64)
+            : m_rule(rule),
+              m_shard_bits(static_cast<unsigned>(std::countr_zero(std::bit_ceil(shards)))),
+              m_slot_mask(std::bit_ceil(capacity) / std::bit_ceil(shards) - 1),
+              m_slots(std::make_unique<Slot[]>(std::bit_ceil(capacity)))
+        {
+            if (m_slot_mask + 1 < k_probe_limit || capacity < shards)
+            {
+                throw std::invalid_argument("ShardedRateLimiter: capacity too small for shards");
+            }
+        }
+
+        /**
+         * @brief Acquires tokens for a key at the current time.
+         * @param key The key.
+         * @param tokens The number of tokens.
+         * @return True if the request is within the key's limit.
+         */
+        auto try_acquire(std::uint64_t key, std::uint64_t tokens = 1) noexcept -> bool
+        {
+            return try_acquire_at(key, SteadyClock::now(), tokens);
+        }
+
+        /**
+         * @brief Acquires tokens for a key at a given time.
+         * @param key The key.
+         * @param now The current time.
+         * @param tokens The number of tokens.
+         * @return True if the request is within the key's limit.
+         */
+        auto try_acquire_at(std::uint64_t key, std::chrono::steady_clock::time_point now,
+                            std::uint64_t tokens = 1) noexcept -> bool
+        {
+            const std::int64_t now_ns = RateLimiter<Rule>::to_ns(now);
+            std::atomic<std::uint64_t>* state = find_or_claim(key, now_ns);
+            if (state == nullptr)
+            {
+                m_untracked.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            return m_rule.try_acquire(*state, now_ns, tokens);
+        }
+
+        /**
+         * @brief Returns the number of requests denied because the table was full.
+         * @return The count.
+         */
+        [[nodiscard]] auto untracked() const noexcept -> std::uint64_t
+        {
+            return m_untracked.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the number of keys the table can hold.
+         * @return The capacity.
+         */
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t
+        {
+            return (m_slot_mask + 1) << m_shard_bits;
+        }
+
+    private:
+        struct Slot {
+                std::atomic<std::uint64_t> key{k_empty};
+                std::atomic<std::uint64_t> state{0};
+        };
+
+        static constexpr std::uint64_t k_empty = 0;
+
+        /// Spreads the bits of a key (SplitMix64 finalizer).
+        static auto mix(std::uint64_t key) noexcept -> std::uint64_t
+        {
+            key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+            return key ^ (key >> 31);
+        }
+
+        auto find_or_claim(std::uint64_t key, std::int64_t now_ns) noexcept
+            -> std::atomic<std::uint64_t>*
+        {
+            if (key == k_empty)
+            {
+                return &m_empty_key_state;  // The empty marker cannot be stored in a slot.
+            }
+
+            const std::uint64_t hash = mix(key);
+            const std::size_t shard = m_shard_bits == 0 ? 0 : hash >> (64 - m_shard_bits);
+            Slot* slots = m_slots.get() + (shard * (m_slot_mask + 1));
+            Slot* idle = nullptr;
+            std::uint64_t idle_key = k_empty;
+            for (std::size_t probe = 0; probe < k_probe_limit; ++probe)
+            {
+                Slot& slot = slots[(hash + probe) & m_slot_mask];
+                std::uint64_t current = slot.key.load(std::memory_order_acquire);
+                if (current == key)
+                {
+                    return &slot.state;
+                }
+                if (current == k_empty)
+                {
+                    if (slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel) ||
+                        current == key)
+                    {
+                        return &slot.state;
+                    }
+                }
+                if (idle == nullptr &&
+                    m_rule.is_idle(slot.state.load(std::memory_order_relaxed), now_ns))
+                {
+                    idle = &slot;
+                    idle_key = current;
+                }
+            }
+
+            if (idle != nullptr)
+            {
+                // Fails if another key took the slot since it was found idle.
+                if (idle->key.compare_exchange_strong(idle_key, key, std::memory_order_acq_rel) ||
+                    idle_key == key)
+                {
+                    return &idle->state;
+                }
+            }
+            return nullptr;
+        }
+
+        Rule m_rule;
+        unsigned m_shard_bits;
+        std::size_t m_slot_mask;
+        std::unique_ptr<Slot[]> m_slots;
+        std::atomic<std::uint64_t> m_empty_key_state{0};
+        alignas(64) std::atomic<std::uint64_t> m_untracked{0};
+};
+}  // namespace CommonLib
@@ -0,0 +1,368 @@
+/** @file
+ *  @brief This file contains the definition of the AsyncLogger class.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Patterns/Singleton.h"
+#include "CommonLib/Utils/DateTimeFormatter.h"
+
+namespace CommonLib
+{
+/**
+ * @class AsyncLogger
+ * @brief A process-wide logger that moves formatting and file I/O off the calling thread.
+ *
+ * log() only captures: it claims a fixed-size record in a bounded lock-free multi-producer,
+ * single-consumer queue, stores the wall clock time, the level, a pointer to the format string
+ * and a binary copy of the arguments, and publishes the record. A background thread renders the
+ * records in batches - the timestamp through a CachedDateTimeFormatter, the same renderer
+ * DateTimeUtils::now_cached() uses - gathers the lines in a large buffer and writes it with a
+ * single call once the buffer is full or the queue runs empty. The file is rotated by size:
+ * "app.log" becomes "app.log.1", "app.log.1" becomes "app.log.2" and so on.
+ *
+ * The format string uses "{}" as placeholder for the next argument and "{{" / "}}" for literal
+ * braces. It is stored by pointer and must outlive the logger, e.g. a string literal. Arguments
+ * may be arithmetic types, enums, pointers and anything convertible to std::string_view; strings
+ * are copied. If the arguments do not fit into a record, the remaining ones are dropped and the
+ * line ends with " [truncated]".
+ *
+ * When the queue is full, log() either drops the line and counts it (OverflowPolicy::Drop) or
+ * waits for the background thread (OverflowPolicy::Block). start() and stop() may be called from
+ * any thread; lines logged concurrently with stop() are either written or kept for the next
+ * start(). If start() changes the queue capacity, no other thread may log at the same time.
+ */
+class COMMONLIB_API AsyncLogger: public Singleton<AsyncLogger>
+{
+        friend class Singleton<AsyncLogger>;
+
+    public:
+        /**
+         * @enum Level
+         * @brief The severity of a line.
+         */
+        enum class Level : std::uint8_t
+        {
+            Trace,
+            Debug,
+            Info,
+            Warning,
+            Error,
+            Critical,
+            Off  ///< Only valid as threshold; disables logging
+        };
+
+        /**
+         * @enum OverflowPolicy
+         * @brief What log() does when the queue is full.
+         */
+        enum class OverflowPolicy : std::uint8_t
+        {
+            Drop,
+            Block
+        };
+
+        /**
+         * @struct Config
+         * @brief The settings of a logging session.
+         */
+        struct Config {
+                std::string path;  ///< The log file; rotated files get ".1", ".2", ... appended
+                std::uint64_t max_file_size = 64 * 1024 * 1024;  ///< 0 disables rotation
+                std::uint32_t max_files = 5;  ///< Number of rotated files kept besides path
+                std::string timestamp_format = "%Y-%m-%d %H:%M:%S.%6N";
+                DateTimeFormatter::Zone zone = DateTimeFormatter::Zone::Local;
+                Level level = Level::Info;
+                OverflowPolicy overflow = OverflowPolicy::Drop;
+                std::size_t queue_capacity = 65536;  ///< Number of records; a power of two
+                std::size_t buffer_size = 256 * 1024;  ///< Bytes gathered before a write
+                std::chrono::milliseconds idle_wait{2};  ///< Sleep of the idle background thread
+        };
+
+        /// The size of a queue record in bytes.
+        static constexpr std::size_t k_record_size = 256;
+
+        /**
+         * @brief Opens the log file and starts the background thread; restarts the logger with
+         *        the new settings if it is already running.
+         * @param config The settings.
+         * @throws std::invalid_argument if the path is empty, the queue capacity is not a power of
+         *         two of at least 2 or the buffer size is 0.
+         * @throws std::runtime_error if the log file cannot be opened.
+         */
+        void start(const Config& config);
+
+        /**
+         * @brief Writes all queued lines, closes the file and stops the background thread.
+         */
+        void stop();
+
+        /**
+         * @brief Waits until every line logged before the call is written to the file.
+         */
+        void flush();
+
+        /**
+         * @brief Returns whether the logger is running.
+         * @return True between start() and stop().
+         */
+        [[nodiscard]] auto running() const noexcept -> bool
+        {
+            return m_running.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Changes the lowest level that is logged.
+         * @param level The new threshold.
+         */
+        void set_level(Level level) noexcept;
+
+        /**
+         * @brief Returns the lowest level that is logged.
+         * @return The threshold of the current or last session.
+         */
+        [[nodiscard]] auto level() const noexcept -> Level;
+
+        /**
+         * @brief Returns whether a line of a level would be captured.
+         * @param level The level.
+         * @return True if the logger is running and the level is not below the threshold.
+         */
+        [[nodiscard]] auto enabled(Level level) const noexcept -> bool
+        {
+            return level >= m_threshold.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Captures a line; formatting and writing happen on the background thread.
+         * @param level The level of the line.
+         * @param format The format string with "{}" placeholders; must outlive the logger.
+         * @param args The arguments.
+         * @return True if the line was queued, false if it was filtered or dropped.
+         */
+        template<typename... Args>
+        auto log(Level level, const char* format, const Args&... args) noexcept -> bool
+        {
+            if (!enabled(level))
+            {
+                return false;
+            }
+            Record* record = claim(level, format);
+            if (record == nullptr)
+            {
+                return false;
+            }
+            std::size_t offset = 0;
+            (encode(*record, offset, args), ...);
+            record->size = static_cast<std::uint16_t>(offset);
+            record->sequence.store(record->position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Returns the number of lines dropped because the queue was full.
+         * @return The count since the logger was created.
+         */
+        [[nodiscard]] auto dropped() const noexcept -> std::uint64_t;
+
+        /**
+         * @brief Returns the number of lines written to files.
+         * @return The count since the logger was created.
+         */
+        [[nodiscard]] auto written() const noexcept -> std::uint64_t;
+
+        /**
+         * @brief Returns the name a level is written with.
+         * @param level The level.
+         * @return The name, e.g. "INFO".
+         */
+        static auto level_name(Level level) noexcept -> std::string_view;
+
+    private:
+        /**
+         * @enum ArgType
+         * @brief The tag in front of an encoded argument.
+         */
+        enum class ArgType : std::uint8_t
+        {
+            Bool,
+            Char,
+            Int,
+            UInt,
+            Double,
+            String,
+            Pointer
+        };
+
+        static constexpr std::size_t k_header_size = 40;
+        static constexpr std::size_t k_payload_size = k_record_size - k_header_size;
+
+        /**
+         * @struct Record
+         * @brief A queue slot: one captured line.
+         */
+        struct alignas(64) Record {
+                std::atomic<std::uint64_t> sequence{0};  ///< Slot state of the queue protocol
+                std::uint64_t position = 0;  ///< The queue position the record was claimed at
+                std::int64_t timestamp_ns = 0;  ///< system_clock time since the epoch
+                const char* format = nullptr;
+                std::uint32_t thread = 0;
+                Level level = Level::Info;
+                bool truncated = false;
+                std::uint16_t size = 0;  ///< Number of used payload bytes
+                std::array<char, k_payload_size> payload{};
+        };
+        static_assert(sizeof(Record) == k_record_size);
+
+        struct Writer;
+
+        AsyncLogger();
+        ~AsyncLogger();
+
+        auto claim(Level level, const char* format) noexcept -> Record*;
+        auto drain(Writer& writer, std::size_t limit) -> std::size_t;
+        void run();
+        void stop_locked();
+
+        static void put(Record& record, std::size_t& offset, ArgType type, const void* data,
+                        std::size_t size) noexcept
+        {
+            if (record.truncated || offset + 1 + size > k_payload_size)
+            {
+                record.truncated = true;
+                return;
+            }
+            record.payload[offset] = static_cast<char>(type);
+            std::memcpy(record.payload.data() + offset + 1, data, size);
+            offset += 1 + size;
+        }
+
+        static void put_string(Record& record, std::size_t& offset, std::string_view value) noexcept
+        {
+            constexpr std::size_t k_prefix = 1 + sizeof(std::uint16_t);
+            if (record.truncated || offset + k_prefix > k_payload_size)
+            {
+                record.truncated = true;
+                return;
+            }
+            const std::size_t length = std::min(value.size(), k_payload_size - offset - k_prefix);
+            const auto stored = static_cast<std::uint16_t>(length);
+            record.payload[offset] = static_cast<char>(ArgType::String);
+            std::memcpy(record.payload.data() + offset + 1, &stored, sizeof(stored));
+            std::memcpy(record.payload.data() + offset + k_prefix, value.data(), length);
+            offset += k_prefix + length;
+            record.truncated = length < value.size();
+        }
+
+        template<typename T>
+        static void encode(Record& record, std::size_t& offset, const T& value) noexcept
+        {
+            using Type = std::decay_t<T>;
+            if constexpr (std::is_same_v<Type, bool>)
+            {
+                put(record, offset, ArgType::Bool, &value, sizeof(value));
+            }
+            else if constexpr (std::is_same_v<Type, char>)
+            {
+                put(record, offset, ArgType::Char, &value, sizeof(value));
+            }
+            else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+            {
+                const auto widened = static_cast<std::int64_t>(value);
+                put(record, offset, ArgType::Int, &widened, sizeof(widened));
+            }
+            else if constexpr (std::is_integral_v<Type>)
+            {
+                const auto widened = static_cast<std::uint64_t>(value);
+                put(record, offset, ArgType::UInt, &widened, sizeof(widened));
+            }
+            else if constexpr (std::is_floating_point_v<Type>)
+            {
+                const auto widened = static_cast<double>(value);
+                put(record, offset, ArgType::Double, &widened, sizeof(widened));
+            }
+            else if constexpr (std::is_enum_v<Type>)
+            {
+                encode(record, offset, static_cast<std::underlying_type_t<Type>>(value));
+            }
+            else if constexpr (std::is_array_v<T> &&
+                               std::is_same_v<std::remove_cv_t<std::remove_extent_t<T>>, char>)
+            {
+                // String literals and char buffers; an array is never null.
+                put_string(record, offset, std::string_view(value));
+            }
+            else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>)
+            {
+                put_string(record, offset, value != nullptr ? std::string_view(value) : "(null)");
+            }
+            else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            {
+                put_string(record, offset, std::string_view(value));
+            }
+            else if constexpr (std::is_pointer_v<Type> || std::is_null_pointer_v<Type>)
+            {
+                const auto address = reinterpret_cast<std::uintptr_t>(value);
+                put(record, offset, ArgType::Pointer, &address, sizeof(address));
+            }
+            else
+            {
+                static_assert(std::is_void_v<T>, "AsyncLogger: unsupported argument type");
+            }
+        }
+
+        std::unique_ptr<Record[]> m_records;
+        std::uint64_t m_mask = 0;
+        std::atomic<OverflowPolicy> m_overflow{OverflowPolicy::Drop};
+        std::atomic<Level> m_threshold{Level::Off};  ///< Level::Off while stopped
+        std::atomic<Level> m_level{Level::Info};
+        std::atomic<bool> m_running{false};
+        alignas(64) std::atomic<std::uint64_t> m_enqueue_position{0};
+        alignas(64) std::atomic<std::uint64_t> m_dropped{0};
+        alignas(64) std::uint64_t m_dequeue_position = 0;  ///< Only used by the writer thread
+        std::atomic<std::uint64_t> m_written{0};
+        std::mutex m_control;  ///< Serializes start(), stop(), flush() and set_level()
+        std::unique_ptr<Writer> m_writer;
+};
+}  // namespace CommonLib
+
+/**
+ * @def COMMONLIB_LOG
+ * @brief Logs a line through AsyncLogger; the arguments are not evaluated if the level is
+ *        disabled. Define COMMONLIB_DISABLE_LOGGING to compile all log statements out.
+ */
+#if defined(COMMONLIB_DISABLE_LOGGING)
+#define COMMONLIB_LOG(level, ...) static_cast<void>(0)
+#else
+#define COMMONLIB_LOG(level, ...)                                                                \
+    do                                                                                           \
+    {                                                                                            \
+        auto& commonlib_logger = ::CommonLib::AsyncLogger::get_instance();                       \
+        if (commonlib_logger.enabled(level))                                                     \
+        {                                                                                        \
+            static_cast<void>(commonlib_logger.log(level, __VA_ARGS__));                         \
+        }                                                                                        \
+    } while (false)
+#endif
+
+#define COMMONLIB_LOG_TRACE(...) COMMONLIB_LOG(::CommonLib::AsyncLogger::Level::Trace, __VA_ARGS__)
+#define COMMONLIB_LOG_DEBUG(...) COMMONLIB_LOG(::CommonLib::AsyncLogger::Level::Debug, __VA_ARGS__)
+#define COMMONLIB_LOG_INFO(...) COMMONLIB_LOG(::CommonLib::AsyncLogger::Level::Info, __VA_ARGS__)
+#define COMMONLIB_LOG_WARNING(...)                                                               \
+    COMMONLIB_LOG(::CommonLib::AsyncLogger::Level::Warning, __VA_ARGS__)
+#define COMMONLIB_LOG_ERROR(...) COMMONLIB_LOG(::CommonLib::AsyncLogger::Level::Error, __VA_ARGS__)
+#define COMMONLIB_LOG_CRITICAL(...)                                                              \
+    COMMONLIB_LOG(::CommonLib::AsyncLogger::Level::Critical, __VA_ARGS__)
@@ -0,0 +1,223 @@
+/** @file
+ *  @brief This file contains the definition of the ObjectPool class.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/NonCopyable.h"
+#include "CommonLib/Base/NonMoveable.h"
+#include "CommonLib/Memory/SlotAllocator.h"
+
+namespace CommonLib
+{
+/**
+ * @class ObjectPool
+ * @brief A pool of T objects whose storage is recycled instead of returned to the heap.
+ *
+ * acquire() constructs an object in a free slot and returns a move-only Handle that destroys the
+ * object and returns the slot when it goes out of scope, on whichever thread that happens. The
+ * slots come from a SlotAllocator: per-thread caches over a shared lock-free free list, slabs
+ * that double in size as the pool grows, and one or more whole cache lines per object. When
+ * SlotAllocator::poisoning() is on, freed objects are overwritten with
+ * SlotAllocator::k_poison_byte, so reads through dangling pointers see garbage and writes are
+ * caught when the slot is reused.
+ *
+ * The pool must outlive all its handles.
+ *
+ * @tparam T The type of the pooled objects.
+ */
+template<typename T>
+class COMMONLIB_API COMMONLIB_EMPTY_BASES ObjectPool: public NonCopyable, public NonMoveable
+{
+    public:
+        /**
+         * @class Handle
+         * @brief Owns one pooled object, like a std::unique_ptr whose deleter returns the slot.
+         */
+        class Handle: public NonCopyable
+        {
+            public:
+                /**
+                 * @brief Constructs an empty handle.
+                 */
+                Handle() noexcept = default;
+
+                /**
+                 * @brief Destroys the object, if any, and returns its slot to the pool.
+                 */
+                ~Handle()
+                {
+                    reset();
+                }
+
+                /**
+                 * @brief Takes over the object of another handle, which becomes empty.
+                 * @param other The handle to move from.
+                 */
+                Handle(Handle&& other) noexcept
+                    : m_pool(std::exchange(other.m_pool, nullptr)),
+                      m_object(std::exchange(other.m_object, nullptr)),
+                      m_index(other.m_index)
+                {
+                }
+
+                /**
+                 * @brief Releases the current object and takes over the one of another handle.
+                 * @param other The handle to move from.
+                 * @return A reference to this handle.
+                 */
+                auto operator=(Handle&& other) noexcept -> Handle&
+                {
+                    if (this != &other)
+                    {
+                        reset();
+                        m_pool = std::exchange(other.m_pool, nullptr);
+                        m_object = std::exchange(other.m_object, nullptr);
+                        m_index = other.m_index;
+                    }
+                    return *this;
+                }
+
+                /**
+                 * @brief Destroys the object, if any, and returns its slot to the pool.
+                 */
+                void reset() noexcept
+                {
+                    if (m_object != nullptr)
+                    {
+                        m_pool->release(std::exchange(m_object, nullptr), m_index);
+                        m_pool = nullptr;
+                    }
+                }
+
+                /**
+                 * @brief Returns the object.
+                 * @return The object, or nullptr if the handle is empty.
+                 */
+                [[nodiscard]] auto get() const noexcept -> T*
+                {
+                    return m_object;
+                }
+
+                /**
+                 * @brief Accesses a member of the object; the handle must not be empty.
+                 * @return The object.
+                 */
+                auto operator->() const noexcept -> T*
+                {
+                    return m_object;
+                }
+
+                /**
+                 * @brief Returns the object; the handle must not be empty.
+                 * @return The object.
+                 */
+                auto operator*() const noexcept -> T&
+                {
+                    return *m_object;
+                }
+
+                /**
+                 * @brief Checks whether the handle owns an object.
+                 * @return True unless the handle is empty.
+                 */
+                explicit operator bool() const noexcept
+                {
+                    return m_object != nullptr;
+                }
+
+            private:
+                friend class ObjectPool;
+
+                Handle(ObjectPool* pool, T* object, std::uint32_t index) noexcept
+                    : m_pool(pool), m_object(object), m_index(index)
+                {
+                }
+
+                ObjectPool* m_pool = nullptr;
+                T* m_object = nullptr;
+                std::uint32_t m_index = 0;
+        };
+
+        /**
+         * @brief Creates an empty pool.
+         * @param first_slab_objects The number of objects in the first slab, rounded up to a power
+         *                           of two; every further slab is twice as large.
+         * @param cache_objects The number of free slots each thread keeps for this pool.
+         */
+        explicit ObjectPool(std::size_t first_slab_objects = 256, std::size_t cache_objects = 64)
+            : m_slots(sizeof(T), alignof(T), first_slab_objects, cache_objects)
+        {
+        }
+
+        /**
+         * @brief Releases the slabs; all handles must have been destroyed.
+         */
+        ~ObjectPool() = default;
+
+        /**
+         * @brief Constructs an object in a free slot, growing the pool if there is none.
+         * @param args The constructor arguments.
+         * @return The handle owning the object.
+         * @throws std::bad_alloc if the pool needs to grow and cannot.
+         * @throws Whatever the constructor of T throws; the slot is returned then.
+         */
+        template<typename... Args>
+        [[nodiscard]] auto acquire(Args&&... args) -> Handle
+        {
+            const SlotAllocator::Slot slot = m_slots.allocate();
+            try
+            {
+                T* object = ::new (slot.pointer) T(std::forward<Args>(args)...);
+                return Handle(this, object, slot.index);
+            }
+            catch (...)
+            {
+                m_slots.deallocate(slot.index);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Returns the number of objects the pool can hold without growing.
+         * @return The number of slots, allocated or free.
+         */
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t
+        {
+            return m_slots.capacity();
+        }
+
+        /**
+         * @brief Returns the distance between two pooled objects in bytes.
+         * @return sizeof(T) rounded up to whole cache lines.
+         */
+        [[nodiscard]] auto slot_size() const noexcept -> std::size_t
+        {
+            return m_slots.slot_size();
+        }
+
+        /**
+         * @brief Returns the free slots cached by the calling thread to the shared free list,
+         *        e.g. before a thread that freed many objects goes idle.
+         */
+        void flush_thread_cache() noexcept
+        {
+            m_slots.flush_thread_cache();
+        }
+
+    private:
+        void release(T* object, std::uint32_t index) noexcept
+        {
+            object->~T();
+            m_slots.deallocate(index);
+        }
+
+        SlotAllocator m_slots;
+};
+}  // namespace CommonLib
@@ -0,0 +1,178 @@
+/** @file
+ *  @brief This file contains the definition of the SlotAllocator class.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/NonCopyable.h"
+#include "CommonLib/Base/NonMoveable.h"
+
+namespace CommonLib
+{
+/**
+ * @class SlotAllocator
+ * @brief Allocates fixed-size slots from slabs through per-thread caches and a shared lock-free
+ *        free list; the untyped storage behind ObjectPool.
+ *
+ * Slots are padded to whole cache lines, so objects handed to different threads never share
+ * one. The slabs double in size as the allocator grows; a slot is identified by a 32-bit index,
+ * which the free lists link through and which the shared list tags against ABA. The links are
+ * atomics in an array behind the slots of each slab, never in the slots themselves, so a thread
+ * reading a stale list head does not race with the owner of that slot writing its object. Slots
+ * are only returned to the operating system when the allocator is destroyed.
+ *
+ * Every thread keeps a small cache of free slots per allocator, so allocate() and deallocate()
+ * usually touch no shared cache line. A thread that runs out takes a batch from the shared list
+ * with one compare-and-swap per slot, and a thread whose cache overflows returns a batch with a
+ * single one, so slots freed on another thread than the one that allocated them migrate in
+ * batches. Only growing the allocator takes a mutex. A thread hands its cached slots back when it
+ * exits or when it starts using more allocators than its cache has entries. Once its caches are
+ * destroyed, e.g. when static objects release slots after main() returned, a thread allocates
+ * from and frees to the shared list directly.
+ *
+ * When poisoning() is on, freed slots are filled with k_poison_byte and checked when they are
+ * handed out again, so writes through dangling pointers trigger an assertion.
+ */
+class COMMONLIB_API COMMONLIB_EMPTY_BASES SlotAllocator: public NonCopyable, public NonMoveable
+{
+    public:
+        /// The assumed cache line size; every slot is a multiple of it.
+        static constexpr std::size_t k_cache_line = 64;
+
+        /// The byte freed slots are filled with when poisoning() is on.
+        static constexpr unsigned char k_poison_byte = 0xDD;
+
+        /**
+         * @brief Whether freed slots are poisoned and checked on reuse.
+         *
+         * Decided when the library is built, on with NDEBUG undefined; callers built with other
+         * settings than the library get the library's answer.
+         */
+        [[nodiscard]] static auto poisoning() noexcept -> bool;
+
+        /**
+         * @struct Slot
+         * @brief An allocated slot.
+         */
+        struct Slot {
+                void* pointer = nullptr;
+                std::uint32_t index = 0;  ///< Passed back to deallocate()
+        };
+
+        /**
+         * @brief Creates an allocator without any slabs.
+         * @param object_size The size of the objects stored in the slots.
+         * @param object_alignment Their alignment, a power of two.
+         * @param first_slab_slots The number of slots in the first slab, rounded up to a power of
+         *                         two; every further slab is twice as large as the previous one.
+         * @param cache_slots The number of free slots a thread keeps before returning half of
+         *                    them to the shared list.
+         * @throws std::invalid_argument if the alignment is not a power of two or a count is 0.
+         */
+        SlotAllocator(std::size_t object_size, std::size_t object_alignment,
+                      std::size_t first_slab_slots = 256, std::size_t cache_slots = 64);
+
+        /**
+         * @brief Releases all slabs. All slots must have been deallocated, and no other thread may
+         *        use the allocator any more.
+         */
+        ~SlotAllocator();
+
+        /**
+         * @brief Allocates a slot.
+         * @return The slot; its storage is uninitialized.
+         * @throws std::bad_alloc if a new slab is needed and cannot be allocated.
+         */
+        auto allocate() -> Slot;
+
+        /**
+         * @brief Returns a slot, from any thread.
+         * @param index The index of the slot, as returned by allocate().
+         */
+        void deallocate(std::uint32_t index) noexcept;
+
+        /**
+         * @brief Returns the storage of a slot.
+         * @param index The index of the slot.
+         * @return The storage.
+         */
+        [[nodiscard]] auto slot(std::uint32_t index) const noexcept -> void*;
+
+        /**
+         * @brief Returns the distance between two slots in bytes.
+         * @return The object size rounded up to whole cache lines and the object alignment.
+         */
+        [[nodiscard]] auto slot_size() const noexcept -> std::size_t
+        {
+            return m_slot_size;
+        }
+
+        /**
+         * @brief Returns the number of slots in all slabs, allocated or free.
+         * @return The capacity.
+         */
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t;
+
+        /**
+         * @brief Returns the number of slabs allocated so far.
+         * @return The slab count.
+         */
+        [[nodiscard]] auto slab_count() const noexcept -> std::size_t
+        {
+            return m_slab_count.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Returns the free slots cached by the calling thread to the shared list.
+         */
+        void flush_thread_cache() noexcept;
+
+    private:
+        /**
+         * @struct ThreadCache
+         * @brief The free slots one thread keeps for one allocator.
+         */
+        struct ThreadCache;
+
+        /**
+         * @struct ThreadCaches
+         * @brief The caches of one thread; hands the slots back at thread exit.
+         */
+        struct ThreadCaches;
+
+        static constexpr std::uint32_t k_null = 0xFFFFFFFF;
+        static constexpr std::size_t k_max_slabs = 32;
+
+        static auto thread_caches() noexcept -> ThreadCaches&;
+        auto thread_cache() noexcept -> ThreadCache&;
+        auto refill(ThreadCache& cache) noexcept -> bool;
+        void grow();
+        auto pop_shared() noexcept -> std::uint32_t;
+        void push_shared(std::uint32_t first, std::uint32_t last) noexcept;
+        void push_list(ThreadCache& cache, std::uint32_t count) noexcept;
+        [[nodiscard]] auto next(std::uint32_t index) const noexcept -> std::atomic<std::uint32_t>&;
+        void poison(void* storage) const noexcept;
+        void check_poison(const void* storage) const noexcept;
+
+        const std::size_t m_object_size;
+        const std::size_t m_alignment;  ///< Of the slots and slabs
+        const std::size_t m_slot_size;
+        const std::uint32_t m_first_slab_shift;  ///< log2 of the first slab size
+        const std::uint32_t m_cache_slots;
+        const std::uint64_t m_id;  ///< Tells allocators at the same address apart
+
+        /// The free list head: the tag in the upper and the index in the lower 32 bits.
+        alignas(k_cache_line) std::atomic<std::uint64_t> m_head;
+        /// Each slab holds its slots followed by their free list links.
+        alignas(k_cache_line) std::array<std::atomic<std::byte*>, k_max_slabs> m_slabs{};
+        std::atomic<std::size_t> m_slab_count{0};
+        std::mutex m_grow_mutex;
+};
+}  // namespace CommonLib
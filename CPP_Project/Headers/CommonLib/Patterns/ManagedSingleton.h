@@ -0,0 +1,131 @@
+/** @file
+ *  @brief This file contains the definition of the ManagedSingleton class.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <typeinfo>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/NonCopyable.h"
+#include "CommonLib/Base/NonMoveable.h"
+#include "CommonLib/Patterns/SingletonRegistry.h"
+
+namespace CommonLib
+{
+/**
+ * @class ManagedSingleton
+ * @brief Singleton using CRTP whose instance is created by SingletonRegistry::initialize()
+ *        instead of on first use.
+ *
+ * Singleton::get_instance() checks the initialization guard of a function-local static on every
+ * call, and the instances are destroyed at exit in an order that does not respect their
+ * dependencies. A ManagedSingleton declares the singletons it depends on as template arguments;
+ * SingletonRegistry::initialize() constructs them first and stores the instance pointer once,
+ * so instance() is a plain load, and SingletonRegistry::shutdown() destroys all instances in the
+ * reverse order. SingletonRegistry::warm_up() constructs independent singletons in parallel.
+ *
+ * T may also declare an init routine 'void warm_up()', which runs right after the constructor
+ * and may already call code that uses instance(), e.g. to fill a cache. If it throws, the
+ * instance is destroyed and initialization fails as if the constructor had thrown.
+ *
+ * Derived classes need to declare 'friend class ManagedSingleton<T, Dependencies...>' and keep
+ * their constructor and destructor private. instance() must not be called before initialize()
+ * or after shutdown().
+ *
+ * @tparam T The derived class.
+ * @tparam Dependencies ManagedSingleton types, or Singleton types, that must exist while T exists.
+ */
+template<typename T, typename... Dependencies>
+class COMMONLIB_API COMMONLIB_EMPTY_BASES ManagedSingleton: public NonCopyable, public NonMoveable
+{
+    protected:
+        /**
+         * @brief Constructs a ManagedSingleton object.
+         */
+        ManagedSingleton() = default;
+
+        /**
+         * @brief Destroys the ManagedSingleton object.
+         */
+        ~ManagedSingleton() = default;
+
+    public:
+        /**
+         * @brief Returns the instance created by SingletonRegistry::initialize().
+         * @return The instance.
+         */
+        static auto instance() noexcept -> T&
+        {
+            static_cast<void>(s_registered);
+            assert(s_instance != nullptr && "ManagedSingleton used outside of its lifetime");
+            return *s_instance;
+        }
+
+        /**
+         * @brief Returns the instance if it exists.
+         * @return The instance, or nullptr before initialization and after shutdown.
+         */
+        static auto try_instance() noexcept -> T*
+        {
+            static_cast<void>(s_registered);
+            return s_instance;
+        }
+
+        /**
+         * @brief Constructs the instance and its dependencies, if they do not exist yet.
+         * @throws std::logic_error if the dependencies form a cycle.
+         */
+        static void initialize()
+        {
+            SingletonRegistry::initialize(entry());
+        }
+
+        /**
+         * @brief Returns the registry entry of T, e.g. to list T as a dependency.
+         * @return The entry.
+         */
+        static auto entry() -> SingletonRegistry::Entry&
+        {
+            static constexpr std::array<SingletonRegistry::Entry::Getter, sizeof...(Dependencies)>
+                k_dependencies{&Dependencies::entry...};
+            static SingletonRegistry::Entry instance_entry{.name = typeid(T).name(),
+                                                           .create = &create,
+                                                           .destroy = &destroy,
+                                                           .dependencies = k_dependencies,
+                                                           .registered = false,
+                                                           .constructed = false,
+                                                           .visiting = false};
+            return instance_entry;
+        }
+
+    private:
+        static void create()
+        {
+            s_instance = new T();
+            if constexpr (requires(T& instance) { instance.warm_up(); })
+            {
+                try
+                {
+                    s_instance->warm_up();
+                }
+                catch (...)
+                {
+                    destroy();
+                    throw;
+                }
+            }
+        }
+
+        static void destroy() noexcept
+        {
+            delete s_instance;
+            s_instance = nullptr;
+        }
+
+        static inline T* s_instance = nullptr;
+        static inline const bool s_registered = SingletonRegistry::add(entry());
+};
+}  // namespace CommonLib
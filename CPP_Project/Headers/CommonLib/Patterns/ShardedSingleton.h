@@ -0,0 +1,213 @@
+/** @file
+ *  @brief This file contains the definition of the CpuShard and ShardedSingleton classes.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/NonCopyable.h"
+#include "CommonLib/Base/NonMoveable.h"
+
+namespace CommonLib
+{
+/**
+ * @class CpuShard
+ * @brief Maps the CPU the calling thread runs on to a shard index.
+ *
+ * On Linux the CPU number is read from the restartable sequences (rseq) area that glibc 2.35+
+ * registers for every thread and the kernel updates on migration, which is a plain load;
+ * sched_getcpu() is the fallback. On Windows GetCurrentProcessorNumber() is used. Elsewhere
+ * every thread gets a fixed shard, assigned round-robin when it first asks.
+ */
+class COMMONLIB_API CpuShard
+{
+    public:
+        /**
+         * @brief Returns the number of shards: the number of CPUs rounded up to a power of two.
+         * @return The shard count, at least 1.
+         */
+        static auto count() noexcept -> std::size_t;
+
+        /**
+         * @brief Returns the shard of the CPU the calling thread currently runs on.
+         * @return An index below count(). The thread may migrate right after the call.
+         */
+        static auto current() noexcept -> std::size_t;
+};
+
+/**
+ * @class ShardedSingleton
+ * @brief Singleton using CRTP with one cache-line-aligned instance per CPU.
+ *
+ * local() returns the shard of the CPU the caller runs on, so threads on different CPUs update
+ * different cache lines instead of contending for one. visit() and aggregate() combine the
+ * shards, e.g. to sum per-CPU counters.
+ *
+ * A shard is shared by all threads that run on its CPU, and a thread can be preempted or
+ * migrated between choosing a shard and using it, so T must be safe for concurrent use. Atomics
+ * with relaxed ordering are enough for counters and stay uncontended in the common case. The
+ * shards are created together on the first call and destroyed at process exit. Derived classes
+ * need to declare 'friend class ShardedSingleton<T>' and keep their constructor and destructor
+ * private.
+ *
+ * @tparam T The derived class.
+ */
+template<typename T>
+class COMMONLIB_API COMMONLIB_EMPTY_BASES ShardedSingleton: public NonCopyable, public NonMoveable
+{
+    protected:
+        /**
+         * @brief Constructs a ShardedSingleton object.
+         */
+        ShardedSingleton() = default;
+
+        /**
+         * @brief Destroys the ShardedSingleton object.
+         */
+        ~ShardedSingleton() = default;
+
+    public:
+        /**
+         * @brief Returns the shard of the CPU the calling thread runs on.
+         * @return The shard.
+         */
+        static auto local() -> T&
+        {
+            return *shards().get(CpuShard::current());
+        }
+
+        /**
+         * @brief Returns a shard by index.
+         * @param index The index, below shard_count().
+         * @return The shard.
+         * @throws std::out_of_range if index is not below shard_count().
+         */
+        static auto shard(std::size_t index) -> T&
+        {
+            const Shards& all = shards();
+            if (index >= all.count)
+            {
+                throw std::out_of_range("ShardedSingleton: Shard index out of range");
+            }
+            return *all.get(index);
+        }
+
+        /**
+         * @brief Returns the number of shards.
+         * @return CpuShard::count().
+         */
+        static auto shard_count() -> std::size_t
+        {
+            return shards().count;
+        }
+
+        /**
+         * @brief Calls a function for every shard, in index order.
+         * @param function Called as function(T&).
+         */
+        template<typename Function>
+        static void visit(Function&& function)
+        {
+            const Shards& all = shards();
+            for (std::size_t index = 0; index < all.count; ++index)
+            {
+                function(*all.get(index));
+            }
+        }
+
+        /**
+         * @brief Folds all shards into one value.
+         * @param initial The start value.
+         * @param function Called as function(Result, const T&) and returns the next Result.
+         * @return The folded value.
+         */
+        template<typename Result, typename Function>
+        static auto aggregate(Result initial, Function&& function) -> Result
+        {
+            visit([&](const T& shard) {
+                initial = function(std::move(initial), shard);
+            });
+            return initial;
+        }
+
+    private:
+        /**
+         * @struct Slot
+         * @brief Storage for one shard, padded so that no two shards share a cache line.
+         */
+        struct alignas(64) Slot {
+                alignas(T) std::byte storage[sizeof(T)];
+        };
+
+        /**
+         * @struct Shards
+         * @brief The shards, constructed in index order and destroyed in reverse.
+         */
+        struct Shards {
+                Shards(): count(CpuShard::count()), slots(std::make_unique<Slot[]>(count))
+                {
+                    std::size_t created = 0;
+                    try
+                    {
+                        for (; created < count; ++created)
+                        {
+                            ShardedSingleton::construct(slots[created].storage);
+                        }
+                    }
+                    catch (...)
+                    {
+                        destroy(created);
+                        throw;
+                    }
+                }
+
+                ~Shards()
+                {
+                    destroy(count);
+                }
+
+                Shards(const Shards&) = delete;
+                auto operator=(const Shards&) -> Shards& = delete;
+                Shards(Shards&&) = delete;
+                auto operator=(Shards&&) -> Shards& = delete;
+
+                [[nodiscard]] auto get(std::size_t index) const noexcept -> T*
+                {
+                    return std::launder(reinterpret_cast<T*>(slots[index].storage));
+                }
+
+                void destroy(std::size_t created) noexcept
+                {
+                    while (created > 0)
+                    {
+                        ShardedSingleton::destruct(get(--created));
+                    }
+                }
+
+                std::size_t count;
+                std::unique_ptr<Slot[]> slots;
+        };
+
+        static auto shards() -> const Shards&
+        {
+            static const Shards all;
+            return all;
+        }
+
+        static void construct(std::byte* storage)
+        {
+            ::new (static_cast<void*>(storage)) T();
+        }
+
+        static void destruct(T* shard) noexcept
+        {
+            shard->~T();
+        }
+};
+}  // namespace CommonLib
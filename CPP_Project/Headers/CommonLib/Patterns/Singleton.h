@@ -4,9 +4,13 @@
 
 #pragma once
 
+#include <array>
+#include <typeinfo>
+
 #include "CommonLib/ApiMacro.h"
 #include "CommonLib/Base/NonCopyable.h"
 #include "CommonLib/Base/NonMoveable.h"
+#include "CommonLib/Patterns/SingletonRegistry.h"
 
 namespace CommonLib
 {
@@ -17,9 +21,18 @@ namespace CommonLib
  * This class implements the Meyers Singleton Pattern using the Curiously Recurring Template Pattern
  * (CRTP). Note: Derived classes need to declare 'friend class Singleton<T>'. Derived classes must
  * also have their constructor set to private to prevent instantiation.
+ *
+ * The instance is created on first use, which puts an expensive constructor on the path of the
+ * first request. register_warm_up() lets SingletonRegistry::warm_up() create it at startup
+ * instead, after its dependencies and in parallel with independent singletons.
+ *
+ * Singleton and its bases are empty and have no virtual functions, so they add nothing to the
+ * size of T and keep it standard-layout. Derived classes written for the former virtual
+ * destructors declare theirs 'override'; drop it, or build the library and its clients with
+ * COMMONLIB_VIRTUAL_POLICY_BASES (see NonCopyable) until they are migrated.
  */
 template<typename T>
-class COMMONLIB_API Singleton: public NonCopyable, public NonMoveable
+class COMMONLIB_API COMMONLIB_EMPTY_BASES Singleton: public NonCopyable, public NonMoveable
 {
     protected:
         /**
@@ -32,9 +45,10 @@ class COMMONLIB_API Singleton: public NonCopyable, public NonMoveable
         /**
          * @brief Destroys the Singleton object.
          *
-         * The destructor is virtual to ensure proper cleanup of derived classes.
+         * The destructor is protected and, like those of the bases, not virtual: the instance is
+         * only ever destroyed as a T.
          */
-        ~Singleton() override = default;
+        ~Singleton() = default;
 
     public:
         /**
@@ -50,5 +64,48 @@ class COMMONLIB_API Singleton: public NonCopyable, public NonMoveable
             static T instance;  // Thread-safe in C++11 and later
             return instance;
         }
+
+        /**
+         * @brief Registers T so that SingletonRegistry::initialize() and warm_up() create the
+         *        instance.
+         *
+         * Call it before main(), e.g. to initialize a namespace-scope constant, or at least
+         * before the first warm-up. The instance is still destroyed at exit, not by shutdown().
+         *
+         * @tparam Dependencies Singleton or ManagedSingleton types to create before T.
+         * @return True, so that the call can initialize a static variable.
+         */
+        template<typename... Dependencies>
+        static auto register_warm_up() -> bool
+        {
+            static constexpr std::array<SingletonRegistry::Entry::Getter, sizeof...(Dependencies)>
+                k_dependencies{&Dependencies::entry...};
+            entry().dependencies = k_dependencies;
+            return SingletonRegistry::add(entry());
+        }
+
+        /**
+         * @brief Returns the registry entry of T, e.g. to list T as a dependency.
+         * @return The entry.
+         */
+        static auto entry() -> SingletonRegistry::Entry&
+        {
+            static SingletonRegistry::Entry instance_entry{.name = typeid(T).name(),
+                                                           .create = &create,
+                                                           .destroy = &release,
+                                                           .dependencies = {},
+                                                           .registered = false,
+                                                           .constructed = false,
+                                                           .visiting = false};
+            return instance_entry;
+        }
+
+    private:
+        static void create()
+        {
+            static_cast<void>(get_instance());
+        }
+
+        static void release() noexcept {}
 };
 }  // namespace CommonLib
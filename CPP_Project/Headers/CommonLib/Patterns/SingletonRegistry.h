@@ -0,0 +1,129 @@
+/** @file
+ *  @brief This file contains the definition of the SingletonRegistry class.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "CommonLib/ApiMacro.h"
+
+namespace CommonLib
+{
+/**
+ * @class SingletonRegistry
+ * @brief Constructs the ManagedSingleton instances in dependency order and destroys them in
+ *        reverse.
+ *
+ * Every ManagedSingleton type that is used somewhere in the program registers itself before
+ * main(), and so does every Singleton type whose register_warm_up() is called. initialize() then
+ * constructs each registered singleton after the singletons it depends on, and shutdown()
+ * destroys them in the reverse order of construction, so a singleton can use its dependencies in
+ * its destructor. If shutdown() is not called, it runs when the registry itself is destroyed at
+ * process exit. Singleton instances are only created here; they are still destroyed at exit.
+ *
+ * warm_up() does the same as initialize() on a pool of worker threads: a singleton starts as
+ * soon as all its dependencies are constructed, so independent singletons such as caches, time
+ * zone tables and connection pools are built in parallel, and it reports how long each one took.
+ *
+ * initialize(), warm_up() and shutdown() serialize on a mutex, but they publish the instance
+ * pointers without synchronization of their own: call them before starting the threads that use
+ * the singletons and after joining them, respectively. The constructors run without the mutex,
+ * so a constructor may initialize singletons it does not declare as dependencies; a thread that
+ * needs a singleton another thread is constructing waits for it.
+ */
+class COMMONLIB_API SingletonRegistry
+{
+    public:
+        /**
+         * @struct Entry
+         * @brief The registration of one singleton type; created by ManagedSingleton and by
+         *        Singleton::register_warm_up().
+         *
+         * Entries are trivially destructible, so they stay valid while the registry destroys the
+         * singletons at exit.
+         */
+        struct Entry {
+                using Getter = auto (*)() -> Entry&;
+
+                const char* name = nullptr;  ///< The type name as given by typeid
+                void (*create)() = nullptr;
+                void (*destroy)() noexcept = nullptr;
+                std::span<const Getter> dependencies;  ///< Resolved lazily, so cycles are found
+                bool registered = false;   ///< Guarded by the registry
+                bool constructed = false;  ///< Guarded by the registry
+                bool visiting = false;     ///< Guarded by the registry; for cycle detection
+        };
+
+        /**
+         * @struct InitTiming
+         * @brief How long the construction of one singleton took during warm_up().
+         */
+        struct InitTiming {
+                std::string name;                ///< The readable type name
+                std::chrono::nanoseconds start;  ///< Since the start of warm_up()
+                std::chrono::nanoseconds duration;
+                std::size_t worker = 0;  ///< The worker thread; 0 is the calling thread
+        };
+
+        /**
+         * @brief Adds an entry to the singletons that initialize() constructs.
+         * @param entry The entry; it must live until the end of the program.
+         * @return True, so that the call can initialize a static variable.
+         */
+        static auto add(Entry& entry) -> bool;
+
+        /**
+         * @brief Constructs every registered singleton that is not constructed yet, dependencies
+         *        first.
+         * @throws std::logic_error if the dependencies form a cycle; nothing is constructed then.
+         * @throws Whatever a constructor throws; the singletons constructed by this call are
+         *         destroyed again before the exception propagates.
+         */
+        static void initialize();
+
+        /**
+         * @brief Constructs one singleton and, first, its dependencies.
+         * @param entry The entry of the singleton, as returned by ManagedSingleton::entry().
+         * @throws std::logic_error if the dependencies form a cycle.
+         * @throws Whatever a constructor throws, after destroying the singletons constructed by
+         *         this call.
+         */
+        static void initialize(Entry& entry);
+
+        /**
+         * @brief Constructs every registered singleton that is not constructed yet on a pool of
+         *        threads, each one as soon as its dependencies are constructed.
+         * @param threads The number of threads including the calling one; 0 uses one per
+         *                hardware thread. Never more than there are singletons to construct.
+         * @return The timings of the constructed singletons in construction order, which is the
+         *         order construction_order() reports and the reverse of destruction.
+         * @throws std::logic_error if the dependencies form a cycle; nothing is constructed then.
+         * @throws Whatever a constructor throws; no further singletons are started, and the ones
+         *         constructed by this call are destroyed again before the exception propagates.
+         */
+        static auto warm_up(std::size_t threads = 0) -> std::vector<InitTiming>;
+
+        /**
+         * @brief Destroys all constructed singletons in the reverse order of their construction.
+         */
+        static void shutdown() noexcept;
+
+        /**
+         * @brief Returns the names of the constructed singletons in construction order.
+         * @return The readable type names.
+         */
+        static auto construction_order() -> std::vector<std::string>;
+
+        /**
+         * @brief Returns a readable name for a type name given by typeid.
+         * @param name The name from std::type_info::name().
+         * @return The demangled name where the platform supports it, otherwise name.
+         */
+        static auto readable_name(const char* name) -> std::string;
+};
+}  // namespace CommonLib
@@ -0,0 +1,187 @@
+/** @file
+ *  @brief This file contains the definition of the ThreadLocalSingleton class.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/NonCopyable.h"
+#include "CommonLib/Base/NonMoveable.h"
+
+namespace CommonLib
+{
+/**
+ * @class ThreadLocalSingleton
+ * @brief Singleton using CRTP with one instance per thread and visitation of all instances.
+ *
+ * get_instance() returns the instance of the calling thread, so mutable state such as counters,
+ * caches or scratch buffers is never shared between threads on the hot path. When a thread
+ * exits, its instance is not destroyed but handed to the next thread that asks for one: state
+ * accumulated by exited threads stays visible to visit() and aggregate(), and the number of
+ * instances never exceeds the peak number of threads that used the singleton. The instances are
+ * destroyed at process exit.
+ *
+ * visit() and aggregate() run on the calling thread while the owners keep using their
+ * instances, so the fields they read must be safe for that, e.g. std::atomic written by the
+ * owner with relaxed stores. Derived classes need to declare 'friend class
+ * ThreadLocalSingleton<T>' and keep their constructor and destructor private.
+ *
+ * @tparam T The derived class.
+ */
+template<typename T>
+class COMMONLIB_API COMMONLIB_EMPTY_BASES ThreadLocalSingleton
+    : public NonCopyable, public NonMoveable
+{
+    protected:
+        /**
+         * @brief Constructs a ThreadLocalSingleton object.
+         */
+        ThreadLocalSingleton() = default;
+
+        /**
+         * @brief Destroys the ThreadLocalSingleton object.
+         */
+        ~ThreadLocalSingleton() = default;
+
+    public:
+        /**
+         * @brief Returns the instance of the calling thread, creating or recycling one on the
+         *        first call of the thread.
+         * @return The instance of the calling thread.
+         */
+        static auto get_instance() -> T&
+        {
+            thread_local const Lease lease;
+            return *lease.instance;
+        }
+
+        /**
+         * @brief Calls a function for every instance, including those of exited threads.
+         * @param function Called as function(T&); it must not call get_instance() of T on a
+         *                 thread that has not used it yet.
+         */
+        template<typename Function>
+        static void visit(Function&& function)
+        {
+            Pool& instances = pool();
+            std::lock_guard lock(instances.mutex);
+            for (T* instance: instances.all)
+            {
+                function(*instance);
+            }
+        }
+
+        /**
+         * @brief Folds all instances into one value.
+         * @param initial The start value.
+         * @param function Called as function(Result, const T&) and returns the next Result.
+         * @return The folded value.
+         */
+        template<typename Result, typename Function>
+        static auto aggregate(Result initial, Function&& function) -> Result
+        {
+            visit([&](const T& instance) {
+                initial = function(std::move(initial), instance);
+            });
+            return initial;
+        }
+
+        /**
+         * @brief Returns the number of instances created so far.
+         * @return The peak number of threads that used the singleton at once.
+         */
+        static auto instance_count() -> std::size_t
+        {
+            Pool& instances = pool();
+            std::lock_guard lock(instances.mutex);
+            return instances.all.size();
+        }
+
+    private:
+        /**
+         * @struct Pool
+         * @brief All instances and the ones not leased by a thread.
+         */
+        struct Pool {
+                Pool() = default;
+
+                ~Pool()
+                {
+                    for (T* instance: all)
+                    {
+                        ThreadLocalSingleton::destroy(instance);
+                    }
+                }
+
+                Pool(const Pool&) = delete;
+                auto operator=(const Pool&) -> Pool& = delete;
+                Pool(Pool&&) = delete;
+                auto operator=(Pool&&) -> Pool& = delete;
+
+                std::mutex mutex;
+                std::vector<T*> all;
+                std::vector<T*> free;
+        };
+
+        /**
+         * @struct Lease
+         * @brief Holds the instance of one thread and returns it to the pool at thread exit.
+         */
+        struct Lease {
+                Lease(): instance(ThreadLocalSingleton::acquire()) {}
+
+                ~Lease()
+                {
+                    ThreadLocalSingleton::release(instance);
+                }
+
+                Lease(const Lease&) = delete;
+                auto operator=(const Lease&) -> Lease& = delete;
+                Lease(Lease&&) = delete;
+                auto operator=(Lease&&) -> Lease& = delete;
+
+                T* instance;
+        };
+
+        static auto pool() -> Pool&
+        {
+            static Pool instances;
+            return instances;
+        }
+
+        static auto acquire() -> T*
+        {
+            Pool& instances = pool();
+            std::lock_guard lock(instances.mutex);
+            if (!instances.free.empty())
+            {
+                T* instance = instances.free.back();
+                instances.free.pop_back();
+                return instance;
+            }
+            instances.all.reserve(instances.all.size() + 1);
+            instances.free.reserve(instances.all.size() + 1);
+            T* instance = new T();
+            instances.all.push_back(instance);
+            return instance;
+        }
+
+        static void release(T* instance) noexcept
+        {
+            Pool& instances = pool();
+            std::lock_guard lock(instances.mutex);
+            // Cannot throw: free has room for every instance.
+            instances.free.push_back(instance);
+        }
+
+        static void destroy(T* instance) noexcept
+        {
+            delete instance;
+        }
+};
+}  // namespace CommonLib
@@ -0,0 +1,24 @@
+/** @file
+ *  @brief This file contains helpers for compiling per-function SIMD kernels.
+ */
+
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define COMMONLIB_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define COMMONLIB_SIMD_X86 0
+#endif
+
+/**
+ * @def COMMONLIB_TARGET
+ * @brief Enables an instruction set for a single function (GCC and Clang), so that kernels can
+ *        be compiled without raising the baseline architecture of the whole library. MSVC allows
+ *        intrinsics everywhere and needs no attribute.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define COMMONLIB_TARGET(isa)
+#else
+#define COMMONLIB_TARGET(isa) __attribute__((target(isa)))
+#endif
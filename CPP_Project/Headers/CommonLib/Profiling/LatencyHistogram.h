@@ -0,0 +1,347 @@
+/** @file
+ *  @brief This file contains the definition of the HistogramLayout, LatencyHistogram and
+ *         ConcurrentLatencyHistogram classes.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "CommonLib/ApiMacro.h"
+
+namespace CommonLib
+{
+/**
+ * @class HistogramLayout
+ * @brief The log-linear bucket geometry shared by the latency histograms.
+ *
+ * Values below 2^S, where S is the number of sub-bucket bits, get a bucket of their own. Above
+ * that, every power-of-two range is split into 2^(S-1) equally wide buckets, so the width of a
+ * bucket is never more than 1 / 2^(S-1) of the values in it. S is chosen from the requested
+ * number of significant decimal digits: 3 digits give 1024 buckets per power of two and a
+ * relative error below 0.1 %. The memory is fixed at construction and grows with the logarithm
+ * of the highest trackable value.
+ */
+class COMMONLIB_API HistogramLayout
+{
+    public:
+        /**
+         * @brief Computes the layout.
+         * @param highest_trackable The largest value that is recorded without saturating.
+         * @param significant_digits The decimal precision, from 1 to 5.
+         * @throws std::invalid_argument if highest_trackable is below 2 or significant_digits is
+         *         out of range.
+         */
+        HistogramLayout(std::uint64_t highest_trackable, int significant_digits);
+
+        /**
+         * @brief Returns the bucket of a value; values above the highest trackable value share
+         *        its bucket.
+         * @param value The value.
+         * @return The index of the bucket.
+         */
+        [[nodiscard]] auto index_of(std::uint64_t value) const noexcept -> std::size_t
+        {
+            value = std::min(value, m_highest_trackable);
+            const auto width = static_cast<unsigned>(std::bit_width(value | m_sub_bucket_mask));
+            const unsigned shift = width - m_sub_bucket_bits;
+            return (static_cast<std::size_t>(shift) << (m_sub_bucket_bits - 1)) + (value >> shift);
+        }
+
+        /**
+         * @brief Returns the smallest value that falls into a bucket.
+         * @param index The index of the bucket.
+         * @return The lowest equivalent value.
+         */
+        [[nodiscard]] auto lowest_equivalent(std::size_t index) const noexcept -> std::uint64_t;
+
+        /**
+         * @brief Returns the largest value that falls into a bucket.
+         * @param index The index of the bucket.
+         * @return The highest equivalent value.
+         */
+        [[nodiscard]] auto highest_equivalent(std::size_t index) const noexcept -> std::uint64_t;
+
+        /**
+         * @brief Returns the number of buckets.
+         * @return The bucket count.
+         */
+        [[nodiscard]] auto bucket_count() const noexcept -> std::size_t
+        {
+            return m_bucket_count;
+        }
+
+        /**
+         * @brief Returns the largest value that is recorded without saturating.
+         * @return The highest trackable value.
+         */
+        [[nodiscard]] auto highest_trackable() const noexcept -> std::uint64_t
+        {
+            return m_highest_trackable;
+        }
+
+        /**
+         * @brief Returns the decimal precision the layout was created with.
+         * @return The number of significant digits.
+         */
+        [[nodiscard]] auto significant_digits() const noexcept -> int
+        {
+            return m_significant_digits;
+        }
+
+        auto operator==(const HistogramLayout& other) const noexcept -> bool = default;
+
+    private:
+        std::uint64_t m_highest_trackable;
+        int m_significant_digits;
+        unsigned m_sub_bucket_bits;
+        std::uint64_t m_sub_bucket_mask;
+        std::size_t m_bucket_count;
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief A fixed-memory histogram of durations in nanoseconds with percentile queries.
+ *
+ * Recording is O(1) and never allocates. The histogram is not thread-safe; give every thread its
+ * own instance and merge() them for reporting, or use ConcurrentLatencyHistogram when threads
+ * must record into one instance. Percentiles are reported as the highest value of the bucket
+ * that holds the requested rank, so they are never below the exact value and exceed it by at
+ * most the precision of the layout. count(), min(), max() and mean() are exact.
+ */
+class COMMONLIB_API LatencyHistogram
+{
+    public:
+        /// One hour, in nanoseconds.
+        static constexpr std::uint64_t k_default_highest_trackable = 3'600'000'000'000;
+
+        /**
+         * @brief Creates an empty histogram.
+         * @param highest_trackable_ns The largest duration that is recorded without saturating;
+         *        longer durations are counted as this value.
+         * @param significant_digits The decimal precision, from 1 to 5.
+         * @throws std::invalid_argument if a parameter is out of range.
+         */
+        explicit LatencyHistogram(std::uint64_t highest_trackable_ns = k_default_highest_trackable,
+                                  int significant_digits = 3);
+
+        /**
+         * @brief Records one duration.
+         * @param value_ns The duration in nanoseconds.
+         */
+        void record(std::uint64_t value_ns) noexcept
+        {
+            record(value_ns, 1);
+        }
+
+        /**
+         * @brief Records the same duration several times.
+         * @param value_ns The duration in nanoseconds.
+         * @param count The number of occurrences.
+         */
+        void record(std::uint64_t value_ns, std::uint64_t count) noexcept
+        {
+            value_ns = std::min(value_ns, m_layout.highest_trackable());
+            m_counts[m_layout.index_of(value_ns)] += count;
+            m_count += count;
+            m_sum += value_ns * count;
+            m_min = std::min(m_min, value_ns);
+            m_max = std::max(m_max, value_ns);
+        }
+
+        /**
+         * @brief Records one duration; negative durations are recorded as 0.
+         * @param duration The duration.
+         */
+        void record(std::chrono::steady_clock::duration duration) noexcept
+        {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            record(ns < 0 ? 0 : static_cast<std::uint64_t>(ns));
+        }
+
+        /**
+         * @brief Records the time between two readings of DateTimeUtils::timer_now().
+         * @param start The start time point.
+         * @param end The end time point.
+         */
+        void record(std::chrono::steady_clock::time_point start,
+                    std::chrono::steady_clock::time_point end) noexcept
+        {
+            record(end - start);
+        }
+
+        /**
+         * @brief Adds all measurements of another histogram.
+         * @param other A histogram with the same layout.
+         * @throws std::invalid_argument if the layouts differ.
+         */
+        void merge(const LatencyHistogram& other);
+
+        /**
+         * @brief Removes all measurements.
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Returns the value at a percentile.
+         * @param percentile The percentile, from 0 to 100.
+         * @return The duration in nanoseconds, or 0 if the histogram is empty.
+         * @throws std::invalid_argument if percentile is outside [0, 100].
+         */
+        [[nodiscard]] auto percentile(double percentile) const -> std::uint64_t;
+
+        /**
+         * @brief Returns the number of recorded durations.
+         * @return The count.
+         */
+        [[nodiscard]] auto count() const noexcept -> std::uint64_t
+        {
+            return m_count;
+        }
+
+        /**
+         * @brief Returns the smallest recorded duration.
+         * @return The minimum in nanoseconds, or 0 if the histogram is empty.
+         */
+        [[nodiscard]] auto min() const noexcept -> std::uint64_t
+        {
+            return m_count == 0 ? 0 : m_min;
+        }
+
+        /**
+         * @brief Returns the largest recorded duration.
+         * @return The maximum in nanoseconds.
+         */
+        [[nodiscard]] auto max() const noexcept -> std::uint64_t
+        {
+            return m_max;
+        }
+
+        /**
+         * @brief Returns the average recorded duration.
+         * @return The mean in nanoseconds, or 0 if the histogram is empty.
+         */
+        [[nodiscard]] auto mean() const noexcept -> double
+        {
+            return m_count == 0 ? 0.0 : static_cast<double>(m_sum) / static_cast<double>(m_count);
+        }
+
+        /**
+         * @brief Returns the bucket geometry.
+         * @return The layout.
+         */
+        [[nodiscard]] auto layout() const noexcept -> const HistogramLayout&
+        {
+            return m_layout;
+        }
+
+    private:
+        friend class ConcurrentLatencyHistogram;
+
+        HistogramLayout m_layout;
+        std::vector<std::uint64_t> m_counts;
+        std::uint64_t m_count = 0;
+        std::uint64_t m_sum = 0;
+        std::uint64_t m_min;
+        std::uint64_t m_max = 0;
+};
+
+/**
+ * @class ConcurrentLatencyHistogram
+ * @brief A LatencyHistogram that any number of threads may record into at the same time.
+ *
+ * Recording is lock-free: one relaxed fetch_add on the bucket and one on the sum, plus a
+ * compare-exchange only when a new minimum or maximum is seen. Threads that hit the same bucket
+ * share its cache line, so for very hot paths per-thread LatencyHistogram instances merged at
+ * reporting time scale better. snapshot() copies the counts into a LatencyHistogram for
+ * queries; while threads are recording, it may miss measurements that are in flight.
+ */
+class COMMONLIB_API ConcurrentLatencyHistogram
+{
+    public:
+        /**
+         * @brief Creates an empty histogram.
+         * @param highest_trackable_ns The largest duration that is recorded without saturating.
+         * @param significant_digits The decimal precision, from 1 to 5.
+         * @throws std::invalid_argument if a parameter is out of range.
+         */
+        explicit ConcurrentLatencyHistogram(
+            std::uint64_t highest_trackable_ns = LatencyHistogram::k_default_highest_trackable,
+            int significant_digits = 3);
+
+        /**
+         * @brief Records one duration.
+         * @param value_ns The duration in nanoseconds.
+         */
+        void record(std::uint64_t value_ns) noexcept
+        {
+            value_ns = std::min(value_ns, m_layout.highest_trackable());
+            m_counts[m_layout.index_of(value_ns)].fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(value_ns, std::memory_order_relaxed);
+
+            std::uint64_t current = m_min.load(std::memory_order_relaxed);
+            while (value_ns < current &&
+                   !m_min.compare_exchange_weak(current, value_ns, std::memory_order_relaxed))
+            {}
+            current = m_max.load(std::memory_order_relaxed);
+            while (value_ns > current &&
+                   !m_max.compare_exchange_weak(current, value_ns, std::memory_order_relaxed))
+            {}
+        }
+
+        /**
+         * @brief Records one duration; negative durations are recorded as 0.
+         * @param duration The duration.
+         */
+        void record(std::chrono::steady_clock::duration duration) noexcept
+        {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            record(ns < 0 ? 0 : static_cast<std::uint64_t>(ns));
+        }
+
+        /**
+         * @brief Records the time between two readings of DateTimeUtils::timer_now().
+         * @param start The start time point.
+         * @param end The end time point.
+         */
+        void record(std::chrono::steady_clock::time_point start,
+                    std::chrono::steady_clock::time_point end) noexcept
+        {
+            record(end - start);
+        }
+
+        /**
+         * @brief Copies the current measurements.
+         * @return A histogram with the same layout.
+         */
+        [[nodiscard]] auto snapshot() const -> LatencyHistogram;
+
+        /**
+         * @brief Removes all measurements; must not race with record().
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Returns the bucket geometry.
+         * @return The layout.
+         */
+        [[nodiscard]] auto layout() const noexcept -> const HistogramLayout&
+        {
+            return m_layout;
+        }
+
+    private:
+        HistogramLayout m_layout;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> m_counts;
+        std::atomic<std::uint64_t> m_sum{0};
+        std::atomic<std::uint64_t> m_min;
+        std::atomic<std::uint64_t> m_max{0};
+};
+}  // namespace CommonLib
@@ -0,0 +1,90 @@
+/** @file
+ *  @brief This file contains the definition of the TimerRegistry class.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CommonLib/ApiMacro.h"
+
+namespace CommonLib
+{
+/**
+ * @struct TimerStats
+ * @brief The merged measurements of one timer call site.
+ */
+struct TimerStats {
+        std::string name;
+        std::string file;
+        int line = 0;
+        std::uint64_t count = 0;  ///< Number of completed scopes
+        double total_ns = 0.0;
+        double min_ns = 0.0;  ///< 0 if count is 0
+        double max_ns = 0.0;
+
+        /**
+         * @brief Returns the average duration of a scope.
+         * @return The mean in nanoseconds, or 0 if nothing was recorded.
+         */
+        [[nodiscard]] auto mean_ns() const noexcept -> double
+        {
+            return count == 0 ? 0.0 : total_ns / static_cast<double>(count);
+        }
+};
+
+/**
+ * @class TimerRegistry
+ * @brief Collects ScopedTimer measurements in per-thread accumulators.
+ *
+ * Every thread that records owns a block of cache-line-sized accumulators (count, sum, min, max
+ * in TscClock ticks), one per call site, so threads never write to shared cache lines. Only the
+ * owning thread writes an accumulator, with plain relaxed loads and stores; recording takes no
+ * lock and allocates only the first time a thread reaches a new group of 64 call sites.
+ *
+ * snapshot() merges the accumulators of all live threads and of the threads that have exited.
+ * It takes a mutex that only registration and thread exit contend for. While timers are running,
+ * the four fields of a site may be read at slightly different moments.
+ */
+class COMMONLIB_API TimerRegistry
+{
+    public:
+        /// The number of call sites that can be registered.
+        static constexpr std::uint32_t k_max_sites = 4096;
+
+        /**
+         * @brief Registers a call site; called once per site by TimerSite.
+         * @param name The name of the timer.
+         * @param file The source file of the call site.
+         * @param line The source line of the call site.
+         * @return The id of the call site.
+         * @throws std::length_error if k_max_sites sites are already registered.
+         */
+        static auto register_site(std::string_view name, std::string_view file, int line)
+            -> std::uint32_t;
+
+        /**
+         * @brief Adds one duration to the calling thread's accumulator of a site.
+         * @param site The id returned by register_site().
+         * @param ticks The duration in TscClock ticks.
+         */
+        static void record(std::uint32_t site, std::uint64_t ticks) noexcept;
+
+        /**
+         * @brief Merges the measurements of all threads.
+         * @return The statistics of every registered site, in registration order.
+         */
+        static auto snapshot() -> std::vector<TimerStats>;
+
+        /**
+         * @brief Returns the merged measurements of one site.
+         * @param site The id returned by register_site().
+         * @return The statistics of the site.
+         * @throws std::out_of_range if the site is not registered.
+         */
+        static auto snapshot(std::uint32_t site) -> TimerStats;
+};
+}  // namespace CommonLib
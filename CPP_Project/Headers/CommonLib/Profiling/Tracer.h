@@ -0,0 +1,208 @@
+/** @file
+ *  @brief This file contains the definition of the Tracer and TraceScope classes and the
+ *         COMMONLIB_TRACE_SCOPE macro.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Utils/TscClock.h"
+
+namespace CommonLib
+{
+/**
+ * @brief The kind of a trace event, as in the Chrome Trace Event format.
+ */
+enum class TracePhase : std::uint8_t
+{
+    Begin,    ///< Start of a duration ("B")
+    End,      ///< End of the innermost open duration ("E")
+    Instant,  ///< A point in time ("i")
+};
+
+/**
+ * @brief What a thread's buffer does when it is full.
+ */
+enum class TraceOverflow : std::uint8_t
+{
+    Overwrite,  ///< Overwrite the oldest events; keeps the most recent history
+    Drop,       ///< Discard new events; keeps the oldest history
+};
+
+/**
+ * @struct TraceEvent
+ * @brief One drained trace event.
+ */
+struct TraceEvent {
+        TscClock::Ticks ticks = 0;    ///< Raw TscClock reading
+        const char* name = nullptr;   ///< The name passed when recording
+        TracePhase phase = TracePhase::Instant;
+        std::uint32_t thread_id = 0;  ///< Sequential id of the recording thread, from 1
+};
+
+/**
+ * @class Tracer
+ * @brief Records begin/end/instant events into per-thread ring buffers.
+ *
+ * Each thread writes to its own fixed-size ring buffer, taken the first time it records, with
+ * a raw TscClock reading and a pointer to the event name; no lock, allocation or time conversion
+ * happens while recording. drain() collects the buffered events of all threads, including
+ * threads that have exited, and may run while other threads are recording. The buffer of an
+ * exited thread is handed to the next thread that starts recording, whose events may push out
+ * the unread ones of the exited thread, so that between two configure() calls memory is bounded
+ * by the largest number of threads recording at once, however rarely drain() runs. The
+ * conversion to the Chrome Trace Event JSON format (readable by chrome://tracing and Perfetto)
+ * happens afterwards in write_chrome_json().
+ *
+ * Event names are stored as pointers and must outlive the drain, which string literals do.
+ */
+class COMMONLIB_API Tracer
+{
+    public:
+        /// The default number of events per thread buffer.
+        static constexpr std::size_t k_default_capacity = 65536;
+
+        /**
+         * @brief Sets the buffer size and overflow policy of threads that start recording
+         *        afterwards; existing buffers keep their configuration.
+         * @param events_per_thread The capacity, rounded up to a power of two.
+         * @param overflow The overflow policy.
+         * @throws std::invalid_argument if events_per_thread is 0.
+         */
+        static void configure(std::size_t events_per_thread, TraceOverflow overflow);
+
+        /**
+         * @brief Enables or disables recording for all threads; enabled by default.
+         * @param enabled Whether events are recorded.
+         */
+        static void set_enabled(bool enabled) noexcept;
+
+        /**
+         * @brief Returns whether events are recorded.
+         * @return True if recording is enabled.
+         */
+        [[nodiscard]] static auto enabled() noexcept -> bool;
+
+        /**
+         * @brief Opens a duration on the calling thread.
+         * @param name The name of the duration; must outlive the drain.
+         */
+        static void begin(const char* name) noexcept
+        {
+            record(name, TracePhase::Begin);
+        }
+
+        /**
+         * @brief Closes the innermost open duration on the calling thread.
+         * @param name The name of the duration; must outlive the drain.
+         */
+        static void end(const char* name) noexcept
+        {
+            record(name, TracePhase::End);
+        }
+
+        /**
+         * @brief Records a point in time on the calling thread.
+         * @param name The name of the event; must outlive the drain.
+         */
+        static void instant(const char* name) noexcept
+        {
+            record(name, TracePhase::Instant);
+        }
+
+        /**
+         * @brief Records an event with the current time on the calling thread.
+         * @param name The name of the event; must outlive the drain.
+         * @param phase The kind of event.
+         */
+        static void record(const char* name, TracePhase phase) noexcept;
+
+        /**
+         * @brief Removes and returns the buffered events of all threads.
+         * @return The events, grouped by thread and in recording order within a thread.
+         */
+        static auto drain() -> std::vector<TraceEvent>;
+
+        /**
+         * @brief Returns the number of events lost to full buffers so far.
+         *
+         * Dropped and overwritten events are counted when they are detected, i.e. on recording
+         * for TraceOverflow::Drop and on drain() for TraceOverflow::Overwrite.
+         *
+         * @return The number of lost events.
+         */
+        [[nodiscard]] static auto lost_events() -> std::uint64_t;
+
+        /**
+         * @brief Writes events as a Chrome Trace Event JSON document.
+         *
+         * Timestamps are written in microseconds relative to the earliest event.
+         *
+         * @param out The stream to write to.
+         * @param events The events, e.g. the result of drain().
+         */
+        static void write_chrome_json(std::ostream& out, std::span<const TraceEvent> events);
+
+        /**
+         * @brief Writes events as a Chrome Trace Event JSON file.
+         * @param path The file to create or overwrite.
+         * @param events The events, e.g. the result of drain().
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        static void write_chrome_json(const std::string& path, std::span<const TraceEvent> events);
+};
+
+/**
+ * @class TraceScope
+ * @brief Records a begin event on construction and the matching end event on destruction.
+ */
+class TraceScope
+{
+    public:
+        /**
+         * @brief Opens the duration.
+         * @param name The name of the duration; must outlive the drain.
+         */
+        explicit TraceScope(const char* name) noexcept : m_name(name)
+        {
+            Tracer::begin(m_name);
+        }
+
+        /**
+         * @brief Closes the duration.
+         */
+        ~TraceScope()
+        {
+            Tracer::end(m_name);
+        }
+
+        TraceScope(const TraceScope&) = delete;
+        auto operator=(const TraceScope&) -> TraceScope& = delete;
+        TraceScope(TraceScope&&) = delete;
+        auto operator=(TraceScope&&) -> TraceScope& = delete;
+
+    private:
+        const char* m_name;
+};
+}  // namespace CommonLib
+
+/**
+ * @def COMMONLIB_TRACE_SCOPE
+ * @brief Traces the rest of the enclosing scope under the given name, which should be a string
+ *        literal. Define COMMONLIB_DISABLE_TRACING to compile all trace scopes out.
+ */
+#if defined(COMMONLIB_DISABLE_TRACING)
+#define COMMONLIB_TRACE_SCOPE(name) static_cast<void>(0)
+#else
+#define COMMONLIB_TRACE_SCOPE_CONCAT_IMPL(a, b) a##b
+#define COMMONLIB_TRACE_SCOPE_CONCAT(a, b) COMMONLIB_TRACE_SCOPE_CONCAT_IMPL(a, b)
+#define COMMONLIB_TRACE_SCOPE(name)                                                              \
+    const ::CommonLib::TraceScope COMMONLIB_TRACE_SCOPE_CONCAT(commonlib_trace_, __LINE__)(name)
+#endif
@@ -0,0 +1,235 @@
+/** @file
+ *  @brief This file contains the definition of the TimerNode and TimingWheel classes.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace CommonLib
+{
+class TimingWheel;
+
+/**
+ * @class TimerNode
+ * @brief An intrusive timer that can be scheduled on one TimingWheel at a time.
+ *
+ * Embed it in (or derive from it in) the object the timeout belongs to, e.g. a connection, and
+ * recover that object in the expiry callback. The wheel never allocates: all bookkeeping lives
+ * in the node. A node that is destroyed while scheduled cancels itself; it must therefore not
+ * outlive its wheel while scheduled, and it can be neither copied nor moved.
+ */
+class COMMONLIB_API TimerNode
+{
+    public:
+        TimerNode() = default;
+
+        /**
+         * @brief Cancels the timer if it is still scheduled.
+         */
+        ~TimerNode();
+
+        TimerNode(const TimerNode&) = delete;
+        auto operator=(const TimerNode&) -> TimerNode& = delete;
+        TimerNode(TimerNode&&) = delete;
+        auto operator=(TimerNode&&) -> TimerNode& = delete;
+
+        /**
+         * @brief Returns whether the timer is scheduled and has not fired yet.
+         * @return True if the timer is pending on a wheel.
+         */
+        [[nodiscard]] auto scheduled() const noexcept -> bool
+        {
+            return m_wheel != nullptr;
+        }
+
+    private:
+        friend class TimingWheel;
+
+        TimerNode* m_prev = nullptr;
+        TimerNode* m_next = nullptr;
+        TimingWheel* m_wheel = nullptr;
+        std::uint64_t m_expiry = 0;  ///< Expiry in wheel ticks
+        std::uint32_t m_list = 0;    ///< Index of the list the node is linked into
+};
+
+/**
+ * @class TimingWheel
+ * @brief A hierarchical timing wheel with O(1) schedule, cancel and reschedule.
+ *
+ * Time is divided into ticks of a fixed resolution. Four levels of 256 slots cover 2^32 ticks
+ * (about 49 days at 1 ms); later deadlines wait in an overflow list that is redistributed every
+ * 2^32 ticks. A timer is filed in the level that matches the most significant bit in which its
+ * expiry tick differs from the current tick and moves to finer levels as time approaches it, so
+ * every timer is touched at most once per level. Occupancy bitmaps let advance() skip empty slots,
+ * so long idle periods cost no more than a few bit scans.
+ *
+ * Deadlines are rounded up to whole ticks, so timers never fire early. The wheel is not
+ * thread-safe; it is meant to be owned by one event loop thread.
+ */
+class COMMONLIB_API TimingWheel
+{
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr unsigned k_levels = 4;
+        static constexpr unsigned k_slot_bits = 8;
+        static constexpr unsigned k_slots = 1U << k_slot_bits;
+
+        /**
+         * @brief Creates an empty wheel.
+         * @param resolution The length of a tick.
+         * @param start The time of tick 0; pass a fixed time point to drive the wheel with an
+         *        injected clock.
+         * @throws std::invalid_argument if resolution is not positive.
+         */
+        explicit TimingWheel(Clock::duration resolution = std::chrono::milliseconds(1),
+                             Clock::time_point start = DateTimeUtils::timer_now());
+
+        /**
+         * @brief Unschedules all pending timers without firing them.
+         */
+        ~TimingWheel();
+
+        TimingWheel(const TimingWheel&) = delete;
+        auto operator=(const TimingWheel&) -> TimingWheel& = delete;
+        TimingWheel(TimingWheel&&) = delete;
+        auto operator=(TimingWheel&&) -> TimingWheel& = delete;
+
+        /**
+         * @brief Schedules a timer, or reschedules it if it is already pending.
+         *
+         * A deadline that is not after the current wheel time fires on the next advance().
+         *
+         * @param node The timer; if it is pending on another wheel it is moved to this one.
+         * @param deadline The time at which the timer expires.
+         */
+        void schedule(TimerNode& node, Clock::time_point deadline) noexcept;
+
+        /**
+         * @brief Schedules a timer relative to the current wheel time.
+         * @param node The timer.
+         * @param delay The time from now() until the timer expires.
+         */
+        void schedule_after(TimerNode& node, Clock::duration delay) noexcept
+        {
+            schedule(node, now() + delay);
+        }
+
+        /**
+         * @brief Cancels a timer.
+         * @param node The timer.
+         * @return True if the timer was pending on this wheel.
+         */
+        auto cancel(TimerNode& node) noexcept -> bool;
+
+        /**
+         * @brief Advances the wheel and fires every timer whose deadline has passed.
+         *
+         * Expired timers are collected slot by slot and handed to the callback one at a time;
+         * each node is unscheduled before its callback runs. The callback may schedule or cancel
+         * any timer, including the one passed to it. Timers it schedules for a deadline that has
+         * already passed fire on the next advance(), not in this one.
+         *
+         * @param now The current time, e.g. DateTimeUtils::timer_now(); earlier times than a
+         *        previous call are ignored.
+         * @param on_expire Called as on_expire(TimerNode&) for every expired timer.
+         * @return The number of timers fired.
+         */
+        template<typename Callback>
+        auto advance(Clock::time_point now, Callback&& on_expire) -> std::size_t
+        {
+            const std::uint64_t target = tick_floor(now);
+            begin_advance();
+            std::size_t fired = 0;
+            do
+            {
+                while (TimerNode* node = pop_expired())
+                {
+                    ++fired;
+                    on_expire(*node);
+                }
+            } while (step(target));
+            return fired;
+        }
+
+        /**
+         * @brief Advances the wheel to DateTimeUtils::timer_now().
+         * @param on_expire Called as on_expire(TimerNode&) for every expired timer.
+         * @return The number of timers fired.
+         */
+        template<typename Callback>
+        auto poll(Callback&& on_expire) -> std::size_t
+        {
+            return advance(DateTimeUtils::timer_now(), std::forward<Callback>(on_expire));
+        }
+
+        /**
+         * @brief Returns the number of pending timers.
+         * @return The timer count.
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Returns whether no timer is pending.
+         * @return True if the wheel is empty.
+         */
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return m_size == 0;
+        }
+
+        /**
+         * @brief Returns the time the wheel has been advanced to, rounded down to a tick.
+         * @return The current wheel time.
+         */
+        [[nodiscard]] auto now() const noexcept -> Clock::time_point
+        {
+            return m_start + m_resolution * static_cast<Clock::rep>(m_now);
+        }
+
+        /**
+         * @brief Returns the length of a tick.
+         * @return The resolution.
+         */
+        [[nodiscard]] auto resolution() const noexcept -> Clock::duration
+        {
+            return m_resolution;
+        }
+
+    private:
+        static constexpr std::uint32_t k_overflow_list = k_levels * k_slots;
+        static constexpr std::uint32_t k_due_list = k_overflow_list + 1;
+        static constexpr std::uint32_t k_expired_list = k_overflow_list + 2;
+        static constexpr std::uint32_t k_list_count = k_overflow_list + 3;
+
+        [[nodiscard]] auto tick_floor(Clock::time_point time) const noexcept -> std::uint64_t;
+        [[nodiscard]] auto tick_ceil(Clock::time_point time) const noexcept -> std::uint64_t;
+
+        void link(TimerNode& node, std::uint32_t list) noexcept;
+        void unlink(TimerNode& node) noexcept;
+        void insert(TimerNode& node, std::uint32_t due_list) noexcept;
+        void redistribute(std::uint32_t list) noexcept;
+
+        void begin_advance() noexcept;
+        auto pop_expired() noexcept -> TimerNode*;
+        auto step(std::uint64_t target) noexcept -> bool;
+
+        Clock::time_point m_start;
+        Clock::duration m_resolution;
+        std::uint64_t m_now = 0;
+        std::size_t m_size = 0;
+        std::array<TimerNode*, k_list_count> m_heads{};
+        std::array<std::array<std::uint64_t, k_slots / 64>, k_levels> m_occupied{};
+};
+}  // namespace CommonLib
@@ -0,0 +1,102 @@
+/** @file
+ *  @brief This file contains the definition of the CachedDateTimeFormatter class.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Utils/DateTimeFormatter.h"
+
+namespace CommonLib
+{
+/**
+ * @class CachedDateTimeFormatter
+ * @brief DateTimeFormatter that caches the rendered output of the most recent second.
+ *
+ * Everything a strftime-style format renders only changes once per second, except the
+ * fractional second fields (%N, %3N, %6N, %9N). This class keeps the full rendering of the last
+ * second it saw and, as long as subsequent time points fall into the same second, copies that
+ * rendering and only patches the fraction digits in place. A new second (including the step over
+ * a day or DST boundary) triggers a full render, so the output is always identical to the one
+ * of the wrapped DateTimeFormatter. Local renderings are also dropped when the local time zone
+ * is reloaded (see TimeZone::reload_local()).
+ *
+ * Instances are not thread-safe; the intended use is one instance per thread, as done by
+ * DateTimeUtils::now_cached() and DateTimeUtils::now_utc_cached().
+ */
+class COMMONLIB_API CachedDateTimeFormatter
+{
+    public:
+        /**
+         * @brief Compiles the given format string.
+         * @param format The strftime-style format string.
+         * @param zone The time zone used when rendering (default: Zone::Local).
+         */
+        explicit CachedDateTimeFormatter(
+            std::string_view format, DateTimeFormatter::Zone zone = DateTimeFormatter::Zone::Local);
+
+        /**
+         * @brief Renders a time point into the given buffer, reusing the cached second if possible.
+         * @param buffer The destination buffer.
+         * @param tp The time point to render.
+         * @return The number of characters written, or 0 if the buffer is smaller than max_size().
+         */
+        auto format_to(std::span<char> buffer, const std::chrono::system_clock::time_point& tp)
+            -> std::size_t;
+
+        /**
+         * @brief Renders a time point into a newly allocated string.
+         * @param tp The time point to render.
+         * @return The formatted date and time string.
+         */
+        [[nodiscard]] auto format(const std::chrono::system_clock::time_point& tp) -> std::string;
+
+        /**
+         * @brief Drops the cached second so that the next call renders from scratch.
+         *
+         * Local renderings are invalidated automatically by TimeZone::reload_local(); call this
+         * after other changes that affect the output.
+         */
+        void invalidate() noexcept;
+
+        /**
+         * @brief Returns the wrapped formatter.
+         * @return The underlying DateTimeFormatter.
+         */
+        [[nodiscard]] auto formatter() const noexcept -> const DateTimeFormatter&;
+
+        /**
+         * @brief Returns an upper bound for the number of characters a single render produces.
+         * @return The maximum output size in characters.
+         */
+        [[nodiscard]] auto max_size() const noexcept -> std::size_t;
+
+    private:
+        /**
+         * @struct FractionSlot
+         * @brief Position and width of a fractional second field inside the cached rendering.
+         */
+        struct FractionSlot {
+                std::uint32_t offset = 0;
+                std::uint32_t width = 0;
+        };
+
+        void render_second(const std::chrono::system_clock::time_point& tp);
+
+        DateTimeFormatter m_formatter;
+        std::vector<char> m_cache;
+        std::vector<FractionSlot> m_fractions;
+        std::size_t m_cache_length = 0;
+        std::int64_t m_cached_second = 0;
+        std::uint64_t m_zone_generation = 0;
+        bool m_valid = false;
+};
+}  // namespace CommonLib
@@ -0,0 +1,297 @@
+/** @file
+ *  @brief This file contains the definition of the CivilTime class.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+#include "CommonLib/ApiMacro.h"
+
+namespace CommonLib
+{
+/**
+ * @struct CivilDate
+ * @brief A date in the proleptic Gregorian calendar.
+ */
+struct CivilDate {
+        std::int32_t year = 1970;
+        std::uint32_t month = 1;  ///< 1 - 12
+        std::uint32_t day = 1;    ///< 1 - 31
+
+        constexpr auto operator==(const CivilDate&) const -> bool = default;
+};
+
+/**
+ * @struct CivilDateTime
+ * @brief A date and time of day in the proleptic Gregorian calendar, without time zone.
+ */
+struct CivilDateTime {
+        std::int32_t year = 1970;
+        std::uint32_t month = 1;        ///< 1 - 12
+        std::uint32_t day = 1;          ///< 1 - 31
+        std::uint32_t hour = 0;         ///< 0 - 23
+        std::uint32_t minute = 0;       ///< 0 - 59
+        std::uint32_t second = 0;       ///< 0 - 60 (60 only when parsed from a leap second)
+        std::uint32_t nanosecond = 0;   ///< 0 - 999999999
+        std::uint32_t weekday = 4;      ///< 0 - 6, days since Sunday
+        std::uint32_t day_of_year = 0;  ///< 0 - 365, days since January 1st
+
+        constexpr auto operator==(const CivilDateTime&) const -> bool = default;
+};
+
+/**
+ * @class CivilTime
+ * @brief Pure arithmetic conversions between Unix time and the civil (UTC) calendar.
+ *
+ * Implements the days_from_civil / civil_from_days algorithms by Howard Hinnant. All functions
+ * are constexpr, allocation free and never touch the C library, so unlike gmtime_r, timegm or
+ * mktime they take no locks and read no time zone state. Negative Unix times and years before
+ * 1970 are supported.
+ */
+class COMMONLIB_API CivilTime
+{
+    public:
+        static constexpr std::int64_t k_seconds_per_day = 86400;
+
+        /**
+         * @brief Returns whether the given year is a leap year.
+         * @param year The year.
+         * @return True for leap years.
+         */
+        static constexpr auto is_leap_year(std::int32_t year) noexcept -> bool
+        {
+            return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+        }
+
+        /**
+         * @brief Returns the number of days in the given month.
+         * @param year The year.
+         * @param month The month (1 - 12).
+         * @return The number of days (28 - 31).
+         */
+        static constexpr auto days_in_month(std::int32_t year, std::uint32_t month) noexcept
+            -> std::uint32_t
+        {
+            constexpr std::uint32_t k_days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+            return month == 2 && is_leap_year(year) ? 29U : k_days[month - 1];
+        }
+
+        /**
+         * @brief Returns the number of days since 1970-01-01 for the given date.
+         * @param year The year.
+         * @param month The month (1 - 12).
+         * @param day The day of the month (1 - 31).
+         * @return The days since the Unix epoch (negative before 1970).
+         */
+        static constexpr auto days_from_civil(std::int32_t year, std::uint32_t month,
+                                              std::uint32_t day) noexcept -> std::int64_t
+        {
+            const std::int64_t y = static_cast<std::int64_t>(year) - (month <= 2 ? 1 : 0);
+            const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+            const auto yoe = static_cast<std::uint32_t>(y - era * 400);
+            const std::uint32_t mp = month > 2 ? month - 3 : month + 9;
+            const std::uint32_t doy = (153 * mp + 2) / 5 + day - 1;
+            const std::uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+            return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+        }
+
+        /**
+         * @brief Returns the date for the given number of days since 1970-01-01.
+         * @param days The days since the Unix epoch.
+         * @return The civil date.
+         */
+        static constexpr auto civil_from_days(std::int64_t days) noexcept -> CivilDate
+        {
+            days += 719468;
+            const std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+            const auto doe = static_cast<std::uint32_t>(days - era * 146097);
+            const std::uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+            const std::uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+            const std::uint32_t mp = (5 * doy + 2) / 153;
+            const std::uint32_t day = doy - (153 * mp + 2) / 5 + 1;
+            const std::uint32_t month = mp < 10 ? mp + 3 : mp - 9;
+            const std::int64_t year = static_cast<std::int64_t>(yoe) + era * 400 + (month <= 2);
+            return {static_cast<std::int32_t>(year), month, day};
+        }
+
+        /**
+         * @brief Returns the weekday for the given number of days since 1970-01-01.
+         * @param days The days since the Unix epoch.
+         * @return The weekday (0 - 6, days since Sunday).
+         */
+        static constexpr auto weekday_from_days(std::int64_t days) noexcept -> std::uint32_t
+        {
+            return static_cast<std::uint32_t>(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6);
+        }
+
+        /**
+         * @brief Returns the zero based day of the year for the given date.
+         * @param year The year.
+         * @param month The month (1 - 12).
+         * @param day The day of the month (1 - 31).
+         * @return The days since January 1st of the same year (0 - 365).
+         */
+        static constexpr auto day_of_year(std::int32_t year, std::uint32_t month,
+                                          std::uint32_t day) noexcept -> std::uint32_t
+        {
+            return static_cast<std::uint32_t>(days_from_civil(year, month, day) -
+                                              days_from_civil(year, 1, 1));
+        }
+
+        /**
+         * @brief Breaks Unix seconds down into UTC calendar fields.
+         * @param seconds The seconds since the Unix epoch.
+         * @return The civil date and time.
+         */
+        static constexpr auto from_unix_seconds(std::int64_t seconds) noexcept -> CivilDateTime
+        {
+            return from_unix_parts(seconds, 0);
+        }
+
+        /**
+         * @brief Breaks Unix milliseconds down into UTC calendar fields.
+         * @param milliseconds The milliseconds since the Unix epoch.
+         * @return The civil date and time.
+         */
+        static constexpr auto from_unix_milliseconds(std::int64_t milliseconds) noexcept
+            -> CivilDateTime
+        {
+            const std::int64_t seconds = floor_div(milliseconds, 1000);
+            return from_unix_parts(seconds,
+                                   static_cast<std::uint32_t>(milliseconds - seconds * 1000) *
+                                       1000000U);
+        }
+
+        /**
+         * @brief Breaks Unix nanoseconds down into UTC calendar fields.
+         * @param nanoseconds The nanoseconds since the Unix epoch.
+         * @return The civil date and time.
+         */
+        static constexpr auto from_unix_nanoseconds(std::int64_t nanoseconds) noexcept
+            -> CivilDateTime
+        {
+            const std::int64_t seconds = floor_div(nanoseconds, 1000000000);
+            return from_unix_parts(seconds,
+                                   static_cast<std::uint32_t>(nanoseconds - seconds * 1000000000));
+        }
+
+        /**
+         * @brief Breaks a system_clock time point down into UTC calendar fields.
+         * @param tp The time point.
+         * @return The civil date and time.
+         */
+        static constexpr auto from_time_point(const std::chrono::system_clock::time_point& tp)
+            -> CivilDateTime
+        {
+            const auto seconds = std::chrono::floor<std::chrono::seconds>(tp);
+            return from_unix_parts(
+                seconds.time_since_epoch().count(),
+                static_cast<std::uint32_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(tp - seconds).count()));
+        }
+
+        /**
+         * @brief Converts UTC calendar fields to Unix seconds.
+         *
+         * Only year, month, day, hour, minute and second are used; out of range time of day
+         * values carry over (e.g. hour 24 is midnight of the next day).
+         *
+         * @param civil The civil date and time.
+         * @return The seconds since the Unix epoch.
+         */
+        static constexpr auto to_unix_seconds(const CivilDateTime& civil) noexcept -> std::int64_t
+        {
+            return days_from_civil(civil.year, civil.month, civil.day) * k_seconds_per_day +
+                   static_cast<std::int64_t>(civil.hour) * 3600 +
+                   static_cast<std::int64_t>(civil.minute) * 60 +
+                   static_cast<std::int64_t>(civil.second);
+        }
+
+        /**
+         * @brief Converts UTC calendar fields to Unix milliseconds.
+         * @param civil The civil date and time.
+         * @return The milliseconds since the Unix epoch.
+         */
+        static constexpr auto to_unix_milliseconds(const CivilDateTime& civil) noexcept
+            -> std::int64_t
+        {
+            return to_unix_seconds(civil) * 1000 + civil.nanosecond / 1000000;
+        }
+
+        /**
+         * @brief Converts UTC calendar fields to Unix nanoseconds.
+         * @param civil The civil date and time.
+         * @return The nanoseconds since the Unix epoch.
+         */
+        static constexpr auto to_unix_nanoseconds(const CivilDateTime& civil) noexcept
+            -> std::int64_t
+        {
+            return to_unix_seconds(civil) * 1000000000 + civil.nanosecond;
+        }
+
+        /**
+         * @brief Converts UTC calendar fields to a system_clock time point.
+         * @param civil The civil date and time.
+         * @return The time point.
+         */
+        static constexpr auto to_time_point(const CivilDateTime& civil)
+            -> std::chrono::system_clock::time_point
+        {
+            return std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::seconds(to_unix_seconds(civil)) +
+                    std::chrono::nanoseconds(civil.nanosecond)));
+        }
+
+        /**
+         * @brief Converts calendar fields to a std::tm (tm_isdst is set to 0).
+         * @param civil The civil date and time.
+         * @return The broken-down time.
+         */
+        static constexpr auto to_tm(const CivilDateTime& civil) noexcept -> std::tm
+        {
+            std::tm tm{};
+            tm.tm_year = civil.year - 1900;
+            tm.tm_mon = static_cast<int>(civil.month) - 1;
+            tm.tm_mday = static_cast<int>(civil.day);
+            tm.tm_hour = static_cast<int>(civil.hour);
+            tm.tm_min = static_cast<int>(civil.minute);
+            tm.tm_sec = static_cast<int>(civil.second);
+            tm.tm_wday = static_cast<int>(civil.weekday);
+            tm.tm_yday = static_cast<int>(civil.day_of_year);
+            return tm;
+        }
+
+    private:
+        static constexpr auto floor_div(std::int64_t value, std::int64_t divisor) noexcept
+            -> std::int64_t
+        {
+            const std::int64_t quotient = value / divisor;
+            return quotient * divisor > value ? quotient - 1 : quotient;
+        }
+
+        static constexpr auto from_unix_parts(std::int64_t seconds,
+                                              std::uint32_t nanosecond) noexcept -> CivilDateTime
+        {
+            const std::int64_t days = floor_div(seconds, k_seconds_per_day);
+            const auto second_of_day =
+                static_cast<std::uint32_t>(seconds - days * k_seconds_per_day);
+            const CivilDate date = civil_from_days(days);
+
+            CivilDateTime civil;
+            civil.year = date.year;
+            civil.month = date.month;
+            civil.day = date.day;
+            civil.hour = second_of_day / 3600;
+            civil.minute = second_of_day / 60 % 60;
+            civil.second = second_of_day % 60;
+            civil.nanosecond = nanosecond;
+            civil.weekday = weekday_from_days(days);
+            civil.day_of_year = static_cast<std::uint32_t>(days - days_from_civil(date.year, 1, 1));
+            return civil;
+        }
+};
+}  // namespace CommonLib
@@ -0,0 +1,80 @@
+/** @file
+ *  @brief This file contains the definition of the ClockSource concept and the SteadyClock
+ *         source.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <concepts>
+
+namespace CommonLib
+{
+/**
+ * @brief A time source for measuring durations.
+ *
+ * now() returns raw ticks as cheaply as possible; the elapsed functions convert the difference of
+ * two readings into seconds, milliseconds or microseconds, so that the conversion cost is only
+ * paid when a result is read. Instrumentation that is templated on a ClockSource can switch
+ * between SteadyClock, TscClock and CoarseSteadyClock without code changes.
+ */
+template<typename Clock>
+concept ClockSource = requires(typename Clock::Ticks ticks) {
+    { Clock::now() } noexcept -> std::same_as<typename Clock::Ticks>;
+    { Clock::elapsed_s(ticks, ticks) } -> std::same_as<double>;
+    { Clock::elapsed_ms(ticks, ticks) } -> std::same_as<double>;
+    { Clock::elapsed_us(ticks, ticks) } -> std::same_as<double>;
+};
+
+/**
+ * @class SteadyClock
+ * @brief The ClockSource over std::chrono::steady_clock, equivalent to DateTimeUtils::timer_now().
+ */
+class SteadyClock
+{
+    public:
+        using Ticks = std::chrono::steady_clock::time_point;
+
+        /**
+         * @brief Returns the current steady clock time point.
+         * @return The current reading.
+         */
+        static auto now() noexcept -> Ticks
+        {
+            return std::chrono::steady_clock::now();
+        }
+
+        /**
+         * @brief Returns the elapsed time in seconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in seconds.
+         */
+        static auto elapsed_s(Ticks start, Ticks end) noexcept -> double
+        {
+            return std::chrono::duration<double>(end - start).count();
+        }
+
+        /**
+         * @brief Returns the elapsed time in milliseconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in milliseconds.
+         */
+        static auto elapsed_ms(Ticks start, Ticks end) noexcept -> double
+        {
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        }
+
+        /**
+         * @brief Returns the elapsed time in microseconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in microseconds.
+         */
+        static auto elapsed_us(Ticks start, Ticks end) noexcept -> double
+        {
+            return std::chrono::duration<double, std::micro>(end - start).count();
+        }
+};
+}  // namespace CommonLib
@@ -0,0 +1,123 @@
+/** @file
+ *  @brief This file contains the definition of the CoarseSteadyClock and CoarseSystemClock
+ *         classes.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "CommonLib/ApiMacro.h"
+
+namespace CommonLib
+{
+/**
+ * @class CoarseSteadyClock
+ * @brief A monotonic clock that trades resolution for speed (CLOCK_MONOTONIC_COARSE).
+ *
+ * The kernel updates the coarse clocks once per scheduler tick (typically 1 - 4 ms), and reading
+ * them skips the hardware counter access of CLOCK_MONOTONIC. Use it where millisecond
+ * resolution is sufficient, e.g. timeouts and rate limiting. On platforms without coarse clocks
+ * it falls back to std::chrono::steady_clock.
+ *
+ * The class satisfies both the std::chrono Clock requirements and ClockSource.
+ */
+class COMMONLIB_API CoarseSteadyClock
+{
+    public:
+        using rep = std::int64_t;
+        using period = std::nano;
+        using duration = std::chrono::duration<rep, period>;
+        using time_point = std::chrono::time_point<CoarseSteadyClock>;
+        using Ticks = time_point;
+        static constexpr bool is_steady = true;
+
+        /**
+         * @brief Returns the current time, as of the last kernel tick.
+         * @return The current time point.
+         */
+        static auto now() noexcept -> time_point;
+
+        /**
+         * @brief Returns the update interval of the clock.
+         * @return The resolution.
+         */
+        static auto resolution() noexcept -> duration;
+
+        /**
+         * @brief Returns the elapsed time in seconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in seconds.
+         */
+        static auto elapsed_s(Ticks start, Ticks end) noexcept -> double
+        {
+            return std::chrono::duration<double>(end - start).count();
+        }
+
+        /**
+         * @brief Returns the elapsed time in milliseconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in milliseconds.
+         */
+        static auto elapsed_ms(Ticks start, Ticks end) noexcept -> double
+        {
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        }
+
+        /**
+         * @brief Returns the elapsed time in microseconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in microseconds.
+         */
+        static auto elapsed_us(Ticks start, Ticks end) noexcept -> double
+        {
+            return std::chrono::duration<double, std::micro>(end - start).count();
+        }
+};
+
+/**
+ * @class CoarseSystemClock
+ * @brief A wall clock that trades resolution for speed (CLOCK_REALTIME_COARSE).
+ *
+ * Suited for timestamps that only need millisecond accuracy, such as log lines. The time points
+ * share the Unix epoch with system_clock and can be converted with to_sys(). On platforms
+ * without coarse clocks it falls back to std::chrono::system_clock.
+ */
+class COMMONLIB_API CoarseSystemClock
+{
+    public:
+        using rep = std::int64_t;
+        using period = std::nano;
+        using duration = std::chrono::duration<rep, period>;
+        using time_point = std::chrono::time_point<CoarseSystemClock>;
+        static constexpr bool is_steady = false;
+
+        /**
+         * @brief Returns the current time, as of the last kernel tick.
+         * @return The current time point.
+         */
+        static auto now() noexcept -> time_point;
+
+        /**
+         * @brief Returns the update interval of the clock.
+         * @return The resolution.
+         */
+        static auto resolution() noexcept -> duration;
+
+        /**
+         * @brief Converts a time point to a system_clock time point.
+         * @param tp The time point.
+         * @return The same instant on system_clock.
+         */
+        static auto to_sys(const time_point& tp) noexcept -> std::chrono::system_clock::time_point
+        {
+            return std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    tp.time_since_epoch()));
+        }
+};
+}  // namespace CommonLib
@@ -0,0 +1,104 @@
+/** @file
+ *  @brief This file contains the definition of the DateTimeBatchFormatter class.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/CpuFeatures.h"
+#include "CommonLib/Utils/DateTimeBatchParser.h"
+
+namespace CommonLib
+{
+/**
+ * @class DateTimeBatchFormatter
+ * @brief Renders columns of UTC timestamps into one contiguous buffer.
+ *
+ * Every element is written as "YYYY-MM-DDThh:mm:ss[.f...][Z]", the same fixed-width layout
+ * DateTimeBatchParser reads, and consecutive elements are joined by an optional separator. The
+ * date is computed with CivilTime once per day of a sorted column; with AVX2 the time of day and
+ * the fraction of eight elements are then split into digits together and every element is
+ * shuffled into place with one 32 byte store, so no per-element allocation or formatting call is
+ * made. A scalar path is used on CPUs without AVX2.
+ *
+ * Fractions are truncated to Format::fraction_digits. Buffers smaller than required_size()
+ * are a programming error and throw std::invalid_argument.
+ */
+class COMMONLIB_API DateTimeBatchFormatter
+{
+    public:
+        using Format = DateTimeBatchParser::Format;
+
+        /**
+         * @brief Returns the number of characters format_many() writes for a batch.
+         * @param count The number of timestamps.
+         * @param format The layout of every timestamp.
+         * @param separator The text written between consecutive timestamps.
+         * @return The size of the rendered batch.
+         */
+        [[nodiscard]] static auto required_size(std::size_t count, const Format& format,
+                                                std::string_view separator) noexcept
+            -> std::size_t;
+
+        /**
+         * @brief Renders timestamps given as nanoseconds since the Unix epoch.
+         * @param epoch_nanoseconds The timestamps.
+         * @param format The layout of every timestamp.
+         * @param buffer Receives the text (at least required_size() characters).
+         * @param separator The text written between consecutive timestamps.
+         * @param level The SIMD level to use, clamped to what the CPU supports.
+         * @return The number of characters written.
+         * @throws std::invalid_argument if the buffer is too small or the format is invalid.
+         */
+        static auto format_many(std::span<const std::int64_t> epoch_nanoseconds,
+                                const Format& format, std::span<char> buffer,
+                                std::string_view separator = "\n",
+                                SimdLevel level = CpuFeatures::simd_level()) -> std::size_t;
+
+        /**
+         * @brief Renders system_clock time points.
+         * @param time_points The timestamps.
+         * @param format The layout of every timestamp.
+         * @param buffer Receives the text (at least required_size() characters).
+         * @param separator The text written between consecutive timestamps.
+         * @param level The SIMD level to use, clamped to what the CPU supports.
+         * @return The number of characters written.
+         * @throws std::invalid_argument if the buffer is too small or the format is invalid.
+         */
+        static auto format_many(std::span<const std::chrono::system_clock::time_point> time_points,
+                                const Format& format, std::span<char> buffer,
+                                std::string_view separator = "\n",
+                                SimdLevel level = CpuFeatures::simd_level()) -> std::size_t;
+
+        /**
+         * @brief Renders timestamps given as nanoseconds since the Unix epoch into a string.
+         * @param epoch_nanoseconds The timestamps.
+         * @param format The layout of every timestamp.
+         * @param separator The text written between consecutive timestamps.
+         * @return The rendered batch.
+         * @throws std::invalid_argument if the format is invalid.
+         */
+        [[nodiscard]] static auto format_many(std::span<const std::int64_t> epoch_nanoseconds,
+                                              const Format& format,
+                                              std::string_view separator = "\n") -> std::string;
+
+        /**
+         * @brief Renders system_clock time points into a string.
+         * @param time_points The timestamps.
+         * @param format The layout of every timestamp.
+         * @param separator The text written between consecutive timestamps.
+         * @return The rendered batch.
+         * @throws std::invalid_argument if the format is invalid.
+         */
+        [[nodiscard]] static auto format_many(
+            std::span<const std::chrono::system_clock::time_point> time_points,
+            const Format& format, std::string_view separator = "\n") -> std::string;
+};
+}  // namespace CommonLib
@@ -0,0 +1,113 @@
+/** @file
+ *  @brief This file contains the definition of the DateTimeBatchParser class.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/CpuFeatures.h"
+#include "CommonLib/Utils/DateTimeParser.h"
+
+namespace CommonLib
+{
+/**
+ * @class DateTimeBatchParser
+ * @brief Parses columns of fixed-width UTC timestamps with SIMD digit validation.
+ *
+ * Every element must have the exact layout "YYYY-MM-DDThh:mm:ss[.f...][Z]" described by a
+ * Format; the date/time separator may be 'T', 't' or a space. The 16 byte "YYYY-MM-DDThh:mm"
+ * prefix is validated and converted with SSSE3 (one element at a time) or AVX2 (two elements
+ * per instruction); the remaining characters and the calendar checks are scalar. Timestamps are
+ * UTC and converted to nanoseconds since the Unix epoch.
+ *
+ * Errors are reported per element: failing elements are written as 0 and, if a status span is
+ * given, flagged there, while the rest of the batch is still parsed. Output spans smaller than
+ * the input are a programming error and throw std::invalid_argument.
+ */
+class COMMONLIB_API DateTimeBatchParser
+{
+    public:
+        using TimePoint = DateTimeParser::TimePoint;
+
+        /**
+         * @brief The outcome for a single element.
+         */
+        enum class Status : std::uint8_t
+        {
+            Ok,
+            InvalidLength,  ///< The element does not have the width of the format.
+            InvalidSyntax,  ///< A digit or separator is missing.
+            InvalidDate,    ///< Month or day are out of range.
+            InvalidTime,    ///< Hour, minute or second are out of range.
+            OutOfRange      ///< The instant cannot be represented in int64 nanoseconds.
+        };
+
+        /**
+         * @struct Format
+         * @brief The fixed layout shared by all elements of a batch.
+         */
+        struct Format {
+                std::uint8_t fraction_digits = 0;  ///< 0 - 9 digits after the '.'
+                bool utc_suffix = false;           ///< Whether every element ends with 'Z'
+
+                /**
+                 * @brief Returns the number of characters of every element.
+                 * @return The element width.
+                 */
+                [[nodiscard]] constexpr auto width() const noexcept -> std::size_t
+                {
+                    return 19 + (fraction_digits != 0 ? 1U + fraction_digits : 0U) +
+                           (utc_suffix ? 1U : 0U);
+                }
+        };
+
+        /**
+         * @brief Parses a span of timestamps into nanoseconds since the Unix epoch.
+         * @param input The timestamps.
+         * @param format The layout of every timestamp.
+         * @param epoch_nanoseconds Receives the results (at least input.size() elements).
+         * @param status Receives the per-element status; may be empty.
+         * @param level The SIMD level to use, clamped to what the CPU supports.
+         * @return The number of elements that failed to parse.
+         * @throws std::invalid_argument if an output span is too small or the format is invalid.
+         */
+        static auto parse(std::span<const std::string_view> input, const Format& format,
+                          std::span<std::int64_t> epoch_nanoseconds, std::span<Status> status = {},
+                          SimdLevel level = CpuFeatures::simd_level()) -> std::size_t;
+
+        /**
+         * @brief Parses a span of timestamps into time points.
+         * @param input The timestamps.
+         * @param format The layout of every timestamp.
+         * @param time_points Receives the results (at least input.size() elements).
+         * @param status Receives the per-element status; may be empty.
+         * @param level The SIMD level to use, clamped to what the CPU supports.
+         * @return The number of elements that failed to parse.
+         * @throws std::invalid_argument if an output span is too small or the format is invalid.
+         */
+        static auto parse(std::span<const std::string_view> input, const Format& format,
+                          std::span<TimePoint> time_points, std::span<Status> status = {},
+                          SimdLevel level = CpuFeatures::simd_level()) -> std::size_t;
+
+        /**
+         * @brief Parses timestamps stored in one contiguous buffer, e.g. a CSV column.
+         * @param buffer The buffer holding all timestamps.
+         * @param offsets The start offset of every timestamp inside the buffer.
+         * @param format The layout of every timestamp.
+         * @param epoch_nanoseconds Receives the results (at least offsets.size() elements).
+         * @param status Receives the per-element status; may be empty.
+         * @param level The SIMD level to use, clamped to what the CPU supports.
+         * @return The number of elements that failed to parse.
+         * @throws std::invalid_argument if an output span is too small or the format is invalid.
+         */
+        static auto parse(std::string_view buffer, std::span<const std::size_t> offsets,
+                          const Format& format, std::span<std::int64_t> epoch_nanoseconds,
+                          std::span<Status> status = {},
+                          SimdLevel level = CpuFeatures::simd_level()) -> std::size_t;
+};
+}  // namespace CommonLib
@@ -0,0 +1,274 @@
+/** @file
+ *  @brief This file contains the definition of the DateTimeFormatter class.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CommonLib/ApiMacro.h"
+
+namespace CommonLib
+{
+class TimeZone;
+
+/**
+ * @class DateTimeFormatter
+ * @brief Compiled strftime-style formatter that renders time points without heap allocations.
+ *
+ * The format string is parsed once on construction into a list of tokens. Rendering walks that
+ * list and writes directly into a caller provided buffer or output iterator, so no streams,
+ * locales or temporary strings are involved on the hot path.
+ *
+ * All conversion specifiers of strftime are accepted. The common numeric ones (%Y, %m, %d, %H,
+ * %M, %S, %F, %T, ...) as well as the C locale names (%a, %A, %b, %B, %p) are rendered natively;
+ * everything else (e.g. %c, %U, %V or flagged specifiers like %-d) is delegated to std::strftime
+ * on a stack buffer. As an extension, %N renders the nanoseconds of the second and %3N / %6N /
+ * %9N render the first 3, 6 or 9 digits of the fraction.
+ */
+class COMMONLIB_API DateTimeFormatter
+{
+    public:
+        /**
+         * @enum Zone
+         * @brief The time zone used to break a time point down into calendar fields.
+         */
+        enum class Zone : std::uint8_t
+        {
+            Local,
+            Utc
+        };
+
+        /**
+         * @brief Compiles the given format string.
+         * @param format The strftime-style format string.
+         * @param zone The time zone used when rendering (default: Zone::Local).
+         */
+        explicit DateTimeFormatter(std::string_view format, Zone zone = Zone::Local);
+
+        /**
+         * @brief Renders a time point into the given buffer.
+         *
+         * Like std::strftime, nothing useful is written if the buffer is smaller than max_size().
+         *
+         * @param buffer The destination buffer.
+         * @param tp The time point to render.
+         * @return The number of characters written, or 0 if the buffer is too small.
+         */
+        auto format_to(std::span<char> buffer,
+                       const std::chrono::system_clock::time_point& tp) const -> std::size_t;
+
+        /**
+         * @brief Renders a time point into an output iterator.
+         * @tparam OutputIt An output iterator accepting char.
+         * @param out The output iterator.
+         * @param tp The time point to render.
+         * @return The iterator past the last written character.
+         */
+        template<typename OutputIt>
+        auto format_to(OutputIt out, const std::chrono::system_clock::time_point& tp) const
+            -> OutputIt
+        {
+            const Fields fields = break_down(tp, m_zone);
+            std::array<char, k_max_token_size> scratch{};
+
+            for (const auto& token: m_tokens)
+            {
+                if (token.kind == Kind::Literal)
+                {
+                    out = std::copy_n(m_pattern.data() + token.offset, token.length, out);
+                }
+                else
+                {
+                    const auto length =
+                        render_token(token, m_pattern.data(), fields, scratch.data());
+                    out = std::copy_n(scratch.data(), length, out);
+                }
+            }
+
+            return out;
+        }
+
+        /**
+         * @brief Renders a time point into a newly allocated string.
+         * @param tp The time point to render.
+         * @return The formatted date and time string.
+         */
+        [[nodiscard]] auto format(const std::chrono::system_clock::time_point& tp) const
+            -> std::string;
+
+        /**
+         * @brief Renders a time point in the given time zone instead of the formatter's zone.
+         * @param buffer The destination buffer.
+         * @param tp The time point to render.
+         * @param zone The time zone, e.g. one found in the TimeZoneDatabase.
+         * @return The number of characters written, or 0 if the buffer is too small.
+         */
+        auto format_to(std::span<char> buffer, const std::chrono::system_clock::time_point& tp,
+                       const TimeZone& zone) const -> std::size_t;
+
+        /**
+         * @brief Renders a time point in the given time zone into a newly allocated string.
+         * @param tp The time point to render.
+         * @param zone The time zone, e.g. one found in the TimeZoneDatabase.
+         * @return The formatted date and time string.
+         */
+        [[nodiscard]] auto format(const std::chrono::system_clock::time_point& tp,
+                                  const TimeZone& zone) const -> std::string;
+
+        /**
+         * @brief Returns an upper bound for the number of characters a single render produces.
+         * @return The maximum output size in characters.
+         */
+        [[nodiscard]] auto max_size() const noexcept -> std::size_t;
+
+        /**
+         * @brief Returns the format string this formatter was compiled from.
+         * @return The format string.
+         */
+        [[nodiscard]] auto pattern() const noexcept -> std::string_view;
+
+        /**
+         * @brief Returns the time zone this formatter renders in.
+         * @return The time zone.
+         */
+        [[nodiscard]] auto zone() const noexcept -> Zone;
+
+        /**
+         * @brief Renders a time point using an uncompiled format string.
+         *
+         * The format is interpreted on the fly, which avoids building a token list for one-off
+         * calls. No heap memory is allocated.
+         *
+         * @param buffer The destination buffer.
+         * @param format The strftime-style format string.
+         * @param tp The time point to render.
+         * @param zone The time zone used when rendering.
+         * @return The number of characters written, or 0 if the buffer is too small.
+         */
+        static auto format_to(std::span<char> buffer, std::string_view format,
+                              const std::chrono::system_clock::time_point& tp, Zone zone)
+            -> std::size_t;
+
+        /**
+         * @brief Renders a time point in the given time zone using an uncompiled format string.
+         * @param buffer The destination buffer.
+         * @param format The strftime-style format string.
+         * @param tp The time point to render.
+         * @param zone The time zone, e.g. one found in the TimeZoneDatabase.
+         * @return The number of characters written, or 0 if the buffer is too small.
+         */
+        static auto format_to(std::span<char> buffer, std::string_view format,
+                              const std::chrono::system_clock::time_point& tp,
+                              const TimeZone& zone) -> std::size_t;
+
+        /**
+         * @brief Returns an upper bound for the output size of an uncompiled format string.
+         * @param format The strftime-style format string.
+         * @return The maximum output size in characters.
+         */
+        static auto max_size(std::string_view format) -> std::size_t;
+
+    private:
+        friend class CachedDateTimeFormatter;
+
+        /**
+         * @brief Largest number of characters any non-literal token renders to.
+         */
+        static constexpr std::size_t k_max_token_size = 128;
+
+        /**
+         * @enum Kind
+         * @brief The kind of a compiled format token.
+         */
+        enum class Kind : std::uint8_t
+        {
+            Literal,
+            Percent,
+            Newline,
+            Tab,
+            Year,
+            YearShort,
+            Century,
+            Month,
+            Day,
+            DaySpacePadded,
+            Hour24,
+            Hour12,
+            Minute,
+            Second,
+            Fraction,
+            DayOfYear,
+            WeekdayIso,
+            Weekday,
+            WeekdayName,
+            WeekdayNameShort,
+            MonthName,
+            MonthNameShort,
+            AmPm,
+            UtcOffset,
+            ZoneName,
+            EpochSeconds,
+            IsoDate,
+            IsoTime,
+            UsDate,
+            HourMinute,
+            Time12,
+            Fallback
+        };
+
+        /**
+         * @struct Token
+         * @brief A single compiled format token.
+         *
+         * Literal and fallback tokens reference their text inside the pattern by offset and
+         * length; for Kind::Fraction the width holds the number of fraction digits.
+         */
+        struct Token {
+                Kind kind = Kind::Literal;
+                std::uint8_t width = 0;
+                std::uint32_t offset = 0;
+                std::uint32_t length = 0;
+        };
+
+        /**
+         * @struct Fields
+         * @brief A time point broken down into the calendar fields used for rendering.
+         */
+        struct Fields {
+                std::tm tm{};
+                std::int64_t epoch_seconds = 0;
+                std::int32_t nanoseconds = 0;
+                std::int32_t utc_offset = 0;
+                const char* zone_name = "";
+        };
+
+        static auto next_token(std::string_view format, std::size_t& pos) -> Token;
+        static auto token_max_size(const Token& token) noexcept -> std::size_t;
+        static auto break_down(const std::chrono::system_clock::time_point& tp, Zone zone)
+            -> Fields;
+        static auto break_down(const std::chrono::system_clock::time_point& tp,
+                               const TimeZone& zone) -> Fields;
+        static auto render_token(const Token& token, const char* pattern, const Fields& fields,
+                                 char* out) -> std::size_t;
+
+        static auto render(std::string_view format, const Fields& fields, char* out)
+            -> std::size_t;
+
+        auto render(const Fields& fields, char* out) const -> std::size_t;
+
+        std::string m_pattern;
+        std::vector<Token> m_tokens;
+        std::size_t m_max_size = 0;
+        Zone m_zone = Zone::Local;
+};
+}  // namespace CommonLib
@@ -0,0 +1,133 @@
+/** @file
+ *  @brief This file contains the definition of the DateTimeParser class.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/Expected.h"
+#include "CommonLib/Utils/CivilTime.h"
+
+namespace CommonLib
+{
+class TimeZone;
+
+/**
+ * @class DateTimeParser
+ * @brief Allocation and exception free parser for fixed date/time formats.
+ *
+ * Supported formats:
+ * - ISO 8601 extended: "2024-03-31", "2024-03-31T02:30", "2024-03-31 02:30:15.123456789+02:00".
+ *   The date/time separator may be 'T', 't' or a space, the fraction may use '.' or ',' and the
+ *   offset may be "Z", "+hh:mm", "+hhmm" or "+hh".
+ * - RFC 3339: the strict ISO 8601 profile with mandatory seconds and offset ("Z" or "+hh:mm").
+ * - RFC 1123 (HTTP dates): "Sun, 06 Nov 1994 08:49:37 GMT"; the weekday is optional and
+ *   "UT", "UTC", "Z" and "+hhmm" are accepted as zones as well.
+ *
+ * Fractions with more than nine digits are truncated to nanoseconds. A leap second (":60")
+ * is accepted and folds into the first second of the next minute, as POSIX time has no leap
+ * seconds. Results are time points with nanosecond precision, which covers the years 1678 - 2261.
+ */
+class COMMONLIB_API DateTimeParser
+{
+    public:
+        using TimePoint =
+            std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>;
+
+        /**
+         * @brief The reasons a parse can fail.
+         */
+        enum class Error : std::uint8_t
+        {
+            Empty,               ///< The input is empty.
+            InvalidSyntax,       ///< A character does not match the expected format.
+            InvalidDate,         ///< Month, day or weekday are out of range or inconsistent.
+            InvalidTime,         ///< Hour, minute or second are out of range.
+            InvalidOffset,       ///< The UTC offset or zone name is malformed or out of range.
+            TrailingCharacters,  ///< The timestamp is followed by unparsed characters.
+            OutOfRange           ///< The instant cannot be represented by TimePoint.
+        };
+
+        /**
+         * @struct Fields
+         * @brief The calendar fields of a parsed timestamp, before conversion to an instant.
+         */
+        struct Fields {
+                CivilDateTime civil;
+                std::int32_t utc_offset = 0;  ///< Seconds east of UTC, valid if has_offset
+                bool has_offset = false;
+                bool has_time = false;
+        };
+
+        using Result = Expected<TimePoint, Error>;
+        using FieldsResult = Expected<Fields, Error>;
+
+        /**
+         * @brief Parses an ISO 8601 timestamp; timestamps without offset are taken as UTC.
+         * @param text The timestamp.
+         * @return The instant, or the reason parsing failed.
+         */
+        static auto parse_iso8601(std::string_view text) noexcept -> Result;
+
+        /**
+         * @brief Parses an ISO 8601 timestamp; timestamps without offset are local to the zone.
+         * @param text The timestamp.
+         * @param zone The time zone used for timestamps without an explicit offset.
+         * @return The instant, or the reason parsing failed.
+         */
+        static auto parse_iso8601(std::string_view text, const TimeZone& zone) noexcept -> Result;
+
+        /**
+         * @brief Parses an RFC 3339 timestamp.
+         * @param text The timestamp, e.g. "2024-03-31T02:30:15.5Z".
+         * @return The instant, or the reason parsing failed.
+         */
+        static auto parse_rfc3339(std::string_view text) noexcept -> Result;
+
+        /**
+         * @brief Parses an RFC 1123 timestamp.
+         * @param text The timestamp, e.g. "Sun, 06 Nov 1994 08:49:37 GMT".
+         * @return The instant, or the reason parsing failed.
+         */
+        static auto parse_rfc1123(std::string_view text) noexcept -> Result;
+
+        /**
+         * @brief Parses either format, choosing RFC 1123 if the text starts with a letter.
+         * @param text The timestamp.
+         * @return The instant, or the reason parsing failed.
+         */
+        static auto parse(std::string_view text) noexcept -> Result;
+
+        /**
+         * @brief Parses the fields of an ISO 8601 timestamp without converting them.
+         * @param text The timestamp.
+         * @return The fields, or the reason parsing failed.
+         */
+        static auto parse_iso8601_fields(std::string_view text) noexcept -> FieldsResult;
+
+        /**
+         * @brief Parses the fields of an RFC 1123 timestamp without converting them.
+         * @param text The timestamp.
+         * @return The fields, or the reason parsing failed.
+         */
+        static auto parse_rfc1123_fields(std::string_view text) noexcept -> FieldsResult;
+
+        /**
+         * @brief Converts parsed fields to an instant.
+         * @param fields The fields; fields without offset are taken as UTC.
+         * @return The instant, or Error::OutOfRange.
+         */
+        static auto to_time_point(const Fields& fields) noexcept -> Result;
+
+        /**
+         * @brief Returns a human readable description of an error.
+         * @param error The error.
+         * @return A static description.
+         */
+        static auto error_message(Error error) noexcept -> std::string_view;
+};
+}  // namespace CommonLib
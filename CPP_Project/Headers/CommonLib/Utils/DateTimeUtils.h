@@ -1,9 +1,13 @@
 #pragma once
 
 #include <chrono>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 #include "CommonLib/ApiMacro.h"
+#include "CommonLib/Utils/DateTimeParser.h"
+#include "CommonLib/Utils/StaticDateTimeFormat.h"
 
 namespace CommonLib
 {
@@ -13,6 +17,11 @@ namespace CommonLib
  *
  * Provides static methods for obtaining the current date and time in various formats,
  * formatting time points, and measuring elapsed time between two time points.
+ *
+ * The string-returning functions have overloads taking a std::pmr::memory_resource as their first
+ * argument. They return a std::pmr::string allocated from that resource and take the format as a
+ * std::string_view, so request-scoped code can keep its timestamps in an arena such as
+ * std::pmr::monotonic_buffer_resource and release them in bulk without touching the global heap.
  */
 class COMMONLIB_API DateTimeUtils
 {
@@ -24,6 +33,42 @@ class COMMONLIB_API DateTimeUtils
          */
         static auto now(const std::string& format = "%Y-%m-%d %H:%M:%S") -> std::string;
 
+        /**
+         * @brief Returns the current local date and time as a string allocated from a resource.
+         * @param resource The memory resource the result is allocated from.
+         * @param format The format string (default: "%Y-%m-%d %H:%M:%S").
+         * @return The formatted date and time string.
+         */
+        static auto now(std::pmr::memory_resource* resource,
+                        std::string_view format = "%Y-%m-%d %H:%M:%S") -> std::pmr::string;
+
+        /**
+         * @brief Returns the current local date and time in a format checked at compile time.
+         *
+         * For example now<"%F %T">(); see StaticDateTimeFormat for the supported specifiers.
+         *
+         * @tparam Format The format string.
+         * @return The formatted date and time string.
+         */
+        template<FixedString Format>
+        static auto now() -> std::string
+        {
+            return StaticDateTimeFormat<Format>::format(std::chrono::system_clock::now());
+        }
+
+        /**
+         * @brief Returns the current local date and time in a format checked at compile time, as
+         *        a string allocated from a resource.
+         * @tparam Format The format string.
+         * @param resource The memory resource the result is allocated from.
+         * @return The formatted date and time string.
+         */
+        template<FixedString Format>
+        static auto now(std::pmr::memory_resource* resource) -> std::pmr::string
+        {
+            return format<Format>(resource, std::chrono::system_clock::now());
+        }
+
         /**
          * @brief Returns the current UTC date and time as a string.
          * @param format The format string (default: "%Y-%m-%d %H:%M:%S").
@@ -31,6 +76,48 @@ class COMMONLIB_API DateTimeUtils
          */
         static auto now_utc(const std::string& format = "%Y-%m-%d %H:%M:%S") -> std::string;
 
+        /**
+         * @brief Returns the current UTC date and time as a string allocated from a resource.
+         * @param resource The memory resource the result is allocated from.
+         * @param format The format string (default: "%Y-%m-%d %H:%M:%S").
+         * @return The formatted UTC date and time string.
+         */
+        static auto now_utc(std::pmr::memory_resource* resource,
+                            std::string_view format = "%Y-%m-%d %H:%M:%S") -> std::pmr::string;
+
+        /**
+         * @brief Returns the current UTC date and time in a format checked at compile time.
+         * @tparam Format The format string.
+         * @return The formatted UTC date and time string.
+         */
+        template<FixedString Format>
+        static auto now_utc() -> std::string
+        {
+            return StaticDateTimeFormat<Format, DateTimeFormatter::Zone::Utc>::format(
+                std::chrono::system_clock::now());
+        }
+
+        /**
+         * @brief Returns the current local date and time as a string using a per-thread cache.
+         *
+         * Produces the same output as now(), but keeps the rendering of the current second per
+         * thread and format, so repeated calls within the same second only patch the fractional
+         * second fields (%N, %3N, %6N, %9N). See CachedDateTimeFormatter for details.
+         *
+         * @param format The format string (default: "%Y-%m-%d %H:%M:%S").
+         * @return The formatted date and time string.
+         */
+        static auto now_cached(const std::string& format = "%Y-%m-%d %H:%M:%S") -> std::string;
+
+        /**
+         * @brief Returns the current UTC date and time as a string using a per-thread cache.
+         * @param format The format string (default: "%Y-%m-%d %H:%M:%S").
+         * @return The formatted UTC date and time string.
+         * @see now_cached()
+         */
+        static auto now_utc_cached(const std::string& format = "%Y-%m-%d %H:%M:%S")
+            -> std::string;
+
         /**
          * @brief Returns the current local date as a string.
          * @param format The format string (default: "%Y-%m-%d").
@@ -38,6 +125,15 @@ class COMMONLIB_API DateTimeUtils
          */
         static auto current_date(const std::string& format = "%Y-%m-%d") -> std::string;
 
+        /**
+         * @brief Returns the current local date as a string allocated from a resource.
+         * @param resource The memory resource the result is allocated from.
+         * @param format The format string (default: "%Y-%m-%d").
+         * @return The formatted date string.
+         */
+        static auto current_date(std::pmr::memory_resource* resource,
+                                 std::string_view format = "%Y-%m-%d") -> std::pmr::string;
+
         /**
          * @brief Returns the current local time as a string.
          * @param format The format string (default: "%H:%M:%S").
@@ -45,6 +141,15 @@ class COMMONLIB_API DateTimeUtils
          */
         static auto current_time(const std::string& format = "%H:%M:%S") -> std::string;
 
+        /**
+         * @brief Returns the current local time as a string allocated from a resource.
+         * @param resource The memory resource the result is allocated from.
+         * @param format The format string (default: "%H:%M:%S").
+         * @return The formatted time string.
+         */
+        static auto current_time(std::pmr::memory_resource* resource,
+                                 std::string_view format = "%H:%M:%S") -> std::pmr::string;
+
         /**
          * @brief Formats a given time_point as a string.
          * @param tp The time point to format.
@@ -54,9 +159,71 @@ class COMMONLIB_API DateTimeUtils
         static auto format(const std::chrono::system_clock::time_point& tp,
                            const std::string& format) -> std::string;
 
+        /**
+         * @brief Formats a given time_point as a string allocated from a resource.
+         * @param resource The memory resource the result is allocated from.
+         * @param tp The time point to format.
+         * @param format The format string.
+         * @return The formatted date and time string.
+         */
+        static auto format(std::pmr::memory_resource* resource,
+                           const std::chrono::system_clock::time_point& tp, std::string_view format)
+            -> std::pmr::string;
+
+        /**
+         * @brief Formats a given time_point in a local time format checked at compile time.
+         * @tparam Format The format string.
+         * @param tp The time point to format.
+         * @return The formatted date and time string.
+         */
+        template<FixedString Format>
+        static auto format(const std::chrono::system_clock::time_point& tp) -> std::string
+        {
+            return StaticDateTimeFormat<Format>::format(tp);
+        }
+
+        /**
+         * @brief Formats a given time_point in a local time format checked at compile time, as a
+         *        string allocated from a resource.
+         * @tparam Format The format string.
+         * @param resource The memory resource the result is allocated from.
+         * @param tp The time point to format.
+         * @return The formatted date and time string.
+         */
+        template<FixedString Format>
+        static auto format(std::pmr::memory_resource* resource,
+                           const std::chrono::system_clock::time_point& tp) -> std::pmr::string
+        {
+            const auto characters = StaticDateTimeFormat<Format>::format_array(tp);
+            return {characters.data(), characters.size(), resource};
+        }
+
+        /**
+         * @brief Formats a given time_point in a named IANA time zone.
+         * @param tp The time point to format.
+         * @param zone The zone name as found in TimeZoneDatabase, e.g. "Asia/Tokyo".
+         * @param format The format string.
+         * @return The formatted date and time string.
+         * @throws std::invalid_argument If the time zone is unknown.
+         */
+        static auto format_in(const std::chrono::system_clock::time_point& tp,
+                              std::string_view zone,
+                              const std::string& format = "%Y-%m-%d %H:%M:%S") -> std::string;
+
+        /**
+         * @brief Gets the current date and time in a named IANA time zone.
+         * @param zone The zone name as found in TimeZoneDatabase, e.g. "Asia/Tokyo".
+         * @param format The format string.
+         * @return The formatted date and time string.
+         * @throws std::invalid_argument If the time zone is unknown.
+         */
+        static auto now_in(std::string_view zone, const std::string& format = "%Y-%m-%d %H:%M:%S")
+            -> std::string;
+
         /**
          * @brief Returns the current steady clock time point for duration measurement.
          * @return The current steady clock time point.
+         * @see TscClock and CoarseSteadyClock for cheaper sources on hot paths.
          */
         static auto timer_now() -> std::chrono::steady_clock::time_point;
 
@@ -96,15 +263,49 @@ class COMMONLIB_API DateTimeUtils
         static auto to_string(const std::chrono::system_clock::time_point& tp,
                               const std::string& format) -> std::string;
 
+        /**
+         * @brief Converts a time_point to a string allocated from a resource.
+         * @param resource The memory resource the result is allocated from.
+         * @param tp The time point to convert.
+         * @param format The format string.
+         * @return The formatted date and time string.
+         */
+        static auto to_string(std::pmr::memory_resource* resource,
+                              const std::chrono::system_clock::time_point& tp,
+                              std::string_view format) -> std::pmr::string;
+
         /**
          * @brief Parses a string to a time_point using the given format.
+         *
+         * Compatibility wrapper: the string is interpreted as local time and converted with the
+         * rules of TimeZone::local_cached(), so daylight saving time applies where it is in
+         * effect; platforms without TimeZone support fall back to std::mktime with
+         * tm_isdst = -1, so that the C library applies daylight saving time the same way. The
+         * common "%Y-%m-%d %H:%M:%S", "%Y-%m-%dT%H:%M:%S" and "%Y-%m-%d" formats skip
+         * std::get_time. The arguments are views, so strings allocated from an
+         * arena are parsed in place; only a failure allocates, for the exception message.
+         * Prefer parse() for new code and untrusted input.
+         *
          * @param str The date/time string.
          * @param format The format string.
          * @return The parsed time_point.
          * @throws std::runtime_error if parsing fails.
          */
-        static auto from_string(const std::string& str,
-                                const std::string& format) -> std::chrono::system_clock::time_point;
+        static auto from_string(std::string_view str,
+                                std::string_view format) -> std::chrono::system_clock::time_point;
+
+        /**
+         * @brief Parses an ISO 8601, RFC 3339 or RFC 1123 timestamp without throwing.
+         *
+         * Timestamps without a UTC offset are interpreted in the local time zone. Does not
+         * allocate once the calling thread has loaded the local zone through
+         * TimeZone::local_cached(), which the first such timestamp does; see DateTimeParser for
+         * the accepted syntax.
+         *
+         * @param str The timestamp.
+         * @return The instant with nanosecond precision, or the reason parsing failed.
+         */
+        static auto parse(std::string_view str) noexcept -> DateTimeParser::Result;
 };
 
 }  // namespace CommonLib
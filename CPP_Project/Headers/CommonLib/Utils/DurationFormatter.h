@@ -0,0 +1,97 @@
+/** @file
+ *  @brief This file contains the definition of the DurationFormatter class.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "CommonLib/ApiMacro.h"
+
+namespace CommonLib
+{
+/**
+ * @class DurationFormatter
+ * @brief Renders durations for humans, e.g. "1.5ms" or "-250ns", without heap allocations.
+ *
+ * Values are rounded to at most three decimals of the chosen unit and trailing zeros are
+ * dropped. Unit::Auto picks the largest of s, ms, us and ns that the magnitude reaches, so the
+ * integer part stays short. Rendering is integer arithmetic only; no streams or locales are
+ * involved.
+ */
+class COMMONLIB_API DurationFormatter
+{
+    public:
+        /**
+         * @enum Unit
+         * @brief The unit a duration is rendered in.
+         */
+        enum class Unit : std::uint8_t
+        {
+            Auto,
+            Nanoseconds,
+            Microseconds,
+            Milliseconds,
+            Seconds
+        };
+
+        /// An upper bound for the number of characters a single render produces.
+        static constexpr std::size_t k_max_size = 32;
+
+        /**
+         * @brief Renders a duration into the given buffer.
+         * @param buffer The destination buffer.
+         * @param duration The duration.
+         * @param unit The unit (default: Unit::Auto).
+         * @return The number of characters written, or 0 if the buffer is smaller than
+         *         k_max_size.
+         */
+        static auto format_to(std::span<char> buffer, std::chrono::nanoseconds duration,
+                              Unit unit = Unit::Auto) noexcept -> std::size_t;
+
+        /**
+         * @brief Renders a duration into a newly allocated string.
+         * @param duration The duration.
+         * @param unit The unit (default: Unit::Auto).
+         * @return The rendered duration.
+         */
+        static auto format(std::chrono::nanoseconds duration, Unit unit = Unit::Auto)
+            -> std::string;
+
+        /**
+         * @brief Returns the unit for a unit suffix.
+         * @param suffix "ns", "us", "ms", "s", or empty for Unit::Auto.
+         * @return The unit, or std::nullopt for an unknown suffix.
+         */
+        static constexpr auto parse_unit(std::string_view suffix) noexcept -> std::optional<Unit>
+        {
+            if (suffix.empty())
+            {
+                return Unit::Auto;
+            }
+            if (suffix == "ns")
+            {
+                return Unit::Nanoseconds;
+            }
+            if (suffix == "us")
+            {
+                return Unit::Microseconds;
+            }
+            if (suffix == "ms")
+            {
+                return Unit::Milliseconds;
+            }
+            if (suffix == "s")
+            {
+                return Unit::Seconds;
+            }
+            return std::nullopt;
+        }
+};
+}  // namespace CommonLib
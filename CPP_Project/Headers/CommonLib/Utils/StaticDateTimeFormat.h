@@ -0,0 +1,1059 @@
+/** @file
+ *  @brief This file contains the definition of the StaticDateTimeFormat class template and the
+ *         _utc timestamp literal.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/FixedString.h"
+#include "CommonLib/Utils/CivilTime.h"
+#include "CommonLib/Utils/DateTimeFormatter.h"
+#include "CommonLib/Utils/DateTimeParser.h"
+
+namespace CommonLib
+{
+/**
+ * @class StaticDateTimeFormatBase
+ * @brief The format compiler and the per-token code shared by all StaticDateTimeFormat
+ *        instantiations.
+ *
+ * Everything that depends on the format string is constexpr, so a format is tokenized while
+ * compiling and each token is rendered or parsed by a switch that constant folds away. Invalid
+ * formats call one of the non-constexpr functions below during constant evaluation, which turns
+ * them into compile errors whose name describes the problem.
+ */
+class COMMONLIB_API StaticDateTimeFormatBase
+{
+    public:
+        using Zone = DateTimeFormatter::Zone;
+
+        /**
+         * @brief Parses an ISO 8601 timestamp literal at compile time; see operator""_utc.
+         * @param text "YYYY-MM-DD", optionally followed by 'T' or ' ', "hh:mm", ":ss", a
+         *        fraction of 1 - 9 digits and "Z", "+hh:mm" or "+hhmm".
+         * @return The instant; timestamps without offset are taken as UTC.
+         */
+        static consteval auto parse_timestamp_literal(std::string_view text)
+            -> DateTimeParser::TimePoint
+        {
+            std::array<char, 40> format{};
+            std::size_t length = 0;
+            const auto append = [&](std::string_view part) {
+                for (const char c: part)
+                {
+                    format[length++] = c;
+                }
+            };
+
+            append("%Y-%m-%d");
+            std::size_t pos = 10;
+            if (text.size() > pos)
+            {
+                if (text[pos] != 'T' && text[pos] != 't' && text[pos] != ' ')
+                {
+                    timestamp_literal_is_invalid();
+                }
+                append(std::string_view(&text[pos], 1));
+                append("%H:%M");
+                pos += 6;
+                if (text.size() > pos && text[pos] == ':')
+                {
+                    append(":%S");
+                    pos += 3;
+                }
+                if (text.size() > pos && (text[pos] == '.' || text[pos] == ','))
+                {
+                    std::size_t digits = 0;
+                    while (pos + 1 + digits < text.size() && text[pos + 1 + digits] >= '0' &&
+                           text[pos + 1 + digits] <= '9')
+                    {
+                        ++digits;
+                    }
+                    const std::array<char, 4> fraction = {text[pos], '%',
+                                                          static_cast<char>('0' + digits), 'N'};
+                    append(std::string_view(fraction.data(), fraction.size()));
+                    pos += 1 + digits;
+                }
+                if (text.size() > pos)
+                {
+                    append(text[pos] == 'Z' ? "Z" : (text.size() - pos == 6 ? "%:z" : "%z"));
+                }
+            }
+
+            std::array<Token, 32> tokens{};
+            const std::string_view pattern(format.data(), length);
+            const std::size_t count = tokenize(pattern, tokens.data());
+            const auto fields =
+                parse_tokens(std::span<const Token>(tokens.data(), count), pattern, text);
+            const auto instant = fields ? to_utc_time_point(*fields) : Unexpected(fields.error());
+            if (!instant)
+            {
+                timestamp_literal_is_invalid();
+            }
+            return *instant;
+        }
+
+    protected:
+        /**
+         * @enum Kind
+         * @brief The kind of a compiled format token; composite specifiers such as %F are
+         *        expanded into these.
+         */
+        enum class Kind : std::uint8_t
+        {
+            Literal,
+            Char,
+            Year,
+            YearShort,
+            Century,
+            Month,
+            Day,
+            DaySpacePadded,
+            Hour24,
+            Hour12,
+            Minute,
+            Second,
+            Fraction,
+            DayOfYear,
+            WeekdayIso,
+            Weekday,
+            WeekdayNameShort,
+            MonthNameShort,
+            AmPm,
+            UtcOffset,
+            UtcOffsetColon
+        };
+
+        /**
+         * @struct Token
+         * @brief A single compiled format token.
+         *
+         * Literal tokens reference their text inside the pattern; Char tokens hold their
+         * character and Fraction tokens their number of digits in width.
+         */
+        struct Token {
+                Kind kind = Kind::Literal;
+                std::uint8_t width = 0;
+                std::uint16_t offset = 0;
+                std::uint16_t length = 0;
+        };
+
+        /**
+         * @struct RenderFields
+         * @brief A time point broken down into local calendar fields.
+         */
+        struct RenderFields {
+                CivilDateTime civil;
+                std::int32_t utc_offset = 0;
+        };
+
+        /**
+         * @struct ParseState
+         * @brief The fields parsed so far, plus those that are only checked at the end.
+         */
+        struct ParseState {
+                DateTimeParser::Fields fields;
+                DateTimeParser::Error error = DateTimeParser::Error::InvalidSyntax;
+                std::int32_t weekday = -1;
+                std::int32_t day_of_year = -1;
+                std::int32_t pm = -1;
+                bool hour12 = false;
+                bool has_month_day = false;
+        };
+
+        static constexpr std::array<std::string_view, 7> k_weekday_names = {
+            "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+        static constexpr std::array<std::string_view, 12> k_month_names = {
+            "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+        // Never defined as constexpr: calling them while compiling a format is the diagnostic.
+        static void format_ends_with_percent() {}
+        static void format_specifier_has_no_fixed_width_or_is_unknown() {}
+        static void timestamp_literal_is_invalid() {}
+
+        /**
+         * @brief Splits a format into tokens.
+         * @param format The strftime-style format.
+         * @param out The destination, or nullptr to only count the tokens.
+         * @return The number of tokens.
+         */
+        static constexpr auto tokenize(std::string_view format, Token* out) -> std::size_t
+        {
+            std::size_t count = 0;
+            const auto emit = [&](Kind kind, std::size_t width = 0, std::size_t offset = 0,
+                                  std::size_t length = 0) {
+                if (out != nullptr)
+                {
+                    out[count] = {kind, static_cast<std::uint8_t>(width),
+                                  static_cast<std::uint16_t>(offset),
+                                  static_cast<std::uint16_t>(length)};
+                }
+                ++count;
+            };
+            const auto emit_char = [&](char c) {
+                emit(Kind::Char, static_cast<unsigned char>(c));
+            };
+
+            std::size_t pos = 0;
+            while (pos < format.size())
+            {
+                if (format[pos] != '%')
+                {
+                    std::size_t end = pos;
+                    while (end < format.size() && format[end] != '%')
+                    {
+                        ++end;
+                    }
+                    emit(Kind::Literal, 0, pos, end - pos);
+                    pos = end;
+                    continue;
+                }
+                if (pos + 1 == format.size())
+                {
+                    format_ends_with_percent();
+                }
+
+                const char spec = format[pos + 1];
+                if (spec >= '1' && spec <= '9' && pos + 2 < format.size() &&
+                    format[pos + 2] == 'N')
+                {
+                    emit(Kind::Fraction, static_cast<std::size_t>(spec - '0'));
+                    pos += 3;
+                    continue;
+                }
+                if (spec == ':' && pos + 2 < format.size() && format[pos + 2] == 'z')
+                {
+                    emit(Kind::UtcOffsetColon);
+                    pos += 3;
+                    continue;
+                }
+
+                pos += 2;
+                switch (spec)
+                {
+                case '%':
+                    emit_char('%');
+                    break;
+                case 'n':
+                    emit_char('\n');
+                    break;
+                case 't':
+                    emit_char('\t');
+                    break;
+                case 'Y':
+                    emit(Kind::Year);
+                    break;
+                case 'y':
+                    emit(Kind::YearShort);
+                    break;
+                case 'C':
+                    emit(Kind::Century);
+                    break;
+                case 'm':
+                    emit(Kind::Month);
+                    break;
+                case 'd':
+                    emit(Kind::Day);
+                    break;
+                case 'e':
+                    emit(Kind::DaySpacePadded);
+                    break;
+                case 'H':
+                    emit(Kind::Hour24);
+                    break;
+                case 'I':
+                    emit(Kind::Hour12);
+                    break;
+                case 'M':
+                    emit(Kind::Minute);
+                    break;
+                case 'S':
+                    emit(Kind::Second);
+                    break;
+                case 'N':
+                    emit(Kind::Fraction, 9);
+                    break;
+                case 'j':
+                    emit(Kind::DayOfYear);
+                    break;
+                case 'u':
+                    emit(Kind::WeekdayIso);
+                    break;
+                case 'w':
+                    emit(Kind::Weekday);
+                    break;
+                case 'a':
+                    emit(Kind::WeekdayNameShort);
+                    break;
+                case 'b':
+                case 'h':
+                    emit(Kind::MonthNameShort);
+                    break;
+                case 'p':
+                    emit(Kind::AmPm);
+                    break;
+                case 'z':
+                    emit(Kind::UtcOffset);
+                    break;
+                case 'F':
+                    emit(Kind::Year);
+                    emit_char('-');
+                    emit(Kind::Month);
+                    emit_char('-');
+                    emit(Kind::Day);
+                    break;
+                case 'T':
+                    emit(Kind::Hour24);
+                    emit_char(':');
+                    emit(Kind::Minute);
+                    emit_char(':');
+                    emit(Kind::Second);
+                    break;
+                case 'D':
+                    emit(Kind::Month);
+                    emit_char('/');
+                    emit(Kind::Day);
+                    emit_char('/');
+                    emit(Kind::YearShort);
+                    break;
+                case 'R':
+                    emit(Kind::Hour24);
+                    emit_char(':');
+                    emit(Kind::Minute);
+                    break;
+                case 'r':
+                    emit(Kind::Hour12);
+                    emit_char(':');
+                    emit(Kind::Minute);
+                    emit_char(':');
+                    emit(Kind::Second);
+                    emit_char(' ');
+                    emit(Kind::AmPm);
+                    break;
+                default:
+                    // Names (%A, %B), %Z, %s, flags and locale dependent specifiers vary in width.
+                    format_specifier_has_no_fixed_width_or_is_unknown();
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Returns the number of characters a token renders to.
+         */
+        static constexpr auto token_size(const Token& token) noexcept -> std::size_t
+        {
+            switch (token.kind)
+            {
+            case Kind::Literal:
+                return token.length;
+            case Kind::Fraction:
+                return token.width;
+            case Kind::Char:
+            case Kind::WeekdayIso:
+            case Kind::Weekday:
+                return 1;
+            case Kind::DayOfYear:
+            case Kind::WeekdayNameShort:
+            case Kind::MonthNameShort:
+                return 3;
+            case Kind::Year:
+                return 4;
+            case Kind::UtcOffset:
+                return 5;
+            case Kind::UtcOffsetColon:
+                return 6;
+            default:
+                return 2;
+            }
+        }
+
+        static constexpr auto write_digits(char* out, std::uint32_t value,
+                                           std::size_t count) noexcept -> char*
+        {
+            for (std::size_t i = count; i > 0; --i)
+            {
+                out[i - 1] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            }
+            return out + count;
+        }
+
+        static constexpr auto write_text(char* out, std::string_view text) noexcept -> char*
+        {
+            for (const char c: text)
+            {
+                *out++ = c;
+            }
+            return out;
+        }
+
+        /**
+         * @brief Renders one token of kind K; each instantiation compiles to a single case.
+         */
+        template<Kind K>
+        static constexpr auto render_token(const Token& token, std::string_view pattern,
+                                           const RenderFields& fields, char* out) noexcept
+            -> char*
+        {
+            const CivilDateTime& civil = fields.civil;
+            // Nanosecond time points span the years 1678 - 2261, so years always have 4 digits.
+            const auto year = static_cast<std::uint32_t>(civil.year) % 10000;
+            switch (K)
+            {
+            case Kind::Literal:
+                return write_text(out, std::string_view(pattern.data() + token.offset,
+                                                        token.length));
+            case Kind::Char:
+                *out = static_cast<char>(token.width);
+                return out + 1;
+            case Kind::Year:
+                return write_digits(out, year, 4);
+            case Kind::YearShort:
+                return write_digits(out, year % 100, 2);
+            case Kind::Century:
+                return write_digits(out, year / 100, 2);
+            case Kind::Month:
+                return write_digits(out, civil.month, 2);
+            case Kind::Day:
+                return write_digits(out, civil.day, 2);
+            case Kind::DaySpacePadded:
+                write_digits(out, civil.day, 2);
+                if (civil.day < 10)
+                {
+                    *out = ' ';
+                }
+                return out + 2;
+            case Kind::Hour24:
+                return write_digits(out, civil.hour, 2);
+            case Kind::Hour12:
+                return write_digits(out, civil.hour % 12 == 0 ? 12 : civil.hour % 12, 2);
+            case Kind::Minute:
+                return write_digits(out, civil.minute, 2);
+            case Kind::Second:
+                return write_digits(out, civil.second, 2);
+            case Kind::Fraction:
+            {
+                std::uint32_t value = civil.nanosecond;
+                for (std::size_t i = token.width; i < 9; ++i)
+                {
+                    value /= 10;
+                }
+                return write_digits(out, value, token.width);
+            }
+            case Kind::DayOfYear:
+                return write_digits(out, civil.day_of_year + 1, 3);
+            case Kind::WeekdayIso:
+                return write_digits(out, civil.weekday == 0 ? 7 : civil.weekday, 1);
+            case Kind::Weekday:
+                return write_digits(out, civil.weekday, 1);
+            case Kind::WeekdayNameShort:
+                return write_text(out, k_weekday_names[civil.weekday]);
+            case Kind::MonthNameShort:
+                return write_text(out, k_month_names[civil.month - 1]);
+            case Kind::AmPm:
+                return write_text(out, civil.hour < 12 ? "AM" : "PM");
+            case Kind::UtcOffset:
+            case Kind::UtcOffsetColon:
+            {
+                const std::int32_t offset_minutes = fields.utc_offset / 60;
+                const auto magnitude =
+                    static_cast<std::uint32_t>(offset_minutes < 0 ? -offset_minutes
+                                                                  : offset_minutes);
+                *out++ = offset_minutes < 0 ? '-' : '+';
+                out = write_digits(out, magnitude / 60, 2);
+                if (token.kind == Kind::UtcOffsetColon)
+                {
+                    *out++ = ':';
+                }
+                return write_digits(out, magnitude % 60, 2);
+            }
+            }
+            return out;
+        }
+
+        static constexpr auto read_digits(std::string_view text, std::size_t& pos,
+                                          std::size_t count, std::uint32_t& value) noexcept
+            -> bool
+        {
+            if (pos > text.size() || text.size() - pos < count)
+            {
+                return false;
+            }
+            value = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const char c = text[pos + i];
+                if (c < '0' || c > '9')
+                {
+                    return false;
+                }
+                value = value * 10 + static_cast<std::uint32_t>(c - '0');
+            }
+            pos += count;
+            return true;
+        }
+
+        template<std::size_t N>
+        static constexpr auto read_name(std::string_view text, std::size_t& pos,
+                                        const std::array<std::string_view, N>& names,
+                                        std::int32_t& index) noexcept -> bool
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (text.size() - pos >= names[i].size() &&
+                    std::string_view(text.data() + pos, names[i].size()) == names[i])
+                {
+                    index = static_cast<std::int32_t>(i);
+                    pos += names[i].size();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<std::size_t N>
+        static constexpr auto make_tokens(std::string_view format) -> std::array<Token, N>
+        {
+            std::array<Token, N> tokens{};
+            tokenize(format, tokens.data());
+            return tokens;
+        }
+
+        template<std::size_t N>
+        static constexpr auto tokens_size(const std::array<Token, N>& tokens) noexcept
+            -> std::size_t
+        {
+            std::size_t size = 0;
+            for (const Token& token: tokens)
+            {
+                size += token_size(token);
+            }
+            return size;
+        }
+
+        template<std::size_t N>
+        static constexpr auto tokens_parsable(const std::array<Token, N>& tokens) noexcept -> bool
+        {
+            return std::none_of(tokens.begin(), tokens.end(),
+                                [](const Token& token) { return token.kind == Kind::Century; });
+        }
+
+        /**
+         * @brief Parses one token of kind K; each instantiation compiles to a single case.
+         * @return False if the text does not match, with the reason in state.error.
+         */
+        template<Kind K>
+        static constexpr auto parse_token(const Token& token, std::string_view pattern,
+                                          std::string_view text, std::size_t& pos,
+                                          ParseState& state) noexcept -> bool
+        {
+            CivilDateTime& civil = state.fields.civil;
+            std::uint32_t value = 0;
+            switch (K)
+            {
+            case Kind::Literal:
+            {
+                const std::string_view literal(pattern.data() + token.offset, token.length);
+                if (text.size() - pos < literal.size() ||
+                    std::string_view(text.data() + pos, literal.size()) != literal)
+                {
+                    return false;
+                }
+                pos += literal.size();
+                return true;
+            }
+            case Kind::Char:
+                if (pos >= text.size() || text[pos] != static_cast<char>(token.width))
+                {
+                    return false;
+                }
+                ++pos;
+                return true;
+            case Kind::Year:
+                if (!read_digits(text, pos, 4, value))
+                {
+                    return false;
+                }
+                civil.year = static_cast<std::int32_t>(value);
+                return true;
+            case Kind::YearShort:
+                if (!read_digits(text, pos, 2, value))
+                {
+                    return false;
+                }
+                civil.year = static_cast<std::int32_t>(value < 69 ? 2000 + value : 1900 + value);
+                return true;
+            case Kind::Month:
+                state.has_month_day = true;
+                return read_digits(text, pos, 2, civil.month);
+            case Kind::Day:
+                state.has_month_day = true;
+                return read_digits(text, pos, 2, civil.day);
+            case Kind::DaySpacePadded:
+                state.has_month_day = true;
+                if (pos < text.size() && text[pos] == ' ')
+                {
+                    ++pos;
+                    return read_digits(text, pos, 1, civil.day);
+                }
+                return read_digits(text, pos, 2, civil.day);
+            case Kind::Hour24:
+            case Kind::Hour12:
+                state.fields.has_time = true;
+                state.hour12 = state.hour12 || token.kind == Kind::Hour12;
+                return read_digits(text, pos, 2, civil.hour);
+            case Kind::Minute:
+                state.fields.has_time = true;
+                return read_digits(text, pos, 2, civil.minute);
+            case Kind::Second:
+                state.fields.has_time = true;
+                return read_digits(text, pos, 2, civil.second);
+            case Kind::Fraction:
+                if (!read_digits(text, pos, token.width, value))
+                {
+                    return false;
+                }
+                for (std::size_t i = token.width; i < 9; ++i)
+                {
+                    value *= 10;
+                }
+                civil.nanosecond = value;
+                return true;
+            case Kind::DayOfYear:
+                if (!read_digits(text, pos, 3, value))
+                {
+                    return false;
+                }
+                state.day_of_year = static_cast<std::int32_t>(value) - 1;
+                return true;
+            case Kind::WeekdayIso:
+            case Kind::Weekday:
+                if (!read_digits(text, pos, 1, value))
+                {
+                    return false;
+                }
+                state.weekday = static_cast<std::int32_t>(value % 7);
+                if (value > (token.kind == Kind::Weekday ? 6U : 7U) ||
+                    (token.kind == Kind::WeekdayIso && value == 0))
+                {
+                    state.error = DateTimeParser::Error::InvalidDate;
+                    return false;
+                }
+                return true;
+            case Kind::WeekdayNameShort:
+                return read_name(text, pos, k_weekday_names, state.weekday);
+            case Kind::MonthNameShort:
+            {
+                std::int32_t month = 0;
+                if (!read_name(text, pos, k_month_names, month))
+                {
+                    return false;
+                }
+                state.has_month_day = true;
+                civil.month = static_cast<std::uint32_t>(month) + 1;
+                return true;
+            }
+            case Kind::AmPm:
+            {
+                constexpr std::array<std::string_view, 2> k_am_pm = {"AM", "PM"};
+                return read_name(text, pos, k_am_pm, state.pm);
+            }
+            case Kind::UtcOffset:
+            case Kind::UtcOffsetColon:
+            {
+                std::uint32_t hours = 0;
+                std::uint32_t minutes = 0;
+                state.error = DateTimeParser::Error::InvalidOffset;
+                if (pos >= text.size() || (text[pos] != '+' && text[pos] != '-'))
+                {
+                    return false;
+                }
+                const std::int32_t sign = text[pos++] == '-' ? -1 : 1;
+                if (!read_digits(text, pos, 2, hours) ||
+                    (token.kind == Kind::UtcOffsetColon &&
+                     (pos >= text.size() || text[pos++] != ':')) ||
+                    !read_digits(text, pos, 2, minutes) || hours > 23 || minutes > 59)
+                {
+                    return false;
+                }
+                state.fields.utc_offset = sign * static_cast<std::int32_t>(hours * 3600 +
+                                                                           minutes * 60);
+                state.fields.has_offset = true;
+                state.error = DateTimeParser::Error::InvalidSyntax;
+                return true;
+            }
+            case Kind::Century:
+                return false;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Parses one token whose kind is only known at run time.
+         */
+        static constexpr auto parse_token(const Token& token, std::string_view pattern,
+                                          std::string_view text, std::size_t& pos,
+                                          ParseState& state) noexcept -> bool
+        {
+            switch (token.kind)
+            {
+            case Kind::Literal:
+                return parse_token<Kind::Literal>(token, pattern, text, pos, state);
+            case Kind::Char:
+                return parse_token<Kind::Char>(token, pattern, text, pos, state);
+            case Kind::Year:
+                return parse_token<Kind::Year>(token, pattern, text, pos, state);
+            case Kind::YearShort:
+                return parse_token<Kind::YearShort>(token, pattern, text, pos, state);
+            case Kind::Century:
+                return parse_token<Kind::Century>(token, pattern, text, pos, state);
+            case Kind::Month:
+                return parse_token<Kind::Month>(token, pattern, text, pos, state);
+            case Kind::Day:
+                return parse_token<Kind::Day>(token, pattern, text, pos, state);
+            case Kind::DaySpacePadded:
+                return parse_token<Kind::DaySpacePadded>(token, pattern, text, pos, state);
+            case Kind::Hour24:
+                return parse_token<Kind::Hour24>(token, pattern, text, pos, state);
+            case Kind::Hour12:
+                return parse_token<Kind::Hour12>(token, pattern, text, pos, state);
+            case Kind::Minute:
+                return parse_token<Kind::Minute>(token, pattern, text, pos, state);
+            case Kind::Second:
+                return parse_token<Kind::Second>(token, pattern, text, pos, state);
+            case Kind::Fraction:
+                return parse_token<Kind::Fraction>(token, pattern, text, pos, state);
+            case Kind::DayOfYear:
+                return parse_token<Kind::DayOfYear>(token, pattern, text, pos, state);
+            case Kind::WeekdayIso:
+                return parse_token<Kind::WeekdayIso>(token, pattern, text, pos, state);
+            case Kind::Weekday:
+                return parse_token<Kind::Weekday>(token, pattern, text, pos, state);
+            case Kind::WeekdayNameShort:
+                return parse_token<Kind::WeekdayNameShort>(token, pattern, text, pos, state);
+            case Kind::MonthNameShort:
+                return parse_token<Kind::MonthNameShort>(token, pattern, text, pos, state);
+            case Kind::AmPm:
+                return parse_token<Kind::AmPm>(token, pattern, text, pos, state);
+            case Kind::UtcOffset:
+                return parse_token<Kind::UtcOffset>(token, pattern, text, pos, state);
+            case Kind::UtcOffsetColon:
+                return parse_token<Kind::UtcOffsetColon>(token, pattern, text, pos, state);
+            }
+            return false;
+        }
+
+        /**
+         * @brief Validates the parsed fields and derives weekday and day of year.
+         */
+        static constexpr auto finish_parse(ParseState& state, std::string_view text,
+                                           std::size_t pos) noexcept
+            -> DateTimeParser::FieldsResult
+        {
+            using Error = DateTimeParser::Error;
+            CivilDateTime& civil = state.fields.civil;
+            if (pos != text.size())
+            {
+                return Unexpected(Error::TrailingCharacters);
+            }
+
+            if (state.day_of_year >= 0)
+            {
+                const std::int32_t days_in_year = CivilTime::is_leap_year(civil.year) ? 366 : 365;
+                if (state.day_of_year >= days_in_year)
+                {
+                    return Unexpected(Error::InvalidDate);
+                }
+                const CivilDate date =
+                    CivilTime::civil_from_days(CivilTime::days_from_civil(civil.year, 1, 1) +
+                                               state.day_of_year);
+                if (state.has_month_day && (date.month != civil.month || date.day != civil.day))
+                {
+                    return Unexpected(Error::InvalidDate);
+                }
+                civil.month = date.month;
+                civil.day = date.day;
+            }
+            if (civil.month < 1 || civil.month > 12 || civil.day < 1 ||
+                civil.day > CivilTime::days_in_month(civil.year, civil.month))
+            {
+                return Unexpected(Error::InvalidDate);
+            }
+
+            if (state.hour12)
+            {
+                if (civil.hour < 1 || civil.hour > 12)
+                {
+                    return Unexpected(Error::InvalidTime);
+                }
+                civil.hour = civil.hour % 12 + (state.pm == 1 ? 12 : 0);
+            }
+            if (civil.hour > 23 || civil.minute > 59 || civil.second > 60)
+            {
+                return Unexpected(Error::InvalidTime);
+            }
+
+            const std::int64_t days =
+                CivilTime::days_from_civil(civil.year, civil.month, civil.day);
+            civil.weekday = CivilTime::weekday_from_days(days);
+            civil.day_of_year =
+                static_cast<std::uint32_t>(days - CivilTime::days_from_civil(civil.year, 1, 1));
+            if (state.weekday >= 0 && static_cast<std::uint32_t>(state.weekday) != civil.weekday)
+            {
+                return Unexpected(Error::InvalidDate);
+            }
+            return state.fields;
+        }
+
+        /**
+         * @brief Parses text with a token list that is only known at run time.
+         */
+        static constexpr auto parse_tokens(std::span<const Token> tokens, std::string_view pattern,
+                                           std::string_view text) noexcept
+            -> DateTimeParser::FieldsResult
+        {
+            if (text.empty())
+            {
+                return Unexpected(DateTimeParser::Error::Empty);
+            }
+            ParseState state;
+            std::size_t pos = 0;
+            for (const Token& token: tokens)
+            {
+                if (!parse_token(token, pattern, text, pos, state))
+                {
+                    return Unexpected(state.error);
+                }
+            }
+            return finish_parse(state, text, pos);
+        }
+
+        /**
+         * @brief Converts fields to an instant; fields without offset are taken as UTC.
+         */
+        static constexpr auto to_utc_time_point(const DateTimeParser::Fields& fields) noexcept
+            -> DateTimeParser::Result
+        {
+            constexpr std::int64_t k_min_seconds = -9223372036;
+            constexpr std::int64_t k_max_seconds = 9223372035;
+            const std::int64_t seconds =
+                CivilTime::to_unix_seconds(fields.civil) - (fields.has_offset ? fields.utc_offset
+                                                                              : 0);
+            if (seconds < k_min_seconds || seconds > k_max_seconds)
+            {
+                return Unexpected(DateTimeParser::Error::OutOfRange);
+            }
+            return DateTimeParser::TimePoint(std::chrono::seconds(seconds) +
+                                             std::chrono::nanoseconds(fields.civil.nanosecond));
+        }
+
+        /**
+         * @brief Returns the UTC offset of the local time zone at an instant.
+         */
+        static auto local_utc_offset(std::int64_t unix_seconds) noexcept -> std::int32_t;
+
+        /**
+         * @brief Converts local calendar fields to Unix seconds.
+         * @return The seconds, or std::nullopt if the C library cannot represent them.
+         */
+        static auto local_to_unix_seconds(const CivilDateTime& civil) noexcept
+            -> std::optional<std::int64_t>;
+};
+
+/**
+ * @class StaticDateTimeFormat
+ * @brief A strftime-style format that is compiled together with the code that uses it.
+ * @tparam Format The format string, e.g. StaticDateTimeFormat<"%Y-%m-%d %H:%M:%S">.
+ * @tparam FormatZone The time zone used to render, and to parse timestamps without %z.
+ *
+ * The format is validated and tokenized at compile time; an unknown specifier, one whose output
+ * width varies (such as %A, %B, %Z or %s) or a trailing '%' is a compile error. Rendering and
+ * parsing are unrolled over the tokens into straight-line code, and every rendering has the same
+ * length k_size. Supported are %Y %y %C %m %d %e %H %I %M %S %j %u %w %a %b %h %p %z %F %T %D %R
+ * %r %% %n %t, %N / %1N - %9N for the fraction of the second and %:z for "+hh:mm" offsets.
+ *
+ * With FormatZone = Zone::Utc everything is constexpr, including parsing, so timestamps can be
+ * checked by static_assert. Parsing accepts exactly the text the format renders; names are
+ * matched case-sensitively and %C cannot be parsed.
+ */
+template<FixedString Format, DateTimeFormatter::Zone FormatZone = DateTimeFormatter::Zone::Local>
+class StaticDateTimeFormat: public StaticDateTimeFormatBase
+{
+    private:
+        static constexpr std::size_t k_token_count = tokenize(Format.view(), nullptr);
+        static constexpr std::array<Token, k_token_count> k_tokens =
+            make_tokens<k_token_count>(Format.view());
+
+    public:
+        /// The number of characters every rendering produces.
+        static constexpr std::size_t k_size = tokens_size(k_tokens);
+
+        /**
+         * @brief Returns the format string.
+         * @return The format string.
+         */
+        static constexpr auto pattern() noexcept -> std::string_view
+        {
+            return Format.view();
+        }
+
+        /**
+         * @brief Renders a time point.
+         * @param out The destination; exactly k_size characters are written.
+         * @param tp The time point to render.
+         * @return The pointer past the last written character.
+         */
+        static constexpr auto format_to(char* out,
+                                        const std::chrono::system_clock::time_point& tp) noexcept
+            -> char*
+        {
+            return render(out, break_down(tp), std::make_index_sequence<k_token_count>());
+        }
+
+        /**
+         * @brief Renders a time point into a character array.
+         * @param tp The time point to render.
+         * @return The rendered characters, without terminating null character.
+         */
+        static constexpr auto format_array(const std::chrono::system_clock::time_point& tp) noexcept
+            -> std::array<char, k_size>
+        {
+            std::array<char, k_size> result{};
+            format_to(result.data(), tp);
+            return result;
+        }
+
+        /**
+         * @brief Renders a time point into a newly allocated string.
+         * @param tp The time point to render.
+         * @return The formatted date and time string.
+         */
+        static auto format(const std::chrono::system_clock::time_point& tp) -> std::string
+        {
+            std::string result(k_size, '\0');
+            format_to(result.data(), tp);
+            return result;
+        }
+
+        /**
+         * @brief Parses the calendar fields of a timestamp in this format.
+         * @param text The timestamp.
+         * @return The fields, or the reason parsing failed.
+         */
+        static constexpr auto parse_fields(std::string_view text) noexcept
+            -> DateTimeParser::FieldsResult
+        {
+            static_assert(tokens_parsable(k_tokens), "StaticDateTimeFormat: %C cannot be parsed");
+            if (text.empty())
+            {
+                return Unexpected(DateTimeParser::Error::Empty);
+            }
+            ParseState state;
+            std::size_t pos = 0;
+            if (!parse_all(text, pos, state, std::make_index_sequence<k_token_count>()))
+            {
+                return Unexpected(state.error);
+            }
+            return finish_parse(state, text, pos);
+        }
+
+        /**
+         * @brief Parses a timestamp in this format.
+         *
+         * Timestamps without %z are taken in FormatZone. Fields the format does not contain
+         * default to 1970-01-01 00:00:00.
+         *
+         * @param text The timestamp.
+         * @return The instant, or the reason parsing failed.
+         */
+        static constexpr auto parse(std::string_view text) noexcept -> DateTimeParser::Result
+        {
+            const auto fields = parse_fields(text);
+            if (!fields)
+            {
+                return Unexpected(fields.error());
+            }
+            if constexpr (FormatZone == Zone::Local)
+            {
+                if (!fields->has_offset)
+                {
+                    const std::optional<std::int64_t> seconds =
+                        local_to_unix_seconds(fields->civil);
+                    if (!seconds)
+                    {
+                        return Unexpected(DateTimeParser::Error::OutOfRange);
+                    }
+                    DateTimeParser::Fields utc = *fields;
+                    utc.civil = CivilTime::from_unix_seconds(*seconds);
+                    utc.civil.nanosecond = fields->civil.nanosecond;
+                    return to_utc_time_point(utc);
+                }
+            }
+            return to_utc_time_point(*fields);
+        }
+
+    private:
+        static constexpr auto break_down(const std::chrono::system_clock::time_point& tp) noexcept
+            -> RenderFields
+        {
+            const std::int64_t nanoseconds =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch())
+                    .count();
+            RenderFields fields;
+            if constexpr (FormatZone == Zone::Local)
+            {
+                fields.utc_offset = local_utc_offset(
+                    std::chrono::floor<std::chrono::seconds>(tp).time_since_epoch().count());
+            }
+            fields.civil = CivilTime::from_unix_nanoseconds(
+                nanoseconds + static_cast<std::int64_t>(fields.utc_offset) * 1000000000);
+            return fields;
+        }
+
+        template<std::size_t... I>
+        static constexpr auto render(char* out, const RenderFields& fields,
+                                     std::index_sequence<I...>) noexcept -> char*
+        {
+            ((out = render_token<k_tokens[I].kind>(k_tokens[I], Format.view(), fields, out)), ...);
+            return out;
+        }
+
+        template<std::size_t... I>
+        static constexpr auto parse_all(std::string_view text, std::size_t& pos, ParseState& state,
+                                        std::index_sequence<I...>) noexcept -> bool
+        {
+            return (parse_token<k_tokens[I].kind>(k_tokens[I], Format.view(), text, pos, state) &&
+                    ...);
+        }
+};
+
+namespace literals
+{
+/**
+ * @brief A timestamp checked and converted at compile time, e.g. "2024-03-31T02:30:00Z"_utc.
+ *
+ * Accepts "YYYY-MM-DD", optionally followed by 'T' or ' ', "hh:mm", ":ss", a fraction and "Z",
+ * "+hh:mm" or "+hhmm". Timestamps without offset are taken as UTC; invalid ones do not compile.
+ *
+ * @return The instant with nanosecond precision.
+ */
+template<FixedString Text>
+consteval auto operator""_utc() -> DateTimeParser::TimePoint
+{
+    return StaticDateTimeFormatBase::parse_timestamp_literal(Text.view());
+}
+}  // namespace literals
+}  // namespace CommonLib
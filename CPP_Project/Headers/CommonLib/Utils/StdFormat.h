@@ -0,0 +1,215 @@
+/** @file
+ *  @brief This file contains the std::formatter specializations for CommonLib time values.
+ *
+ * Wrap a value to choose how it is rendered and pass it to std::format or std::format_to:
+ *
+ *     std::format("{} took {}", CommonLib::as_local(start), CommonLib::as_readable(elapsed));
+ *     std::format("{:%F %T.%3N}", CommonLib::as_utc(tp));
+ *     std::format("{}", CommonLib::as_formatted<"%F %T">(tp));
+ *
+ * The time is rendered by DateTimeFormatter, StaticDateTimeFormat or DurationFormatter into an
+ * uninitialized stack buffer and written to the output in one piece by the standard string_view
+ * formatter, so neither libstdc++'s chrono formatting nor a temporary std::string is involved.
+ * The wrappers are always available; the formatters only when the standard library provides
+ * <format>, which the "Build and Test std::format Support" workflow builds with GCC 13.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+
+#if defined(__has_include)
+#if __has_include(<format>)
+#include <format>
+#endif
+#endif
+
+#include "CommonLib/Base/FixedString.h"
+#include "CommonLib/Utils/DateTimeFormatter.h"
+#include "CommonLib/Utils/DurationFormatter.h"
+#include "CommonLib/Utils/StaticDateTimeFormat.h"
+
+namespace CommonLib
+{
+/**
+ * @struct ZonedTimePoint
+ * @brief A time point together with the time zone to render it in.
+ *
+ * Formats with a strftime-style spec as accepted by DateTimeFormatter, e.g. "{:%F %T}"; an empty
+ * spec renders "%Y-%m-%d %H:%M:%S" like DateTimeUtils::now().
+ */
+struct ZonedTimePoint {
+        std::chrono::system_clock::time_point time;
+        DateTimeFormatter::Zone zone = DateTimeFormatter::Zone::Local;
+};
+
+/**
+ * @struct ReadableDuration
+ * @brief A duration rendered by DurationFormatter.
+ *
+ * Formats with an optional unit spec: "{}" picks the unit, "{:ms}" fixes it ("ns", "us", "ms",
+ * "s").
+ */
+struct ReadableDuration {
+        std::chrono::nanoseconds duration;
+};
+
+/**
+ * @struct StaticFormattedTimePoint
+ * @brief A time point rendered with a format compiled by StaticDateTimeFormat; takes no spec.
+ */
+template<FixedString Format, DateTimeFormatter::Zone FormatZone>
+struct StaticFormattedTimePoint {
+        std::chrono::system_clock::time_point time;
+};
+
+/**
+ * @brief Wraps a time point for rendering in local time.
+ * @param tp The time point.
+ * @return The wrapper.
+ */
+constexpr auto as_local(std::chrono::system_clock::time_point tp) noexcept -> ZonedTimePoint
+{
+    return {tp, DateTimeFormatter::Zone::Local};
+}
+
+/**
+ * @brief Wraps a time point for rendering in UTC.
+ * @param tp The time point.
+ * @return The wrapper.
+ */
+constexpr auto as_utc(std::chrono::system_clock::time_point tp) noexcept -> ZonedTimePoint
+{
+    return {tp, DateTimeFormatter::Zone::Utc};
+}
+
+/**
+ * @brief Wraps a duration for human readable rendering.
+ * @param duration The duration, e.g. the difference of two steady_clock time points.
+ * @return The wrapper.
+ */
+template<typename Rep, typename Period>
+constexpr auto as_readable(std::chrono::duration<Rep, Period> duration) noexcept
+    -> ReadableDuration
+{
+    return {std::chrono::duration_cast<std::chrono::nanoseconds>(duration)};
+}
+
+/**
+ * @brief Wraps a time point for rendering with a compile-time format.
+ * @tparam Format The format string, checked at compile time.
+ * @tparam FormatZone The time zone (default: Zone::Local).
+ * @param tp The time point.
+ * @return The wrapper.
+ */
+template<FixedString Format, DateTimeFormatter::Zone FormatZone = DateTimeFormatter::Zone::Local>
+constexpr auto as_formatted(std::chrono::system_clock::time_point tp) noexcept
+    -> StaticFormattedTimePoint<Format, FormatZone>
+{
+    return {tp};
+}
+}  // namespace CommonLib
+
+#if defined(__cpp_lib_format)
+
+/**
+ * @brief Formats a ZonedTimePoint with a strftime-style spec.
+ */
+template<>
+struct std::formatter<CommonLib::ZonedTimePoint, char> {
+        std::string_view m_format = "%Y-%m-%d %H:%M:%S";
+
+        constexpr auto parse(std::format_parse_context& context)
+            -> std::format_parse_context::iterator
+        {
+            const auto end = std::find(context.begin(), context.end(), '}');
+            if (end != context.begin())
+            {
+                m_format = std::string_view(context.begin(), end);
+            }
+            return end;
+        }
+
+        template<typename FormatContext>
+        auto format(const CommonLib::ZonedTimePoint& value, FormatContext& context) const
+            -> decltype(context.out())
+        {
+            std::array<char, 256> buffer;
+            const std::size_t length = CommonLib::DateTimeFormatter::format_to(
+                std::span<char>(buffer), m_format, value.time, value.zone);
+            if (length != 0 || CommonLib::DateTimeFormatter::max_size(m_format) <= buffer.size())
+            {
+                return std::formatter<std::string_view, char>().format(
+                    std::string_view(buffer.data(), length), context);
+            }
+            const CommonLib::DateTimeFormatter formatter(m_format, value.zone);
+            return formatter.format_to(context.out(), value.time);
+        }
+};
+
+/**
+ * @brief Formats a ReadableDuration with an optional unit spec.
+ */
+template<>
+struct std::formatter<CommonLib::ReadableDuration, char> {
+        CommonLib::DurationFormatter::Unit m_unit = CommonLib::DurationFormatter::Unit::Auto;
+
+        constexpr auto parse(std::format_parse_context& context)
+            -> std::format_parse_context::iterator
+        {
+            const auto end = std::find(context.begin(), context.end(), '}');
+            const auto unit =
+                CommonLib::DurationFormatter::parse_unit(std::string_view(context.begin(), end));
+            if (!unit)
+            {
+                throw std::format_error("ReadableDuration: unit must be ns, us, ms or s");
+            }
+            m_unit = *unit;
+            return end;
+        }
+
+        template<typename FormatContext>
+        auto format(const CommonLib::ReadableDuration& value, FormatContext& context) const
+            -> decltype(context.out())
+        {
+            std::array<char, CommonLib::DurationFormatter::k_max_size> buffer;
+            const std::size_t length = CommonLib::DurationFormatter::format_to(
+                std::span<char>(buffer), value.duration, m_unit);
+            return std::formatter<std::string_view, char>().format(
+                std::string_view(buffer.data(), length), context);
+        }
+};
+
+/**
+ * @brief Formats a StaticFormattedTimePoint; the format was compiled with the call site.
+ */
+template<CommonLib::FixedString Format, CommonLib::DateTimeFormatter::Zone FormatZone>
+struct std::formatter<CommonLib::StaticFormattedTimePoint<Format, FormatZone>, char> {
+        constexpr auto parse(std::format_parse_context& context)
+            -> std::format_parse_context::iterator
+        {
+            if (context.begin() != context.end() && *context.begin() != '}')
+            {
+                throw std::format_error("StaticFormattedTimePoint: takes no format spec");
+            }
+            return context.begin();
+        }
+
+        template<typename FormatContext>
+        auto format(const CommonLib::StaticFormattedTimePoint<Format, FormatZone>& value,
+                    FormatContext& context) const -> decltype(context.out())
+        {
+            using Static = CommonLib::StaticDateTimeFormat<Format, FormatZone>;
+            const auto rendered = Static::format_array(value.time);
+            return std::formatter<std::string_view, char>().format(
+                std::string_view(rendered.data(), rendered.size()), context);
+        }
+};
+
+#endif
@@ -0,0 +1,156 @@
+/** @file
+ *  @brief This file contains the definition of the TimeBucketer class.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/CpuFeatures.h"
+
+namespace CommonLib
+{
+class TimeZone;
+
+/**
+ * @class TimeBucketer
+ * @brief Floors columns of epoch timestamps to the start of their minute, hour, day, week,
+ *        month or year bucket, for grouping time series.
+ *
+ * The bucket id of a timestamp is the timestamp its bucket starts at, in the same resolution as
+ * the input, so ids sort like the buckets and can be rendered directly. Weeks start on Monday;
+ * multiples (e.g. 15 minutes or 3 months) are aligned to the Unix epoch, respectively to
+ * January of year 0.
+ *
+ * The bounds of the last bucket are remembered: in time ordered columns most timestamps fall
+ * into the bucket of their predecessor, which AVX2 checks for four timestamps with two
+ * comparisons. Other timestamps are floored arithmetically if the buckets have a fixed width in
+ * UTC (with AVX2 four at once, using a double precision quotient estimate and an exact 64-bit
+ * remainder correction), and with the civil calendar otherwise: months, years, and everything in
+ * a TimeZone, where days can be 23 or 25 hours long.
+ */
+class COMMONLIB_API TimeBucketer
+{
+    public:
+        /**
+         * @enum Unit
+         * @brief The calendar unit of a bucket.
+         */
+        enum class Unit : std::uint8_t
+        {
+            Second,
+            Minute,
+            Hour,
+            Day,
+            Week,
+            Month,
+            Year
+        };
+
+        /**
+         * @enum Resolution
+         * @brief The unit of the input timestamps, counted from the Unix epoch.
+         */
+        enum class Resolution : std::uint8_t
+        {
+            Seconds,
+            Milliseconds,
+            Microseconds,
+            Nanoseconds
+        };
+
+        /**
+         * @struct Run
+         * @brief A run of equal consecutive bucket ids.
+         */
+        struct Run {
+                std::int64_t bucket = 0;
+                std::size_t begin = 0;  ///< Index of the first element of the run
+                std::size_t count = 0;
+        };
+
+        /**
+         * @brief Creates a bucketer.
+         * @param unit The calendar unit of a bucket.
+         * @param count The number of units per bucket, e.g. 15 for quarter hours.
+         * @param resolution The unit of the input timestamps.
+         * @param zone The time zone whose wall clock defines the buckets, or nullptr for UTC. It
+         *             must outlive the bucketer, e.g. a zone from TimeZoneDatabase.
+         * @throws std::invalid_argument if count is 0 or a bucket exceeds the int64 range.
+         */
+        explicit TimeBucketer(Unit unit, std::uint32_t count = 1,
+                              Resolution resolution = Resolution::Nanoseconds,
+                              const TimeZone* zone = nullptr);
+
+        /**
+         * @brief Returns the bucket of a single timestamp.
+         * @param value The timestamp.
+         * @return The first timestamp of its bucket.
+         */
+        [[nodiscard]] auto bucket_of(std::int64_t value) const noexcept -> std::int64_t;
+
+        /**
+         * @brief Returns the buckets of a column of timestamps.
+         * @param values The timestamps.
+         * @param buckets Receives the bucket ids; may be the same memory as values.
+         * @param level The SIMD level to use, clamped to what the CPU supports.
+         * @throws std::invalid_argument if buckets is smaller than values.
+         */
+        void bucket_many(std::span<const std::int64_t> values, std::span<std::int64_t> buckets,
+                         SimdLevel level = CpuFeatures::simd_level()) const;
+
+        /**
+         * @brief Splits a column of bucket ids into runs of equal values.
+         * @param buckets The bucket ids, typically from bucket_many() on a time ordered column.
+         * @param runs Receives the runs; at most buckets.size() are written.
+         * @param level The SIMD level to use, clamped to what the CPU supports.
+         * @return The number of runs.
+         * @throws std::invalid_argument if runs is smaller than buckets.
+         */
+        static auto group_runs(std::span<const std::int64_t> buckets, std::span<Run> runs,
+                               SimdLevel level = CpuFeatures::simd_level()) -> std::size_t;
+
+        /**
+         * @brief Splits a column of bucket ids into runs of equal values.
+         * @param buckets The bucket ids.
+         * @return The runs.
+         */
+        static auto group_runs(std::span<const std::int64_t> buckets) -> std::vector<Run>;
+
+        /**
+         * @brief Returns the unit of a bucket.
+         * @return The unit.
+         */
+        [[nodiscard]] auto unit() const noexcept -> Unit;
+
+        /**
+         * @brief Returns the number of units per bucket.
+         * @return The count.
+         */
+        [[nodiscard]] auto count() const noexcept -> std::uint32_t;
+
+        /**
+         * @brief Returns the time zone the buckets follow.
+         * @return The zone, or nullptr for UTC.
+         */
+        [[nodiscard]] auto zone() const noexcept -> const TimeZone*;
+
+    private:
+        auto bucket_range(std::int64_t value) const noexcept
+            -> std::pair<std::int64_t, std::int64_t>;
+        void bucket_cached(std::span<const std::int64_t> values, std::span<std::int64_t> buckets,
+                           SimdLevel level) const noexcept;
+
+        Unit m_unit = Unit::Day;
+        std::uint32_t m_count = 1;
+        std::int64_t m_ticks_per_second = 1;
+        const TimeZone* m_zone = nullptr;
+        std::int64_t m_width = 0;   ///< Bucket width in ticks; 0 for calendar buckets
+        std::int64_t m_origin = 0;  ///< A bucket start in ticks (a Monday for weeks)
+};
+}  // namespace CommonLib
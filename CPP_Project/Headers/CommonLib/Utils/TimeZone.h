@@ -0,0 +1,218 @@
+/** @file
+ *  @brief This file contains the definition of the TimeZone class.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/NonCopyable.h"
+#include "CommonLib/Base/NonMoveable.h"
+#include "CommonLib/Utils/CivilTime.h"
+
+namespace CommonLib
+{
+/**
+ * @class TimeZone
+ * @brief Immutable time zone rules loaded from TZif data or a POSIX TZ string.
+ *
+ * The transition table is parsed once and never modified afterwards, so a TimeZone can be shared
+ * between threads without any synchronization. UTC offsets are found with a binary search over a
+ * contiguous array of transition times; the POSIX rule found in the TZif footer is materialized
+ * into additional transitions up to the year 2100 and evaluated arithmetically beyond that.
+ *
+ * The local time zone is resolved like the C library does it (TZ environment variable, then
+ * /etc/localtime) and cached process wide. Use reload_local() after the system zone changed.
+ */
+class COMMONLIB_API COMMONLIB_EMPTY_BASES TimeZone: public NonCopyable, public NonMoveable
+{
+    public:
+        /**
+         * @struct Offset
+         * @brief The UTC offset in effect at a given instant.
+         */
+        struct Offset {
+                std::int32_t utc_offset = 0;  ///< Seconds east of UTC
+                bool is_dst = false;
+                const char* abbreviation = "UTC";
+        };
+
+        /**
+         * @brief Destroys the TimeZone object.
+         */
+        ~TimeZone() = default;
+
+        /**
+         * @brief Parses TZif (RFC 8536, versions 1 - 4) data.
+         * @param data The raw TZif file contents.
+         * @param name The name reported by name().
+         * @return The time zone, or nullptr if the data is malformed.
+         */
+        static auto from_tzif(std::span<const std::uint8_t> data, std::string name)
+            -> std::shared_ptr<const TimeZone>;
+
+        /**
+         * @brief Loads a TZif file.
+         * @param path The path of the file, e.g. "/usr/share/zoneinfo/Europe/Berlin".
+         * @return The time zone, or nullptr if the file cannot be read or is malformed.
+         */
+        static auto from_file(const std::string& path) -> std::shared_ptr<const TimeZone>;
+
+        /**
+         * @brief Parses a POSIX TZ rule string such as "CET-1CEST,M3.5.0,M10.5.0/3".
+         * @param rule The POSIX TZ string.
+         * @return The time zone, or nullptr if the string is malformed.
+         */
+        static auto from_posix_rule(std::string_view rule) -> std::shared_ptr<const TimeZone>;
+
+        /**
+         * @brief Returns the UTC time zone.
+         * @return The shared UTC instance.
+         */
+        static auto utc() -> std::shared_ptr<const TimeZone>;
+
+        /**
+         * @brief Returns the local time zone, loading it on first use.
+         * @return The local time zone, or nullptr if it could not be determined (e.g. on
+         *         Windows, where the C library is used instead).
+         */
+        static auto local() -> std::shared_ptr<const TimeZone>;
+
+        /**
+         * @brief Returns the local time zone through a per-thread cache.
+         *
+         * Unlike local(), this avoids touching the shared reference count on every call: each
+         * thread keeps its own reference and only refreshes it when reload_local() has been
+         * called. The pointer stays valid until the calling thread observes such a reload.
+         * Loading errors are not thrown: the thread keeps its previous zone, if any, and tries
+         * again on the next call.
+         *
+         * @return The local time zone, or nullptr if it could not be determined or loaded.
+         */
+        static auto local_cached() noexcept -> const TimeZone*;
+
+        /**
+         * @brief Reloads the local time zone, e.g. after TZ or /etc/localtime changed.
+         * @return True if the new local zone could be loaded.
+         */
+        static auto reload_local() -> bool;
+
+        /**
+         * @brief Returns a counter that is incremented every time the local zone is (re)loaded.
+         * @return The local zone generation (0 if it has not been loaded yet).
+         */
+        static auto local_generation() noexcept -> std::uint64_t;
+
+        /**
+         * @brief Returns the name of the time zone.
+         * @return The zone name, file path or POSIX rule it was created from.
+         */
+        [[nodiscard]] auto name() const noexcept -> const std::string&;
+
+        /**
+         * @brief Returns the offset in effect at the given instant.
+         * @param unix_seconds The instant as seconds since the Unix epoch.
+         * @return The UTC offset, DST flag and abbreviation.
+         */
+        [[nodiscard]] auto offset_at(std::int64_t unix_seconds) const noexcept -> Offset;
+
+        /**
+         * @brief Converts an instant to local calendar fields.
+         * @param unix_seconds The instant as seconds since the Unix epoch.
+         * @return The local date and time.
+         */
+        [[nodiscard]] auto to_local(std::int64_t unix_seconds) const noexcept -> CivilDateTime;
+
+        /**
+         * @brief Converts a local wall clock time to an instant.
+         *
+         * Ambiguous times (when clocks are set back) resolve to the earlier instant. Times that
+         * do not exist (when clocks are set forward) are interpreted with the offset in effect
+         * before the transition, which moves them forward like mktime() does.
+         *
+         * @param local_seconds The local wall clock time, counted like Unix seconds.
+         * @return The seconds since the Unix epoch.
+         */
+        [[nodiscard]] auto to_utc(std::int64_t local_seconds) const noexcept -> std::int64_t;
+
+        /**
+         * @brief Converts a wall clock time in this zone to the wall clock time in another zone.
+         *
+         * The local time is resolved like to_utc() does it; the nanoseconds are carried over.
+         *
+         * @param local The wall clock time in this zone.
+         * @param target The zone to convert to.
+         * @return The wall clock time in the target zone.
+         */
+        [[nodiscard]] auto convert(const CivilDateTime& local,
+                                   const TimeZone& target) const noexcept -> CivilDateTime;
+
+    private:
+        /**
+         * @struct Type
+         * @brief A local time type of the transition table.
+         */
+        struct Type {
+                std::int32_t utc_offset = 0;
+                bool is_dst = false;
+                std::uint32_t abbreviation_index = 0;
+        };
+
+        /**
+         * @struct RuleDate
+         * @brief A transition date of a POSIX TZ rule (Jn, n or Mm.w.d) plus time of day.
+         */
+        struct RuleDate {
+                enum class Kind : std::uint8_t
+                {
+                    JulianNoLeap,
+                    Julian,
+                    MonthWeekDay
+                };
+
+                Kind kind = Kind::MonthWeekDay;
+                std::uint16_t day = 0;
+                std::uint8_t month = 0;
+                std::uint8_t week = 0;
+                std::int32_t time = 7200;
+        };
+
+        /**
+         * @struct Rule
+         * @brief A parsed POSIX TZ rule.
+         */
+        struct Rule {
+                Type standard;
+                Type daylight;
+                bool has_dst = false;
+                RuleDate start;
+                RuleDate end;
+        };
+
+        TimeZone() = default;
+
+        static auto parse_rule(std::string_view text, TimeZone& zone) -> std::optional<Rule>;
+        static auto rule_transition(const RuleDate& date, std::int32_t year) noexcept
+            -> std::int64_t;
+        static auto load_local() -> std::shared_ptr<const TimeZone>;
+
+        auto add_abbreviation(std::string_view abbreviation) -> std::uint32_t;
+        auto rule_offset_at(std::int64_t unix_seconds) const noexcept -> Offset;
+        auto to_offset(const Type& type) const noexcept -> Offset;
+        void materialize_rule();
+
+        std::string m_name;
+        std::vector<std::int64_t> m_transition_times;
+        std::vector<std::uint16_t> m_transition_types;
+        std::vector<Type> m_types;
+        std::string m_abbreviations;
+        std::optional<Rule> m_rule;
+};
+}  // namespace CommonLib
@@ -0,0 +1,137 @@
+/** @file
+ *  @brief This file contains the definition of the TimeZoneDatabase class.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "CommonLib/ApiMacro.h"
+#include "CommonLib/Base/NonCopyable.h"
+#include "CommonLib/Base/NonMoveable.h"
+#include "CommonLib/Utils/CivilTime.h"
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace CommonLib
+{
+/**
+ * @class TimeZoneDatabase
+ * @brief A lazily loaded, process wide cache of the IANA time zones, e.g. "Europe/Berlin".
+ *
+ * A zone is loaded on first lookup by memory mapping its TZif file below the database
+ * directory and parsing it into an immutable TimeZone. Loaded zones are published in a fixed
+ * size hash table that is only ever appended to: lookups of known zones are a hash, an acquire
+ * load and a string compare, without locks or reference counting. Only loading a new zone takes
+ * a mutex. Zones stay loaded until the database is destroyed, so the pointers returned by
+ * locate() never dangle; unknown names are remembered as well (up to a limit), so repeated
+ * lookups of a bad name do not hit the file system either.
+ */
+class COMMONLIB_API COMMONLIB_EMPTY_BASES TimeZoneDatabase: public NonCopyable, public NonMoveable
+{
+    public:
+        /**
+         * @brief Creates an empty database reading from the given directory.
+         * @param directory The zoneinfo directory, e.g. "/usr/share/zoneinfo".
+         */
+        explicit TimeZoneDatabase(std::string directory);
+
+        /**
+         * @brief Destroys the TimeZoneDatabase object and all zones it loaded.
+         */
+        ~TimeZoneDatabase();
+
+        /**
+         * @brief Returns the process wide database.
+         *
+         * It reads from $TZDIR if set and from /usr/share/zoneinfo otherwise; the directory is
+         * fixed on first use.
+         *
+         * @return The shared database.
+         */
+        static auto instance() -> TimeZoneDatabase&;
+
+        /**
+         * @brief Returns the directory the zones are loaded from.
+         * @return The zoneinfo directory.
+         */
+        [[nodiscard]] auto directory() const noexcept -> const std::string&;
+
+        /**
+         * @brief Returns the zone with the given IANA name, loading it on first use.
+         *
+         * Names are relative to the database directory; absolute paths and names containing ".."
+         * are rejected. "UTC" is always available, even without a zoneinfo directory.
+         *
+         * @param name The zone name, e.g. "America/New_York".
+         * @return The zone, valid as long as the database, or nullptr if it does not exist.
+         */
+        auto locate(std::string_view name) -> const TimeZone*;
+
+        /**
+         * @brief Returns the zone with the given IANA name as a shared pointer.
+         * @param name The zone name, e.g. "America/New_York".
+         * @return The zone, or nullptr if it does not exist.
+         */
+        auto find(std::string_view name) -> std::shared_ptr<const TimeZone>;
+
+        /**
+         * @brief Converts a wall clock time from one named zone to another.
+         * @param local The wall clock time in the source zone.
+         * @param from The name of the source zone.
+         * @param to The name of the target zone.
+         * @return The wall clock time in the target zone, or std::nullopt if a zone is unknown.
+         */
+        auto convert(const CivilDateTime& local, std::string_view from, std::string_view to)
+            -> std::optional<CivilDateTime>;
+
+        /**
+         * @brief Returns the number of zones loaded so far.
+         * @return The number of successfully loaded zones.
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t;
+
+    private:
+        /**
+         * @brief Number of hash buckets; there are about 600 zone names including aliases.
+         */
+        static constexpr std::size_t k_bucket_count = 1024;
+
+        /**
+         * @brief Maximum number of unknown names remembered.
+         */
+        static constexpr std::size_t k_max_unknown = 1024;
+
+        /**
+         * @struct Node
+         * @brief A cached lookup result; zone is nullptr for unknown names.
+         */
+        struct Node {
+                std::string name;
+                std::shared_ptr<const TimeZone> zone;
+                std::uint64_t hash = 0;
+                Node* next = nullptr;
+        };
+
+        static auto hash_of(std::string_view name) noexcept -> std::uint64_t;
+        static auto is_valid_name(std::string_view name) noexcept -> bool;
+
+        auto lookup(std::string_view name) -> const Node*;
+        auto search(std::string_view name, std::uint64_t hash) const noexcept -> const Node*;
+        auto load(std::string_view name, std::uint64_t hash) -> const Node*;
+        auto load_file(std::string_view name) const -> std::shared_ptr<const TimeZone>;
+
+        std::string m_directory;
+        std::array<std::atomic<Node*>, k_bucket_count> m_buckets{};
+        std::mutex m_mutex;
+        std::atomic<std::size_t> m_size{0};
+        std::size_t m_unknown = 0;
+};
+}  // namespace CommonLib
@@ -0,0 +1,153 @@
+/** @file
+ *  @brief This file contains the definition of the TscClock class.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "CommonLib/ApiMacro.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define COMMONLIB_HAS_TSC 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#else
+#define COMMONLIB_HAS_TSC 0
+#endif
+
+namespace CommonLib
+{
+/**
+ * @class TscClock
+ * @brief A ClockSource that reads the CPU time stamp counter.
+ *
+ * now() is a single inlined RDTSC (a few nanoseconds, no system call or vDSO jump) when the CPU
+ * reports an invariant TSC, which ticks at a constant rate on all cores regardless of frequency
+ * scaling and sleep states. Otherwise, and on non-x86 targets, it falls back to steady_clock
+ * nanoseconds; the choice is made once per process, so readings are always comparable.
+ *
+ * Ticks are converted only by the elapsed functions. The tick rate is calibrated against
+ * steady_clock on first use (about 10 ms); call calibrate() during start-up to move that cost out
+ * of the measured code or to refine the estimate with a longer window.
+ */
+class COMMONLIB_API TscClock
+{
+    public:
+        using Ticks = std::uint64_t;
+
+        /**
+         * @brief Returns the current reading. Not ordered with respect to surrounding code.
+         * @return The current tick count.
+         */
+        static auto now() noexcept -> Ticks
+        {
+#if COMMONLIB_HAS_TSC
+            if (uses_tsc()) [[likely]]
+            {
+                return read_tsc();
+            }
+#endif
+            return fallback_now();
+        }
+
+        /**
+         * @brief Returns the current reading once all preceding instructions have completed
+         *        (RDTSCP), e.g. to close a measured region.
+         * @return The current tick count.
+         */
+        static auto now_ordered() noexcept -> Ticks
+        {
+#if COMMONLIB_HAS_TSC
+            if (uses_tsc()) [[likely]]
+            {
+                return read_tscp();
+            }
+#endif
+            return fallback_now();
+        }
+
+        /**
+         * @brief Returns whether readings come from the TSC rather than steady_clock.
+         * @return True if an invariant TSC is used.
+         */
+        static auto uses_tsc() noexcept -> bool
+        {
+            static const bool use = detect();
+            return use;
+        }
+
+        /**
+         * @brief Measures the tick rate against steady_clock and stores it for conversions.
+         * @param window How long to measure; longer windows give a more precise rate.
+         * @return The measured number of ticks per second.
+         */
+        static auto calibrate(std::chrono::nanoseconds window = std::chrono::milliseconds(10))
+            -> double;
+
+        /**
+         * @brief Returns the tick rate, calibrating it first if needed.
+         * @return The number of ticks per second.
+         */
+        static auto ticks_per_second() -> double;
+
+        /**
+         * @brief Returns the elapsed time in nanoseconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in nanoseconds; negative if end precedes start.
+         */
+        static auto elapsed_ns(Ticks start, Ticks end) -> double;
+
+        /**
+         * @brief Returns the elapsed time in seconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in seconds.
+         */
+        static auto elapsed_s(Ticks start, Ticks end) -> double;
+
+        /**
+         * @brief Returns the elapsed time in milliseconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in milliseconds.
+         */
+        static auto elapsed_ms(Ticks start, Ticks end) -> double;
+
+        /**
+         * @brief Returns the elapsed time in microseconds between two readings.
+         * @param start The start reading.
+         * @param end The end reading.
+         * @return The elapsed time in microseconds.
+         */
+        static auto elapsed_us(Ticks start, Ticks end) -> double;
+
+    private:
+        static auto detect() noexcept -> bool;
+        static auto fallback_now() noexcept -> Ticks;
+
+#if COMMONLIB_HAS_TSC
+        static auto read_tsc() noexcept -> Ticks
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __rdtsc();
+#else
+            return __builtin_ia32_rdtsc();
+#endif
+        }
+
+        static auto read_tscp() noexcept -> Ticks
+        {
+            unsigned int core = 0;
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __rdtscp(&core);
+#else
+            return __builtin_ia32_rdtscp(&core);
+#endif
+        }
+#endif
+};
+}  // namespace CommonLib
@@ -0,0 +1,128 @@
+#include "CommonLib/Base/CpuFeatures.h"
+
+#include "CommonLib/Private/Simd.h"
+
+#if COMMONLIB_SIMD_X86 && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#elif COMMONLIB_SIMD_X86
+#include <cpuid.h>
+#endif
+
+namespace CommonLib
+{
+
+namespace
+{
+struct Features {
+        bool ssse3 = false;
+        bool avx2 = false;
+        bool invariant_tsc = false;
+        bool rdtscp = false;
+};
+
+auto detect() noexcept -> Features
+{
+    Features features;
+#if COMMONLIB_SIMD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+    int registers[4] = {};
+    __cpuid(registers, 0);
+    const int max_leaf = registers[0];
+
+    __cpuid(registers, 1);
+    features.ssse3 = (registers[2] & (1 << 9)) != 0;
+    const bool os_saves_ymm = (registers[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+
+    if (max_leaf >= 7 && os_saves_ymm)
+    {
+        __cpuidex(registers, 7, 0);
+        features.avx2 = (registers[1] & (1 << 5)) != 0;
+    }
+
+    __cpuid(registers, static_cast<int>(0x80000000));
+    const auto max_extended_leaf = static_cast<unsigned>(registers[0]);
+    if (max_extended_leaf >= 0x80000001)
+    {
+        __cpuid(registers, static_cast<int>(0x80000001));
+        features.rdtscp = (registers[3] & (1 << 27)) != 0;
+    }
+    if (max_extended_leaf >= 0x80000007)
+    {
+        __cpuid(registers, static_cast<int>(0x80000007));
+        features.invariant_tsc = (registers[3] & (1 << 8)) != 0;
+    }
+#else
+    // __builtin_cpu_supports also checks that the OS saves the AVX register state.
+    __builtin_cpu_init();
+    features.ssse3 = __builtin_cpu_supports("ssse3") != 0;
+    features.avx2 = __builtin_cpu_supports("avx2") != 0;
+
+    // __get_cpuid returns 0 if the leaf is above the highest supported one.
+    unsigned eax = 0;
+    unsigned ebx = 0;
+    unsigned ecx = 0;
+    unsigned edx = 0;
+    if (__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) != 0)
+    {
+        features.rdtscp = (edx & (1U << 27)) != 0;
+    }
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) != 0)
+    {
+        features.invariant_tsc = (edx & (1U << 8)) != 0;
+    }
+#endif
+#endif
+    return features;
+}
+
+auto features() noexcept -> const Features&
+{
+    static const Features cached = detect();
+    return cached;
+}
+}  // namespace
+
+auto CpuFeatures::has_ssse3() noexcept -> bool
+{
+    return features().ssse3;
+}
+
+auto CpuFeatures::has_avx2() noexcept -> bool
+{
+    return features().avx2;
+}
+
+auto CpuFeatures::has_invariant_tsc() noexcept -> bool
+{
+    return features().invariant_tsc;
+}
+
+auto CpuFeatures::has_rdtscp() noexcept -> bool
+{
+    return features().rdtscp;
+}
+
+auto CpuFeatures::simd_level() noexcept -> SimdLevel
+{
+    if (has_avx2())
+    {
+        return SimdLevel::Avx2;
+    }
+    return has_ssse3() ? SimdLevel::Ssse3 : SimdLevel::Scalar;
+}
+
+auto CpuFeatures::supports(SimdLevel level) noexcept -> bool
+{
+    switch (level)
+    {
+        case SimdLevel::Scalar:
+            return true;
+        case SimdLevel::Ssse3:
+            return has_ssse3();
+        case SimdLevel::Avx2:
+            return has_avx2();
+    }
+    return false;
+}
+
+}  // namespace CommonLib
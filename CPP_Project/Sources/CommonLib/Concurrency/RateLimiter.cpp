@@ -0,0 +1,140 @@
+#include "CommonLib/Concurrency/RateLimiter.h"
+
+#include <cmath>
+
+namespace CommonLib
+{
+
+namespace
+{
+constexpr unsigned k_count_bits = 20;
+constexpr std::uint64_t k_count_mask = (std::uint64_t{1} << k_count_bits) - 1;
+constexpr std::uint64_t k_index_mask = (std::uint64_t{1} << 24) - 1;
+
+/**
+ * @brief The unpacked state of a sliding window, moved to the window of the current time.
+ */
+struct WindowState {
+        std::uint64_t index = 0;  ///< Window index modulo 2^24
+        std::uint64_t previous = 0;
+        std::uint64_t current = 0;
+        std::int64_t elapsed_ns = 0;  ///< Time since the start of the window
+
+        [[nodiscard]] auto pack() const noexcept -> std::uint64_t
+        {
+            return (index << (2 * k_count_bits)) | (previous << k_count_bits) | current;
+        }
+};
+
+auto unpack(std::uint64_t state, std::int64_t now_ns, std::int64_t window_ns) noexcept
+    -> WindowState
+{
+    const std::uint64_t stored_index = state >> (2 * k_count_bits);
+    const std::uint64_t previous = (state >> k_count_bits) & k_count_mask;
+    const std::uint64_t current = state & k_count_mask;
+    const auto now_index = static_cast<std::uint64_t>(now_ns / window_ns) & k_index_mask;
+    const std::uint64_t distance = (now_index - stored_index) & k_index_mask;
+
+    if (distance == 0)
+    {
+        return {now_index, previous, current, now_ns % window_ns};
+    }
+    if (distance == 1)
+    {
+        return {now_index, current, 0, now_ns % window_ns};
+    }
+    if (distance > (k_index_mask >> 1))
+    {
+        // Another thread read a later time and already moved the state to the next window; count
+        // in that window, as of its start.
+        return {stored_index, previous, current, 0};
+    }
+    return {now_index, 0, 0, now_ns % window_ns};
+}
+
+auto used(const WindowState& window, std::int64_t window_ns) noexcept -> double
+{
+    const double overlap = static_cast<double>(window_ns - window.elapsed_ns) /
+                           static_cast<double>(window_ns);
+    return static_cast<double>(window.previous) * overlap + static_cast<double>(window.current);
+}
+}  // namespace
+
+TokenBucketRule::TokenBucketRule(double tokens_per_second, std::uint64_t burst) : m_burst(burst)
+{
+    if (!(tokens_per_second > 0.0) || tokens_per_second > 1e9)
+    {
+        throw std::invalid_argument("TokenBucketRule: rate must be in (0, 1e9] per second");
+    }
+    if (burst == 0)
+    {
+        throw std::invalid_argument("TokenBucketRule: burst must be positive");
+    }
+    const double interval = std::round(1e9 / tokens_per_second);
+    if (interval * static_cast<double>(burst) > 9e18)
+    {
+        throw std::invalid_argument("TokenBucketRule: burst takes too long to refill");
+    }
+    m_interval_ns = interval < 1.0 ? 1 : static_cast<std::uint64_t>(interval);
+    m_burst_ns = m_interval_ns * burst;
+}
+
+auto TokenBucketRule::available(std::uint64_t state, std::int64_t now_ns) const noexcept
+    -> std::uint64_t
+{
+    const auto now = static_cast<std::uint64_t>(now_ns);
+    const std::uint64_t backlog = state > now ? state - now : 0;
+    return backlog >= m_burst_ns ? 0 : (m_burst_ns - backlog) / m_interval_ns;
+}
+
+SlidingWindowRule::SlidingWindowRule(std::uint64_t limit, std::chrono::nanoseconds window)
+    : m_limit(limit), m_window_ns(window.count())
+{
+    if (limit == 0 || limit > k_max_limit)
+    {
+        throw std::invalid_argument("SlidingWindowRule: limit must be in [1, 2^20)");
+    }
+    if (m_window_ns <= 0)
+    {
+        throw std::invalid_argument("SlidingWindowRule: window must be positive");
+    }
+}
+
+auto SlidingWindowRule::try_acquire(std::atomic<std::uint64_t>& state, std::int64_t now_ns,
+                                    std::uint64_t tokens) const noexcept -> bool
+{
+    if (tokens > m_limit)
+    {
+        return false;
+    }
+    std::uint64_t packed = state.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        WindowState window = unpack(packed, now_ns, m_window_ns);
+        if (used(window, m_window_ns) + static_cast<double>(tokens) >
+            static_cast<double>(m_limit))
+        {
+            return false;
+        }
+        window.current += tokens;
+        if (state.compare_exchange_weak(packed, window.pack(), std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+}
+
+auto SlidingWindowRule::is_idle(std::uint64_t state, std::int64_t now_ns) const noexcept -> bool
+{
+    return used(unpack(state, now_ns, m_window_ns), m_window_ns) == 0.0;
+}
+
+auto SlidingWindowRule::available(std::uint64_t state, std::int64_t now_ns) const noexcept
+    -> std::uint64_t
+{
+    const double in_use = std::ceil(used(unpack(state, now_ns, m_window_ns), m_window_ns));
+    const auto limit = static_cast<double>(m_limit);
+    return in_use >= limit ? 0 : static_cast<std::uint64_t>(limit - in_use);
+}
+
+}  // namespace CommonLib
@@ -0,0 +1,519 @@
+#include "CommonLib/Logging/AsyncLogger.h"
+
+#include <bit>
+#include <charconv>
+#include <condition_variable>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "CommonLib/Utils/CachedDateTimeFormatter.h"
+
+namespace CommonLib
+{
+namespace
+{
+/// The number of records rendered before the writer checks for flush requests.
+constexpr std::size_t k_batch_size = 256;
+
+auto thread_index() noexcept -> std::uint32_t
+{
+    static std::atomic<std::uint32_t> next{1};
+    thread_local const std::uint32_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+template<typename T>
+void append_number(std::string& out, T value, int base = 10)
+{
+    std::array<char, 32> digits{};
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value, base);
+    out.append(digits.data(), result.ptr);
+}
+
+void append_number(std::string& out, double value)
+{
+    std::array<char, 32> digits{};
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    out.append(digits.data(), result.ptr);
+}
+}  // namespace
+
+/**
+ * @struct AsyncLogger::Writer
+ * @brief The state of the background thread of one logging session.
+ */
+struct AsyncLogger::Writer {
+        Writer(const Config& settings, std::atomic<std::uint64_t>& written_lines)
+            : config(settings),
+              formatter(settings.timestamp_format, settings.zone),
+              stamp(formatter.max_size()),
+              written(written_lines)
+        {
+            buffer.reserve(config.buffer_size + 1024);
+        }
+
+        ~Writer()
+        {
+            close();
+        }
+
+        Writer(const Writer&) = delete;
+        auto operator=(const Writer&) -> Writer& = delete;
+        Writer(Writer&&) = delete;
+        auto operator=(Writer&&) -> Writer& = delete;
+
+        auto open(const char* mode) -> bool
+        {
+            file = std::fopen(config.path.c_str(), mode);
+            if (file == nullptr)
+            {
+                return false;
+            }
+            // The writer gathers whole batches itself; a second buffer would only copy them.
+            std::setvbuf(file, nullptr, _IONBF, 0);
+            std::error_code error;
+            const auto size = std::filesystem::file_size(config.path, error);
+            file_size = error ? 0 : size;
+            return true;
+        }
+
+        void close() noexcept
+        {
+            if (file != nullptr)
+            {
+                std::fclose(file);
+                file = nullptr;
+            }
+        }
+
+        void append(const Record& record)
+        {
+            line.clear();
+            const std::chrono::system_clock::time_point tp{
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(record.timestamp_ns))};
+            line.append(stamp.data(), formatter.format_to(stamp, tp));
+            line += " [";
+            line += level_name(record.level);
+            line += "] [";
+            append_number(line, record.thread);
+            line += "] ";
+            render(record);
+            if (record.truncated)
+            {
+                line += " [truncated]";
+            }
+            line += '\n';
+
+            const std::uint64_t pending = file_size + buffer.size();
+            if (config.max_file_size != 0 && pending > 0 &&
+                pending + line.size() > config.max_file_size)
+            {
+                write_out();
+                rotate();
+            }
+            buffer += line;
+            ++buffered_lines;
+            if (buffer.size() >= config.buffer_size)
+            {
+                write_out();
+            }
+        }
+
+        void render(const Record& record)
+        {
+            std::string_view format = record.format;
+            std::size_t offset = 0;
+            while (!format.empty())
+            {
+                const std::size_t brace = format.find_first_of("{}");
+                if (brace == std::string_view::npos)
+                {
+                    line.append(format);
+                    break;
+                }
+                line.append(format.substr(0, brace));
+                const char first = format[brace];
+                const char second = brace + 1 < format.size() ? format[brace + 1] : '\0';
+                if (first == '{' && second == '}')
+                {
+                    if (offset < record.size)
+                    {
+                        offset = append_argument(record, offset);
+                    }
+                    else
+                    {
+                        line += "{}";
+                    }
+                    format.remove_prefix(brace + 2);
+                }
+                else if (first == second)
+                {
+                    line += first;  // "{{" or "}}"
+                    format.remove_prefix(brace + 2);
+                }
+                else
+                {
+                    line += first;
+                    format.remove_prefix(brace + 1);
+                }
+            }
+        }
+
+        auto append_argument(const Record& record, std::size_t offset) -> std::size_t
+        {
+            const char* data = record.payload.data() + offset + 1;
+            const auto read = [data](auto& value) {
+                std::memcpy(&value, data, sizeof(value));
+                return sizeof(value);
+            };
+            std::size_t size = 0;
+            switch (static_cast<ArgType>(record.payload[offset]))
+            {
+                case ArgType::Bool:
+                {
+                    bool value = false;
+                    size = read(value);
+                    line += value ? "true" : "false";
+                    break;
+                }
+                case ArgType::Char:
+                {
+                    char value = 0;
+                    size = read(value);
+                    line += value;
+                    break;
+                }
+                case ArgType::Int:
+                {
+                    std::int64_t value = 0;
+                    size = read(value);
+                    append_number(line, value);
+                    break;
+                }
+                case ArgType::UInt:
+                {
+                    std::uint64_t value = 0;
+                    size = read(value);
+                    append_number(line, value);
+                    break;
+                }
+                case ArgType::Double:
+                {
+                    double value = 0.0;
+                    size = read(value);
+                    append_number(line, value);
+                    break;
+                }
+                case ArgType::String:
+                {
+                    std::uint16_t length = 0;
+                    size = read(length) + length;
+                    line.append(data + sizeof(length), length);
+                    break;
+                }
+                case ArgType::Pointer:
+                {
+                    std::uintptr_t value = 0;
+                    size = read(value);
+                    line += "0x";
+                    append_number(line, value, 16);
+                    break;
+                }
+            }
+            return offset + 1 + size;
+        }
+
+        void write_out()
+        {
+            if (!buffer.empty() && file != nullptr)
+            {
+                file_size += std::fwrite(buffer.data(), 1, buffer.size(), file);
+                written.fetch_add(buffered_lines, std::memory_order_relaxed);
+            }
+            buffer.clear();
+            buffered_lines = 0;
+        }
+
+        void rotate()
+        {
+            close();
+            std::error_code error;
+            const std::string& path = config.path;
+            if (config.max_files == 0)
+            {
+                std::filesystem::remove(path, error);
+            }
+            else
+            {
+                std::filesystem::remove(path + "." + std::to_string(config.max_files), error);
+                for (std::uint32_t index = config.max_files - 1; index > 0; --index)
+                {
+                    std::filesystem::rename(path + "." + std::to_string(index),
+                                            path + "." + std::to_string(index + 1), error);
+                }
+                std::filesystem::rename(path, path + ".1", error);
+            }
+            // If the file cannot be reopened, lines are dropped until the next rotation attempt.
+            open("wb");
+            file_size = 0;
+        }
+
+        Config config;
+        CachedDateTimeFormatter formatter;
+        std::vector<char> stamp;
+        std::string line;
+        std::string buffer;
+        std::uint64_t buffered_lines = 0;
+        std::FILE* file = nullptr;
+        std::uint64_t file_size = 0;
+        std::atomic<std::uint64_t>& written;
+        std::atomic<std::uint64_t> flush_target{0};
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable flushed;
+        bool stop_requested = false;        ///< Guarded by mutex
+        std::uint64_t written_position = 0;  ///< Guarded by mutex
+};
+
+AsyncLogger::AsyncLogger() = default;
+
+AsyncLogger::~AsyncLogger()
+{
+    stop();
+}
+
+void AsyncLogger::start(const Config& config)
+{
+    if (config.path.empty())
+    {
+        throw std::invalid_argument("AsyncLogger: The log file path is empty");
+    }
+    if (config.queue_capacity < 2 || !std::has_single_bit(config.queue_capacity))
+    {
+        throw std::invalid_argument("AsyncLogger: The queue capacity must be a power of two >= 2");
+    }
+    if (config.buffer_size == 0)
+    {
+        throw std::invalid_argument("AsyncLogger: The buffer size must not be 0");
+    }
+
+    std::lock_guard control(m_control);
+    stop_locked();
+
+    auto writer = std::make_unique<Writer>(config, m_written);
+    if (!writer->open("ab"))
+    {
+        throw std::runtime_error("AsyncLogger: Cannot open log file: " + config.path);
+    }
+
+    if (m_records == nullptr || m_mask + 1 != config.queue_capacity)
+    {
+        m_records = std::make_unique<Record[]>(config.queue_capacity);
+        for (std::size_t i = 0; i < config.queue_capacity; ++i)
+        {
+            m_records[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_mask = config.queue_capacity - 1;
+        m_enqueue_position.store(0, std::memory_order_relaxed);
+        m_dequeue_position = 0;
+    }
+    writer->written_position = m_dequeue_position;
+
+    m_overflow.store(config.overflow, std::memory_order_relaxed);
+    m_level.store(config.level, std::memory_order_relaxed);
+    m_writer = std::move(writer);
+    m_running.store(true, std::memory_order_relaxed);
+    m_writer->thread = std::thread(&AsyncLogger::run, this);
+    m_threshold.store(config.level, std::memory_order_release);
+}
+
+void AsyncLogger::stop()
+{
+    std::lock_guard control(m_control);
+    stop_locked();
+}
+
+void AsyncLogger::stop_locked()
+{
+    if (m_writer == nullptr)
+    {
+        return;
+    }
+    m_threshold.store(Level::Off, std::memory_order_relaxed);
+    m_running.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard lock(m_writer->mutex);
+        m_writer->stop_requested = true;
+    }
+    m_writer->wake.notify_one();
+    m_writer->thread.join();
+    m_writer.reset();
+}
+
+void AsyncLogger::flush()
+{
+    std::lock_guard control(m_control);
+    if (m_writer == nullptr)
+    {
+        return;
+    }
+    const std::uint64_t target = m_enqueue_position.load(std::memory_order_acquire);
+    Writer& writer = *m_writer;
+    std::unique_lock lock(writer.mutex);
+    if (writer.flush_target.load(std::memory_order_relaxed) < target)
+    {
+        writer.flush_target.store(target, std::memory_order_relaxed);
+    }
+    writer.wake.notify_one();
+    writer.flushed.wait(lock, [&] { return writer.written_position >= target; });
+}
+
+void AsyncLogger::set_level(Level level) noexcept
+{
+    std::lock_guard control(m_control);
+    m_level.store(level, std::memory_order_relaxed);
+    if (m_writer != nullptr)
+    {
+        m_threshold.store(level, std::memory_order_release);
+    }
+}
+
+auto AsyncLogger::level() const noexcept -> Level
+{
+    return m_level.load(std::memory_order_relaxed);
+}
+
+auto AsyncLogger::dropped() const noexcept -> std::uint64_t
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+auto AsyncLogger::written() const noexcept -> std::uint64_t
+{
+    return m_written.load(std::memory_order_relaxed);
+}
+
+auto AsyncLogger::level_name(Level level) noexcept -> std::string_view
+{
+    switch (level)
+    {
+        case Level::Trace:
+            return "TRACE";
+        case Level::Debug:
+            return "DEBUG";
+        case Level::Info:
+            return "INFO";
+        case Level::Warning:
+            return "WARNING";
+        case Level::Error:
+            return "ERROR";
+        case Level::Critical:
+            return "CRITICAL";
+        case Level::Off:
+            break;
+    }
+    return "OFF";
+}
+
+auto AsyncLogger::claim(Level level, const char* format) noexcept -> Record*
+{
+    std::uint64_t position = m_enqueue_position.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Record& record = m_records[position & m_mask];
+        const std::uint64_t sequence = record.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::int64_t>(sequence - position);
+        if (difference == 0)
+        {
+            if (m_enqueue_position.compare_exchange_weak(position, position + 1,
+                                                         std::memory_order_relaxed))
+            {
+                record.position = position;
+                record.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::system_clock::now().time_since_epoch())
+                                          .count();
+                record.format = format;
+                record.thread = thread_index();
+                record.level = level;
+                record.truncated = false;
+                return &record;
+            }
+        }
+        else if (difference < 0)
+        {
+            // The slot still holds the line from one lap ago: the queue is full.
+            if (m_overflow.load(std::memory_order_relaxed) == OverflowPolicy::Drop ||
+                !m_running.load(std::memory_order_relaxed))
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            std::this_thread::yield();
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+auto AsyncLogger::drain(Writer& writer, std::size_t limit) -> std::size_t
+{
+    std::size_t count = 0;
+    while (count < limit)
+    {
+        Record& record = m_records[m_dequeue_position & m_mask];
+        if (record.sequence.load(std::memory_order_acquire) != m_dequeue_position + 1)
+        {
+            break;
+        }
+        writer.append(record);
+        record.sequence.store(m_dequeue_position + m_mask + 1, std::memory_order_release);
+        ++m_dequeue_position;
+        ++count;
+    }
+    return count;
+}
+
+void AsyncLogger::run()
+{
+    Writer& writer = *m_writer;
+    std::uint64_t reported = m_dequeue_position;
+    for (;;)
+    {
+        const bool idle = drain(writer, k_batch_size) < k_batch_size;
+        const std::uint64_t target = writer.flush_target.load(std::memory_order_relaxed);
+        if (!idle && (target <= reported || m_dequeue_position < target))
+        {
+            continue;
+        }
+
+        writer.write_out();
+        std::unique_lock lock(writer.mutex);
+        if (reported != m_dequeue_position)
+        {
+            reported = m_dequeue_position;
+            writer.written_position = reported;
+            writer.flushed.notify_all();
+        }
+        if (!idle)
+        {
+            continue;
+        }
+        if (writer.stop_requested)
+        {
+            break;
+        }
+        writer.wake.wait_for(lock, writer.config.idle_wait, [&] {
+            return writer.stop_requested ||
+                   writer.flush_target.load(std::memory_order_relaxed) > m_dequeue_position;
+        });
+    }
+}
+}  // namespace CommonLib
@@ -0,0 +1,416 @@
+#include "CommonLib/Memory/SlotAllocator.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace CommonLib
+{
+namespace
+{
+#if defined(NDEBUG)
+constexpr bool k_poisoning = false;
+#else
+constexpr bool k_poisoning = true;
+#endif
+
+/// Set once the calling thread's caches are destroyed, e.g. for static pools used after main()
+/// returned; the thread's slots then go straight to the shared list.
+thread_local bool t_caches_destroyed = false;
+
+/**
+ * @brief The ids of the allocators that exist, so that threads exiting after an allocator was
+ *        destroyed do not hand their cached slots back to it.
+ */
+struct LiveAllocators {
+        std::mutex mutex;
+        std::vector<std::uint64_t> ids;
+        std::uint64_t next_id = 1;
+};
+
+auto live_allocators() -> LiveAllocators&
+{
+    static LiveAllocators instance;
+    return instance;
+}
+
+/// Whether the allocator still exists; the caller holds the mutex.
+auto is_alive(const LiveAllocators& live, std::uint64_t id) -> bool
+{
+    return std::find(live.ids.begin(), live.ids.end(), id) != live.ids.end();
+}
+
+auto validated_size(std::size_t object_size, std::size_t object_alignment,
+                    std::size_t first_slab_slots, std::size_t cache_slots) -> std::size_t
+{
+    if (!std::has_single_bit(object_alignment) || first_slab_slots == 0 || cache_slots == 0)
+    {
+        throw std::invalid_argument("SlotAllocator: Invalid alignment or slot count");
+    }
+    return object_size;
+}
+
+auto register_allocator() -> std::uint64_t
+{
+    LiveAllocators& live = live_allocators();
+    std::lock_guard lock(live.mutex);
+    const std::uint64_t id = live.next_id++;
+    live.ids.push_back(id);
+    return id;
+}
+
+constexpr auto round_up(std::size_t value, std::size_t multiple) -> std::size_t
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+/// The slab holding the slot; slab k holds the indices from (2^k - 1) << shift on.
+constexpr auto slab_of(std::uint32_t index, std::uint32_t shift) -> std::size_t
+{
+    return static_cast<std::size_t>(
+        std::bit_width((static_cast<std::uint64_t>(index) >> shift) + 1) - 1);
+}
+
+constexpr auto first_index(std::size_t slab, std::uint32_t shift) -> std::uint64_t
+{
+    return ((std::uint64_t{1} << slab) - 1) << shift;
+}
+
+constexpr auto slab_slots(std::size_t slab, std::uint32_t shift) -> std::uint64_t
+{
+    return std::uint64_t{1} << (slab + shift);
+}
+
+constexpr auto head_index(std::uint64_t head) -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(head);
+}
+
+/// The head after the next push or pop: the tag is incremented on every change against ABA.
+constexpr auto next_head(std::uint64_t head, std::uint32_t index) -> std::uint64_t
+{
+    return ((head >> 32) + 1) << 32 | index;
+}
+}  // namespace
+
+struct SlotAllocator::ThreadCache {
+        SlotAllocator* allocator = nullptr;
+        std::uint64_t id = 0;
+        std::uint32_t head = k_null;  ///< Linked like the shared list
+        std::uint32_t count = 0;
+};
+
+struct SlotAllocator::ThreadCaches {
+        ThreadCaches() = default;
+
+        ~ThreadCaches()
+        {
+            for (ThreadCache& cache: caches)
+            {
+                release(cache);
+            }
+            t_caches_destroyed = true;
+        }
+
+        ThreadCaches(const ThreadCaches&) = delete;
+        auto operator=(const ThreadCaches&) -> ThreadCaches& = delete;
+        ThreadCaches(ThreadCaches&&) = delete;
+        auto operator=(ThreadCaches&&) -> ThreadCaches& = delete;
+
+        /**
+         * @brief Hands the cached slots back if their allocator still exists, and empties the
+         *        cache.
+         */
+        static void release(ThreadCache& cache) noexcept
+        {
+            if (cache.count > 0)
+            {
+                LiveAllocators& live = live_allocators();
+                std::lock_guard lock(live.mutex);
+                // The destructor of the allocator waits for the mutex before releasing the slabs.
+                if (is_alive(live, cache.id))
+                {
+                    cache.allocator->push_list(cache, cache.count);
+                }
+            }
+            cache = {};
+        }
+
+        std::array<ThreadCache, 4> caches;
+        std::size_t next_victim = 0;
+};
+
+SlotAllocator::SlotAllocator(std::size_t object_size, std::size_t object_alignment,
+                             std::size_t first_slab_slots, std::size_t cache_slots)
+    : m_object_size(validated_size(object_size, object_alignment, first_slab_slots, cache_slots)),
+      m_alignment(std::max(object_alignment, k_cache_line)),
+      m_slot_size(round_up(std::max<std::size_t>(object_size, 1), m_alignment)),
+      m_first_slab_shift(static_cast<std::uint32_t>(
+          std::countr_zero(std::bit_ceil(std::min<std::size_t>(first_slab_slots, 1U << 24))))),
+      m_cache_slots(static_cast<std::uint32_t>(std::min<std::size_t>(cache_slots, 1U << 20))),
+      m_id(register_allocator()),
+      m_head(k_null)
+{
+}
+
+SlotAllocator::~SlotAllocator()
+{
+    {
+        LiveAllocators& live = live_allocators();
+        std::lock_guard lock(live.mutex);
+        std::erase(live.ids, m_id);
+    }
+    // Cache entries left in any thread, this one included, no longer match a live id; they are
+    // dropped when reused or when their thread exits.
+
+    const std::size_t slabs = m_slab_count.load(std::memory_order_acquire);
+    for (std::size_t slab = 0; slab < slabs; ++slab)
+    {
+        ::operator delete(m_slabs[slab].load(std::memory_order_relaxed),
+                          std::align_val_t(m_alignment));
+    }
+}
+
+auto SlotAllocator::allocate() -> Slot
+{
+    std::uint32_t index = k_null;
+    if (t_caches_destroyed)
+    {
+        while ((index = pop_shared()) == k_null)
+        {
+            grow();
+        }
+    }
+    else
+    {
+        ThreadCache& cache = thread_cache();
+        while (cache.count == 0 && !refill(cache))
+        {
+            grow();
+        }
+        index = cache.head;
+        cache.head = next(index).load(std::memory_order_relaxed);
+        --cache.count;
+    }
+
+    void* storage = slot(index);
+    if constexpr (k_poisoning)
+    {
+        check_poison(storage);
+    }
+    return {storage, index};
+}
+
+void SlotAllocator::deallocate(std::uint32_t index) noexcept
+{
+    if constexpr (k_poisoning)
+    {
+        poison(slot(index));
+    }
+    if (t_caches_destroyed)
+    {
+        push_shared(index, index);
+        return;
+    }
+
+    ThreadCache& cache = thread_cache();
+    next(index).store(cache.head, std::memory_order_relaxed);
+    cache.head = index;
+    if (++cache.count > m_cache_slots)
+    {
+        push_list(cache, cache.count / 2);
+    }
+}
+
+auto SlotAllocator::poisoning() noexcept -> bool
+{
+    return k_poisoning;
+}
+
+auto SlotAllocator::slot(std::uint32_t index) const noexcept -> void*
+{
+    const std::size_t slab = slab_of(index, m_first_slab_shift);
+    const std::uint64_t position = index - first_index(slab, m_first_slab_shift);
+    return m_slabs[slab].load(std::memory_order_acquire) + position * m_slot_size;
+}
+
+auto SlotAllocator::capacity() const noexcept -> std::size_t
+{
+    return static_cast<std::size_t>(first_index(slab_count(), m_first_slab_shift));
+}
+
+void SlotAllocator::flush_thread_cache() noexcept
+{
+    if (t_caches_destroyed)
+    {
+        return;
+    }
+    for (ThreadCache& cache: thread_caches().caches)
+    {
+        if (cache.allocator == this && cache.id == m_id)
+        {
+            if (cache.count > 0)
+            {
+                push_list(cache, cache.count);
+            }
+            return;
+        }
+    }
+}
+
+auto SlotAllocator::thread_caches() noexcept -> ThreadCaches&
+{
+    thread_local ThreadCaches caches;
+    return caches;
+}
+
+auto SlotAllocator::thread_cache() noexcept -> ThreadCache&
+{
+    ThreadCaches& caches = thread_caches();
+    ThreadCache* empty = nullptr;
+    for (ThreadCache& cache: caches.caches)
+    {
+        if (cache.allocator == this && cache.id == m_id)
+        {
+            return cache;
+        }
+        if (cache.allocator == nullptr && empty == nullptr)
+        {
+            empty = &cache;
+        }
+    }
+
+    if (empty == nullptr)
+    {
+        empty = &caches.caches[caches.next_victim];
+        caches.next_victim = (caches.next_victim + 1) % caches.caches.size();
+        ThreadCaches::release(*empty);
+    }
+    empty->allocator = this;
+    empty->id = m_id;
+    return *empty;
+}
+
+auto SlotAllocator::refill(ThreadCache& cache) noexcept -> bool
+{
+    const std::uint32_t batch = std::max<std::uint32_t>(m_cache_slots / 2, 1);
+    while (cache.count < batch)
+    {
+        const std::uint32_t index = pop_shared();
+        if (index == k_null)
+        {
+            break;
+        }
+        next(index).store(cache.head, std::memory_order_relaxed);
+        cache.head = index;
+        ++cache.count;
+    }
+    return cache.count > 0;
+}
+
+void SlotAllocator::grow()
+{
+    std::lock_guard lock(m_grow_mutex);
+    if (head_index(m_head.load(std::memory_order_acquire)) != k_null)
+    {
+        // Another thread grew the allocator or returned slots in the meantime.
+        return;
+    }
+
+    const std::size_t slab = m_slab_count.load(std::memory_order_relaxed);
+    const std::uint64_t first = first_index(slab, m_first_slab_shift);
+    const std::uint64_t slots = slab_slots(slab, m_first_slab_shift);
+    if (slab == k_max_slabs || first + slots > k_null)
+    {
+        throw std::bad_alloc();
+    }
+
+    const std::size_t slot_bytes = static_cast<std::size_t>(slots) * m_slot_size;
+    const std::size_t link_bytes = static_cast<std::size_t>(slots) * sizeof(std::uint32_t);
+    auto* storage = static_cast<std::byte*>(
+        ::operator new(slot_bytes + link_bytes, std::align_val_t(m_alignment)));
+    if constexpr (k_poisoning)
+    {
+        std::memset(storage, k_poison_byte, slot_bytes);
+    }
+    // Every slot links to the next one; the last link is set when the slab is pushed.
+    auto* links = reinterpret_cast<std::atomic<std::uint32_t>*>(storage + slot_bytes);
+    const auto begin = static_cast<std::uint32_t>(first);
+    const auto end = static_cast<std::uint32_t>(first + slots);
+    for (std::uint32_t index = begin; index < end; ++index)
+    {
+        ::new (links + (index - begin)) std::atomic<std::uint32_t>(index + 1);
+    }
+    m_slabs[slab].store(storage, std::memory_order_release);
+    m_slab_count.store(slab + 1, std::memory_order_release);
+    push_shared(begin, end - 1);
+}
+
+auto SlotAllocator::pop_shared() noexcept -> std::uint32_t
+{
+    std::uint64_t head = m_head.load(std::memory_order_acquire);
+    while (head_index(head) != k_null)
+    {
+        // The slot may be popped and reused concurrently; the tag then makes the exchange fail.
+        const std::uint32_t following = next(head_index(head)).load(std::memory_order_relaxed);
+        if (m_head.compare_exchange_weak(head, next_head(head, following),
+                                         std::memory_order_acquire, std::memory_order_acquire))
+        {
+            return head_index(head);
+        }
+    }
+    return k_null;
+}
+
+void SlotAllocator::push_shared(std::uint32_t first, std::uint32_t last) noexcept
+{
+    std::uint64_t head = m_head.load(std::memory_order_relaxed);
+    do
+    {
+        next(last).store(head_index(head), std::memory_order_relaxed);
+    } while (!m_head.compare_exchange_weak(head, next_head(head, first),
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed));
+}
+
+void SlotAllocator::push_list(ThreadCache& cache, std::uint32_t count) noexcept
+{
+    const std::uint32_t first = cache.head;
+    std::uint32_t last = first;
+    for (std::uint32_t linked = 1; linked < count; ++linked)
+    {
+        last = next(last).load(std::memory_order_relaxed);
+    }
+    cache.head = next(last).load(std::memory_order_relaxed);
+    cache.count -= count;
+    push_shared(first, last);
+}
+
+auto SlotAllocator::next(std::uint32_t index) const noexcept -> std::atomic<std::uint32_t>&
+{
+    const std::size_t slab = slab_of(index, m_first_slab_shift);
+    const std::uint64_t slots = slab_slots(slab, m_first_slab_shift);
+    std::byte* storage = m_slabs[slab].load(std::memory_order_acquire);
+    auto* links = reinterpret_cast<std::atomic<std::uint32_t>*>(
+        storage + static_cast<std::size_t>(slots) * m_slot_size);
+    return links[index - first_index(slab, m_first_slab_shift)];
+}
+
+void SlotAllocator::poison(void* storage) const noexcept
+{
+    std::memset(storage, k_poison_byte, m_object_size);
+}
+
+void SlotAllocator::check_poison(const void* storage) const noexcept
+{
+    const auto* bytes = static_cast<const unsigned char*>(storage);
+    const bool intact = std::all_of(bytes, bytes + m_object_size,
+                                    [](unsigned char byte) { return byte == k_poison_byte; });
+    assert(intact && "SlotAllocator: Slot written after it was freed");
+    static_cast<void>(intact);
+}
+}  // namespace CommonLib
@@ -0,0 +1,81 @@
+#include "CommonLib/Patterns/ShardedSingleton.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#if __has_include(<sys/rseq.h>) && defined(__has_builtin)
+#if __has_builtin(__builtin_thread_pointer)
+#include <sys/rseq.h>
+#define COMMONLIB_HAS_RSEQ 1
+#endif
+#endif
+#endif
+
+namespace CommonLib
+{
+namespace
+{
+auto cpu_count() noexcept -> std::size_t
+{
+#if defined(__linux__)
+    // Configured rather than online CPUs: sched_getcpu() may return any of them.
+    const long configured = sysconf(_SC_NPROCESSORS_CONF);
+    if (configured > 0)
+    {
+        return static_cast<std::size_t>(configured);
+    }
+#endif
+    return std::max(std::thread::hardware_concurrency(), 1U);
+}
+}  // namespace
+
+auto CpuShard::count() noexcept -> std::size_t
+{
+    static const std::size_t shards = std::bit_ceil(cpu_count());
+    return shards;
+}
+
+auto CpuShard::current() noexcept -> std::size_t
+{
+    const std::size_t mask = count() - 1;
+#if defined(_WIN32)
+    return static_cast<std::size_t>(GetCurrentProcessorNumber()) & mask;
+#else
+#if defined(COMMONLIB_HAS_RSEQ)
+    // glibc registers the rseq area of every thread; its cpu_id field is what sched_getcpu()
+    // returns, without the call.
+    if (__rseq_size > 0)
+    {
+        const auto* area = reinterpret_cast<const volatile struct rseq*>(
+            static_cast<const char*>(__builtin_thread_pointer()) + __rseq_offset);
+        const auto cpu = static_cast<std::int32_t>(area->cpu_id);
+        if (cpu >= 0)
+        {
+            return static_cast<std::size_t>(cpu) & mask;
+        }
+    }
+#endif
+#if defined(__linux__)
+    const int cpu = sched_getcpu();
+    if (cpu >= 0)
+    {
+        return static_cast<std::size_t>(cpu) & mask;
+    }
+#endif
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+    return index & mask;
+#endif
+}
+}  // namespace CommonLib
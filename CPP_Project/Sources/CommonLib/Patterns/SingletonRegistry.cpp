@@ -0,0 +1,509 @@
+#include "CommonLib/Patterns/SingletonRegistry.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define COMMONLIB_HAS_CXXABI 1
+#endif
+
+namespace CommonLib
+{
+namespace
+{
+using Entry = SingletonRegistry::Entry;
+
+static_assert(std::is_trivially_destructible_v<Entry>);
+
+/**
+ * @brief The registered and the constructed singletons.
+ */
+struct RegistryState {
+        RegistryState() = default;
+
+        ~RegistryState()
+        {
+            destroy_all();
+        }
+
+        RegistryState(const RegistryState&) = delete;
+        auto operator=(const RegistryState&) -> RegistryState& = delete;
+        RegistryState(RegistryState&&) = delete;
+        auto operator=(RegistryState&&) -> RegistryState& = delete;
+
+        void destroy_all() noexcept
+        {
+            while (!constructed.empty())
+            {
+                Entry* entry = constructed.back();
+                entry->destroy();
+                entry->constructed = false;
+                constructed.pop_back();
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable changed;  ///< Notified when a construction ends
+        std::vector<Entry*> registered;
+        std::vector<Entry*> constructed;  ///< In construction order
+        /// The entries being constructed, without the mutex, and the threads constructing them.
+        std::vector<std::pair<const Entry*, std::thread::id>> creating;
+};
+
+auto state() -> RegistryState&
+{
+    static RegistryState instance;
+    return instance;
+}
+
+/**
+ * @brief Appends the entry to order after its dependencies, skipping constructed entries.
+ */
+void visit(Entry& entry, std::vector<Entry*>& order, std::vector<Entry*>& path)
+{
+    if (entry.constructed || std::find(order.begin(), order.end(), &entry) != order.end())
+    {
+        return;
+    }
+    if (entry.visiting)
+    {
+        throw std::logic_error("SingletonRegistry: Dependency cycle involving " +
+                               SingletonRegistry::readable_name(entry.name));
+    }
+    entry.visiting = true;
+    path.push_back(&entry);
+    for (auto* dependency: entry.dependencies)
+    {
+        visit(dependency(), order, path);
+    }
+    path.pop_back();
+    entry.visiting = false;
+    order.push_back(&entry);
+}
+
+/**
+ * @brief Returns the entries that are not constructed yet in an order that respects their
+ *        dependencies; the caller holds the mutex.
+ */
+auto construction_plan(const std::vector<Entry*>& roots) -> std::vector<Entry*>
+{
+    std::vector<Entry*> order;
+    std::vector<Entry*> path;
+    try
+    {
+        for (Entry* root: roots)
+        {
+            visit(*root, order, path);
+        }
+    }
+    catch (...)
+    {
+        for (Entry* entry: path)
+        {
+            entry->visiting = false;
+        }
+        throw;
+    }
+    return order;
+}
+
+/**
+ * @brief Claims the entry for construction by the calling thread, waiting while another thread
+ *        constructs it; the caller holds the lock.
+ * @return False if the entry is constructed already.
+ * @throws std::logic_error if the calling thread is constructing the entry itself.
+ */
+auto claim(RegistryState& registry, std::unique_lock<std::mutex>& lock, Entry& entry) -> bool
+{
+    const auto creator = [&registry, &entry] {
+        return std::find_if(registry.creating.begin(), registry.creating.end(),
+                            [&entry](const auto& creating) { return creating.first == &entry; });
+    };
+    if (const auto it = creator();
+        it != registry.creating.end() && it->second == std::this_thread::get_id())
+    {
+        throw std::logic_error("SingletonRegistry: " +
+                               SingletonRegistry::readable_name(entry.name) +
+                               " is initialized by its own construction");
+    }
+    registry.changed.wait(lock, [&registry, &creator] {
+        return creator() == registry.creating.end();
+    });
+    if (entry.constructed)
+    {
+        return false;
+    }
+    // Room for every claimed entry, so that finish() cannot throw.
+    registry.constructed.reserve(registry.constructed.size() + registry.creating.size() + 1);
+    registry.creating.emplace_back(&entry, std::this_thread::get_id());
+    return true;
+}
+
+/**
+ * @brief Ends a construction claimed by the calling thread; the caller holds the lock.
+ */
+void finish(RegistryState& registry, Entry& entry, bool constructed) noexcept
+{
+    std::erase_if(registry.creating,
+                  [&entry](const auto& creating) { return creating.first == &entry; });
+    if (constructed)
+    {
+        entry.constructed = true;
+        registry.constructed.push_back(&entry);
+    }
+    registry.changed.notify_all();
+}
+
+/**
+ * @brief Destroys the given singletons in reverse; the caller holds the lock.
+ */
+void roll_back(RegistryState& registry, std::vector<Entry*>& created) noexcept
+{
+    while (!created.empty())
+    {
+        Entry* entry = created.back();
+        entry->destroy();
+        entry->constructed = false;
+        std::erase(registry.constructed, entry);
+        created.pop_back();
+    }
+}
+
+/**
+ * @brief Constructs the given entries and their dependencies; the caller holds the lock.
+ *
+ * The constructors run without the lock, so they may initialize other singletons themselves.
+ */
+void construct(RegistryState& registry, std::unique_lock<std::mutex>& lock,
+               const std::vector<Entry*>& roots)
+{
+    const std::vector<Entry*> order = construction_plan(roots);
+    std::vector<Entry*> created;
+    created.reserve(order.size());
+    try
+    {
+        for (Entry* entry: order)
+        {
+            if (!claim(registry, lock, *entry))
+            {
+                continue;
+            }
+            lock.unlock();
+            try
+            {
+                entry->create();
+            }
+            catch (...)
+            {
+                lock.lock();
+                finish(registry, *entry, false);
+                throw;
+            }
+            lock.lock();
+            finish(registry, *entry, true);
+            created.push_back(entry);
+        }
+    }
+    catch (...)
+    {
+        roll_back(registry, created);
+        throw;
+    }
+}
+
+/**
+ * @brief The work shared by the threads of one warm_up() call.
+ *
+ * An entry becomes ready when its last unconstructed dependency is constructed. The workers take
+ * ready entries until all are constructed or one has failed. Everything here is guarded by the
+ * mutex; a worker that holds both locks took the registry mutex first.
+ */
+class WarmUp
+{
+    public:
+        WarmUp(RegistryState& registry, const std::vector<Entry*>& order)
+            : m_registry(registry), m_order(order), m_pending(order.size()),
+              m_dependents(order.size()), m_remaining(order.size()),
+              m_start(std::chrono::steady_clock::now())
+        {
+            m_ready.reserve(order.size());
+            m_created.reserve(order.size());
+            m_timings.reserve(order.size());
+            std::unordered_map<const Entry*, std::size_t> indices;
+            for (std::size_t index = 0; index < order.size(); ++index)
+            {
+                indices.emplace(order[index], index);
+            }
+            for (std::size_t index = 0; index < order.size(); ++index)
+            {
+                for (auto* dependency: order[index]->dependencies)
+                {
+                    const auto found = indices.find(&dependency());
+                    if (found != indices.end())
+                    {
+                        ++m_pending[index];
+                        m_dependents[found->second].push_back(index);
+                    }
+                }
+                if (m_pending[index] == 0)
+                {
+                    m_ready.push_back(index);
+                }
+            }
+        }
+
+        /**
+         * @brief Constructs ready entries until there is nothing left to do.
+         */
+        void work(std::size_t worker)
+        {
+            std::unique_lock lock(m_mutex);
+            while (true)
+            {
+                m_changed.wait(lock, [this] {
+                    return !m_ready.empty() || m_remaining == 0 || m_failure != nullptr;
+                });
+                if (m_remaining == 0 || m_failure != nullptr)
+                {
+                    return;
+                }
+                const std::size_t index = m_ready.back();
+                m_ready.pop_back();
+                lock.unlock();
+
+                Entry* entry = m_order[index];
+                auto started = std::chrono::steady_clock::now();
+                auto finished = started;
+                bool created = false;
+                std::exception_ptr failure;
+                {
+                    std::unique_lock registry_lock(m_registry.mutex);
+                    try
+                    {
+                        // Constructed already if another thread initialized it in the meantime.
+                        if (claim(m_registry, registry_lock, *entry))
+                        {
+                            registry_lock.unlock();
+                            started = std::chrono::steady_clock::now();
+                            try
+                            {
+                                entry->create();
+                                created = true;
+                            }
+                            catch (...)
+                            {
+                                failure = std::current_exception();
+                            }
+                            finished = std::chrono::steady_clock::now();
+                            registry_lock.lock();
+                            finish(m_registry, *entry, created);
+                        }
+                    }
+                    catch (...)
+                    {
+                        failure = std::current_exception();
+                    }
+                    // Taken before the registry lock is released, so that the timings and
+                    // created entries are recorded in construction order.
+                    lock.lock();
+                }
+
+                if (failure != nullptr)
+                {
+                    // The first failure is rethrown; the other workers stop taking entries.
+                    if (m_failure == nullptr)
+                    {
+                        m_failure = std::move(failure);
+                    }
+                    m_changed.notify_all();
+                    return;
+                }
+                if (created)
+                {
+                    // Cannot throw: both have room for every entry.
+                    m_created.push_back(entry);
+                    m_timings.push_back({entry, started - m_start, finished - started, worker});
+                }
+                --m_remaining;
+                for (const std::size_t dependent: m_dependents[index])
+                {
+                    if (--m_pending[dependent] == 0)
+                    {
+                        m_ready.push_back(dependent);
+                    }
+                }
+                m_changed.notify_all();
+            }
+        }
+
+        /**
+         * @brief Returns the failure, if any; call it after joining the workers.
+         */
+        [[nodiscard]] auto failure() const -> std::exception_ptr
+        {
+            return m_failure;
+        }
+
+        /**
+         * @brief Returns the entries constructed by the workers in construction order; call it
+         *        after joining the workers.
+         */
+        [[nodiscard]] auto created() noexcept -> std::vector<Entry*>&
+        {
+            return m_created;
+        }
+
+        /**
+         * @brief Returns the timings in construction order; call it after joining the workers.
+         */
+        [[nodiscard]] auto timings() const -> std::vector<SingletonRegistry::InitTiming>
+        {
+            std::vector<SingletonRegistry::InitTiming> timings;
+            timings.reserve(m_timings.size());
+            for (const Timing& timing: m_timings)
+            {
+                timings.push_back({SingletonRegistry::readable_name(timing.entry->name),
+                                   timing.start, timing.duration, timing.worker});
+            }
+            return timings;
+        }
+
+    private:
+        struct Timing {
+                const Entry* entry;
+                std::chrono::nanoseconds start;
+                std::chrono::nanoseconds duration;
+                std::size_t worker;
+        };
+
+        RegistryState& m_registry;
+        const std::vector<Entry*>& m_order;
+        std::vector<std::size_t> m_pending;  ///< Unconstructed dependencies per entry
+        std::vector<std::vector<std::size_t>> m_dependents;
+        std::vector<std::size_t> m_ready;
+        std::size_t m_remaining;
+        std::exception_ptr m_failure;
+        std::vector<Entry*> m_created;
+        std::vector<Timing> m_timings;
+        std::mutex m_mutex;
+        std::condition_variable m_changed;
+        const std::chrono::steady_clock::time_point m_start;
+};
+}  // namespace
+
+auto SingletonRegistry::add(Entry& entry) -> bool
+{
+    RegistryState& registry = state();
+    std::lock_guard lock(registry.mutex);
+    if (!entry.registered)
+    {
+        entry.registered = true;
+        registry.registered.push_back(&entry);
+    }
+    return true;
+}
+
+void SingletonRegistry::initialize()
+{
+    RegistryState& registry = state();
+    std::unique_lock lock(registry.mutex);
+    construct(registry, lock, registry.registered);
+}
+
+void SingletonRegistry::initialize(Entry& entry)
+{
+    RegistryState& registry = state();
+    std::unique_lock lock(registry.mutex);
+    construct(registry, lock, {&entry});
+}
+
+auto SingletonRegistry::warm_up(std::size_t threads) -> std::vector<InitTiming>
+{
+    RegistryState& registry = state();
+    std::unique_lock lock(registry.mutex);
+    const std::vector<Entry*> order = construction_plan(registry.registered);
+    lock.unlock();
+    if (order.empty())
+    {
+        return {};
+    }
+    if (threads == 0)
+    {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    threads = std::min(threads, order.size());
+
+    WarmUp warm_up(registry, order);
+    std::vector<std::thread> workers;
+    try
+    {
+        workers.reserve(threads - 1);
+        for (std::size_t worker = 1; worker < threads; ++worker)
+        {
+            workers.emplace_back(&WarmUp::work, &warm_up, worker);
+        }
+    }
+    catch (const std::system_error&)
+    {
+        // The calling thread works too, so fewer threads only take longer.
+    }
+    warm_up.work(0);
+    for (std::thread& worker: workers)
+    {
+        worker.join();
+    }
+
+    if (warm_up.failure() != nullptr)
+    {
+        lock.lock();
+        roll_back(registry, warm_up.created());
+        std::rethrow_exception(warm_up.failure());
+    }
+    return warm_up.timings();
+}
+
+void SingletonRegistry::shutdown() noexcept
+{
+    RegistryState& registry = state();
+    std::lock_guard lock(registry.mutex);
+    registry.destroy_all();
+}
+
+auto SingletonRegistry::construction_order() -> std::vector<std::string>
+{
+    RegistryState& registry = state();
+    std::lock_guard lock(registry.mutex);
+    std::vector<std::string> names;
+    names.reserve(registry.constructed.size());
+    for (const Entry* entry: registry.constructed)
+    {
+        names.push_back(readable_name(entry->name));
+    }
+    return names;
+}
+
+auto SingletonRegistry::readable_name(const char* name) -> std::string
+{
+#if defined(COMMONLIB_HAS_CXXABI)
+    int status = 0;
+    const std::unique_ptr<char, decltype(&std::free)> demangled(
+        abi::__cxa_demangle(name, nullptr, nullptr, &status), &std::free);
+    if (status == 0 && demangled != nullptr)
+    {
+        return demangled.get();
+    }
+#endif
+    return name;
+}
+}  // namespace CommonLib
@@ -0,0 +1,146 @@
+#include "CommonLib/Profiling/LatencyHistogram.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace CommonLib
+{
+
+namespace
+{
+constexpr std::uint64_t k_no_minimum = std::numeric_limits<std::uint64_t>::max();
+}  // namespace
+
+HistogramLayout::HistogramLayout(std::uint64_t highest_trackable, int significant_digits)
+    : m_highest_trackable(highest_trackable), m_significant_digits(significant_digits)
+{
+    if (highest_trackable < 2)
+    {
+        throw std::invalid_argument("HistogramLayout: highest trackable value must be at least 2");
+    }
+    if (significant_digits < 1 || significant_digits > 5)
+    {
+        throw std::invalid_argument("HistogramLayout: significant digits must be from 1 to 5");
+    }
+
+    // Half of the sub-buckets cover each power of two, so 2^(S-1) must reach 10^digits.
+    std::uint64_t resolution = 1;
+    for (int i = 0; i < significant_digits; ++i)
+    {
+        resolution *= 10;
+    }
+    m_sub_bucket_bits = static_cast<unsigned>(std::bit_width(resolution - 1)) + 1;
+    m_sub_bucket_mask = (std::uint64_t{1} << m_sub_bucket_bits) - 1;
+    m_bucket_count = index_of(highest_trackable) + 1;
+}
+
+auto HistogramLayout::lowest_equivalent(std::size_t index) const noexcept -> std::uint64_t
+{
+    const std::size_t half = std::size_t{1} << (m_sub_bucket_bits - 1);
+    const std::size_t shift = index < 2 * half ? 0 : index / half - 1;
+    return static_cast<std::uint64_t>(index - (shift << (m_sub_bucket_bits - 1))) << shift;
+}
+
+auto HistogramLayout::highest_equivalent(std::size_t index) const noexcept -> std::uint64_t
+{
+    const std::size_t half = std::size_t{1} << (m_sub_bucket_bits - 1);
+    const std::size_t shift = index < 2 * half ? 0 : index / half - 1;
+    return lowest_equivalent(index) + (std::uint64_t{1} << shift) - 1;
+}
+
+LatencyHistogram::LatencyHistogram(std::uint64_t highest_trackable_ns, int significant_digits)
+    : m_layout(highest_trackable_ns, significant_digits),
+      m_counts(m_layout.bucket_count(), 0),
+      m_min(k_no_minimum)
+{}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    if (!(m_layout == other.m_layout))
+    {
+        throw std::invalid_argument("LatencyHistogram: cannot merge histograms of another layout");
+    }
+    for (std::size_t i = 0; i < m_counts.size(); ++i)
+    {
+        m_counts[i] += other.m_counts[i];
+    }
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+}
+
+void LatencyHistogram::reset() noexcept
+{
+    std::fill(m_counts.begin(), m_counts.end(), 0);
+    m_count = 0;
+    m_sum = 0;
+    m_min = k_no_minimum;
+    m_max = 0;
+}
+
+auto LatencyHistogram::percentile(double percentile) const -> std::uint64_t
+{
+    if (!(percentile >= 0.0 && percentile <= 100.0))
+    {
+        throw std::invalid_argument("LatencyHistogram: percentile must be within [0, 100]");
+    }
+    if (m_count == 0)
+    {
+        return 0;
+    }
+    if (percentile == 0.0)
+    {
+        return m_min;
+    }
+
+    // The rank of the requested sample, counted from 1, as in a sorted array.
+    const double exact_rank = std::ceil(percentile / 100.0 * static_cast<double>(m_count));
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(exact_rank));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < m_counts.size(); ++i)
+    {
+        seen += m_counts[i];
+        if (seen >= rank)
+        {
+            return std::clamp(m_layout.highest_equivalent(i), m_min, m_max);
+        }
+    }
+    return m_max;
+}
+
+ConcurrentLatencyHistogram::ConcurrentLatencyHistogram(std::uint64_t highest_trackable_ns,
+                                                       int significant_digits)
+    : m_layout(highest_trackable_ns, significant_digits),
+      m_counts(std::make_unique<std::atomic<std::uint64_t>[]>(m_layout.bucket_count())),
+      m_min(k_no_minimum)
+{}
+
+auto ConcurrentLatencyHistogram::snapshot() const -> LatencyHistogram
+{
+    LatencyHistogram result(m_layout.highest_trackable(), m_layout.significant_digits());
+    for (std::size_t i = 0; i < m_layout.bucket_count(); ++i)
+    {
+        const std::uint64_t count = m_counts[i].load(std::memory_order_relaxed);
+        result.m_counts[i] = count;
+        result.m_count += count;
+    }
+    result.m_sum = m_sum.load(std::memory_order_relaxed);
+    result.m_min = m_min.load(std::memory_order_relaxed);
+    result.m_max = m_max.load(std::memory_order_relaxed);
+    return result;
+}
+
+void ConcurrentLatencyHistogram::reset() noexcept
+{
+    for (std::size_t i = 0; i < m_layout.bucket_count(); ++i)
+    {
+        m_counts[i].store(0, std::memory_order_relaxed);
+    }
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(k_no_minimum, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace CommonLib
@@ -0,0 +1,286 @@
+#include "CommonLib/Profiling/TimerRegistry.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#include "CommonLib/Utils/TscClock.h"
+
+namespace CommonLib
+{
+
+namespace
+{
+constexpr std::uint32_t k_sites_per_chunk = 64;
+constexpr std::uint32_t k_chunk_count = TimerRegistry::k_max_sites / k_sites_per_chunk;
+constexpr std::uint64_t k_no_minimum = std::numeric_limits<std::uint64_t>::max();
+
+/**
+ * @brief The measurements of one site on one thread, alone on its cache line.
+ *
+ * Only the owning thread writes, so relaxed load/store pairs suffice and no read-modify-write
+ * instruction is needed; the atomics only make the concurrent reads of snapshot() well defined.
+ */
+struct alignas(64) Accumulator {
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> sum{0};
+        std::atomic<std::uint64_t> min{k_no_minimum};
+        std::atomic<std::uint64_t> max{0};
+};
+
+struct Chunk {
+        std::array<Accumulator, k_sites_per_chunk> accumulators;
+};
+
+/**
+ * @brief The accumulators of one thread; chunks are allocated when first used.
+ */
+struct ThreadBlock {
+        std::array<std::atomic<Chunk*>, k_chunk_count> chunks{};
+
+        ThreadBlock() = default;
+        ThreadBlock(const ThreadBlock&) = delete;
+        auto operator=(const ThreadBlock&) -> ThreadBlock& = delete;
+
+        ~ThreadBlock()
+        {
+            for (auto& chunk: chunks)
+            {
+                delete chunk.load(std::memory_order_relaxed);
+            }
+        }
+};
+
+/**
+ * @brief Merged raw measurements, in ticks.
+ */
+struct Totals {
+        std::uint64_t count = 0;
+        std::uint64_t sum = 0;
+        std::uint64_t min = k_no_minimum;
+        std::uint64_t max = 0;
+
+        void add(const Accumulator& accumulator) noexcept
+        {
+            count += accumulator.count.load(std::memory_order_relaxed);
+            sum += accumulator.sum.load(std::memory_order_relaxed);
+            min = std::min(min, accumulator.min.load(std::memory_order_relaxed));
+            max = std::max(max, accumulator.max.load(std::memory_order_relaxed));
+        }
+};
+
+struct Site {
+        std::string name;
+        std::string file;
+        int line = 0;
+};
+
+/**
+ * @brief The process-wide registry state.
+ *
+ * It is never destroyed, so that threads exiting during static destruction can still retire
+ * their blocks.
+ */
+struct Registry {
+        std::mutex mutex;
+        std::deque<Site> sites;
+        std::vector<ThreadBlock*> threads;
+        std::array<Totals, TimerRegistry::k_max_sites> retired{};
+
+        static auto instance() -> Registry&
+        {
+            static auto* registry = new Registry();
+            return *registry;
+        }
+
+        void add_thread(ThreadBlock* block)
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            threads.push_back(block);
+        }
+
+        void retire_thread(ThreadBlock* block)
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            merge(*block, retired);
+            threads.erase(std::find(threads.begin(), threads.end(), block));
+        }
+
+        static void merge(const ThreadBlock& block,
+                          std::array<Totals, TimerRegistry::k_max_sites>& totals)
+        {
+            for (std::uint32_t c = 0; c < k_chunk_count; ++c)
+            {
+                const Chunk* chunk = block.chunks[c].load(std::memory_order_acquire);
+                if (chunk == nullptr)
+                {
+                    continue;
+                }
+                for (std::uint32_t i = 0; i < k_sites_per_chunk; ++i)
+                {
+                    totals[c * k_sites_per_chunk + i].add(chunk->accumulators[i]);
+                }
+            }
+        }
+
+        auto to_stats(std::uint32_t id, const Totals& totals) const -> TimerStats
+        {
+            const Site& site = sites[id];
+            TimerStats stats{site.name, site.file, site.line};
+            stats.count = totals.count;
+            if (totals.count != 0)
+            {
+                stats.total_ns = TscClock::elapsed_ns(0, totals.sum);
+                stats.min_ns = TscClock::elapsed_ns(0, totals.min);
+                stats.max_ns = TscClock::elapsed_ns(0, totals.max);
+            }
+            return stats;
+        }
+};
+
+// A trivially initialized pointer keeps the hot path free of thread_local guard checks.
+thread_local ThreadBlock* t_block = nullptr;
+thread_local bool t_retired = false;
+
+/**
+ * @brief Owns the calling thread's block and retires it when the thread exits.
+ */
+class ThreadHandle
+{
+    public:
+        ThreadHandle() : m_block(std::make_unique<ThreadBlock>())
+        {
+            Registry::instance().add_thread(m_block.get());
+        }
+
+        ~ThreadHandle()
+        {
+            Registry::instance().retire_thread(m_block.get());
+            t_block = nullptr;
+            t_retired = true;
+        }
+
+        ThreadHandle(const ThreadHandle&) = delete;
+        auto operator=(const ThreadHandle&) -> ThreadHandle& = delete;
+
+        [[nodiscard]] auto block() const noexcept -> ThreadBlock*
+        {
+            return m_block.get();
+        }
+
+    private:
+        std::unique_ptr<ThreadBlock> m_block;
+};
+
+auto thread_chunk(std::uint32_t index) noexcept -> Chunk*
+{
+    if (t_block == nullptr)
+    {
+        if (t_retired)
+        {
+            return nullptr;  // Timers in thread_local destructors that run after ours.
+        }
+        thread_local ThreadHandle handle;
+        t_block = handle.block();
+    }
+
+    Chunk* chunk = t_block->chunks[index].load(std::memory_order_relaxed);
+    if (chunk == nullptr)
+    {
+        chunk = new (std::nothrow) Chunk();
+        t_block->chunks[index].store(chunk, std::memory_order_release);
+    }
+    return chunk;
+}
+}  // namespace
+
+auto TimerRegistry::register_site(std::string_view name, std::string_view file, int line)
+    -> std::uint32_t
+{
+    Registry& registry = Registry::instance();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    if (registry.sites.size() >= k_max_sites)
+    {
+        throw std::length_error("TimerRegistry: too many timer sites");
+    }
+    registry.sites.push_back({std::string(name), std::string(file), line});
+    return static_cast<std::uint32_t>(registry.sites.size() - 1);
+}
+
+void TimerRegistry::record(std::uint32_t site, std::uint64_t ticks) noexcept
+{
+    const std::uint32_t index = site / k_sites_per_chunk;
+    Chunk* chunk = t_block != nullptr ? t_block->chunks[index].load(std::memory_order_relaxed)
+                                      : nullptr;
+    if (chunk == nullptr)
+    {
+        chunk = thread_chunk(index);
+        if (chunk == nullptr)
+        {
+            return;  // Out of memory or thread exit; drop the measurement.
+        }
+    }
+
+    Accumulator& accumulator = chunk->accumulators[site % k_sites_per_chunk];
+    accumulator.count.store(accumulator.count.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+    accumulator.sum.store(accumulator.sum.load(std::memory_order_relaxed) + ticks,
+                          std::memory_order_relaxed);
+    if (ticks < accumulator.min.load(std::memory_order_relaxed))
+    {
+        accumulator.min.store(ticks, std::memory_order_relaxed);
+    }
+    if (ticks > accumulator.max.load(std::memory_order_relaxed))
+    {
+        accumulator.max.store(ticks, std::memory_order_relaxed);
+    }
+}
+
+auto TimerRegistry::snapshot() -> std::vector<TimerStats>
+{
+    Registry& registry = Registry::instance();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto totals = std::make_unique<std::array<Totals, k_max_sites>>(registry.retired);
+    for (const ThreadBlock* block: registry.threads)
+    {
+        Registry::merge(*block, *totals);
+    }
+
+    std::vector<TimerStats> result;
+    result.reserve(registry.sites.size());
+    for (std::uint32_t id = 0; id < registry.sites.size(); ++id)
+    {
+        result.push_back(registry.to_stats(id, (*totals)[id]));
+    }
+    return result;
+}
+
+auto TimerRegistry::snapshot(std::uint32_t site) -> TimerStats
+{
+    Registry& registry = Registry::instance();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    if (site >= registry.sites.size())
+    {
+        throw std::out_of_range("TimerRegistry: unknown timer site");
+    }
+
+    Totals totals = registry.retired[site];
+    for (const ThreadBlock* block: registry.threads)
+    {
+        const Chunk* chunk =
+            block->chunks[site / k_sites_per_chunk].load(std::memory_order_acquire);
+        if (chunk != nullptr)
+        {
+            totals.add(chunk->accumulators[site % k_sites_per_chunk]);
+        }
+    }
+    return registry.to_stats(site, totals);
+}
+
+}  // namespace CommonLib
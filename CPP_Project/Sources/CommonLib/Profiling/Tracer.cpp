@@ -0,0 +1,430 @@
+#include "CommonLib/Profiling/Tracer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+
+namespace CommonLib
+{
+
+namespace
+{
+/**
+ * @brief One buffered event; the fields are atomics so that drain() may read them while the
+ *        owning thread overwrites the slot.
+ *
+ * The thread id is kept per event because a buffer changes hands when its thread exits; it fits
+ * into what would otherwise be padding.
+ */
+struct Slot {
+        std::atomic<TscClock::Ticks> ticks{0};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<std::uint32_t> thread_id{0};
+        std::atomic<TracePhase> phase{TracePhase::Instant};
+};
+
+/**
+ * @brief The single-producer ring buffer of one thread.
+ *
+ * The owning thread bumps m_claimed before it writes a slot and publishes the slot by bumping
+ * m_published afterwards, like a sequence lock. drain() copies the published range and then
+ * discards the entries whose slots were claimed again while it was copying.
+ */
+class ThreadBuffer
+{
+    public:
+        ThreadBuffer(std::size_t capacity, TraceOverflow overflow, std::uint32_t thread_id)
+            : m_slots(std::make_unique<Slot[]>(capacity)),
+              m_mask(capacity - 1),
+              m_overflow(overflow),
+              m_thread_id(thread_id)
+        {}
+
+        void push(TscClock::Ticks ticks, const char* name, TracePhase phase) noexcept
+        {
+            const std::uint64_t head = m_published.load(std::memory_order_relaxed);
+            if (m_overflow == TraceOverflow::Drop &&
+                head - m_consumed.load(std::memory_order_acquire) > m_mask)
+            {
+                m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1,
+                                std::memory_order_relaxed);
+                return;
+            }
+
+            m_claimed.store(head + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            Slot& slot = m_slots[head & m_mask];
+            slot.ticks.store(ticks, std::memory_order_relaxed);
+            slot.name.store(name, std::memory_order_relaxed);
+            slot.thread_id.store(m_thread_id, std::memory_order_relaxed);
+            slot.phase.store(phase, std::memory_order_relaxed);
+            m_published.store(head + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Appends the unread events to out; called with the registry mutex held.
+         * @return The number of events lost since the previous drain.
+         */
+        auto drain(std::vector<TraceEvent>& out) -> std::uint64_t
+        {
+            const std::uint64_t head = m_published.load(std::memory_order_acquire);
+            const std::uint64_t tail = m_consumed.load(std::memory_order_relaxed);
+            const std::uint64_t capacity = m_mask + 1;
+            std::uint64_t begin = std::max(tail, head > capacity ? head - capacity : 0);
+
+            const std::size_t first = out.size();
+            for (std::uint64_t i = begin; i < head; ++i)
+            {
+                const Slot& slot = m_slots[i & m_mask];
+                out.push_back({slot.ticks.load(std::memory_order_relaxed),
+                               slot.name.load(std::memory_order_relaxed),
+                               slot.phase.load(std::memory_order_relaxed),
+                               slot.thread_id.load(std::memory_order_relaxed)});
+            }
+
+            // Entries whose slot was claimed for a newer event during the copy may be torn.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const std::uint64_t claimed = m_claimed.load(std::memory_order_relaxed);
+            if (claimed > capacity && claimed - capacity > begin)
+            {
+                const std::uint64_t torn = std::min(claimed - capacity, head) - begin;
+                out.erase(out.begin() + static_cast<std::ptrdiff_t>(first),
+                          out.begin() + static_cast<std::ptrdiff_t>(first + torn));
+                begin += torn;
+            }
+            m_consumed.store(head, std::memory_order_release);
+
+            const std::uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+            const std::uint64_t lost = begin - tail + dropped - m_reported_drops;
+            m_reported_drops = dropped;
+            return lost;
+        }
+
+        void retire() noexcept
+        {
+            m_retired.store(true, std::memory_order_release);
+        }
+
+        [[nodiscard]] auto retired() const noexcept -> bool
+        {
+            return m_retired.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Whether drain() has anything to report: events or drops; called with the
+         *        registry mutex held.
+         */
+        [[nodiscard]] auto pending() const noexcept -> bool
+        {
+            return m_published.load(std::memory_order_acquire) !=
+                       m_consumed.load(std::memory_order_relaxed) ||
+                   m_dropped.load(std::memory_order_relaxed) != m_reported_drops;
+        }
+
+        [[nodiscard]] auto configured(std::size_t capacity, TraceOverflow overflow) const noexcept
+            -> bool
+        {
+            return m_mask + 1 == capacity && m_overflow == overflow;
+        }
+
+        /**
+         * @brief Hands the retired buffer to a new thread, which appends after the unread events
+         *        of the previous one; called by that thread with the registry mutex held.
+         */
+        void adopt(std::uint32_t thread_id) noexcept
+        {
+            m_thread_id = thread_id;
+            m_retired.store(false, std::memory_order_relaxed);
+        }
+
+    private:
+        std::unique_ptr<Slot[]> m_slots;
+        std::uint64_t m_mask;
+        TraceOverflow m_overflow;
+        std::uint32_t m_thread_id;
+        alignas(64) std::atomic<std::uint64_t> m_claimed{0};
+        std::atomic<std::uint64_t> m_published{0};
+        std::atomic<std::uint64_t> m_dropped{0};
+        std::atomic<bool> m_retired{false};
+        alignas(64) std::atomic<std::uint64_t> m_consumed{0};
+        std::uint64_t m_reported_drops = 0;
+};
+
+/**
+ * @brief The process-wide tracer state; never destroyed, so that threads exiting during static
+ *        destruction can still retire their buffers.
+ */
+struct Registry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        std::uint32_t next_thread_id = 1;
+        std::size_t capacity = Tracer::k_default_capacity;
+        TraceOverflow overflow = TraceOverflow::Overwrite;
+        std::uint64_t lost = 0;
+
+        static auto instance() -> Registry&
+        {
+            static auto* registry = new Registry();
+            return *registry;
+        }
+
+        /**
+         * @brief Returns a buffer for the calling thread.
+         *
+         * The buffers of exited threads are handed on, so that threads that come and go between
+         * drains need no more buffers than ever ran at once. Empty ones are preferred, since the
+         * new thread overwrites or drops the unread events of the previous one as it fills up.
+         */
+        auto add_thread() -> ThreadBuffer*
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            ThreadBuffer* adopted = nullptr;
+            for (auto it = buffers.begin(); it != buffers.end();)
+            {
+                ThreadBuffer& buffer = **it;
+                if (!buffer.retired())
+                {
+                    ++it;
+                }
+                else if (!buffer.configured(capacity, overflow))
+                {
+                    // Left from before configure(); kept only until drained.
+                    it = buffer.pending() ? it + 1 : buffers.erase(it);
+                }
+                else
+                {
+                    if (adopted == nullptr || (adopted->pending() && !buffer.pending()))
+                    {
+                        adopted = &buffer;
+                    }
+                    ++it;
+                }
+            }
+
+            if (adopted != nullptr)
+            {
+                adopted->adopt(next_thread_id++);
+                return adopted;
+            }
+            buffers.push_back(std::make_unique<ThreadBuffer>(capacity, overflow, next_thread_id++));
+            return buffers.back().get();
+        }
+};
+
+std::atomic<bool> g_enabled{true};
+
+// A trivially initialized pointer keeps the hot path free of thread_local guard checks.
+thread_local ThreadBuffer* t_buffer = nullptr;
+thread_local bool t_retired = false;
+
+/**
+ * @brief Gets the calling thread's buffer and retires it when the thread exits; the registry
+ *        frees it once drained or hands it to the next thread.
+ */
+class ThreadHandle
+{
+    public:
+        ThreadHandle() : m_buffer(Registry::instance().add_thread()) {}
+
+        ~ThreadHandle()
+        {
+            m_buffer->retire();
+            t_buffer = nullptr;
+            t_retired = true;
+        }
+
+        ThreadHandle(const ThreadHandle&) = delete;
+        auto operator=(const ThreadHandle&) -> ThreadHandle& = delete;
+
+        [[nodiscard]] auto buffer() const noexcept -> ThreadBuffer*
+        {
+            return m_buffer;
+        }
+
+    private:
+        ThreadBuffer* m_buffer;
+};
+
+auto thread_buffer() noexcept -> ThreadBuffer*
+{
+    if (t_retired)
+    {
+        return nullptr;  // Events in thread_local destructors that run after ours.
+    }
+    try
+    {
+        thread_local ThreadHandle handle;
+        t_buffer = handle.buffer();
+    }
+    catch (...)
+    {
+        return nullptr;  // Out of memory; drop the event rather than fail the caller.
+    }
+    return t_buffer;
+}
+
+auto phase_code(TracePhase phase) noexcept -> char
+{
+    switch (phase)
+    {
+        case TracePhase::Begin:
+            return 'B';
+        case TracePhase::End:
+            return 'E';
+        case TracePhase::Instant:
+            break;
+    }
+    return 'i';
+}
+
+void append_json_string(std::string& out, const char* text)
+{
+    static constexpr char k_hex[] = "0123456789abcdef";
+    out += '"';
+    for (const char* p = text != nullptr ? text : ""; *p != '\0'; ++p)
+    {
+        const auto c = static_cast<unsigned char>(*p);
+        if (c == '"' || c == '\\')
+        {
+            out += '\\';
+            out += *p;
+        }
+        else if (c < 0x20)
+        {
+            out += "\\u00";
+            out += k_hex[c >> 4];
+            out += k_hex[c & 0xF];
+        }
+        else
+        {
+            out += *p;
+        }
+    }
+    out += '"';
+}
+
+template<typename T, typename... Args>
+void append_number(std::string& out, T value, Args... format)
+{
+    char buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, format...);
+    out.append(buffer, result.ptr);
+}
+}  // namespace
+
+void Tracer::configure(std::size_t events_per_thread, TraceOverflow overflow)
+{
+    if (events_per_thread == 0)
+    {
+        throw std::invalid_argument("Tracer: events per thread must be positive");
+    }
+    Registry& registry = Registry::instance();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.capacity = std::bit_ceil(std::max<std::size_t>(events_per_thread, 2));
+    registry.overflow = overflow;
+}
+
+void Tracer::set_enabled(bool enabled) noexcept
+{
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+auto Tracer::enabled() noexcept -> bool
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void Tracer::record(const char* name, TracePhase phase) noexcept
+{
+    if (!g_enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    ThreadBuffer* buffer = t_buffer != nullptr ? t_buffer : thread_buffer();
+    if (buffer != nullptr)
+    {
+        buffer->push(TscClock::now(), name, phase);
+    }
+}
+
+auto Tracer::drain() -> std::vector<TraceEvent>
+{
+    Registry& registry = Registry::instance();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::vector<TraceEvent> events;
+    for (auto it = registry.buffers.begin(); it != registry.buffers.end();)
+    {
+        // Read the flag first: a retired buffer receives no further events.
+        const bool retired = (*it)->retired();
+        registry.lost += (*it)->drain(events);
+        it = retired ? registry.buffers.erase(it) : it + 1;
+    }
+    return events;
+}
+
+auto Tracer::lost_events() -> std::uint64_t
+{
+    Registry& registry = Registry::instance();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.lost;
+}
+
+void Tracer::write_chrome_json(std::ostream& out, std::span<const TraceEvent> events)
+{
+    TscClock::Ticks origin = std::numeric_limits<TscClock::Ticks>::max();
+    for (const TraceEvent& event: events)
+    {
+        origin = std::min(origin, event.ticks);
+    }
+
+    // Events are rendered into a string that is handed to the stream in large pieces.
+    constexpr std::size_t k_flush_size = 64 * 1024;
+    std::string chunk = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    chunk.reserve(k_flush_size + 256);
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+        const TraceEvent& event = events[i];
+        chunk += i == 0 ? "\n{\"name\":" : ",\n{\"name\":";
+        append_json_string(chunk, event.name);
+        chunk += ",\"ph\":\"";
+        chunk += phase_code(event.phase);
+        chunk += "\",\"ts\":";
+        append_number(chunk, TscClock::elapsed_us(origin, event.ticks), std::chars_format::fixed,
+                      3);
+        chunk += ",\"pid\":1,\"tid\":";
+        append_number(chunk, event.thread_id);
+        chunk += event.phase == TracePhase::Instant ? ",\"s\":\"t\"}" : "}";
+        if (chunk.size() >= k_flush_size)
+        {
+            out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            chunk.clear();
+        }
+    }
+    chunk += "\n]}\n";
+    out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+}
+
+void Tracer::write_chrome_json(const std::string& path, std::span<const TraceEvent> events)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("Tracer: cannot open " + path);
+    }
+    write_chrome_json(file, events);
+    file.flush();
+    if (!file)
+    {
+        throw std::runtime_error("Tracer: cannot write " + path);
+    }
+}
+
+}  // namespace CommonLib
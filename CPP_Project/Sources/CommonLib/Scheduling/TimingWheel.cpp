@@ -0,0 +1,248 @@
+#include "CommonLib/Scheduling/TimingWheel.h"
+
+#include <bit>
+#include <stdexcept>
+
+namespace CommonLib
+{
+
+namespace
+{
+constexpr unsigned k_wheel_bits = TimingWheel::k_levels * TimingWheel::k_slot_bits;
+constexpr std::uint64_t k_slot_mask = TimingWheel::k_slots - 1;
+
+/**
+ * @brief Returns the first set bit after position from in a 256-bit map, or k_slots if none.
+ */
+auto next_set_bit(const std::array<std::uint64_t, TimingWheel::k_slots / 64>& bits,
+                  unsigned from) noexcept -> unsigned
+{
+    unsigned position = from + 1;
+    while (position < TimingWheel::k_slots)
+    {
+        const std::uint64_t word = bits[position / 64] >> (position % 64);
+        if (word != 0)
+        {
+            return position + static_cast<unsigned>(std::countr_zero(word));
+        }
+        position = (position / 64 + 1) * 64;
+    }
+    return TimingWheel::k_slots;
+}
+}  // namespace
+
+TimerNode::~TimerNode()
+{
+    if (m_wheel != nullptr)
+    {
+        m_wheel->cancel(*this);
+    }
+}
+
+TimingWheel::TimingWheel(Clock::duration resolution, Clock::time_point start)
+    : m_start(start), m_resolution(resolution)
+{
+    if (resolution <= Clock::duration::zero())
+    {
+        throw std::invalid_argument("TimingWheel: resolution must be positive");
+    }
+}
+
+TimingWheel::~TimingWheel()
+{
+    for (TimerNode* head: m_heads)
+    {
+        while (head != nullptr)
+        {
+            TimerNode* next = head->m_next;
+            head->m_prev = nullptr;
+            head->m_next = nullptr;
+            head->m_wheel = nullptr;
+            head = next;
+        }
+    }
+}
+
+void TimingWheel::schedule(TimerNode& node, Clock::time_point deadline) noexcept
+{
+    if (node.m_wheel != nullptr)
+    {
+        node.m_wheel->cancel(node);
+    }
+    node.m_wheel = this;
+    node.m_expiry = tick_ceil(deadline);
+    ++m_size;
+    insert(node, k_due_list);
+}
+
+auto TimingWheel::cancel(TimerNode& node) noexcept -> bool
+{
+    if (node.m_wheel != this)
+    {
+        return false;
+    }
+    unlink(node);
+    node.m_wheel = nullptr;
+    --m_size;
+    return true;
+}
+
+auto TimingWheel::tick_floor(Clock::time_point time) const noexcept -> std::uint64_t
+{
+    const Clock::duration offset = time - m_start;
+    return offset <= Clock::duration::zero() ? 0
+                                             : static_cast<std::uint64_t>(offset / m_resolution);
+}
+
+auto TimingWheel::tick_ceil(Clock::time_point time) const noexcept -> std::uint64_t
+{
+    const Clock::duration offset = time - m_start;
+    if (offset <= Clock::duration::zero())
+    {
+        return 0;
+    }
+    const auto ticks = static_cast<std::uint64_t>(offset / m_resolution);
+    return offset % m_resolution == Clock::duration::zero() ? ticks : ticks + 1;
+}
+
+void TimingWheel::link(TimerNode& node, std::uint32_t list) noexcept
+{
+    TimerNode*& head = m_heads[list];
+    node.m_list = list;
+    node.m_prev = nullptr;
+    node.m_next = head;
+    if (head != nullptr)
+    {
+        head->m_prev = &node;
+    }
+    else if (list < k_overflow_list)
+    {
+        const std::uint32_t slot = list % k_slots;
+        m_occupied[list / k_slots][slot / 64] |= std::uint64_t{1} << (slot % 64);
+    }
+    head = &node;
+}
+
+void TimingWheel::unlink(TimerNode& node) noexcept
+{
+    if (node.m_next != nullptr)
+    {
+        node.m_next->m_prev = node.m_prev;
+    }
+    if (node.m_prev != nullptr)
+    {
+        node.m_prev->m_next = node.m_next;
+    }
+    else
+    {
+        m_heads[node.m_list] = node.m_next;
+        if (node.m_next == nullptr && node.m_list < k_overflow_list)
+        {
+            const std::uint32_t slot = node.m_list % k_slots;
+            m_occupied[node.m_list / k_slots][slot / 64] &= ~(std::uint64_t{1} << (slot % 64));
+        }
+    }
+    node.m_prev = nullptr;
+    node.m_next = nullptr;
+}
+
+void TimingWheel::insert(TimerNode& node, std::uint32_t due_list) noexcept
+{
+    if (node.m_expiry <= m_now)
+    {
+        link(node, due_list);
+        return;
+    }
+
+    // The level is given by the highest bit in which the expiry differs from the current tick.
+    const auto highest_bit = static_cast<unsigned>(std::bit_width(node.m_expiry ^ m_now)) - 1;
+    if (highest_bit >= k_wheel_bits)
+    {
+        link(node, k_overflow_list);
+        return;
+    }
+    const unsigned level = highest_bit / k_slot_bits;
+    const auto slot = static_cast<std::uint32_t>((node.m_expiry >> (level * k_slot_bits)) &
+                                                 k_slot_mask);
+    link(node, level * k_slots + slot);
+}
+
+void TimingWheel::redistribute(std::uint32_t list) noexcept
+{
+    TimerNode* node = m_heads[list];
+    while (node != nullptr)
+    {
+        TimerNode* next = node->m_next;
+        unlink(*node);
+        insert(*node, k_expired_list);
+        node = next;
+    }
+}
+
+void TimingWheel::begin_advance() noexcept
+{
+    while (TimerNode* node = m_heads[k_due_list])
+    {
+        unlink(*node);
+        link(*node, k_expired_list);
+    }
+}
+
+auto TimingWheel::pop_expired() noexcept -> TimerNode*
+{
+    TimerNode* node = m_heads[k_expired_list];
+    if (node != nullptr)
+    {
+        unlink(*node);
+        node->m_wheel = nullptr;
+        --m_size;
+    }
+    return node;
+}
+
+auto TimingWheel::step(std::uint64_t target) noexcept -> bool
+{
+    if (m_now >= target)
+    {
+        return false;
+    }
+
+    // The next tick at which anything happens is the next occupied slot of the finest level that
+    // has one; finer levels are empty beyond their current slot, so nothing is skipped.
+    for (unsigned level = 0; level < k_levels; ++level)
+    {
+        const unsigned shift = level * k_slot_bits;
+        const auto current = static_cast<unsigned>((m_now >> shift) & k_slot_mask);
+        const unsigned slot = next_set_bit(m_occupied[level], current);
+        if (slot == k_slots)
+        {
+            continue;
+        }
+
+        const std::uint64_t upper = (m_now >> (shift + k_slot_bits)) << (shift + k_slot_bits);
+        const std::uint64_t tick = upper | (std::uint64_t{slot} << shift);
+        if (tick > target)
+        {
+            m_now = target;
+            return false;
+        }
+        m_now = tick;
+        redistribute(level * k_slots + slot);
+        return true;
+    }
+
+    if (m_heads[k_overflow_list] != nullptr)
+    {
+        const std::uint64_t tick = ((m_now >> k_wheel_bits) + 1) << k_wheel_bits;
+        if (tick <= target)
+        {
+            m_now = tick;
+            redistribute(k_overflow_list);
+            return true;
+        }
+    }
+    m_now = target;
+    return false;
+}
+
+}  // namespace CommonLib
@@ -0,0 +1,122 @@
+#include "CommonLib/Utils/CachedDateTimeFormatter.h"
+
+#include <array>
+#include <cstring>
+
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace CommonLib
+{
+
+namespace
+{
+void write_fraction(char* out, std::int32_t nanoseconds, std::uint32_t width)
+{
+    std::array<char, 9> digits{};
+    for (int i = 8; i >= 0; --i)
+    {
+        digits[static_cast<std::size_t>(i)] = static_cast<char>('0' + nanoseconds % 10);
+        nanoseconds /= 10;
+    }
+    std::memcpy(out, digits.data(), width);
+}
+}  // namespace
+
+CachedDateTimeFormatter::CachedDateTimeFormatter(std::string_view format,
+                                                 DateTimeFormatter::Zone zone)
+    : m_formatter(format, zone), m_cache(m_formatter.max_size())
+{}
+
+auto CachedDateTimeFormatter::format_to(std::span<char> buffer,
+                                        const std::chrono::system_clock::time_point& tp)
+    -> std::size_t
+{
+    if (buffer.size() < m_formatter.max_size())
+    {
+        return 0;
+    }
+
+    const auto second = std::chrono::floor<std::chrono::seconds>(tp);
+
+    if (!m_valid || second.time_since_epoch().count() != m_cached_second ||
+        (m_formatter.m_zone == DateTimeFormatter::Zone::Local &&
+         TimeZone::local_generation() != m_zone_generation))
+    {
+        render_second(tp);
+    }
+
+    if (m_cache_length != 0)
+    {
+        std::memcpy(buffer.data(), m_cache.data(), m_cache_length);
+    }
+
+    if (!m_fractions.empty())
+    {
+        const auto nanoseconds = static_cast<std::int32_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(tp - second).count());
+        for (const auto& slot: m_fractions)
+        {
+            write_fraction(buffer.data() + slot.offset, nanoseconds, slot.width);
+        }
+    }
+
+    return m_cache_length;
+}
+
+auto CachedDateTimeFormatter::format(const std::chrono::system_clock::time_point& tp)
+    -> std::string
+{
+    std::array<char, 256> stack_buffer{};
+
+    if (m_formatter.max_size() <= stack_buffer.size())
+    {
+        const auto length = format_to(std::span<char>(stack_buffer), tp);
+        return {stack_buffer.data(), length};
+    }
+
+    std::string result(m_formatter.max_size(), '\0');
+    result.resize(format_to(std::span<char>(result), tp));
+    return result;
+}
+
+void CachedDateTimeFormatter::invalidate() noexcept
+{
+    m_valid = false;
+}
+
+auto CachedDateTimeFormatter::formatter() const noexcept -> const DateTimeFormatter&
+{
+    return m_formatter;
+}
+
+auto CachedDateTimeFormatter::max_size() const noexcept -> std::size_t
+{
+    return m_formatter.max_size();
+}
+
+void CachedDateTimeFormatter::render_second(const std::chrono::system_clock::time_point& tp)
+{
+    using Kind = DateTimeFormatter::Kind;
+
+    m_zone_generation = TimeZone::local_generation();
+    const auto fields = DateTimeFormatter::break_down(tp, m_formatter.m_zone);
+    const char* pattern = m_formatter.m_pattern.data();
+    char* out = m_cache.data();
+
+    m_fractions.clear();
+
+    for (const auto& token: m_formatter.m_tokens)
+    {
+        if (token.kind == Kind::Fraction)
+        {
+            m_fractions.push_back({static_cast<std::uint32_t>(out - m_cache.data()), token.width});
+        }
+        out += DateTimeFormatter::render_token(token, pattern, fields, out);
+    }
+
+    m_cache_length = static_cast<std::size_t>(out - m_cache.data());
+    m_cached_second = fields.epoch_seconds;
+    m_valid = true;
+}
+
+}  // namespace CommonLib
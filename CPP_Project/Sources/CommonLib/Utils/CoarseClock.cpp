@@ -0,0 +1,83 @@
+#include "CommonLib/Utils/CoarseClock.h"
+
+#include <ctime>
+
+namespace CommonLib
+{
+
+namespace
+{
+#if defined(CLOCK_MONOTONIC_COARSE) && defined(CLOCK_REALTIME_COARSE)
+auto read(clockid_t clock) noexcept -> std::int64_t
+{
+    timespec ts{};
+    clock_gettime(clock, &ts);
+    return static_cast<std::int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+auto resolution_of(clockid_t clock) noexcept -> std::int64_t
+{
+    timespec ts{};
+    clock_getres(clock, &ts);
+    return static_cast<std::int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+#else
+template<typename Clock>
+auto read() noexcept -> std::int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+        .count();
+}
+
+template<typename Clock>
+auto resolution_of() noexcept -> std::int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(typename Clock::duration(1))
+        .count();
+}
+#endif
+}  // namespace
+
+#if defined(CLOCK_MONOTONIC_COARSE) && defined(CLOCK_REALTIME_COARSE)
+auto CoarseSteadyClock::now() noexcept -> time_point
+{
+    return time_point(duration(read(CLOCK_MONOTONIC_COARSE)));
+}
+
+auto CoarseSteadyClock::resolution() noexcept -> duration
+{
+    return duration(resolution_of(CLOCK_MONOTONIC_COARSE));
+}
+
+auto CoarseSystemClock::now() noexcept -> time_point
+{
+    return time_point(duration(read(CLOCK_REALTIME_COARSE)));
+}
+
+auto CoarseSystemClock::resolution() noexcept -> duration
+{
+    return duration(resolution_of(CLOCK_REALTIME_COARSE));
+}
+#else
+auto CoarseSteadyClock::now() noexcept -> time_point
+{
+    return time_point(duration(read<std::chrono::steady_clock>()));
+}
+
+auto CoarseSteadyClock::resolution() noexcept -> duration
+{
+    return duration(resolution_of<std::chrono::steady_clock>());
+}
+
+auto CoarseSystemClock::now() noexcept -> time_point
+{
+    return time_point(duration(read<std::chrono::system_clock>()));
+}
+
+auto CoarseSystemClock::resolution() noexcept -> duration
+{
+    return duration(resolution_of<std::chrono::system_clock>());
+}
+#endif
+
+}  // namespace CommonLib
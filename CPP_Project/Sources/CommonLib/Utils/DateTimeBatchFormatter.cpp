@@ -0,0 +1,483 @@
+#include "CommonLib/Utils/DateTimeBatchFormatter.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "CommonLib/Private/Simd.h"
+#include "CommonLib/Utils/CivilTime.h"
+
+namespace CommonLib
+{
+
+namespace
+{
+using Format = DateTimeBatchFormatter::Format;
+
+constexpr std::uint32_t k_fraction_divisor[] = {1000000000, 100000000, 10000000, 1000000, 100000,
+                                                10000,      1000,      100,      10,      1};
+
+constexpr auto make_digit_pairs() -> std::array<char, 200>
+{
+    std::array<char, 200> pairs{};
+    for (int i = 0; i < 100; ++i)
+    {
+        pairs[static_cast<std::size_t>(i) * 2] = static_cast<char>('0' + i / 10);
+        pairs[static_cast<std::size_t>(i) * 2 + 1] = static_cast<char>('0' + i % 10);
+    }
+    return pairs;
+}
+
+constexpr std::array<char, 200> k_digit_pairs = make_digit_pairs();
+
+void write_2digits(char* out, std::uint32_t value) noexcept
+{
+    std::memcpy(out, &k_digit_pairs[static_cast<std::size_t>(value) * 2], 2);
+}
+
+/**
+ * @brief The UTC fields of one element; the year is always 1677 - 2262 for int64 nanoseconds.
+ */
+struct Fields {
+        char date[8] = {};  ///< "YYYYMMDD"
+        std::uint32_t second_of_day = 0;
+        std::uint32_t nanosecond = 0;
+};
+
+/**
+ * @brief Breaks timestamps down into fields, reusing the date of the previous call.
+ *
+ * Exported columns are usually sorted, so most neighbours share their day and the
+ * civil_from_days() conversion and the date digits are computed once per day instead of once
+ * per element.
+ */
+class FieldCache
+{
+    public:
+        auto break_down(std::int64_t nanoseconds) noexcept -> Fields
+        {
+            std::int64_t seconds = nanoseconds / 1000000000;
+            std::int64_t nanosecond = nanoseconds - seconds * 1000000000;
+            if (nanosecond < 0)
+            {
+                --seconds;
+                nanosecond += 1000000000;
+            }
+            std::int64_t days = seconds / CivilTime::k_seconds_per_day;
+            std::int64_t second_of_day = seconds - days * CivilTime::k_seconds_per_day;
+            if (second_of_day < 0)
+            {
+                --days;
+                second_of_day += CivilTime::k_seconds_per_day;
+            }
+
+            if (days != m_days)
+            {
+                const CivilDate date = CivilTime::civil_from_days(days);
+                const auto year = static_cast<std::uint32_t>(date.year);
+                write_2digits(m_date, year / 100);
+                write_2digits(m_date + 2, year % 100);
+                write_2digits(m_date + 4, date.month);
+                write_2digits(m_date + 6, date.day);
+                m_days = days;
+            }
+
+            Fields fields;
+            std::memcpy(fields.date, m_date, sizeof(m_date));
+            fields.second_of_day = static_cast<std::uint32_t>(second_of_day);
+            fields.nanosecond = static_cast<std::uint32_t>(nanosecond);
+            return fields;
+        }
+
+    private:
+        std::int64_t m_days = std::numeric_limits<std::int64_t>::min();
+        char m_date[8] = {};
+};
+
+/**
+ * @brief The state of one format_many() call, shared by the per-ISA loops.
+ */
+template<typename Input>
+struct Batch {
+        const Input& input;
+        std::size_t count = 0;
+        const Format& format;
+        std::string_view separator;
+        char* out = nullptr;
+        char* end = nullptr;
+        std::size_t index = 0;
+        std::size_t width = 0;
+        FieldCache cache;
+
+        void write_separator() noexcept
+        {
+            if (index == 0)
+            {
+                return;
+            }
+            if (separator.size() == 1)
+            {
+                *out++ = separator.front();
+            }
+            else
+            {
+                std::memcpy(out, separator.data(), separator.size());
+                out += separator.size();
+            }
+        }
+};
+
+void render_scalar(const Fields& fields, const Format& format, char* out) noexcept
+{
+    std::memcpy(out, fields.date, 4);
+    out[4] = '-';
+    std::memcpy(out + 5, fields.date + 4, 2);
+    out[7] = '-';
+    std::memcpy(out + 8, fields.date + 6, 2);
+    out[10] = 'T';
+    write_2digits(out + 11, fields.second_of_day / 3600);
+    out[13] = ':';
+    write_2digits(out + 14, fields.second_of_day / 60 % 60);
+    out[16] = ':';
+    write_2digits(out + 17, fields.second_of_day % 60);
+
+    if (format.fraction_digits != 0)
+    {
+        out[19] = '.';
+        std::uint32_t fraction = fields.nanosecond / k_fraction_divisor[format.fraction_digits];
+        for (std::size_t i = format.fraction_digits; i > 0; --i)
+        {
+            out[19 + i] = static_cast<char>('0' + fraction % 10);
+            fraction /= 10;
+        }
+    }
+    if (format.utc_suffix)
+    {
+        out[format.width() - 1] = 'Z';
+    }
+}
+
+template<typename B>
+void run_scalar(B& batch) noexcept
+{
+    for (; batch.index < batch.count; ++batch.index)
+    {
+        batch.write_separator();
+        render_scalar(batch.cache.break_down(batch.input(batch.index)), batch.format, batch.out);
+        batch.out += batch.width;
+    }
+}
+
+#if COMMONLIB_SIMD_X86
+constexpr char k_zero = static_cast<char>(0x80);
+constexpr std::size_t k_chunk = 64;
+
+/**
+ * @brief The shuffle and the constant characters that turn the digit vector into an element.
+ *
+ * The low lane holds "YYYYMMDD" and the digits of hh and mm and becomes "YYYY-MM-DDThh:mm";
+ * the high lane holds the digits of ss and of the nine fraction digits and becomes
+ * ":ss[.f...][Z]". Positions taken from the constants are zeroed by the shuffle.
+ */
+struct Layout {
+        alignas(32) char shuffle[32] = {};
+        alignas(32) char constants[32] = {};
+
+        explicit Layout(const Format& format) noexcept
+        {
+            constexpr char k_date_time[16] = {0, 1, 2,      3, k_zero, 4,  5,      k_zero,
+                                              6, 7, k_zero, 8, 9,      k_zero, 10, 11};
+            for (std::size_t i = 0; i < 16; ++i)
+            {
+                shuffle[i] = k_date_time[i];
+                shuffle[16 + i] = k_zero;
+            }
+            constants[4] = '-';
+            constants[7] = '-';
+            constants[10] = 'T';
+            constants[13] = ':';
+
+            constants[16] = ':';
+            shuffle[17] = 0;
+            shuffle[18] = 1;
+            std::size_t position = 19;
+            if (format.fraction_digits != 0)
+            {
+                constants[position++] = '.';
+                for (std::size_t i = 0; i < format.fraction_digits; ++i)
+                {
+                    shuffle[position++] = static_cast<char>(2 + i);
+                }
+            }
+            if (format.utc_suffix)
+            {
+                constants[position] = 'Z';
+            }
+        }
+};
+
+/**
+ * @brief A chunk of fields in structure-of-arrays form, eight elements per vector.
+ */
+struct Columns {
+        alignas(32) std::uint32_t date_low[k_chunk] = {};   ///< "YYYY"
+        alignas(32) std::uint32_t date_high[k_chunk] = {};  ///< "MMDD"
+        alignas(32) std::uint32_t second_of_day[k_chunk] = {};
+        alignas(32) std::uint32_t nanosecond[k_chunk] = {};
+};
+
+/**
+ * @brief Divides eight values by a constant as (value * multiplier) >> shift.
+ *
+ * The multipliers below are exact for the value ranges they are used with.
+ */
+COMMONLIB_TARGET("avx2")
+inline auto divide(__m256i value, std::uint32_t multiplier, int shift) noexcept -> __m256i
+{
+    const __m256i factor = _mm256_set1_epi32(static_cast<int>(multiplier));
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    const __m256i even = _mm256_srl_epi64(_mm256_mul_epu32(value, factor), count);
+    const __m256i odd =
+        _mm256_srl_epi64(_mm256_mul_epu32(_mm256_srli_epi64(value, 32), factor), count);
+    return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0b10101010);
+}
+
+COMMONLIB_TARGET("avx2")
+inline auto load(const std::uint32_t* column) noexcept -> __m256i
+{
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(column));
+}
+
+COMMONLIB_TARGET("avx2")
+inline auto multiply(__m256i value, std::uint32_t factor) noexcept -> __m256i
+{
+    return _mm256_mullo_epi32(value, _mm256_set1_epi32(static_cast<int>(factor)));
+}
+
+/**
+ * @brief Combines two vectors of values below 100 into 16-bit lanes and converts every lane
+ *        into two ASCII digits.
+ */
+COMMONLIB_TARGET("avx2")
+inline auto to_digits(__m256i low, __m256i high) noexcept -> __m256i
+{
+    // tens = value * 6554 >> 16 is exact below 100.
+    const __m256i values = _mm256_or_si256(low, _mm256_slli_epi32(high, 16));
+    const __m256i tens = _mm256_mulhi_epu16(values, _mm256_set1_epi16(6554));
+    const __m256i ones = _mm256_sub_epi16(values, _mm256_mullo_epi16(tens, _mm256_set1_epi16(10)));
+    return _mm256_add_epi8(_mm256_or_si256(tens, _mm256_slli_epi16(ones, 8)),
+                           _mm256_set1_epi8('0'));
+}
+
+/**
+ * @brief Transposes the 4x4 blocks of 32-bit values in each 128-bit lane.
+ */
+COMMONLIB_TARGET("avx2")
+inline void transpose(__m256i& a, __m256i& b, __m256i& c, __m256i& d) noexcept
+{
+    const __m256i ab_low = _mm256_unpacklo_epi32(a, b);
+    const __m256i cd_low = _mm256_unpacklo_epi32(c, d);
+    const __m256i ab_high = _mm256_unpackhi_epi32(a, b);
+    const __m256i cd_high = _mm256_unpackhi_epi32(c, d);
+    a = _mm256_unpacklo_epi64(ab_low, cd_low);
+    b = _mm256_unpackhi_epi64(ab_low, cd_low);
+    c = _mm256_unpacklo_epi64(ab_high, cd_high);
+    d = _mm256_unpackhi_epi64(ab_high, cd_high);
+}
+
+/**
+ * @brief Renders columns[0, count) with AVX2 while the 32 byte stores stay inside the batch.
+ * @return The number of elements rendered.
+ *
+ * Eight elements are converted at a time: the time of day and the fraction are split into two
+ * digit values with multiply-shift divisions, converted to ASCII, and transposed so that every
+ * element ends up in one vector that a single shuffle turns into its text.
+ */
+template<typename B>
+COMMONLIB_TARGET("avx2")
+auto render_chunk_avx2(B& batch, const Layout& layout, const Columns& columns,
+                       std::size_t count) noexcept -> std::size_t
+{
+    const __m256i shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.shuffle));
+    const __m256i constants =
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.constants));
+    const bool fraction = batch.format.fraction_digits != 0;
+    const std::size_t stride = batch.width + batch.separator.size();
+
+    for (std::size_t group = 0; group < count; group += 8)
+    {
+        const std::size_t valid = std::min<std::size_t>(8, count - group);
+        if (static_cast<std::size_t>(batch.end - batch.out) < valid * stride + sizeof(__m256i))
+        {
+            return group;
+        }
+
+        const __m256i second_of_day = load(columns.second_of_day + group);
+        const __m256i hours = divide(second_of_day, 37283, 27);
+        const __m256i second_of_hour = _mm256_sub_epi32(second_of_day, multiply(hours, 3600));
+        const __m256i minutes = divide(second_of_hour, 2185, 17);
+        const __m256i seconds = _mm256_sub_epi32(second_of_hour, multiply(minutes, 60));
+
+        __m256i fraction_01 = _mm256_setzero_si256();
+        __m256i fraction_23 = _mm256_setzero_si256();
+        __m256i fraction_45 = _mm256_setzero_si256();
+        if (fraction)
+        {
+            __m256i rest = load(columns.nanosecond + group);
+            const __m256i f0 = divide(rest, 1801439851, 54);
+            rest = _mm256_sub_epi32(rest, multiply(f0, 10000000));
+            const __m256i f1 = divide(rest, 21990233, 41);
+            rest = _mm256_sub_epi32(rest, multiply(f1, 100000));
+            const __m256i f2 = divide(rest, 134218, 27);
+            rest = _mm256_sub_epi32(rest, multiply(f2, 1000));
+            const __m256i f3 = divide(rest, 1639, 14);
+            const __m256i f4 = multiply(_mm256_sub_epi32(rest, multiply(f3, 10)), 10);
+            fraction_01 = to_digits(seconds, f0);
+            fraction_23 = to_digits(f1, f2);
+            fraction_45 = to_digits(f3, f4);
+        }
+        else
+        {
+            fraction_01 = to_digits(seconds, _mm256_setzero_si256());
+        }
+
+        __m256i date_low = load(columns.date_low + group);
+        __m256i date_high = load(columns.date_high + group);
+        __m256i time = to_digits(hours, minutes);
+        __m256i unused_low = _mm256_setzero_si256();
+        __m256i unused_high = _mm256_setzero_si256();
+        transpose(date_low, date_high, time, unused_low);
+        transpose(fraction_01, fraction_23, fraction_45, unused_high);
+
+        // After the transposes row k holds element k in its low and element k + 4 in its high
+        // lane.
+        const __m256i low[4] = {date_low, date_high, time, unused_low};
+        const __m256i high[4] = {fraction_01, fraction_23, fraction_45, unused_high};
+        for (std::size_t i = 0; i < valid; ++i)
+        {
+            const std::size_t row = i % 4;
+            const __m256i element = i < 4 ? _mm256_permute2x128_si256(low[row], high[row], 0x20)
+                                          : _mm256_permute2x128_si256(low[row], high[row], 0x31);
+            batch.write_separator();
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(batch.out),
+                                _mm256_or_si256(_mm256_shuffle_epi8(element, shuffle), constants));
+            batch.out += batch.width;
+            ++batch.index;
+        }
+    }
+    return count;
+}
+
+// The calendar arithmetic runs in a separate scalar pass over a chunk, so that the vector loop
+// makes no calls and the SSE/AVX state switches once per chunk rather than once per element.
+template<typename B>
+void run_avx2(B& batch) noexcept
+{
+    const Layout layout(batch.format);
+    Columns columns;
+
+    while (batch.index < batch.count)
+    {
+        const std::size_t count = std::min(k_chunk, batch.count - batch.index);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Fields fields = batch.cache.break_down(batch.input(batch.index + i));
+            std::memcpy(&columns.date_low[i], fields.date, 4);
+            std::memcpy(&columns.date_high[i], fields.date + 4, 4);
+            columns.second_of_day[i] = fields.second_of_day;
+            columns.nanosecond[i] = fields.nanosecond;
+        }
+        if (render_chunk_avx2(batch, layout, columns, count) < count)
+        {
+            return;  // The scalar loop renders the last few elements.
+        }
+    }
+}
+#endif
+
+template<typename Input>
+auto run(std::size_t count, const Input& input, const Format& format, std::span<char> buffer,
+         std::string_view separator, SimdLevel level) -> std::size_t
+{
+    if (format.fraction_digits > 9)
+    {
+        throw std::invalid_argument(
+            "DateTimeBatchFormatter: at most 9 fraction digits are supported");
+    }
+    const std::size_t size = DateTimeBatchFormatter::required_size(count, format, separator);
+    if (buffer.size() < size)
+    {
+        throw std::invalid_argument("DateTimeBatchFormatter: buffer is smaller than required");
+    }
+
+    // Characters past the batch are never written, not even by the vector stores.
+    char* const out = buffer.data();
+    Batch<Input> batch{input, count, format, separator, out, out + size, 0, format.width(), {}};
+#if COMMONLIB_SIMD_X86
+    if (level >= SimdLevel::Avx2 && CpuFeatures::has_avx2())
+    {
+        run_avx2(batch);
+    }
+#else
+    static_cast<void>(level);
+#endif
+    run_scalar(batch);
+    return size;
+}
+
+auto nanoseconds_of(std::span<const std::chrono::system_clock::time_point> time_points)
+{
+    return [time_points](std::size_t index) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   time_points[index].time_since_epoch())
+            .count();
+    };
+}
+}  // namespace
+
+auto DateTimeBatchFormatter::required_size(std::size_t count, const Format& format,
+                                           std::string_view separator) noexcept -> std::size_t
+{
+    return count == 0 ? 0 : count * format.width() + (count - 1) * separator.size();
+}
+
+auto DateTimeBatchFormatter::format_many(std::span<const std::int64_t> epoch_nanoseconds,
+                                         const Format& format, std::span<char> buffer,
+                                         std::string_view separator, SimdLevel level)
+    -> std::size_t
+{
+    return run(
+        epoch_nanoseconds.size(),
+        [epoch_nanoseconds](std::size_t index) { return epoch_nanoseconds[index]; }, format,
+        buffer, separator, level);
+}
+
+auto DateTimeBatchFormatter::format_many(
+    std::span<const std::chrono::system_clock::time_point> time_points, const Format& format,
+    std::span<char> buffer, std::string_view separator, SimdLevel level) -> std::size_t
+{
+    return run(time_points.size(), nanoseconds_of(time_points), format, buffer, separator,
+               level);
+}
+
+auto DateTimeBatchFormatter::format_many(std::span<const std::int64_t> epoch_nanoseconds,
+                                         const Format& format, std::string_view separator)
+    -> std::string
+{
+    std::string result(required_size(epoch_nanoseconds.size(), format, separator), '\0');
+    format_many(epoch_nanoseconds, format, std::span<char>(result), separator);
+    return result;
+}
+
+auto DateTimeBatchFormatter::format_many(
+    std::span<const std::chrono::system_clock::time_point> time_points, const Format& format,
+    std::string_view separator) -> std::string
+{
+    std::string result(required_size(time_points.size(), format, separator), '\0');
+    format_many(time_points, format, std::span<char>(result), separator);
+    return result;
+}
+
+}  // namespace CommonLib
@@ -0,0 +1,392 @@
+#include "CommonLib/Utils/DateTimeBatchParser.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "CommonLib/Private/Simd.h"
+#include "CommonLib/Utils/CivilTime.h"
+
+namespace CommonLib
+{
+
+namespace
+{
+using Status = DateTimeBatchParser::Status;
+using Format = DateTimeBatchParser::Format;
+
+// Keep one second of headroom so that adding the fraction can never overflow.
+constexpr std::int64_t k_max_seconds = 9223372035;
+constexpr std::int64_t k_min_seconds = -9223372035;
+
+constexpr std::int64_t k_fraction_scale[] = {1000000000, 100000000, 10000000, 1000000, 100000,
+                                             10000,      1000,      100,      10,      1};
+
+/**
+ * @brief The fields of the "YYYY-MM-DDThh:mm" prefix every element starts with.
+ */
+struct Prefix {
+        std::uint32_t year = 0;
+        std::uint32_t month = 0;
+        std::uint32_t day = 0;
+        std::uint32_t hour = 0;
+        std::uint32_t minute = 0;
+};
+
+constexpr auto is_digit(char c) noexcept -> bool
+{
+    return c >= '0' && c <= '9';
+}
+
+constexpr auto digit(char c) noexcept -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(c - '0');
+}
+
+constexpr auto is_date_time_separator(char c) noexcept -> bool
+{
+    return c == 'T' || c == 't' || c == ' ';
+}
+
+auto prefix_scalar(const char* text, Prefix& prefix) noexcept -> bool
+{
+    for (int position: {0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15})
+    {
+        if (!is_digit(text[position]))
+        {
+            return false;
+        }
+    }
+
+    prefix.year = digit(text[0]) * 1000 + digit(text[1]) * 100 + digit(text[2]) * 10 +
+                  digit(text[3]);
+    prefix.month = digit(text[5]) * 10 + digit(text[6]);
+    prefix.day = digit(text[8]) * 10 + digit(text[9]);
+    prefix.hour = digit(text[11]) * 10 + digit(text[12]);
+    prefix.minute = digit(text[14]) * 10 + digit(text[15]);
+    return text[4] == '-' && text[7] == '-' && is_date_time_separator(text[10]) && text[13] == ':';
+}
+
+#if COMMONLIB_SIMD_X86
+// Bits of the movemask that must be digits or separators in "YYYY-MM-DDThh:mm".
+constexpr int k_digit_mask = 0b1101101101101111;
+constexpr int k_separator_mask = 0b0010000010010000;
+
+// Expected separators, the positions of the twelve digits and the weights that pair them.
+alignas(16) constexpr char k_separators[16] = {'0', '0', '0', '0', '-', '0', '0', '-',
+                                               '0', '0', 'T', '0', '0', ':', '0', '0'};
+alignas(16) constexpr char k_gather[16] = {0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, -1, -1, -1, -1};
+alignas(16) constexpr char k_weights[16] = {10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 0, 0, 0, 0};
+
+auto as_vector(const char* constant) noexcept -> const __m128i*
+{
+    return reinterpret_cast<const __m128i*>(constant);
+}
+
+void store_prefix(const std::uint16_t* pairs, Prefix& prefix) noexcept
+{
+    prefix.year = pairs[0] * 100U + pairs[1];
+    prefix.month = pairs[2];
+    prefix.day = pairs[3];
+    prefix.hour = pairs[4];
+    prefix.minute = pairs[5];
+}
+
+COMMONLIB_TARGET("ssse3")
+auto prefix_ssse3(const char* text, Prefix& prefix) noexcept -> bool
+{
+    const __m128i separators = _mm_load_si128(as_vector(k_separators));
+    const __m128i gather = _mm_load_si128(as_vector(k_gather));
+    const __m128i weights = _mm_load_si128(as_vector(k_weights));
+
+    const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text));
+    const __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    const __m128i digit_lanes = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+    const int valid = (_mm_movemask_epi8(digit_lanes) & k_digit_mask) |
+                      (_mm_movemask_epi8(_mm_cmpeq_epi8(chars, separators)) & k_separator_mask);
+
+    // Multiply-add neighbouring digits into the two digit values YY, YY, MM, DD, hh, mm.
+    alignas(16) std::uint16_t pairs[8];
+    _mm_store_si128(reinterpret_cast<__m128i*>(pairs),
+                    _mm_maddubs_epi16(_mm_shuffle_epi8(digits, gather), weights));
+    store_prefix(pairs, prefix);
+
+    return valid == (k_digit_mask | k_separator_mask) && is_date_time_separator(text[10]);
+}
+
+/**
+ * @brief Converts the prefixes of two elements at once, one per 128-bit lane.
+ * @return Bit 0 set if the first prefix is valid, bit 1 if the second one is.
+ */
+COMMONLIB_TARGET("avx2")
+auto prefix_avx2(const char* first, const char* second, Prefix& first_prefix,
+                 Prefix& second_prefix) noexcept -> unsigned
+{
+    const __m256i separators =
+        _mm256_broadcastsi128_si256(_mm_load_si128(as_vector(k_separators)));
+    const __m256i gather = _mm256_broadcastsi128_si256(_mm_load_si128(as_vector(k_gather)));
+    const __m256i weights = _mm256_broadcastsi128_si256(_mm_load_si128(as_vector(k_weights)));
+
+    const __m256i chars = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(second)), 1);
+    const __m256i digits = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    const __m256i digit_lanes =
+        _mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+    const auto digit_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(digit_lanes));
+    const auto separator_bits =
+        static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, separators)));
+
+    alignas(32) std::uint16_t pairs[16];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(pairs),
+                       _mm256_maddubs_epi16(_mm256_shuffle_epi8(digits, gather), weights));
+    store_prefix(pairs, first_prefix);
+    store_prefix(pairs + 8, second_prefix);
+
+    constexpr std::uint32_t k_expected = k_digit_mask | k_separator_mask;
+    const std::uint32_t valid = (digit_bits & (k_digit_mask * 0x10001U)) |
+                                (separator_bits & (k_separator_mask * 0x10001U));
+    return ((valid & 0xFFFFU) == k_expected && is_date_time_separator(first[10]) ? 1U : 0U) |
+           ((valid >> 16) == k_expected && is_date_time_separator(second[10]) ? 2U : 0U);
+}
+#endif
+
+/**
+ * @brief Parses the seconds, fraction and suffix and validates and converts all fields.
+ */
+auto finish(const char* text, const Format& format, const Prefix& prefix,
+            std::int64_t& nanoseconds) noexcept -> Status
+{
+    if (text[16] != ':' || !is_digit(text[17]) || !is_digit(text[18]))
+    {
+        return Status::InvalidSyntax;
+    }
+    const std::uint32_t second = digit(text[17]) * 10 + digit(text[18]);
+
+    std::int64_t fraction = 0;
+    if (format.fraction_digits != 0)
+    {
+        if (text[19] != '.')
+        {
+            return Status::InvalidSyntax;
+        }
+        for (std::size_t i = 0; i < format.fraction_digits; ++i)
+        {
+            const char c = text[20 + i];
+            if (!is_digit(c))
+            {
+                return Status::InvalidSyntax;
+            }
+            fraction = fraction * 10 + digit(c);
+        }
+        fraction *= k_fraction_scale[format.fraction_digits];
+    }
+
+    if (format.utc_suffix && text[format.width() - 1] != 'Z' && text[format.width() - 1] != 'z')
+    {
+        return Status::InvalidSyntax;
+    }
+
+    const auto year = static_cast<std::int32_t>(prefix.year);
+    if (prefix.month < 1 || prefix.month > 12 || prefix.day < 1 ||
+        prefix.day > CivilTime::days_in_month(year, prefix.month))
+    {
+        return Status::InvalidDate;
+    }
+    if (prefix.hour > 23 || prefix.minute > 59 || second > 60)
+    {
+        return Status::InvalidTime;
+    }
+
+    const std::int64_t seconds =
+        CivilTime::days_from_civil(year, prefix.month, prefix.day) * CivilTime::k_seconds_per_day +
+        prefix.hour * 3600 + prefix.minute * 60 + second;
+    if (seconds > k_max_seconds || seconds < k_min_seconds)
+    {
+        return Status::OutOfRange;
+    }
+
+    nanoseconds = seconds * 1000000000 + fraction;
+    return Status::Ok;
+}
+
+/**
+ * @brief The state of one parse() call, shared by the per-ISA loops.
+ */
+template<typename Input, typename Output>
+struct Batch {
+        const Input& input;
+        const Output& output;
+        const Format& format;
+        std::span<Status> status;
+        std::size_t width = 0;
+        std::size_t failures = 0;
+
+        void complete(std::size_t index, std::string_view text, const Prefix& prefix,
+                      bool prefix_valid) noexcept
+        {
+            std::int64_t value = 0;
+            Status result = Status::InvalidLength;
+            if (text.size() == width)
+            {
+                result = prefix_valid ? finish(text.data(), format, prefix, value)
+                                      : Status::InvalidSyntax;
+            }
+            if (result != Status::Ok)
+            {
+                value = 0;
+                ++failures;
+            }
+            output(index, value);
+            if (!status.empty())
+            {
+                status[index] = result;
+            }
+        }
+};
+
+// Each instruction set runs the whole loop in its own function, so that the kernels are inlined
+// instead of being called through a target boundary for every element.
+template<typename B>
+void run_scalar(B& batch, std::size_t index, std::size_t count) noexcept
+{
+    for (; index < count; ++index)
+    {
+        const std::string_view text = batch.input(index);
+        Prefix prefix;
+        const bool valid = text.size() == batch.width && prefix_scalar(text.data(), prefix);
+        batch.complete(index, text, prefix, valid);
+    }
+}
+
+#if COMMONLIB_SIMD_X86
+template<typename B>
+COMMONLIB_TARGET("ssse3")
+void run_ssse3(B& batch, std::size_t index, std::size_t count) noexcept
+{
+    for (; index < count; ++index)
+    {
+        const std::string_view text = batch.input(index);
+        Prefix prefix;
+        const bool valid = text.size() == batch.width && prefix_ssse3(text.data(), prefix);
+        batch.complete(index, text, prefix, valid);
+    }
+}
+
+template<typename B>
+COMMONLIB_TARGET("avx2")
+void run_avx2(B& batch, std::size_t count) noexcept
+{
+    std::size_t index = 0;
+    for (; index + 1 < count; index += 2)
+    {
+        const std::string_view first = batch.input(index);
+        const std::string_view second = batch.input(index + 1);
+        Prefix first_prefix;
+        Prefix second_prefix;
+        unsigned valid = 0;
+
+        if (first.size() == batch.width && second.size() == batch.width)
+        {
+            valid = prefix_avx2(first.data(), second.data(), first_prefix, second_prefix);
+        }
+        else
+        {
+            const bool first_valid =
+                first.size() == batch.width && prefix_ssse3(first.data(), first_prefix);
+            const bool second_valid =
+                second.size() == batch.width && prefix_ssse3(second.data(), second_prefix);
+            valid = (first_valid ? 1U : 0U) | (second_valid ? 2U : 0U);
+        }
+        batch.complete(index, first, first_prefix, (valid & 1U) != 0);
+        batch.complete(index + 1, second, second_prefix, (valid & 2U) != 0);
+    }
+    run_ssse3(batch, index, count);
+}
+#endif
+
+template<typename Input, typename Output>
+auto run(std::size_t count, const Input& input, const Format& format, const Output& output,
+         std::span<Status> status, SimdLevel level) -> std::size_t
+{
+    if (format.fraction_digits > 9)
+    {
+        throw std::invalid_argument("DateTimeBatchParser: at most 9 fraction digits are supported");
+    }
+    if (!status.empty() && status.size() < count)
+    {
+        throw std::invalid_argument("DateTimeBatchParser: status span is smaller than the input");
+    }
+    if (!CpuFeatures::supports(level))
+    {
+        level = std::min(level, CpuFeatures::simd_level());
+    }
+
+    Batch<Input, Output> batch{input, output, format, status, format.width()};
+    switch (level)
+    {
+#if COMMONLIB_SIMD_X86
+        case SimdLevel::Avx2:
+            run_avx2(batch, count);
+            break;
+        case SimdLevel::Ssse3:
+            run_ssse3(batch, 0, count);
+            break;
+#endif
+        default:
+            run_scalar(batch, 0, count);
+            break;
+    }
+    return batch.failures;
+}
+
+template<typename T>
+void require_output(std::span<T> output, std::size_t count)
+{
+    if (output.size() < count)
+    {
+        throw std::invalid_argument("DateTimeBatchParser: output span is smaller than the input");
+    }
+}
+}  // namespace
+
+auto DateTimeBatchParser::parse(std::span<const std::string_view> input, const Format& format,
+                                std::span<std::int64_t> epoch_nanoseconds,
+                                std::span<Status> status, SimdLevel level) -> std::size_t
+{
+    require_output(epoch_nanoseconds, input.size());
+    return run(
+        input.size(), [&](std::size_t index) { return input[index]; }, format,
+        [&](std::size_t index, std::int64_t value) { epoch_nanoseconds[index] = value; }, status,
+        level);
+}
+
+auto DateTimeBatchParser::parse(std::span<const std::string_view> input, const Format& format,
+                                std::span<TimePoint> time_points, std::span<Status> status,
+                                SimdLevel level) -> std::size_t
+{
+    require_output(time_points, input.size());
+    return run(
+        input.size(), [&](std::size_t index) { return input[index]; }, format,
+        [&](std::size_t index, std::int64_t value) {
+            time_points[index] = TimePoint(std::chrono::nanoseconds(value));
+        },
+        status, level);
+}
+
+auto DateTimeBatchParser::parse(std::string_view buffer, std::span<const std::size_t> offsets,
+                                const Format& format, std::span<std::int64_t> epoch_nanoseconds,
+                                std::span<Status> status, SimdLevel level) -> std::size_t
+{
+    require_output(epoch_nanoseconds, offsets.size());
+    const std::size_t width = format.width();
+    return run(
+        offsets.size(),
+        [&](std::size_t index) {
+            const std::size_t offset = std::min(offsets[index], buffer.size());
+            return buffer.substr(offset, width);
+        },
+        format, [&](std::size_t index, std::int64_t value) { epoch_nanoseconds[index] = value; },
+        status, level);
+}
+
+}  // namespace CommonLib
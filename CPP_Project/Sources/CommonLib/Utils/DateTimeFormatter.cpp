@@ -0,0 +1,686 @@
+#include "CommonLib/Utils/DateTimeFormatter.h"
+
+#include <cstring>
+
+#include "CommonLib/Utils/CivilTime.h"
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace CommonLib
+{
+
+namespace
+{
+constexpr std::array<std::string_view, 7> k_weekday_names = {
+    "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+
+constexpr std::array<std::string_view, 12> k_month_names = {
+    "January", "February", "March",     "April",   "May",      "June",
+    "July",    "August",   "September", "October", "November", "December"};
+
+constexpr auto make_digit_pairs() -> std::array<char, 200>
+{
+    std::array<char, 200> pairs{};
+    for (int i = 0; i < 100; ++i)
+    {
+        pairs[static_cast<std::size_t>(i) * 2] = static_cast<char>('0' + i / 10);
+        pairs[static_cast<std::size_t>(i) * 2 + 1] = static_cast<char>('0' + i % 10);
+    }
+    return pairs;
+}
+
+constexpr std::array<char, 200> k_digit_pairs = make_digit_pairs();
+
+auto write_2digits(char* out, int value) -> std::size_t
+{
+    std::memcpy(out, &k_digit_pairs[static_cast<std::size_t>(value) * 2], 2);
+    return 2;
+}
+
+auto write_4digits(char* out, int value) -> std::size_t
+{
+    write_2digits(out, value / 100);
+    write_2digits(out + 2, value % 100);
+    return 4;
+}
+
+auto write_integer(char* out, std::int64_t value) -> std::size_t
+{
+    std::array<char, 20> digits{};
+    std::size_t count = 0;
+    std::uint64_t magnitude =
+        value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+
+    do
+    {
+        digits[count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    std::size_t length = 0;
+    if (value < 0)
+    {
+        out[length++] = '-';
+    }
+    while (count > 0)
+    {
+        out[length++] = digits[--count];
+    }
+    return length;
+}
+
+auto write_text(char* out, std::string_view text) -> std::size_t
+{
+    std::memcpy(out, text.data(), text.size());
+    return text.size();
+}
+
+auto hour12(int hour) -> int
+{
+    const int result = hour % 12;
+    return result == 0 ? 12 : result;
+}
+
+auto fallback(const std::tm& tm, const char* spec, std::size_t spec_length, char* out)
+    -> std::size_t
+{
+    std::array<char, 16> spec_buffer{};
+    const auto length = std::min(spec_length, spec_buffer.size() - 1);
+    std::memcpy(spec_buffer.data(), spec, length);
+    return std::strftime(out, 128, spec_buffer.data(), &tm);
+}
+
+auto is_fast_year(const std::tm& tm) -> bool
+{
+    return tm.tm_year >= 1000 - 1900 && tm.tm_year <= 9999 - 1900;
+}
+}  // namespace
+
+DateTimeFormatter::DateTimeFormatter(std::string_view format, Zone zone)
+    : m_pattern(format), m_zone(zone)
+{
+    std::size_t pos = 0;
+    while (pos < m_pattern.size())
+    {
+        const Token token = next_token(m_pattern, pos);
+
+        if (token.kind == Kind::Literal && !m_tokens.empty() &&
+            m_tokens.back().kind == Kind::Literal &&
+            m_tokens.back().offset + m_tokens.back().length == token.offset)
+        {
+            m_tokens.back().length += token.length;
+        }
+        else
+        {
+            m_tokens.push_back(token);
+        }
+
+        m_max_size += token_max_size(token);
+    }
+}
+
+auto DateTimeFormatter::format_to(std::span<char> buffer,
+                                  const std::chrono::system_clock::time_point& tp) const
+    -> std::size_t
+{
+    if (buffer.size() < m_max_size)
+    {
+        return 0;
+    }
+
+    return render(break_down(tp, m_zone), buffer.data());
+}
+
+auto DateTimeFormatter::format(const std::chrono::system_clock::time_point& tp) const
+    -> std::string
+{
+    std::array<char, 256> stack_buffer{};
+
+    if (m_max_size <= stack_buffer.size())
+    {
+        const auto length = format_to(std::span<char>(stack_buffer), tp);
+        return {stack_buffer.data(), length};
+    }
+
+    std::string result(m_max_size, '\0');
+    result.resize(format_to(std::span<char>(result), tp));
+    return result;
+}
+
+auto DateTimeFormatter::format_to(std::span<char> buffer,
+                                  const std::chrono::system_clock::time_point& tp,
+                                  const TimeZone& zone) const -> std::size_t
+{
+    if (buffer.size() < m_max_size)
+    {
+        return 0;
+    }
+
+    return render(break_down(tp, zone), buffer.data());
+}
+
+auto DateTimeFormatter::format(const std::chrono::system_clock::time_point& tp,
+                               const TimeZone& zone) const -> std::string
+{
+    std::array<char, 256> stack_buffer{};
+
+    if (m_max_size <= stack_buffer.size())
+    {
+        const auto length = format_to(std::span<char>(stack_buffer), tp, zone);
+        return {stack_buffer.data(), length};
+    }
+
+    std::string result(m_max_size, '\0');
+    result.resize(format_to(std::span<char>(result), tp, zone));
+    return result;
+}
+
+auto DateTimeFormatter::max_size() const noexcept -> std::size_t
+{
+    return m_max_size;
+}
+
+auto DateTimeFormatter::pattern() const noexcept -> std::string_view
+{
+    return m_pattern;
+}
+
+auto DateTimeFormatter::zone() const noexcept -> Zone
+{
+    return m_zone;
+}
+
+auto DateTimeFormatter::format_to(std::span<char> buffer, std::string_view format,
+                                  const std::chrono::system_clock::time_point& tp, Zone zone)
+    -> std::size_t
+{
+    if (buffer.size() < max_size(format))
+    {
+        return 0;
+    }
+
+    return render(format, break_down(tp, zone), buffer.data());
+}
+
+auto DateTimeFormatter::format_to(std::span<char> buffer, std::string_view format,
+                                  const std::chrono::system_clock::time_point& tp,
+                                  const TimeZone& zone) -> std::size_t
+{
+    if (buffer.size() < max_size(format))
+    {
+        return 0;
+    }
+
+    return render(format, break_down(tp, zone), buffer.data());
+}
+
+auto DateTimeFormatter::max_size(std::string_view format) -> std::size_t
+{
+    std::size_t size = 0;
+    std::size_t pos = 0;
+
+    while (pos < format.size())
+    {
+        size += token_max_size(next_token(format, pos));
+    }
+
+    return size;
+}
+
+auto DateTimeFormatter::next_token(std::string_view format, std::size_t& pos) -> Token
+{
+    Token token;
+    token.offset = static_cast<std::uint32_t>(pos);
+
+    if (format[pos] != '%')
+    {
+        const auto end = format.find('%', pos);
+        token.length = static_cast<std::uint32_t>(
+            (end == std::string_view::npos ? format.size() : end) - pos);
+        pos += token.length;
+        return token;
+    }
+
+    // A trailing '%' has nothing to convert and is copied verbatim.
+    if (pos + 1 == format.size())
+    {
+        token.length = 1;
+        ++pos;
+        return token;
+    }
+
+    // %1N .. %9N selects the number of fraction digits.
+    if (format[pos + 1] >= '1' && format[pos + 1] <= '9' && pos + 2 < format.size() &&
+        format[pos + 2] == 'N')
+    {
+        token.kind = Kind::Fraction;
+        token.width = static_cast<std::uint8_t>(format[pos + 1] - '0');
+        token.length = 3;
+        pos += 3;
+        return token;
+    }
+
+    token.length = 2;
+
+    switch (format[pos + 1])
+    {
+    case '%':
+        token.kind = Kind::Percent;
+        break;
+    case 'n':
+        token.kind = Kind::Newline;
+        break;
+    case 't':
+        token.kind = Kind::Tab;
+        break;
+    case 'Y':
+        token.kind = Kind::Year;
+        break;
+    case 'y':
+        token.kind = Kind::YearShort;
+        break;
+    case 'C':
+        token.kind = Kind::Century;
+        break;
+    case 'm':
+        token.kind = Kind::Month;
+        break;
+    case 'd':
+        token.kind = Kind::Day;
+        break;
+    case 'e':
+        token.kind = Kind::DaySpacePadded;
+        break;
+    case 'H':
+        token.kind = Kind::Hour24;
+        break;
+    case 'I':
+        token.kind = Kind::Hour12;
+        break;
+    case 'M':
+        token.kind = Kind::Minute;
+        break;
+    case 'S':
+        token.kind = Kind::Second;
+        break;
+    case 'N':
+        token.kind = Kind::Fraction;
+        token.width = 9;
+        break;
+    case 'j':
+        token.kind = Kind::DayOfYear;
+        break;
+    case 'u':
+        token.kind = Kind::WeekdayIso;
+        break;
+    case 'w':
+        token.kind = Kind::Weekday;
+        break;
+    case 'A':
+        token.kind = Kind::WeekdayName;
+        break;
+    case 'a':
+        token.kind = Kind::WeekdayNameShort;
+        break;
+    case 'B':
+        token.kind = Kind::MonthName;
+        break;
+    case 'b':
+    case 'h':
+        token.kind = Kind::MonthNameShort;
+        break;
+    case 'p':
+        token.kind = Kind::AmPm;
+        break;
+#if !defined(_WIN32)
+    case 'z':
+        token.kind = Kind::UtcOffset;
+        break;
+    case 'Z':
+        token.kind = Kind::ZoneName;
+        break;
+#endif
+    case 's':
+        token.kind = Kind::EpochSeconds;
+        break;
+    case 'F':
+        token.kind = Kind::IsoDate;
+        break;
+    case 'T':
+        token.kind = Kind::IsoTime;
+        break;
+    case 'D':
+        token.kind = Kind::UsDate;
+        break;
+    case 'R':
+        token.kind = Kind::HourMinute;
+        break;
+    case 'r':
+        token.kind = Kind::Time12;
+        break;
+    default:
+        // Flags, E/O modifiers and locale dependent specifiers are left to strftime.
+        token.kind = Kind::Fallback;
+        while (pos + token.length < format.size() &&
+               std::strchr("_-^#EO0123456789", format[pos + token.length - 1]) != nullptr &&
+               token.length < 8)
+        {
+            ++token.length;
+        }
+        break;
+    }
+
+    pos += token.length;
+    return token;
+}
+
+auto DateTimeFormatter::token_max_size(const Token& token) noexcept -> std::size_t
+{
+    switch (token.kind)
+    {
+    case Kind::Literal:
+        return token.length;
+    case Kind::Percent:
+    case Kind::Newline:
+    case Kind::Tab:
+    case Kind::WeekdayIso:
+    case Kind::Weekday:
+        return 1;
+    case Kind::Month:
+    case Kind::Day:
+    case Kind::DaySpacePadded:
+    case Kind::Hour24:
+    case Kind::Hour12:
+    case Kind::Minute:
+    case Kind::Second:
+    case Kind::AmPm:
+        return 2;
+    case Kind::DayOfYear:
+    case Kind::WeekdayNameShort:
+    case Kind::MonthNameShort:
+        return 3;
+    case Kind::HourMinute:
+        return 5;
+    case Kind::UtcOffset:
+        return 6;
+    case Kind::IsoTime:
+        return 8;
+    case Kind::UsDate:
+        return 9;
+    case Kind::WeekdayName:
+    case Kind::MonthName:
+    case Kind::Fraction:
+        return 9;
+    case Kind::Time12:
+        return 11;
+    case Kind::Year:
+    case Kind::YearShort:
+    case Kind::Century:
+        return 12;
+    case Kind::IsoDate:
+        return 18;
+    case Kind::EpochSeconds:
+        return 20;
+    case Kind::ZoneName:
+        return 32;
+    case Kind::Fallback:
+        return k_max_token_size;
+    }
+    return k_max_token_size;
+}
+
+auto DateTimeFormatter::break_down(const std::chrono::system_clock::time_point& tp, Zone zone)
+    -> Fields
+{
+    Fields fields;
+    const auto seconds = std::chrono::floor<std::chrono::seconds>(tp);
+    fields.epoch_seconds = seconds.time_since_epoch().count();
+    fields.nanoseconds = static_cast<std::int32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(tp - seconds).count());
+
+    if (zone == Zone::Utc)
+    {
+        fields.tm = CivilTime::to_tm(CivilTime::from_unix_seconds(fields.epoch_seconds));
+        fields.zone_name = "GMT";
+#if !defined(_WIN32)
+        fields.tm.tm_zone = fields.zone_name;
+#endif
+    }
+    else if (const TimeZone* local_zone = TimeZone::local_cached())
+    {
+        return break_down(tp, *local_zone);
+    }
+    else
+    {
+        const auto time_c = static_cast<std::time_t>(fields.epoch_seconds);
+#if defined(_WIN32)
+        localtime_s(&fields.tm, &time_c);
+#else
+        localtime_r(&time_c, &fields.tm);
+        fields.utc_offset = static_cast<std::int32_t>(fields.tm.tm_gmtoff);
+        fields.zone_name = fields.tm.tm_zone != nullptr ? fields.tm.tm_zone : "";
+#endif
+    }
+
+    return fields;
+}
+
+auto DateTimeFormatter::break_down(const std::chrono::system_clock::time_point& tp,
+                                   const TimeZone& zone) -> Fields
+{
+    Fields fields;
+    const auto seconds = std::chrono::floor<std::chrono::seconds>(tp);
+    fields.epoch_seconds = seconds.time_since_epoch().count();
+    fields.nanoseconds = static_cast<std::int32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(tp - seconds).count());
+
+    const auto offset = zone.offset_at(fields.epoch_seconds);
+    fields.tm = CivilTime::to_tm(
+        CivilTime::from_unix_seconds(fields.epoch_seconds + offset.utc_offset));
+    fields.tm.tm_isdst = offset.is_dst ? 1 : 0;
+    fields.utc_offset = offset.utc_offset;
+    fields.zone_name = offset.abbreviation;
+#if !defined(_WIN32)
+    fields.tm.tm_gmtoff = offset.utc_offset;
+    fields.tm.tm_zone = offset.abbreviation;
+#endif
+
+    return fields;
+}
+
+auto DateTimeFormatter::render(const Fields& fields, char* out) const -> std::size_t
+{
+    char* const begin = out;
+
+    for (const auto& token: m_tokens)
+    {
+        if (token.kind == Kind::Literal)
+        {
+            std::memcpy(out, m_pattern.data() + token.offset, token.length);
+            out += token.length;
+        }
+        else
+        {
+            out += render_token(token, m_pattern.data(), fields, out);
+        }
+    }
+
+    return static_cast<std::size_t>(out - begin);
+}
+
+auto DateTimeFormatter::render(std::string_view format, const Fields& fields, char* out)
+    -> std::size_t
+{
+    char* const begin = out;
+    std::size_t pos = 0;
+
+    while (pos < format.size())
+    {
+        const Token token = next_token(format, pos);
+
+        if (token.kind == Kind::Literal)
+        {
+            std::memcpy(out, format.data() + token.offset, token.length);
+            out += token.length;
+        }
+        else
+        {
+            out += render_token(token, format.data(), fields, out);
+        }
+    }
+
+    return static_cast<std::size_t>(out - begin);
+}
+
+auto DateTimeFormatter::render_token(const Token& token, const char* pattern,
+                                     const Fields& fields, char* out) -> std::size_t
+{
+    const std::tm& tm = fields.tm;
+
+    switch (token.kind)
+    {
+    case Kind::Literal:
+        std::memcpy(out, pattern + token.offset, token.length);
+        return token.length;
+    case Kind::Percent:
+        *out = '%';
+        return 1;
+    case Kind::Newline:
+        *out = '\n';
+        return 1;
+    case Kind::Tab:
+        *out = '\t';
+        return 1;
+    case Kind::Year:
+        if (is_fast_year(tm))
+        {
+            return write_4digits(out, tm.tm_year + 1900);
+        }
+        return fallback(tm, "%Y", 2, out);
+    case Kind::YearShort:
+        if (is_fast_year(tm))
+        {
+            return write_2digits(out, (tm.tm_year + 1900) % 100);
+        }
+        return fallback(tm, "%y", 2, out);
+    case Kind::Century:
+        if (is_fast_year(tm))
+        {
+            return write_2digits(out, (tm.tm_year + 1900) / 100);
+        }
+        return fallback(tm, "%C", 2, out);
+    case Kind::Month:
+        return write_2digits(out, tm.tm_mon + 1);
+    case Kind::Day:
+        return write_2digits(out, tm.tm_mday);
+    case Kind::DaySpacePadded:
+        write_2digits(out, tm.tm_mday);
+        if (tm.tm_mday < 10)
+        {
+            out[0] = ' ';
+        }
+        return 2;
+    case Kind::Hour24:
+        return write_2digits(out, tm.tm_hour);
+    case Kind::Hour12:
+        return write_2digits(out, hour12(tm.tm_hour));
+    case Kind::Minute:
+        return write_2digits(out, tm.tm_min);
+    case Kind::Second:
+        return write_2digits(out, tm.tm_sec);
+    case Kind::Fraction:
+    {
+        std::array<char, 9> digits{};
+        int value = fields.nanoseconds;
+        for (int i = 8; i >= 0; --i)
+        {
+            digits[static_cast<std::size_t>(i)] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        std::memcpy(out, digits.data(), token.width);
+        return token.width;
+    }
+    case Kind::DayOfYear:
+        out[0] = static_cast<char>('0' + (tm.tm_yday + 1) / 100);
+        write_2digits(out + 1, (tm.tm_yday + 1) % 100);
+        return 3;
+    case Kind::WeekdayIso:
+        *out = static_cast<char>('0' + (tm.tm_wday == 0 ? 7 : tm.tm_wday));
+        return 1;
+    case Kind::Weekday:
+        *out = static_cast<char>('0' + tm.tm_wday);
+        return 1;
+    case Kind::WeekdayName:
+        return write_text(out, k_weekday_names[static_cast<std::size_t>(tm.tm_wday)]);
+    case Kind::WeekdayNameShort:
+        return write_text(out, k_weekday_names[static_cast<std::size_t>(tm.tm_wday)].substr(0, 3));
+    case Kind::MonthName:
+        return write_text(out, k_month_names[static_cast<std::size_t>(tm.tm_mon)]);
+    case Kind::MonthNameShort:
+        return write_text(out, k_month_names[static_cast<std::size_t>(tm.tm_mon)].substr(0, 3));
+    case Kind::AmPm:
+        return write_text(out, tm.tm_hour < 12 ? "AM" : "PM");
+    case Kind::UtcOffset:
+    {
+        const int offset_minutes = fields.utc_offset / 60;
+        const int magnitude = offset_minutes < 0 ? -offset_minutes : offset_minutes;
+        out[0] = offset_minutes < 0 ? '-' : '+';
+        write_2digits(out + 1, magnitude / 60);
+        write_2digits(out + 3, magnitude % 60);
+        return 5;
+    }
+    case Kind::ZoneName:
+        return write_text(out, std::string_view(fields.zone_name).substr(0, 32));
+    case Kind::EpochSeconds:
+        return write_integer(out, fields.epoch_seconds);
+    case Kind::IsoDate:
+    {
+        if (!is_fast_year(tm))
+        {
+            return fallback(tm, "%F", 2, out);
+        }
+        write_4digits(out, tm.tm_year + 1900);
+        out[4] = '-';
+        write_2digits(out + 5, tm.tm_mon + 1);
+        out[7] = '-';
+        write_2digits(out + 8, tm.tm_mday);
+        return 10;
+    }
+    case Kind::IsoTime:
+        write_2digits(out, tm.tm_hour);
+        out[2] = ':';
+        write_2digits(out + 3, tm.tm_min);
+        out[5] = ':';
+        write_2digits(out + 6, tm.tm_sec);
+        return 8;
+    case Kind::UsDate:
+        if (!is_fast_year(tm))
+        {
+            return fallback(tm, "%D", 2, out);
+        }
+        write_2digits(out, tm.tm_mon + 1);
+        out[2] = '/';
+        write_2digits(out + 3, tm.tm_mday);
+        out[5] = '/';
+        write_2digits(out + 6, (tm.tm_year + 1900) % 100);
+        return 8;
+    case Kind::HourMinute:
+        write_2digits(out, tm.tm_hour);
+        out[2] = ':';
+        write_2digits(out + 3, tm.tm_min);
+        return 5;
+    case Kind::Time12:
+        write_2digits(out, hour12(tm.tm_hour));
+        out[2] = ':';
+        write_2digits(out + 3, tm.tm_min);
+        out[5] = ':';
+        write_2digits(out + 6, tm.tm_sec);
+        out[8] = ' ';
+        write_text(out + 9, tm.tm_hour < 12 ? "AM" : "PM");
+        return 11;
+    case Kind::Fallback:
+        return fallback(tm, pattern + token.offset, token.length, out);
+    }
+    return 0;
+}
+
+}  // namespace CommonLib
@@ -0,0 +1,471 @@
+#include "CommonLib/Utils/DateTimeParser.h"
+
+#include <array>
+#include <optional>
+
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace CommonLib
+{
+
+namespace
+{
+using Error = DateTimeParser::Error;
+using Fields = DateTimeParser::Fields;
+
+// Keep one second of headroom so that adding the fraction can never overflow.
+constexpr std::int64_t k_max_seconds = 9223372035;
+constexpr std::int64_t k_min_seconds = -9223372035;
+
+constexpr std::array<std::string_view, 7> k_weekday_names = {"sun", "mon", "tue", "wed",
+                                                             "thu", "fri", "sat"};
+
+constexpr std::array<std::string_view, 12> k_month_names = {
+    "jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec"};
+
+constexpr auto is_digit(char c) noexcept -> bool
+{
+    return c >= '0' && c <= '9';
+}
+
+constexpr auto is_alpha(char c) noexcept -> bool
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+constexpr auto to_lower(char c) noexcept -> char
+{
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+/**
+ * @brief Cursor over the input that never reads past its end.
+ */
+class Cursor
+{
+    public:
+        constexpr explicit Cursor(std::string_view text) noexcept : m_text(text) {}
+
+        [[nodiscard]] constexpr auto done() const noexcept -> bool
+        {
+            return m_position == m_text.size();
+        }
+
+        [[nodiscard]] constexpr auto peek() const noexcept -> char
+        {
+            return done() ? '\0' : m_text[m_position];
+        }
+
+        constexpr auto consume(char c) noexcept -> bool
+        {
+            if (peek() != c)
+            {
+                return false;
+            }
+            ++m_position;
+            return true;
+        }
+
+        /**
+         * @brief Reads exactly count digits.
+         */
+        constexpr auto digits(std::size_t count, std::uint32_t& value) noexcept -> bool
+        {
+            if (m_text.size() - m_position < count)
+            {
+                return false;
+            }
+
+            value = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const char c = m_text[m_position + i];
+                if (!is_digit(c))
+                {
+                    return false;
+                }
+                value = value * 10 + static_cast<std::uint32_t>(c - '0');
+            }
+            m_position += count;
+            return true;
+        }
+
+        /**
+         * @brief Reads one or more fraction digits, truncated to nanoseconds.
+         */
+        constexpr auto fraction(std::uint32_t& nanoseconds) noexcept -> bool
+        {
+            std::uint32_t scale = 100000000;
+            const std::size_t begin = m_position;
+            nanoseconds = 0;
+
+            while (is_digit(peek()))
+            {
+                nanoseconds += static_cast<std::uint32_t>(peek() - '0') * scale;
+                scale /= 10;
+                ++m_position;
+            }
+            return m_position != begin;
+        }
+
+        /**
+         * @brief Reads a case-insensitive three letter name and returns its index in names.
+         */
+        template<std::size_t N>
+        constexpr auto name(const std::array<std::string_view, N>& names,
+                            std::uint32_t& index) noexcept -> bool
+        {
+            if (m_text.size() - m_position < 3)
+            {
+                return false;
+            }
+
+            const char word[] = {to_lower(m_text[m_position]), to_lower(m_text[m_position + 1]),
+                                 to_lower(m_text[m_position + 2])};
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (names[i] == std::string_view(word, 3))
+                {
+                    index = static_cast<std::uint32_t>(i);
+                    m_position += 3;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        constexpr auto word(std::string_view expected) noexcept -> bool
+        {
+            if (m_text.substr(m_position, expected.size()) != expected)
+            {
+                return false;
+            }
+            m_position += expected.size();
+            return true;
+        }
+
+    private:
+        std::string_view m_text;
+        std::size_t m_position = 0;
+};
+
+auto parse_date(Cursor& cursor, Fields& fields) noexcept -> std::optional<Error>
+{
+    std::uint32_t year = 0;
+    if (!cursor.digits(4, year) || !cursor.consume('-') || !cursor.digits(2, fields.civil.month) ||
+        !cursor.consume('-') || !cursor.digits(2, fields.civil.day))
+    {
+        return Error::InvalidSyntax;
+    }
+
+    fields.civil.year = static_cast<std::int32_t>(year);
+    if (fields.civil.month < 1 || fields.civil.month > 12 || fields.civil.day < 1 ||
+        fields.civil.day > CivilTime::days_in_month(fields.civil.year, fields.civil.month))
+    {
+        return Error::InvalidDate;
+    }
+    return std::nullopt;
+}
+
+auto parse_time(Cursor& cursor, Fields& fields, bool require_seconds) noexcept
+    -> std::optional<Error>
+{
+    CivilDateTime& civil = fields.civil;
+    if (!cursor.digits(2, civil.hour) || !cursor.consume(':') || !cursor.digits(2, civil.minute))
+    {
+        return Error::InvalidSyntax;
+    }
+
+    if (cursor.consume(':'))
+    {
+        if (!cursor.digits(2, civil.second))
+        {
+            return Error::InvalidSyntax;
+        }
+        if ((cursor.consume('.') || cursor.consume(',')) && !cursor.fraction(civil.nanosecond))
+        {
+            return Error::InvalidSyntax;
+        }
+    }
+    else if (require_seconds)
+    {
+        return Error::InvalidSyntax;
+    }
+
+    fields.has_time = true;
+    if (civil.hour > 23 || civil.minute > 59 || civil.second > 60)
+    {
+        return Error::InvalidTime;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Reads "+hh:mm", or additionally "+hhmm" and "+hh" if not strict.
+ */
+auto parse_numeric_offset(Cursor& cursor, Fields& fields, bool strict) noexcept
+    -> std::optional<Error>
+{
+    const std::int32_t sign = cursor.consume('-') ? -1 : (cursor.consume('+') ? 1 : 0);
+    std::uint32_t hours = 0;
+    std::uint32_t minutes = 0;
+
+    if (sign == 0 || !cursor.digits(2, hours))
+    {
+        return Error::InvalidOffset;
+    }
+
+    if (cursor.consume(':'))
+    {
+        if (!cursor.digits(2, minutes))
+        {
+            return Error::InvalidOffset;
+        }
+    }
+    else if (strict || (is_digit(cursor.peek()) && !cursor.digits(2, minutes)))
+    {
+        return Error::InvalidOffset;
+    }
+
+    if (hours > 23 || minutes > 59)
+    {
+        return Error::InvalidOffset;
+    }
+
+    fields.utc_offset = sign * static_cast<std::int32_t>(hours * 3600 + minutes * 60);
+    fields.has_offset = true;
+    return std::nullopt;
+}
+
+void complete(Fields& fields) noexcept
+{
+    CivilDateTime& civil = fields.civil;
+    const std::int64_t days = CivilTime::days_from_civil(civil.year, civil.month, civil.day);
+    civil.weekday = CivilTime::weekday_from_days(days);
+    civil.day_of_year =
+        static_cast<std::uint32_t>(days - CivilTime::days_from_civil(civil.year, 1, 1));
+}
+
+auto parse_iso(std::string_view text, bool strict) noexcept -> DateTimeParser::FieldsResult
+{
+    if (text.empty())
+    {
+        return Unexpected(Error::Empty);
+    }
+
+    Cursor cursor(text);
+    Fields fields;
+
+    if (auto error = parse_date(cursor, fields))
+    {
+        return Unexpected(*error);
+    }
+
+    if (!cursor.done() || strict)
+    {
+        if (!cursor.consume('T') && !cursor.consume('t') && !cursor.consume(' '))
+        {
+            return Unexpected(cursor.done() ? Error::InvalidSyntax : Error::TrailingCharacters);
+        }
+
+        if (auto error = parse_time(cursor, fields, strict))
+        {
+            return Unexpected(*error);
+        }
+
+        if (cursor.consume('Z') || cursor.consume('z'))
+        {
+            fields.has_offset = true;
+        }
+        else if (cursor.peek() == '+' || cursor.peek() == '-')
+        {
+            if (auto error = parse_numeric_offset(cursor, fields, strict))
+            {
+                return Unexpected(*error);
+            }
+        }
+        else if (strict)
+        {
+            return Unexpected(cursor.done() ? Error::InvalidOffset : Error::InvalidSyntax);
+        }
+    }
+
+    if (!cursor.done())
+    {
+        return Unexpected(Error::TrailingCharacters);
+    }
+
+    complete(fields);
+    return fields;
+}
+
+auto make_time_point(std::int64_t seconds, std::uint32_t nanoseconds) noexcept
+    -> DateTimeParser::Result
+{
+    if (seconds > k_max_seconds || seconds < k_min_seconds)
+    {
+        return Unexpected(Error::OutOfRange);
+    }
+    return DateTimeParser::TimePoint(std::chrono::seconds(seconds) +
+                                     std::chrono::nanoseconds(nanoseconds));
+}
+}  // namespace
+
+auto DateTimeParser::parse_iso8601(std::string_view text) noexcept -> Result
+{
+    const auto fields = parse_iso(text, false);
+    if (!fields)
+    {
+        return Unexpected(fields.error());
+    }
+    return to_time_point(*fields);
+}
+
+auto DateTimeParser::parse_iso8601(std::string_view text, const TimeZone& zone) noexcept -> Result
+{
+    const auto fields = parse_iso(text, false);
+    if (!fields)
+    {
+        return Unexpected(fields.error());
+    }
+    if (fields->has_offset)
+    {
+        return to_time_point(*fields);
+    }
+    return make_time_point(zone.to_utc(CivilTime::to_unix_seconds(fields->civil)),
+                           fields->civil.nanosecond);
+}
+
+auto DateTimeParser::parse_rfc3339(std::string_view text) noexcept -> Result
+{
+    const auto fields = parse_iso(text, true);
+    if (!fields)
+    {
+        return Unexpected(fields.error());
+    }
+    return to_time_point(*fields);
+}
+
+auto DateTimeParser::parse_rfc1123(std::string_view text) noexcept -> Result
+{
+    const auto fields = parse_rfc1123_fields(text);
+    if (!fields)
+    {
+        return Unexpected(fields.error());
+    }
+    return to_time_point(*fields);
+}
+
+auto DateTimeParser::parse(std::string_view text) noexcept -> Result
+{
+    return !text.empty() && is_alpha(text.front()) ? parse_rfc1123(text) : parse_iso8601(text);
+}
+
+auto DateTimeParser::parse_iso8601_fields(std::string_view text) noexcept -> FieldsResult
+{
+    return parse_iso(text, false);
+}
+
+auto DateTimeParser::parse_rfc1123_fields(std::string_view text) noexcept -> FieldsResult
+{
+    if (text.empty())
+    {
+        return Unexpected(Error::Empty);
+    }
+
+    Cursor cursor(text);
+    Fields fields;
+    std::optional<std::uint32_t> weekday;
+
+    if (is_alpha(cursor.peek()))
+    {
+        std::uint32_t index = 0;
+        if (!cursor.name(k_weekday_names, index) || !cursor.consume(',') || !cursor.consume(' '))
+        {
+            return Unexpected(Error::InvalidSyntax);
+        }
+        weekday = index;
+    }
+
+    std::uint32_t day = 0;
+    std::uint32_t month = 0;
+    std::uint32_t year = 0;
+    if (!cursor.digits(2, day) && !cursor.digits(1, day))
+    {
+        return Unexpected(Error::InvalidSyntax);
+    }
+    if (!cursor.consume(' ') || !cursor.name(k_month_names, month) || !cursor.consume(' ') ||
+        !cursor.digits(4, year) || !cursor.consume(' '))
+    {
+        return Unexpected(Error::InvalidSyntax);
+    }
+
+    fields.civil.year = static_cast<std::int32_t>(year);
+    fields.civil.month = month + 1;
+    fields.civil.day = day;
+    if (day < 1 || day > CivilTime::days_in_month(fields.civil.year, fields.civil.month))
+    {
+        return Unexpected(Error::InvalidDate);
+    }
+
+    if (auto error = parse_time(cursor, fields, false))
+    {
+        return Unexpected(*error);
+    }
+    if (!cursor.consume(' '))
+    {
+        return Unexpected(Error::InvalidSyntax);
+    }
+
+    if (cursor.word("GMT") || cursor.word("UTC") || cursor.word("UT") || cursor.word("Z"))
+    {
+        fields.has_offset = true;
+    }
+    else if (auto error = parse_numeric_offset(cursor, fields, false))
+    {
+        return Unexpected(*error);
+    }
+
+    if (!cursor.done())
+    {
+        return Unexpected(Error::TrailingCharacters);
+    }
+
+    complete(fields);
+    if (weekday && *weekday != fields.civil.weekday)
+    {
+        return Unexpected(Error::InvalidDate);
+    }
+    return fields;
+}
+
+auto DateTimeParser::to_time_point(const Fields& fields) noexcept -> Result
+{
+    return make_time_point(CivilTime::to_unix_seconds(fields.civil) -
+                               (fields.has_offset ? fields.utc_offset : 0),
+                           fields.civil.nanosecond);
+}
+
+auto DateTimeParser::error_message(Error error) noexcept -> std::string_view
+{
+    switch (error)
+    {
+        case Error::Empty:
+            return "empty input";
+        case Error::InvalidSyntax:
+            return "invalid syntax";
+        case Error::InvalidDate:
+            return "invalid date";
+        case Error::InvalidTime:
+            return "invalid time";
+        case Error::InvalidOffset:
+            return "invalid UTC offset";
+        case Error::TrailingCharacters:
+            return "trailing characters";
+        case Error::OutOfRange:
+            return "out of range";
+    }
+    return "unknown error";
+}
+
+}  // namespace CommonLib
@@ -1,30 +1,168 @@
 #include "CommonLib/Utils/DateTimeUtils.h"
 
+#include <array>
 #include <ctime>
-#include <iomanip>
-#include <sstream>
+#include <istream>
+#include <iterator>
+#include <locale>
+#include <optional>
+#include <stdexcept>
+#include <streambuf>
+
+#include "CommonLib/Utils/CachedDateTimeFormatter.h"
+#include "CommonLib/Utils/CivilTime.h"
+#include "CommonLib/Utils/DateTimeFormatter.h"
+#include "CommonLib/Utils/TimeZone.h"
+#include "CommonLib/Utils/TimeZoneDatabase.h"
 
 namespace CommonLib
 {
 
+namespace
+{
+/**
+ * @brief Formats into a String, constructed with the given allocator if there is one.
+ */
+template<typename String = std::string, typename... Allocator>
+auto render(const std::chrono::system_clock::time_point& tp, std::string_view format,
+            DateTimeFormatter::Zone zone, const Allocator&... allocator) -> String
+{
+    std::array<char, 256> buffer{};
+    const auto length = DateTimeFormatter::format_to(buffer, format, tp, zone);
+
+    if (length != 0 || DateTimeFormatter::max_size(format) <= buffer.size())
+    {
+        return String(buffer.data(), length, allocator...);
+    }
+
+    String result(DateTimeFormatter::max_size(format), '\0', allocator...);
+    result.resize(DateTimeFormatter::format_to(result, format, tp, zone));
+    return result;
+}
+
+/**
+ * @brief Reads a string_view as a stream without copying it.
+ */
+class ViewBuffer: public std::streambuf
+{
+    public:
+        explicit ViewBuffer(std::string_view text)
+        {
+            // The get area is only read from.
+            char* begin = const_cast<char*>(text.data());
+            setg(begin, begin, begin + text.size());
+        }
+};
+
+/**
+ * @brief Small per-thread set of cached formatters, replaced round-robin when full.
+ */
+class CachedFormatterSet
+{
+    public:
+        auto get(const std::string& format, DateTimeFormatter::Zone zone)
+            -> CachedDateTimeFormatter&
+        {
+            for (auto& entry: m_entries)
+            {
+                if (entry && entry->formatter().zone() == zone &&
+                    entry->formatter().pattern() == format)
+                {
+                    return *entry;
+                }
+            }
+
+            auto& slot = m_entries[m_next];
+            m_next = (m_next + 1) % m_entries.size();
+            return slot.emplace(format, zone);
+        }
+
+    private:
+        std::array<std::optional<CachedDateTimeFormatter>, 4> m_entries;
+        std::size_t m_next = 0;
+};
+
+/**
+ * @brief Parses like std::get_time, but with a format that need not be null-terminated.
+ */
+auto get_time(std::string_view str, std::string_view format, std::tm& tm_buf) -> bool
+{
+    ViewBuffer buffer(str);
+    std::istream stream(&buffer);
+    const std::istream::sentry sentry(stream);
+    if (!sentry)
+    {
+        return false;
+    }
+
+    std::ios_base::iostate state = std::ios_base::goodbit;
+    const auto& facet = std::use_facet<std::time_get<char>>(stream.getloc());
+    facet.get(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>(), stream,
+              state, &tm_buf, format.data(), format.data() + format.size());
+    return (state & std::ios_base::failbit) == 0;
+}
+
+/**
+ * @brief Parses the fixed ISO formats from_string() is mostly used with, like std::get_time would.
+ */
+auto parse_fixed_format(std::string_view str, std::string_view format) -> std::optional<std::tm>
+{
+    const bool date_only = format == "%Y-%m-%d";
+    if (!date_only && format != "%Y-%m-%d %H:%M:%S" && format != "%Y-%m-%dT%H:%M:%S")
+    {
+        return std::nullopt;
+    }
+    if (str.size() != (date_only ? 10U : 19U) || (!date_only && str[10] != format[8]))
+    {
+        return std::nullopt;
+    }
+
+    const auto fields = DateTimeParser::parse_iso8601_fields(str);
+    if (!fields || fields->civil.second > 59)
+    {
+        return std::nullopt;
+    }
+    return CivilTime::to_tm(fields->civil);
+}
+
+auto render_cached(const std::string& format, DateTimeFormatter::Zone zone) -> std::string
+{
+    thread_local CachedFormatterSet formatters;
+    return formatters.get(format, zone).format(std::chrono::system_clock::now());
+}
+}  // namespace
+
 auto DateTimeUtils::now(const std::string& format) -> std::string
 {
     return DateTimeUtils::format(std::chrono::system_clock::now(), format);
 }
 
+auto DateTimeUtils::now(std::pmr::memory_resource* resource, std::string_view format)
+    -> std::pmr::string
+{
+    return DateTimeUtils::format(resource, std::chrono::system_clock::now(), format);
+}
+
 auto DateTimeUtils::now_utc(const std::string& format) -> std::string
 {
-    auto now = std::chrono::system_clock::now();
-    std::time_t now_c = std::chrono::system_clock::to_time_t(now);
-    std::tm tm_buf;
-#if defined(_WIN32)
-    gmtime_s(&tm_buf, &now_c);
-#else
-    gmtime_r(&now_c, &tm_buf);
-#endif
-    std::ostringstream oss;
-    oss << std::put_time(&tm_buf, format.c_str());
-    return oss.str();
+    return render(std::chrono::system_clock::now(), format, DateTimeFormatter::Zone::Utc);
+}
+
+auto DateTimeUtils::now_utc(std::pmr::memory_resource* resource, std::string_view format)
+    -> std::pmr::string
+{
+    return render<std::pmr::string>(std::chrono::system_clock::now(), format,
+                                    DateTimeFormatter::Zone::Utc, resource);
+}
+
+auto DateTimeUtils::now_cached(const std::string& format) -> std::string
+{
+    return render_cached(format, DateTimeFormatter::Zone::Local);
+}
+
+auto DateTimeUtils::now_utc_cached(const std::string& format) -> std::string
+{
+    return render_cached(format, DateTimeFormatter::Zone::Utc);
 }
 
 auto DateTimeUtils::current_date(const std::string& format) -> std::string
@@ -32,24 +170,60 @@ auto DateTimeUtils::current_date(const std::string& format) -> std::string
     return now(format);
 }
 
+auto DateTimeUtils::current_date(std::pmr::memory_resource* resource, std::string_view format)
+    -> std::pmr::string
+{
+    return now(resource, format);
+}
+
 auto DateTimeUtils::current_time(const std::string& format) -> std::string
 {
     return now(format);
 }
 
+auto DateTimeUtils::current_time(std::pmr::memory_resource* resource, std::string_view format)
+    -> std::pmr::string
+{
+    return now(resource, format);
+}
+
 auto DateTimeUtils::format(const std::chrono::system_clock::time_point& tp,
                            const std::string& format) -> std::string
 {
-    std::time_t time_c = std::chrono::system_clock::to_time_t(tp);
-    std::tm tm_buf;
-#if defined(_WIN32)
-    localtime_s(&tm_buf, &time_c);
-#else
-    localtime_r(&time_c, &tm_buf);
-#endif
-    std::ostringstream oss;
-    oss << std::put_time(&tm_buf, format.c_str());
-    return oss.str();
+    return render(tp, format, DateTimeFormatter::Zone::Local);
+}
+
+auto DateTimeUtils::format(std::pmr::memory_resource* resource,
+                           const std::chrono::system_clock::time_point& tp, std::string_view format)
+    -> std::pmr::string
+{
+    return render<std::pmr::string>(tp, format, DateTimeFormatter::Zone::Local, resource);
+}
+
+auto DateTimeUtils::format_in(const std::chrono::system_clock::time_point& tp,
+                              std::string_view zone, const std::string& format) -> std::string
+{
+    const TimeZone* time_zone = TimeZoneDatabase::instance().locate(zone);
+    if (time_zone == nullptr)
+    {
+        throw std::invalid_argument("Unknown time zone: " + std::string(zone));
+    }
+
+    std::array<char, 256> buffer{};
+    const std::size_t size = DateTimeFormatter::max_size(format);
+    if (size <= buffer.size())
+    {
+        return {buffer.data(), DateTimeFormatter::format_to(buffer, format, tp, *time_zone)};
+    }
+
+    std::string result(size, '\0');
+    result.resize(DateTimeFormatter::format_to(result, format, tp, *time_zone));
+    return result;
+}
+
+auto DateTimeUtils::now_in(std::string_view zone, const std::string& format) -> std::string
+{
+    return format_in(std::chrono::system_clock::now(), zone, format);
 }
 
 auto DateTimeUtils::timer_now() -> std::chrono::steady_clock::time_point
@@ -81,26 +255,82 @@ auto DateTimeUtils::to_string(const std::chrono::system_clock::time_point& tp,
     return DateTimeUtils::format(tp, format);
 }
 
-auto DateTimeUtils::from_string(const std::string& str,
-                                const std::string& format) -> std::chrono::system_clock::time_point
+auto DateTimeUtils::to_string(std::pmr::memory_resource* resource,
+                              const std::chrono::system_clock::time_point& tp,
+                              std::string_view format) -> std::pmr::string
+{
+    return DateTimeUtils::format(resource, tp, format);
+}
+
+auto DateTimeUtils::from_string(std::string_view str,
+                                std::string_view format) -> std::chrono::system_clock::time_point
 {
     std::tm tm_buf = {};
-    std::istringstream iss(str);
-    iss >> std::get_time(&tm_buf, format.c_str());
 
-    if (iss.fail())
+    if (auto fast = parse_fixed_format(str, format))
+    {
+        tm_buf = *fast;
+    }
+    else if (!get_time(str, format, tm_buf))
     {
-        throw std::runtime_error("Failed to parse date/time string: " + str);
+        throw std::runtime_error("Failed to parse date/time string: " + std::string(str));
     }
 
+    if (const TimeZone* zone = TimeZone::local_cached())
+    {
+        // Formats without a day leave tm_mday at 0, which mktime() treats as the previous day.
+        const std::int64_t days =
+            CivilTime::days_from_civil(tm_buf.tm_year + 1900,
+                                       static_cast<std::uint32_t>(tm_buf.tm_mon + 1), 1) +
+            tm_buf.tm_mday - 1;
+        const std::int64_t local_seconds =
+            days * 86400 + tm_buf.tm_hour * 3600 + tm_buf.tm_min * 60 + tm_buf.tm_sec;
+        return std::chrono::system_clock::time_point(
+            std::chrono::seconds(zone->to_utc(local_seconds)));
+    }
+
+    // Without TimeZone support (Windows) local times are converted by the C library, which is
+    // left to decide whether daylight saving time applies, as it does in parse().
+    tm_buf.tm_isdst = -1;
     std::time_t time_c = std::mktime(&tm_buf);
 
     if (time_c == -1)
     {
-        throw std::runtime_error("Failed to convert tm to time_t: " + str);
+        throw std::runtime_error("Failed to convert tm to time_t: " + std::string(str));
     }
 
     return std::chrono::system_clock::from_time_t(time_c);
 }
 
+auto DateTimeUtils::parse(std::string_view str) noexcept -> DateTimeParser::Result
+{
+    if (!str.empty() && ((str.front() >= 'A' && str.front() <= 'Z') ||
+                         (str.front() >= 'a' && str.front() <= 'z')))
+    {
+        return DateTimeParser::parse_rfc1123(str);
+    }
+
+    if (const TimeZone* zone = TimeZone::local_cached())
+    {
+        return DateTimeParser::parse_iso8601(str, *zone);
+    }
+
+    // Without TimeZone support (Windows) local timestamps are converted by the C library.
+    const auto fields = DateTimeParser::parse_iso8601_fields(str);
+    if (!fields || fields->has_offset)
+    {
+        return fields ? DateTimeParser::to_time_point(*fields) : Unexpected(fields.error());
+    }
+
+    std::tm tm_buf = CivilTime::to_tm(fields->civil);
+    tm_buf.tm_isdst = -1;
+    const std::time_t time_c = std::mktime(&tm_buf);
+    if (time_c == -1)
+    {
+        return Unexpected(DateTimeParser::Error::OutOfRange);
+    }
+    return DateTimeParser::TimePoint(std::chrono::seconds(time_c) +
+                                     std::chrono::nanoseconds(fields->civil.nanosecond));
+}
+
 }  // namespace CommonLib
@@ -0,0 +1,112 @@
+#include "CommonLib/Utils/DurationFormatter.h"
+
+#include <array>
+#include <charconv>
+
+namespace CommonLib
+{
+
+namespace
+{
+struct UnitInfo {
+        std::uint64_t nanoseconds;
+        std::string_view suffix;
+};
+
+auto unit_info(DurationFormatter::Unit unit) noexcept -> UnitInfo
+{
+    switch (unit)
+    {
+    case DurationFormatter::Unit::Seconds:
+        return {1000000000, "s"};
+    case DurationFormatter::Unit::Milliseconds:
+        return {1000000, "ms"};
+    case DurationFormatter::Unit::Microseconds:
+        return {1000, "us"};
+    default:
+        return {1, "ns"};
+    }
+}
+
+auto pick_unit(std::uint64_t magnitude) noexcept -> DurationFormatter::Unit
+{
+    if (magnitude >= 1000000000)
+    {
+        return DurationFormatter::Unit::Seconds;
+    }
+    if (magnitude >= 1000000)
+    {
+        return DurationFormatter::Unit::Milliseconds;
+    }
+    if (magnitude >= 1000)
+    {
+        return DurationFormatter::Unit::Microseconds;
+    }
+    return DurationFormatter::Unit::Nanoseconds;
+}
+}  // namespace
+
+auto DurationFormatter::format_to(std::span<char> buffer, std::chrono::nanoseconds duration,
+                                  Unit unit) noexcept -> std::size_t
+{
+    if (buffer.size() < k_max_size)
+    {
+        return 0;
+    }
+
+    const std::int64_t count = duration.count();
+    const std::uint64_t magnitude =
+        count < 0 ? 0 - static_cast<std::uint64_t>(count) : static_cast<std::uint64_t>(count);
+    const UnitInfo info = unit_info(unit == Unit::Auto ? pick_unit(magnitude) : unit);
+
+    // Round to thousandths of the unit, half away from zero.
+    std::uint64_t whole = magnitude / info.nanoseconds;
+    std::uint64_t thousandths = 0;
+    if (info.nanoseconds > 1)
+    {
+        const std::uint64_t remainder = magnitude % info.nanoseconds;
+        const std::uint64_t step = info.nanoseconds / 1000;
+        thousandths = (remainder + step / 2) / step;
+        if (thousandths == 1000)
+        {
+            ++whole;
+            thousandths = 0;
+        }
+    }
+
+    char* out = buffer.data();
+    if (count < 0 && (whole != 0 || thousandths != 0))
+    {
+        *out++ = '-';
+    }
+    out = std::to_chars(out, buffer.data() + buffer.size(), whole).ptr;
+    if (thousandths != 0)
+    {
+        std::array<char, 3> digits = {static_cast<char>('0' + thousandths / 100),
+                                      static_cast<char>('0' + thousandths / 10 % 10),
+                                      static_cast<char>('0' + thousandths % 10)};
+        std::size_t length = digits.size();
+        while (digits[length - 1] == '0')
+        {
+            --length;
+        }
+        *out++ = '.';
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            *out++ = digits[i];
+        }
+    }
+    for (const char c: info.suffix)
+    {
+        *out++ = c;
+    }
+    return static_cast<std::size_t>(out - buffer.data());
+}
+
+auto DurationFormatter::format(std::chrono::nanoseconds duration, Unit unit) -> std::string
+{
+    std::array<char, k_max_size> buffer{};
+    return {buffer.data(), format_to(std::span<char>(buffer), duration, unit)};
+}
+
+}  // namespace CommonLib
@@ -0,0 +1,54 @@
+#include "CommonLib/Utils/StaticDateTimeFormat.h"
+
+#include <ctime>
+
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace CommonLib
+{
+
+auto StaticDateTimeFormatBase::local_utc_offset(std::int64_t unix_seconds) noexcept
+    -> std::int32_t
+{
+    if (const TimeZone* zone = TimeZone::local_cached())
+    {
+        return zone->offset_at(unix_seconds).utc_offset;
+    }
+
+    // Without TimeZone support (Windows) the offset is derived from the C library's breakdown.
+    const auto time_c = static_cast<std::time_t>(unix_seconds);
+    std::tm tm_buf{};
+#if defined(_WIN32)
+    localtime_s(&tm_buf, &time_c);
+#else
+    localtime_r(&time_c, &tm_buf);
+#endif
+    CivilDateTime civil;
+    civil.year = tm_buf.tm_year + 1900;
+    civil.month = static_cast<std::uint32_t>(tm_buf.tm_mon + 1);
+    civil.day = static_cast<std::uint32_t>(tm_buf.tm_mday);
+    civil.hour = static_cast<std::uint32_t>(tm_buf.tm_hour);
+    civil.minute = static_cast<std::uint32_t>(tm_buf.tm_min);
+    civil.second = static_cast<std::uint32_t>(tm_buf.tm_sec);
+    return static_cast<std::int32_t>(CivilTime::to_unix_seconds(civil) - unix_seconds);
+}
+
+auto StaticDateTimeFormatBase::local_to_unix_seconds(const CivilDateTime& civil) noexcept
+    -> std::optional<std::int64_t>
+{
+    if (const TimeZone* zone = TimeZone::local_cached())
+    {
+        return zone->to_utc(CivilTime::to_unix_seconds(civil));
+    }
+
+    std::tm tm_buf = CivilTime::to_tm(civil);
+    tm_buf.tm_isdst = -1;
+    const std::time_t time_c = std::mktime(&tm_buf);
+    if (time_c == -1)
+    {
+        return std::nullopt;
+    }
+    return static_cast<std::int64_t>(time_c);
+}
+
+}  // namespace CommonLib
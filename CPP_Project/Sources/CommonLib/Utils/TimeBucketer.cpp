@@ -0,0 +1,465 @@
+#include "CommonLib/Utils/TimeBucketer.h"
+
+#include <limits>
+#include <stdexcept>
+
+#include "CommonLib/Private/Simd.h"
+#include "CommonLib/Utils/CivilTime.h"
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace CommonLib
+{
+
+namespace
+{
+using Unit = TimeBucketer::Unit;
+
+constexpr std::int64_t k_max = std::numeric_limits<std::int64_t>::max();
+constexpr std::int64_t k_min = std::numeric_limits<std::int64_t>::min();
+
+/**
+ * @brief 1970-01-05, the first Monday after the epoch, in seconds.
+ */
+constexpr std::int64_t k_week_origin = 4 * CivilTime::k_seconds_per_day;
+
+constexpr auto unit_seconds(Unit unit) noexcept -> std::int64_t
+{
+    switch (unit)
+    {
+        case Unit::Second:
+            return 1;
+        case Unit::Minute:
+            return 60;
+        case Unit::Hour:
+            return 3600;
+        case Unit::Day:
+            return CivilTime::k_seconds_per_day;
+        case Unit::Week:
+            return 7 * CivilTime::k_seconds_per_day;
+        default:
+            return 0;
+    }
+}
+
+constexpr auto ticks_per_second(TimeBucketer::Resolution resolution) noexcept -> std::int64_t
+{
+    switch (resolution)
+    {
+        case TimeBucketer::Resolution::Milliseconds:
+            return 1000;
+        case TimeBucketer::Resolution::Microseconds:
+            return 1000000;
+        case TimeBucketer::Resolution::Nanoseconds:
+            return 1000000000;
+        default:
+            return 1;
+    }
+}
+
+constexpr auto floor_div(std::int64_t value, std::int64_t divisor) noexcept -> std::int64_t
+{
+    const std::int64_t quotient = value / divisor;
+    return quotient * divisor > value ? quotient - 1 : quotient;
+}
+
+/**
+ * @brief Converts seconds to ticks, saturating at the ends of the int64 range.
+ */
+constexpr auto to_ticks(std::int64_t seconds, std::int64_t ticks_per_second) noexcept
+    -> std::int64_t
+{
+    if (seconds > k_max / ticks_per_second)
+    {
+        return k_max;
+    }
+    if (seconds < k_min / ticks_per_second)
+    {
+        return k_min;
+    }
+    return seconds * ticks_per_second;
+}
+
+/**
+ * @brief Returns the Unix seconds of the first day of a month counted from January of year 0.
+ */
+constexpr auto month_start(std::int64_t months) noexcept -> std::int64_t
+{
+    const std::int64_t year = floor_div(months, 12);
+    const auto month = static_cast<std::uint32_t>(months - year * 12 + 1);
+    return CivilTime::days_from_civil(static_cast<std::int32_t>(year), month, 1) *
+           CivilTime::k_seconds_per_day;
+}
+
+/**
+ * @brief Floors a value to a multiple of width counted from origin, with 0 <= origin < width.
+ */
+constexpr auto floor_fixed(std::int64_t value, std::int64_t width, std::int64_t origin) noexcept
+    -> std::int64_t
+{
+    // value % width - origin cannot overflow, unlike value - origin.
+    std::int64_t remainder = value % width - origin;
+    while (remainder < 0)
+    {
+        remainder += width;
+    }
+    return value - remainder;
+}
+
+#if COMMONLIB_SIMD_X86
+/**
+ * @brief Converts four int64 to double (exact below 2^53, rounded above).
+ *
+ * AVX2 has no such conversion; the upper 16 and the lower 48 bits are converted separately with
+ * magic number additions and summed.
+ */
+COMMONLIB_TARGET("avx2")
+inline auto to_double(__m256i value) noexcept -> __m256d
+{
+    __m256i high = _mm256_srai_epi32(value, 16);
+    high = _mm256_blend_epi16(high, _mm256_setzero_si256(), 0x33);
+    high = _mm256_add_epi64(high, _mm256_castpd_si256(_mm256_set1_pd(442721857769029238784.0)));
+    const __m256i low = _mm256_blend_epi16(
+        value, _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.0)), 0x88);
+    const __m256d sum =
+        _mm256_sub_pd(_mm256_castsi256_pd(high), _mm256_set1_pd(442726361368656609280.0));
+    return _mm256_add_pd(sum, _mm256_castsi256_pd(low));
+}
+
+/**
+ * @brief Multiplies four int64 modulo 2^64.
+ */
+COMMONLIB_TARGET("avx2")
+inline auto multiply(__m256i a, __m256i b) noexcept -> __m256i
+{
+    const __m256i low = _mm256_mul_epu32(a, b);
+    const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                           _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+}
+
+/**
+ * @brief Floors four values to fixed-width buckets.
+ *
+ * The quotient (value - origin) / width is estimated in double precision, which is off by at
+ * most one while it stays below 2^50. The remainder value - origin - quotient * width is then
+ * computed exactly in 64-bit integers and moved into [0, width). Vectors with a larger quotient
+ * (widths of a few microseconds over nanosecond timestamps) are floored with scalar code.
+ */
+COMMONLIB_TARGET("avx2")
+inline auto floor_fixed_avx2(__m256i value, const std::int64_t* values, std::int64_t width,
+                             std::int64_t origin) noexcept -> __m256i
+{
+    const __m256i width_v = _mm256_set1_epi64x(width);
+    const __m256d magic = _mm256_set1_pd(6755399441055744.0);  // 2^52 + 2^51
+    const __m256d quotient = _mm256_floor_pd(
+        _mm256_mul_pd(_mm256_sub_pd(to_double(value), _mm256_set1_pd(static_cast<double>(origin))),
+                      _mm256_set1_pd(1.0 / static_cast<double>(width))));
+
+    const __m256d magnitude = _mm256_andnot_pd(_mm256_set1_pd(-0.0), quotient);
+    const __m256d limit = _mm256_set1_pd(1125899906842624.0);  // 2^50
+    if (_mm256_movemask_pd(_mm256_cmp_pd(magnitude, limit, _CMP_LT_OQ)) != 0xF)
+    {
+        return _mm256_setr_epi64x(
+            floor_fixed(values[0], width, origin), floor_fixed(values[1], width, origin),
+            floor_fixed(values[2], width, origin), floor_fixed(values[3], width, origin));
+    }
+
+    const __m256i quotient_i = _mm256_sub_epi64(
+        _mm256_castpd_si256(_mm256_add_pd(quotient, magic)), _mm256_castpd_si256(magic));
+    // Wraps around for values near the ends of the range, but the result is small.
+    __m256i remainder = _mm256_sub_epi64(_mm256_sub_epi64(value, _mm256_set1_epi64x(origin)),
+                                         multiply(quotient_i, width_v));
+    const __m256i negative = _mm256_cmpgt_epi64(_mm256_setzero_si256(), remainder);
+    remainder = _mm256_add_epi64(remainder, _mm256_and_si256(negative, width_v));
+    const __m256i below_width = _mm256_cmpgt_epi64(width_v, remainder);
+    remainder = _mm256_sub_epi64(remainder, _mm256_andnot_si256(below_width, width_v));
+    return _mm256_sub_epi64(value, remainder);
+}
+
+/**
+ * @brief Assigns buckets four values at a time while they fall into the last bucket.
+ *
+ * Other values are floored four at a time if the buckets have a fixed width (width != 0), and
+ * one at a time with range() otherwise, which returns the bounds [low, high) of a bucket.
+ */
+template<typename Range>
+COMMONLIB_TARGET("avx2")
+void bucket_cached_avx2(std::span<const std::int64_t> values, std::span<std::int64_t> buckets,
+                        std::int64_t width, std::int64_t origin, const Range& range) noexcept
+{
+    // An empty range, so that the first value computes its bucket.
+    std::int64_t low = k_max;
+    std::int64_t high = k_min;
+    __m256i low_v = _mm256_set1_epi64x(low);
+    __m256i high_v = _mm256_set1_epi64x(high);
+    int misses = 0;
+
+    std::size_t i = 0;
+    while (i + 4 <= values.size())
+    {
+        const __m256i value =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + i));
+        const __m256i inside = _mm256_andnot_si256(_mm256_cmpgt_epi64(low_v, value),
+                                                   _mm256_cmpgt_epi64(high_v, value));
+        if (_mm256_movemask_pd(_mm256_castsi256_pd(inside)) == 0xF)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(buckets.data() + i), low_v);
+            i += 4;
+            misses = 0;
+            continue;
+        }
+
+        if (width != 0)
+        {
+            __m256i floored = floor_fixed_avx2(value, values.data() + i, width, origin);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(buckets.data() + i), floored);
+            i += 4;
+            // Unordered input misses all the time; then skip the check for a few vectors.
+            const int extra = ++misses > 1 ? 3 : 0;
+            for (int block = 0; block < extra && i + 4 <= values.size(); ++block, i += 4)
+            {
+                const __m256i next =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + i));
+                floored = floor_fixed_avx2(next, values.data() + i, width, origin);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(buckets.data() + i), floored);
+            }
+            low = _mm256_extract_epi64(floored, 3);
+            high = low > k_max - width ? k_max : low + width;
+        }
+        else
+        {
+            if (values[i] < low || values[i] >= high)
+            {
+                const auto bounds = range(values[i]);
+                low = bounds.first;
+                high = bounds.second;
+            }
+            buckets[i++] = low;
+        }
+        low_v = _mm256_set1_epi64x(low);
+        high_v = _mm256_set1_epi64x(high);
+    }
+
+    for (; i < values.size(); ++i)
+    {
+        if (values[i] < low || values[i] >= high)
+        {
+            const auto bounds = range(values[i]);
+            low = bounds.first;
+            high = bounds.second;
+        }
+        buckets[i] = low;
+    }
+}
+
+/**
+ * @brief Finds the first bucket id in [begin, count) that differs from its predecessor.
+ * @return Its index, or count if there is none.
+ */
+COMMONLIB_TARGET("avx2")
+auto next_boundary_avx2(const std::int64_t* buckets, std::size_t begin, std::size_t count) noexcept
+    -> std::size_t
+{
+    std::size_t i = begin;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buckets + i));
+        const __m256i previous =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buckets + i - 1));
+        const int equal =
+            _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(current, previous)));
+        if (equal != 0xF)
+        {
+            return i + static_cast<std::size_t>(__builtin_ctz(static_cast<unsigned>(~equal)));
+        }
+    }
+    for (; i < count; ++i)
+    {
+        if (buckets[i] != buckets[i - 1])
+        {
+            return i;
+        }
+    }
+    return count;
+}
+#endif
+
+auto next_boundary(const std::int64_t* buckets, std::size_t begin, std::size_t count,
+                   bool use_avx2) noexcept -> std::size_t
+{
+#if COMMONLIB_SIMD_X86
+    if (use_avx2)
+    {
+        return next_boundary_avx2(buckets, begin, count);
+    }
+#else
+    static_cast<void>(use_avx2);
+#endif
+    for (std::size_t i = begin; i < count; ++i)
+    {
+        if (buckets[i] != buckets[i - 1])
+        {
+            return i;
+        }
+    }
+    return count;
+}
+}  // namespace
+
+TimeBucketer::TimeBucketer(Unit unit, std::uint32_t count, Resolution resolution,
+                           const TimeZone* zone)
+    : m_unit(unit),
+      m_count(count),
+      m_ticks_per_second(ticks_per_second(resolution)),
+      m_zone(zone)
+{
+    if (count == 0)
+    {
+        throw std::invalid_argument("TimeBucketer: count must be positive");
+    }
+
+    const std::int64_t seconds = unit_seconds(unit);
+    if (seconds != 0 && zone == nullptr)
+    {
+        if (seconds * count > k_max / m_ticks_per_second)
+        {
+            throw std::invalid_argument("TimeBucketer: bucket width exceeds the int64 range");
+        }
+        m_width = seconds * count * m_ticks_per_second;
+        m_origin = unit == Unit::Week ? k_week_origin * m_ticks_per_second % m_width : 0;
+    }
+}
+
+auto TimeBucketer::bucket_of(std::int64_t value) const noexcept -> std::int64_t
+{
+    return m_width != 0 ? floor_fixed(value, m_width, m_origin) : bucket_range(value).first;
+}
+
+void TimeBucketer::bucket_many(std::span<const std::int64_t> values,
+                               std::span<std::int64_t> buckets, SimdLevel level) const
+{
+    if (buckets.size() < values.size())
+    {
+        throw std::invalid_argument("TimeBucketer: bucket buffer is smaller than the input");
+    }
+
+    bucket_cached(values, buckets, level);
+}
+
+auto TimeBucketer::group_runs(std::span<const std::int64_t> buckets, std::span<Run> runs,
+                              SimdLevel level) -> std::size_t
+{
+    if (runs.size() < buckets.size())
+    {
+        throw std::invalid_argument("TimeBucketer: run buffer is smaller than the input");
+    }
+
+    const bool use_avx2 = level >= SimdLevel::Avx2 && CpuFeatures::has_avx2();
+    const std::size_t count = buckets.size();
+    std::size_t run_count = 0;
+    std::size_t begin = 0;
+    while (begin < count)
+    {
+        const std::size_t end = next_boundary(buckets.data(), begin + 1, count, use_avx2);
+        runs[run_count++] = {buckets[begin], begin, end - begin};
+        begin = end;
+    }
+    return run_count;
+}
+
+auto TimeBucketer::group_runs(std::span<const std::int64_t> buckets) -> std::vector<Run>
+{
+    std::vector<Run> runs(buckets.size());
+    runs.resize(group_runs(buckets, runs));
+    return runs;
+}
+
+auto TimeBucketer::unit() const noexcept -> Unit
+{
+    return m_unit;
+}
+
+auto TimeBucketer::count() const noexcept -> std::uint32_t
+{
+    return m_count;
+}
+
+auto TimeBucketer::zone() const noexcept -> const TimeZone*
+{
+    return m_zone;
+}
+
+auto TimeBucketer::bucket_range(std::int64_t value) const noexcept
+    -> std::pair<std::int64_t, std::int64_t>
+{
+    if (m_width != 0)
+    {
+        const std::int64_t start = floor_fixed(value, m_width, m_origin);
+        return {start, start > k_max - m_width ? k_max : start + m_width};
+    }
+
+    const std::int64_t seconds = floor_div(value, m_ticks_per_second);
+    const std::int64_t local =
+        m_zone != nullptr ? seconds + m_zone->offset_at(seconds).utc_offset : seconds;
+
+    std::int64_t start = 0;
+    std::int64_t next = 0;
+    if (m_unit == Unit::Month || m_unit == Unit::Year)
+    {
+        const CivilDateTime civil = CivilTime::from_unix_seconds(local);
+        const std::int64_t step = m_unit == Unit::Year ? std::int64_t{m_count} * 12 : m_count;
+        std::int64_t months = std::int64_t{civil.year} * 12;
+        if (m_unit == Unit::Month)
+        {
+            months += civil.month - 1;
+        }
+        months = floor_div(months, step) * step;
+        start = month_start(months);
+        next = month_start(months + step);
+    }
+    else
+    {
+        const std::int64_t width = unit_seconds(m_unit) * m_count;
+        const std::int64_t origin = m_unit == Unit::Week ? k_week_origin % width : 0;
+        start = floor_fixed(local, width, origin);
+        next = start + width;
+    }
+
+    if (m_zone != nullptr)
+    {
+        start = m_zone->to_utc(start);
+        next = m_zone->to_utc(next);
+    }
+    return {to_ticks(start, m_ticks_per_second), to_ticks(next, m_ticks_per_second)};
+}
+
+void TimeBucketer::bucket_cached(std::span<const std::int64_t> values,
+                                 std::span<std::int64_t> buckets, SimdLevel level) const noexcept
+{
+    const auto range = [this](std::int64_t value) { return bucket_range(value); };
+#if COMMONLIB_SIMD_X86
+    if (level >= SimdLevel::Avx2 && CpuFeatures::has_avx2())
+    {
+        bucket_cached_avx2(values, buckets, m_width, m_origin, range);
+        return;
+    }
+#else
+    static_cast<void>(level);
+#endif
+
+    // An empty range, so that the first value computes its bucket.
+    std::int64_t low = k_max;
+    std::int64_t high = k_min;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (values[i] < low || values[i] >= high)
+        {
+            const auto bounds = range(values[i]);
+            low = bounds.first;
+            high = bounds.second;
+        }
+        buckets[i] = low;
+    }
+}
+
+}  // namespace CommonLib
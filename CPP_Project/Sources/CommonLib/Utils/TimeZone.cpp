@@ -0,0 +1,731 @@
+#include "CommonLib/Utils/TimeZone.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+namespace CommonLib
+{
+
+namespace
+{
+constexpr std::size_t k_header_size = 44;
+constexpr std::int32_t k_last_materialized_year = 2100;
+
+/**
+ * @brief The counts stored in a TZif header.
+ */
+struct TzifHeader {
+        char version = 0;
+        std::uint32_t isutcnt = 0;
+        std::uint32_t isstdcnt = 0;
+        std::uint32_t leapcnt = 0;
+        std::uint32_t timecnt = 0;
+        std::uint32_t typecnt = 0;
+        std::uint32_t charcnt = 0;
+};
+
+auto read_be32(const std::uint8_t* data) -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(data[0]) << 24 | static_cast<std::uint32_t>(data[1]) << 16 |
+           static_cast<std::uint32_t>(data[2]) << 8 | static_cast<std::uint32_t>(data[3]);
+}
+
+auto read_be64(const std::uint8_t* data) -> std::int64_t
+{
+    return static_cast<std::int64_t>(static_cast<std::uint64_t>(read_be32(data)) << 32 |
+                                     read_be32(data + 4));
+}
+
+auto parse_header(std::span<const std::uint8_t> data) -> std::optional<TzifHeader>
+{
+    if (data.size() < k_header_size || data[0] != 'T' || data[1] != 'Z' || data[2] != 'i' ||
+        data[3] != 'f')
+    {
+        return std::nullopt;
+    }
+
+    TzifHeader header;
+    header.version = static_cast<char>(data[4]);
+    header.isutcnt = read_be32(data.data() + 20);
+    header.isstdcnt = read_be32(data.data() + 24);
+    header.leapcnt = read_be32(data.data() + 28);
+    header.timecnt = read_be32(data.data() + 32);
+    header.typecnt = read_be32(data.data() + 36);
+    header.charcnt = read_be32(data.data() + 40);
+
+    if (header.typecnt == 0 || header.typecnt > 256 || header.charcnt == 0 ||
+        (header.isutcnt != 0 && header.isutcnt != header.typecnt) ||
+        (header.isstdcnt != 0 && header.isstdcnt != header.typecnt))
+    {
+        return std::nullopt;
+    }
+    return header;
+}
+
+auto block_size(const TzifHeader& header, std::size_t time_size) -> std::size_t
+{
+    return header.timecnt * time_size + header.timecnt + header.typecnt * 6 + header.charcnt +
+           header.leapcnt * (time_size + 4) + header.isstdcnt + header.isutcnt;
+}
+
+/**
+ * @brief Cursor over a POSIX TZ string.
+ */
+class RuleReader
+{
+    public:
+        explicit RuleReader(std::string_view text) : m_text(text) {}
+
+        [[nodiscard]] auto done() const -> bool
+        {
+            return m_position == m_text.size();
+        }
+
+        [[nodiscard]] auto peek() const -> char
+        {
+            return done() ? '\0' : m_text[m_position];
+        }
+
+        auto consume(char c) -> bool
+        {
+            if (peek() != c)
+            {
+                return false;
+            }
+            ++m_position;
+            return true;
+        }
+
+        auto name() -> std::optional<std::string_view>
+        {
+            const std::size_t begin = m_position;
+
+            if (consume('<'))
+            {
+                const std::size_t end = m_text.find('>', m_position);
+                if (end == std::string_view::npos || end == m_position)
+                {
+                    return std::nullopt;
+                }
+                m_position = end + 1;
+                return m_text.substr(begin + 1, end - begin - 1);
+            }
+
+            while ((peek() >= 'A' && peek() <= 'Z') || (peek() >= 'a' && peek() <= 'z'))
+            {
+                ++m_position;
+            }
+            if (m_position - begin < 3)
+            {
+                return std::nullopt;
+            }
+            return m_text.substr(begin, m_position - begin);
+        }
+
+        auto number(std::int32_t max_value) -> std::optional<std::int32_t>
+        {
+            if (peek() < '0' || peek() > '9')
+            {
+                return std::nullopt;
+            }
+
+            std::int32_t value = 0;
+            while (peek() >= '0' && peek() <= '9')
+            {
+                value = value * 10 + (peek() - '0');
+                if (value > max_value)
+                {
+                    return std::nullopt;
+                }
+                ++m_position;
+            }
+            return value;
+        }
+
+        /**
+         * @brief Reads [+-]hh[:mm[:ss]] and returns it in seconds.
+         */
+        auto duration(std::int32_t max_hours) -> std::optional<std::int32_t>
+        {
+            std::int32_t sign = 1;
+            if (consume('-'))
+            {
+                sign = -1;
+            }
+            else
+            {
+                consume('+');
+            }
+
+            const auto hours = number(max_hours);
+            if (!hours)
+            {
+                return std::nullopt;
+            }
+
+            std::int32_t seconds = *hours * 3600;
+            for (std::int32_t scale: {60, 1})
+            {
+                if (!consume(':'))
+                {
+                    break;
+                }
+                const auto part = number(59);
+                if (!part)
+                {
+                    return std::nullopt;
+                }
+                seconds += *part * scale;
+            }
+            return sign * seconds;
+        }
+
+    private:
+        std::string_view m_text;
+        std::size_t m_position = 0;
+};
+
+struct LocalZoneState {
+        std::mutex mutex;
+        std::shared_ptr<const TimeZone> zone;
+        bool loaded = false;
+        std::atomic<std::uint64_t> generation{0};
+};
+
+auto local_state() -> LocalZoneState&
+{
+    static LocalZoneState state;
+    return state;
+}
+
+/**
+ * @brief Returns the local zone together with its generation, loading it on first use.
+ */
+auto snapshot_local(std::shared_ptr<const TimeZone> (*load)())
+    -> std::pair<std::shared_ptr<const TimeZone>, std::uint64_t>
+{
+    auto& state = local_state();
+    const std::lock_guard<std::mutex> lock(state.mutex);
+
+    if (!state.loaded)
+    {
+        state.zone = load();
+        state.loaded = true;
+        state.generation.fetch_add(1, std::memory_order_release);
+    }
+    return {state.zone, state.generation.load(std::memory_order_relaxed)};
+}
+}  // namespace
+
+auto TimeZone::from_tzif(std::span<const std::uint8_t> data, std::string name)
+    -> std::shared_ptr<const TimeZone>
+{
+    auto header = parse_header(data);
+    if (!header)
+    {
+        return nullptr;
+    }
+
+    std::size_t position = k_header_size;
+    std::size_t time_size = 4;
+
+    if (header->version >= '2')
+    {
+        // Skip the legacy 32-bit block and use the 64-bit one that follows it.
+        position += block_size(*header, 4);
+        header = parse_header(data.subspan(std::min(position, data.size())));
+        if (!header)
+        {
+            return nullptr;
+        }
+        position += k_header_size;
+        time_size = 8;
+    }
+
+    if (data.size() - std::min(position, data.size()) < block_size(*header, time_size))
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<TimeZone> zone(new TimeZone());
+    zone->m_name = std::move(name);
+    const std::uint8_t* cursor = data.data() + position;
+
+    zone->m_transition_times.reserve(header->timecnt);
+    for (std::uint32_t i = 0; i < header->timecnt; ++i, cursor += time_size)
+    {
+        const std::int64_t time = time_size == 8
+                                      ? read_be64(cursor)
+                                      : static_cast<std::int32_t>(read_be32(cursor));
+        if (!zone->m_transition_times.empty() && time <= zone->m_transition_times.back())
+        {
+            return nullptr;
+        }
+        zone->m_transition_times.push_back(time);
+    }
+
+    zone->m_transition_types.reserve(header->timecnt);
+    for (std::uint32_t i = 0; i < header->timecnt; ++i, ++cursor)
+    {
+        if (*cursor >= header->typecnt)
+        {
+            return nullptr;
+        }
+        zone->m_transition_types.push_back(*cursor);
+    }
+
+    zone->m_types.reserve(header->typecnt);
+    for (std::uint32_t i = 0; i < header->typecnt; ++i, cursor += 6)
+    {
+        Type type;
+        type.utc_offset = static_cast<std::int32_t>(read_be32(cursor));
+        type.is_dst = cursor[4] != 0;
+        type.abbreviation_index = cursor[5];
+        if (type.abbreviation_index >= header->charcnt)
+        {
+            return nullptr;
+        }
+        zone->m_types.push_back(type);
+    }
+
+    zone->m_abbreviations.assign(reinterpret_cast<const char*>(cursor), header->charcnt);
+    zone->m_abbreviations.push_back('\0');
+    cursor += header->charcnt;
+
+    // Leap second records and the standard/wall and UT/local indicators are not needed to
+    // convert POSIX timestamps.
+    cursor += header->leapcnt * (time_size + 4) + header->isstdcnt + header->isutcnt;
+
+    if (time_size == 8)
+    {
+        const auto* end = data.data() + data.size();
+        if (cursor == end || *cursor != '\n')
+        {
+            return nullptr;
+        }
+        const auto* footer_end = std::find(cursor + 1, end, '\n');
+        if (footer_end == end)
+        {
+            return nullptr;
+        }
+
+        const std::string_view footer(reinterpret_cast<const char*>(cursor + 1),
+                                      static_cast<std::size_t>(footer_end - cursor - 1));
+        if (!footer.empty())
+        {
+            zone->m_rule = parse_rule(footer, *zone);
+            if (!zone->m_rule)
+            {
+                return nullptr;
+            }
+            zone->materialize_rule();
+        }
+    }
+
+    return zone;
+}
+
+auto TimeZone::from_file(const std::string& path) -> std::shared_ptr<const TimeZone>
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return nullptr;
+    }
+
+    const std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)),
+                                         std::istreambuf_iterator<char>());
+    return from_tzif(data, path);
+}
+
+auto TimeZone::from_posix_rule(std::string_view rule) -> std::shared_ptr<const TimeZone>
+{
+    std::shared_ptr<TimeZone> zone(new TimeZone());
+    zone->m_name = std::string(rule);
+    zone->m_rule = parse_rule(rule, *zone);
+
+    if (!zone->m_rule)
+    {
+        return nullptr;
+    }
+
+    zone->m_types.push_back(zone->m_rule->standard);
+    zone->materialize_rule();
+    return zone;
+}
+
+auto TimeZone::utc() -> std::shared_ptr<const TimeZone>
+{
+    static const std::shared_ptr<const TimeZone> zone = [] {
+        std::shared_ptr<TimeZone> result(new TimeZone());
+        result->m_name = "UTC";
+        result->m_types.push_back({0, false, result->add_abbreviation("UTC")});
+        return result;
+    }();
+    return zone;
+}
+
+auto TimeZone::local() -> std::shared_ptr<const TimeZone>
+{
+    return snapshot_local(&TimeZone::load_local).first;
+}
+
+auto TimeZone::local_cached() noexcept -> const TimeZone*
+{
+    thread_local std::shared_ptr<const TimeZone> zone;
+    thread_local std::uint64_t generation = 0;
+
+    if (generation == 0 || generation != local_generation())
+    {
+        try
+        {
+            std::tie(zone, generation) = snapshot_local(&TimeZone::load_local);
+        }
+        catch (...)
+        {
+            // Loading failed, e.g. with std::bad_alloc; keep what this thread had and retry on
+            // the next call.
+        }
+    }
+    return zone.get();
+}
+
+auto TimeZone::reload_local() -> bool
+{
+    auto zone = load_local();
+    const bool loaded = zone != nullptr;
+
+    auto& state = local_state();
+    const std::lock_guard<std::mutex> lock(state.mutex);
+    state.zone = std::move(zone);
+    state.loaded = true;
+    state.generation.fetch_add(1, std::memory_order_release);
+    return loaded;
+}
+
+auto TimeZone::local_generation() noexcept -> std::uint64_t
+{
+    return local_state().generation.load(std::memory_order_acquire);
+}
+
+auto TimeZone::name() const noexcept -> const std::string&
+{
+    return m_name;
+}
+
+auto TimeZone::offset_at(std::int64_t unix_seconds) const noexcept -> Offset
+{
+    if (m_transition_times.empty() || unix_seconds < m_transition_times.front())
+    {
+        if (m_transition_times.empty() && m_rule)
+        {
+            return rule_offset_at(unix_seconds);
+        }
+        return to_offset(m_types.front());
+    }
+
+    if (m_rule && unix_seconds >= m_transition_times.back())
+    {
+        return rule_offset_at(unix_seconds);
+    }
+
+    const auto it =
+        std::upper_bound(m_transition_times.begin(), m_transition_times.end(), unix_seconds);
+    const auto index = static_cast<std::size_t>(it - m_transition_times.begin()) - 1;
+    return to_offset(m_types[m_transition_types[index]]);
+}
+
+auto TimeZone::to_local(std::int64_t unix_seconds) const noexcept -> CivilDateTime
+{
+    return CivilTime::from_unix_seconds(unix_seconds + offset_at(unix_seconds).utc_offset);
+}
+
+auto TimeZone::to_utc(std::int64_t local_seconds) const noexcept -> std::int64_t
+{
+    // No zone changes its offset by more than a day, so the offsets one day before and after
+    // bracket every candidate. The larger one yields the earlier instant.
+    const std::int32_t before = offset_at(local_seconds - CivilTime::k_seconds_per_day).utc_offset;
+    const std::int32_t after = offset_at(local_seconds + CivilTime::k_seconds_per_day).utc_offset;
+    const std::int32_t first = std::max(before, after);
+    const std::int32_t second = std::min(before, after);
+
+    if (offset_at(local_seconds - first).utc_offset == first)
+    {
+        return local_seconds - first;
+    }
+    if (offset_at(local_seconds - second).utc_offset == second)
+    {
+        return local_seconds - second;
+    }
+    return local_seconds - before;
+}
+
+auto TimeZone::convert(const CivilDateTime& local, const TimeZone& target) const noexcept
+    -> CivilDateTime
+{
+    CivilDateTime result = target.to_local(to_utc(CivilTime::to_unix_seconds(local)));
+    result.nanosecond = local.nanosecond;
+    return result;
+}
+
+auto TimeZone::parse_rule(std::string_view text, TimeZone& zone) -> std::optional<Rule>
+{
+    RuleReader reader(text);
+    Rule rule;
+
+    const auto standard_name = reader.name();
+    const auto standard_offset = reader.duration(24);
+    if (!standard_name || !standard_offset)
+    {
+        return std::nullopt;
+    }
+    rule.standard = {-*standard_offset, false, zone.add_abbreviation(*standard_name)};
+
+    if (reader.done())
+    {
+        return rule;
+    }
+
+    const auto daylight_name = reader.name();
+    if (!daylight_name)
+    {
+        return std::nullopt;
+    }
+    rule.has_dst = true;
+    rule.daylight = {rule.standard.utc_offset + 3600, true, zone.add_abbreviation(*daylight_name)};
+
+    if (!reader.done() && reader.peek() != ',')
+    {
+        const auto daylight_offset = reader.duration(24);
+        if (!daylight_offset)
+        {
+            return std::nullopt;
+        }
+        rule.daylight.utc_offset = -*daylight_offset;
+    }
+
+    if (reader.done())
+    {
+        // US rules are the POSIX default when no dates are given.
+        rule.start = {RuleDate::Kind::MonthWeekDay, 0, 3, 2, 7200};
+        rule.end = {RuleDate::Kind::MonthWeekDay, 0, 11, 1, 7200};
+        return rule;
+    }
+
+    for (RuleDate* date: {&rule.start, &rule.end})
+    {
+        if (!reader.consume(','))
+        {
+            return std::nullopt;
+        }
+
+        if (reader.consume('J'))
+        {
+            const auto day = reader.number(365);
+            if (!day || *day == 0)
+            {
+                return std::nullopt;
+            }
+            *date = {RuleDate::Kind::JulianNoLeap, static_cast<std::uint16_t>(*day), 0, 0, 7200};
+        }
+        else if (reader.consume('M'))
+        {
+            const auto month = reader.number(12);
+            std::optional<std::int32_t> week;
+            std::optional<std::int32_t> weekday;
+            if (reader.consume('.'))
+            {
+                week = reader.number(5);
+            }
+            if (reader.consume('.'))
+            {
+                weekday = reader.number(6);
+            }
+            if (!month || !week || !weekday || *month == 0 || *week == 0)
+            {
+                return std::nullopt;
+            }
+            *date = {RuleDate::Kind::MonthWeekDay, static_cast<std::uint16_t>(*weekday),
+                     static_cast<std::uint8_t>(*month), static_cast<std::uint8_t>(*week), 7200};
+        }
+        else
+        {
+            const auto day = reader.number(365);
+            if (!day)
+            {
+                return std::nullopt;
+            }
+            *date = {RuleDate::Kind::Julian, static_cast<std::uint16_t>(*day), 0, 0, 7200};
+        }
+
+        if (reader.consume('/'))
+        {
+            const auto time = reader.duration(167);
+            if (!time)
+            {
+                return std::nullopt;
+            }
+            date->time = *time;
+        }
+    }
+
+    if (!reader.done())
+    {
+        return std::nullopt;
+    }
+    return rule;
+}
+
+auto TimeZone::rule_transition(const RuleDate& date, std::int32_t year) noexcept -> std::int64_t
+{
+    std::int64_t days = CivilTime::days_from_civil(year, 1, 1);
+
+    switch (date.kind)
+    {
+        case RuleDate::Kind::JulianNoLeap:
+            // Jn counts 1 - 365 and never refers to February 29th.
+            days += date.day - 1 + (CivilTime::is_leap_year(year) && date.day >= 60 ? 1 : 0);
+            break;
+        case RuleDate::Kind::Julian:
+            days += date.day;
+            break;
+        case RuleDate::Kind::MonthWeekDay:
+        {
+            const std::uint32_t month_length = CivilTime::days_in_month(year, date.month);
+            const std::int64_t first = CivilTime::days_from_civil(year, date.month, 1);
+            std::uint32_t day = (date.day + 7 - CivilTime::weekday_from_days(first)) % 7 +
+                                (static_cast<std::uint32_t>(date.week) - 1) * 7;
+            while (day >= month_length)
+            {
+                day -= 7;
+            }
+            days = first + day;
+            break;
+        }
+    }
+
+    return days * CivilTime::k_seconds_per_day + date.time;
+}
+
+auto TimeZone::load_local() -> std::shared_ptr<const TimeZone>
+{
+#if defined(_WIN32)
+    return nullptr;
+#else
+    const char* tz = std::getenv("TZ");
+    if (tz == nullptr)
+    {
+        auto zone = from_file("/etc/localtime");
+        return zone ? zone : utc();
+    }
+
+    std::string_view spec(tz);
+    if (!spec.empty() && spec.front() == ':')
+    {
+        spec.remove_prefix(1);
+    }
+    if (spec.empty())
+    {
+        return utc();
+    }
+
+    if (spec.front() == '/')
+    {
+        return from_file(std::string(spec));
+    }
+
+    if (spec.find("..") == std::string_view::npos)
+    {
+        const char* directory = std::getenv("TZDIR");
+        std::string path = directory != nullptr && *directory != '\0' ? directory
+                                                                        : "/usr/share/zoneinfo";
+        path += '/';
+        path += spec;
+
+        if (auto zone = from_file(path))
+        {
+            return zone;
+        }
+    }
+
+    return from_posix_rule(spec);
+#endif
+}
+
+auto TimeZone::add_abbreviation(std::string_view abbreviation) -> std::uint32_t
+{
+    const auto index = static_cast<std::uint32_t>(m_abbreviations.size());
+    m_abbreviations.append(abbreviation);
+    m_abbreviations.push_back('\0');
+    return index;
+}
+
+auto TimeZone::rule_offset_at(std::int64_t unix_seconds) const noexcept -> Offset
+{
+    const Rule& rule = *m_rule;
+    if (!rule.has_dst)
+    {
+        return to_offset(rule.standard);
+    }
+
+    const std::int32_t year =
+        CivilTime::from_unix_seconds(unix_seconds + rule.standard.utc_offset).year;
+    const std::int64_t start = rule_transition(rule.start, year) - rule.standard.utc_offset;
+    const std::int64_t end = rule_transition(rule.end, year) - rule.daylight.utc_offset;
+
+    // Southern hemisphere rules start DST late in the year and end it early in the next one.
+    const bool is_dst = start < end ? unix_seconds >= start && unix_seconds < end
+                                    : unix_seconds < end || unix_seconds >= start;
+    return to_offset(is_dst ? rule.daylight : rule.standard);
+}
+
+auto TimeZone::to_offset(const Type& type) const noexcept -> Offset
+{
+    return {type.utc_offset, type.is_dst, m_abbreviations.c_str() + type.abbreviation_index};
+}
+
+void TimeZone::materialize_rule()
+{
+    if (!m_rule || !m_rule->has_dst)
+    {
+        return;
+    }
+
+    const auto standard_index = static_cast<std::uint16_t>(m_types.size());
+    m_types.push_back(m_rule->standard);
+    m_types.push_back(m_rule->daylight);
+    const auto daylight_index = static_cast<std::uint16_t>(standard_index + 1);
+
+    // Zones built from a bare POSIX rule get the rule applied to all of the 20th century too.
+    const std::int32_t first_year =
+        m_transition_times.empty() ? 1900
+                                   : CivilTime::from_unix_seconds(m_transition_times.back()).year;
+
+    for (std::int32_t year = first_year; year <= k_last_materialized_year; ++year)
+    {
+        std::pair<std::int64_t, std::uint16_t> transitions[] = {
+            {rule_transition(m_rule->start, year) - m_rule->standard.utc_offset, daylight_index},
+            {rule_transition(m_rule->end, year) - m_rule->daylight.utc_offset, standard_index}};
+        if (transitions[1].first < transitions[0].first)
+        {
+            std::swap(transitions[0], transitions[1]);
+        }
+
+        for (const auto& [time, type]: transitions)
+        {
+            if (m_transition_times.empty() || time > m_transition_times.back())
+            {
+                m_transition_times.push_back(time);
+                m_transition_types.push_back(type);
+            }
+        }
+    }
+}
+
+}  // namespace CommonLib
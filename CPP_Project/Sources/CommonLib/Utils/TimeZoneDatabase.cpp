@@ -0,0 +1,243 @@
+#include "CommonLib/Utils/TimeZoneDatabase.h"
+
+#include <cstdlib>
+#include <span>
+#include <utility>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CommonLib
+{
+
+namespace
+{
+auto default_directory() -> std::string
+{
+    const char* directory = std::getenv("TZDIR");
+    return directory != nullptr && *directory != '\0' ? directory : "/usr/share/zoneinfo";
+}
+
+#if !defined(_WIN32)
+/**
+ * @class MappedFile
+ * @brief A read-only private mapping of a regular file, unmapped on destruction.
+ */
+class MappedFile
+{
+    public:
+        explicit MappedFile(const std::string& path)
+        {
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                return;
+            }
+
+            struct stat info{};
+            if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0)
+            {
+                void* data = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ,
+                                    MAP_PRIVATE, fd, 0);
+                if (data != MAP_FAILED)
+                {
+                    m_data = data;
+                    m_size = static_cast<std::size_t>(info.st_size);
+                }
+            }
+            ::close(fd);
+        }
+
+        ~MappedFile()
+        {
+            if (m_data != nullptr)
+            {
+                ::munmap(m_data, m_size);
+            }
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+        [[nodiscard]] auto bytes() const noexcept -> std::span<const std::uint8_t>
+        {
+            return {static_cast<const std::uint8_t*>(m_data), m_size};
+        }
+
+    private:
+        void* m_data = nullptr;
+        std::size_t m_size = 0;
+};
+#endif
+}  // namespace
+
+TimeZoneDatabase::TimeZoneDatabase(std::string directory): m_directory(std::move(directory)) {}
+
+TimeZoneDatabase::~TimeZoneDatabase()
+{
+    for (auto& bucket: m_buckets)
+    {
+        Node* node = bucket.load(std::memory_order_acquire);
+        while (node != nullptr)
+        {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+}
+
+auto TimeZoneDatabase::instance() -> TimeZoneDatabase&
+{
+    static TimeZoneDatabase database(default_directory());
+    return database;
+}
+
+auto TimeZoneDatabase::directory() const noexcept -> const std::string&
+{
+    return m_directory;
+}
+
+auto TimeZoneDatabase::locate(std::string_view name) -> const TimeZone*
+{
+    const Node* node = lookup(name);
+    return node != nullptr ? node->zone.get() : nullptr;
+}
+
+auto TimeZoneDatabase::find(std::string_view name) -> std::shared_ptr<const TimeZone>
+{
+    const Node* node = lookup(name);
+    return node != nullptr ? node->zone : nullptr;
+}
+
+auto TimeZoneDatabase::convert(const CivilDateTime& local, std::string_view from,
+                               std::string_view to) -> std::optional<CivilDateTime>
+{
+    const TimeZone* source = locate(from);
+    const TimeZone* target = locate(to);
+    if (source == nullptr || target == nullptr)
+    {
+        return std::nullopt;
+    }
+    return source->convert(local, *target);
+}
+
+auto TimeZoneDatabase::size() const noexcept -> std::size_t
+{
+    return m_size.load(std::memory_order_relaxed);
+}
+
+auto TimeZoneDatabase::hash_of(std::string_view name) noexcept -> std::uint64_t
+{
+    // FNV-1a; zone names are short and the table is small.
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char c: name)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+auto TimeZoneDatabase::is_valid_name(std::string_view name) noexcept -> bool
+{
+    return !name.empty() && name.front() != '/' && name.find("..") == std::string_view::npos &&
+           name.find('\0') == std::string_view::npos;
+}
+
+auto TimeZoneDatabase::lookup(std::string_view name) -> const Node*
+{
+    if (!is_valid_name(name))
+    {
+        return nullptr;
+    }
+
+    const std::uint64_t hash = hash_of(name);
+    const Node* node = search(name, hash);
+    return node != nullptr ? node : load(name, hash);
+}
+
+auto TimeZoneDatabase::search(std::string_view name, std::uint64_t hash) const noexcept
+    -> const Node*
+{
+    // Nodes are fully constructed before they are published with a release store and are never
+    // modified or freed afterwards, so the list can be walked without a lock.
+    const Node* node = m_buckets[hash % k_bucket_count].load(std::memory_order_acquire);
+    while (node != nullptr && (node->hash != hash || node->name != name))
+    {
+        node = node->next;
+    }
+    return node;
+}
+
+auto TimeZoneDatabase::load(std::string_view name, std::uint64_t hash) -> const Node*
+{
+    // Parse outside the lock so that threads warming up different zones do not wait for each
+    // other; a zone loaded twice by racing threads is simply discarded by the loser.
+    auto zone = load_file(name);
+    if (!zone && name == "UTC")
+    {
+        zone = TimeZone::utc();
+    }
+
+    const std::lock_guard lock(m_mutex);
+    if (const Node* existing = search(name, hash))
+    {
+        return existing;
+    }
+    if (!zone && m_unknown >= k_max_unknown)
+    {
+        return nullptr;
+    }
+
+    auto& bucket = m_buckets[hash % k_bucket_count];
+    Node* node = new Node{std::string(name), std::move(zone), hash,
+                          bucket.load(std::memory_order_relaxed)};
+    bucket.store(node, std::memory_order_release);
+
+    if (node->zone)
+    {
+        m_size.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        ++m_unknown;
+    }
+    return node;
+}
+
+auto TimeZoneDatabase::load_file(std::string_view name) const -> std::shared_ptr<const TimeZone>
+{
+    std::string path = m_directory;
+    path += '/';
+    path += name;
+
+#if defined(_WIN32)
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return nullptr;
+    }
+
+    const std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)),
+                                         std::istreambuf_iterator<char>());
+    return TimeZone::from_tzif(data, std::string(name));
+#else
+    const MappedFile file(path);
+    if (file.bytes().empty())
+    {
+        return nullptr;
+    }
+    return TimeZone::from_tzif(file.bytes(), std::string(name));
+#endif
+}
+
+}  // namespace CommonLib
@@ -0,0 +1,95 @@
+#include "CommonLib/Utils/TscClock.h"
+
+#include <atomic>
+
+#include "CommonLib/Base/CpuFeatures.h"
+
+namespace CommonLib
+{
+
+namespace
+{
+// 0 until the first calibration.
+std::atomic<double> g_ticks_per_second{0.0};
+
+/**
+ * @brief Reads the counter and steady_clock as close together as possible.
+ *
+ * The steady_clock reading is bracketed by two counter readings and paired with their midpoint,
+ * which halves the error introduced by the clock_gettime call.
+ */
+auto sample(std::chrono::steady_clock::time_point& steady) noexcept -> double
+{
+    const TscClock::Ticks before = TscClock::now_ordered();
+    steady = std::chrono::steady_clock::now();
+    const TscClock::Ticks after = TscClock::now_ordered();
+    return static_cast<double>(before) + static_cast<double>(after - before) / 2;
+}
+}  // namespace
+
+auto TscClock::detect() noexcept -> bool
+{
+#if COMMONLIB_HAS_TSC
+    // Every CPU with an invariant TSC also has RDTSCP; require both so now_ordered() is valid.
+    return CpuFeatures::has_invariant_tsc() && CpuFeatures::has_rdtscp();
+#else
+    return false;
+#endif
+}
+
+auto TscClock::fallback_now() noexcept -> Ticks
+{
+    return static_cast<Ticks>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now().time_since_epoch())
+                                  .count());
+}
+
+auto TscClock::calibrate(std::chrono::nanoseconds window) -> double
+{
+    double rate = 1e9;
+    if (uses_tsc())
+    {
+        std::chrono::steady_clock::time_point start_time;
+        std::chrono::steady_clock::time_point end_time;
+        const double start = sample(start_time);
+        double end = start;
+        do
+        {
+            end = sample(end_time);
+        } while (end_time - start_time < window);
+
+        rate = (end - start) / std::chrono::duration<double>(end_time - start_time).count();
+    }
+    g_ticks_per_second.store(rate, std::memory_order_relaxed);
+    return rate;
+}
+
+auto TscClock::ticks_per_second() -> double
+{
+    const double rate = g_ticks_per_second.load(std::memory_order_relaxed);
+    return rate != 0.0 ? rate : calibrate();
+}
+
+auto TscClock::elapsed_ns(Ticks start, Ticks end) -> double
+{
+    // The difference is taken modulo 2^64, so a reading that precedes start (e.g. on another
+    // core) becomes a small negative number rather than a huge positive one.
+    return static_cast<double>(static_cast<std::int64_t>(end - start)) * 1e9 / ticks_per_second();
+}
+
+auto TscClock::elapsed_s(Ticks start, Ticks end) -> double
+{
+    return elapsed_ns(start, end) / 1e9;
+}
+
+auto TscClock::elapsed_ms(Ticks start, Ticks end) -> double
+{
+    return elapsed_ns(start, end) / 1e6;
+}
+
+auto TscClock::elapsed_us(Ticks start, Ticks end) -> double
+{
+    return elapsed_ns(start, end) / 1e3;
+}
+
+}  // namespace CommonLib
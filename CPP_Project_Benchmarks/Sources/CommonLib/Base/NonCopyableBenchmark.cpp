@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "CommonLib/Base/NonCopyable.h"
+
+namespace
+{
+/// The former NonCopyable, with a virtual destructor and therefore a vptr in every object.
+class VirtualNonCopyable
+{
+    protected:
+        VirtualNonCopyable() = default;
+        virtual ~VirtualNonCopyable() = default;
+
+    public:
+        VirtualNonCopyable(const VirtualNonCopyable&) = delete;
+        auto operator=(const VirtualNonCopyable&) -> VirtualNonCopyable& = delete;
+        VirtualNonCopyable(VirtualNonCopyable&&) = default;
+        auto operator=(VirtualNonCopyable&&) -> VirtualNonCopyable& = default;
+};
+
+/// A small, densely packed object such as a price level; 8 bytes plus whatever the base adds.
+template<typename Base>
+class Level: public Base
+{
+    public:
+        Level(std::int32_t price, std::int32_t quantity): m_price(price), m_quantity(quantity) {}
+
+        [[nodiscard]] auto notional() const noexcept -> std::int64_t
+        {
+            return static_cast<std::int64_t>(m_price) * m_quantity;
+        }
+
+    private:
+        std::int32_t m_price;
+        std::int32_t m_quantity;
+};
+
+template<typename Base>
+void iterate(benchmark::State& state)
+{
+    std::vector<Level<Base>> levels;
+    levels.reserve(static_cast<std::size_t>(state.range(0)));
+    for (std::int64_t index = 0; index < state.range(0); ++index)
+    {
+        levels.emplace_back(static_cast<std::int32_t>(index), static_cast<std::int32_t>(index % 7));
+    }
+    for (auto _: state)
+    {
+        std::int64_t total = 0;
+        for (const auto& level: levels)
+        {
+            total += level.notional();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) *
+                            static_cast<std::int64_t>(sizeof(Level<Base>)));
+    state.counters["object_bytes"] = static_cast<double>(sizeof(Level<Base>));
+}
+}  // namespace
+
+/**
+ * @brief Iterates over an array of objects whose base has a virtual destructor (16 bytes each).
+ */
+static void BM_NonCopyable_Iterate_VirtualBase(benchmark::State& state)
+{
+    iterate<VirtualNonCopyable>(state);
+}
+BENCHMARK(BM_NonCopyable_Iterate_VirtualBase)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 22);
+
+/**
+ * @brief Iterates over an array of objects derived from the empty NonCopyable (8 bytes each).
+ */
+static void BM_NonCopyable_Iterate_EmptyBase(benchmark::State& state)
+{
+    iterate<CommonLib::NonCopyable>(state);
+}
+BENCHMARK(BM_NonCopyable_Iterate_EmptyBase)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 22);
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include "CommonLib/Concurrency/RateLimiter.h"
+
+namespace
+{
+/**
+ * @brief The baseline: a classic token bucket with a token count and a refill time under a mutex.
+ */
+class MutexTokenBucket
+{
+    public:
+        MutexTokenBucket(double tokens_per_second, double burst)
+            : m_rate(tokens_per_second / 1e9), m_burst(burst), m_tokens(burst)
+        {
+        }
+
+        auto try_acquire() -> bool
+        {
+            const auto now = std::chrono::steady_clock::now();
+            const std::lock_guard lock(m_mutex);
+            const auto elapsed = std::chrono::duration<double, std::nano>(now - m_last).count();
+            m_last = now;
+            m_tokens = std::min(m_burst, m_tokens + elapsed * m_rate);
+            if (m_tokens < 1.0)
+            {
+                return false;
+            }
+            m_tokens -= 1.0;
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        double m_rate;
+        double m_burst;
+        double m_tokens;
+        std::chrono::steady_clock::time_point m_last = std::chrono::steady_clock::now();
+};
+
+// High enough that most requests are allowed and write, which is the contended case.
+constexpr double k_rate = 1e9;
+constexpr std::uint64_t k_burst = 1 << 20;
+}  // namespace
+
+/**
+ * @brief One token bucket shared by all threads.
+ */
+static void BM_TokenBucketLimiter_SharedKey(benchmark::State& state)
+{
+    static CommonLib::TokenBucketLimiter limiter(CommonLib::TokenBucketRule(k_rate, k_burst));
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(limiter.try_acquire());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TokenBucketLimiter_SharedKey)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief One sliding window shared by all threads.
+ */
+static void BM_SlidingWindowLimiter_SharedKey(benchmark::State& state)
+{
+    static CommonLib::SlidingWindowLimiter limiter(
+        CommonLib::SlidingWindowRule(CommonLib::SlidingWindowRule::k_max_limit,
+                                     std::chrono::milliseconds(1)));
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(limiter.try_acquire());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SlidingWindowLimiter_SharedKey)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Baseline: one mutex-protected token bucket shared by all threads.
+ */
+static void BM_MutexTokenBucket_SharedKey(benchmark::State& state)
+{
+    static MutexTokenBucket limiter(k_rate, static_cast<double>(k_burst));
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(limiter.try_acquire());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MutexTokenBucket_SharedKey)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Per-client limits for a million keys in a sharded table, hit in a scattered order.
+ */
+static void BM_ShardedRateLimiter_MillionKeys(benchmark::State& state)
+{
+    constexpr std::uint64_t k_keys = 1 << 20;
+    static CommonLib::ShardedRateLimiter<CommonLib::TokenBucketRule> limiter(
+        CommonLib::TokenBucketRule(100.0, 10), 2 * k_keys);
+    std::uint64_t i = static_cast<std::uint64_t>(state.thread_index()) * 7919;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(limiter.try_acquire((i * 2654435761U) % k_keys));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ShardedRateLimiter_MillionKeys)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "CommonLib/Logging/AsyncLogger.h"
+#include "CommonLib/Profiling/LatencyHistogram.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+#include "CommonLib/Utils/TscClock.h"
+
+namespace
+{
+using Level = CommonLib::AsyncLogger::Level;
+
+constexpr int k_lines_per_flush = 10000;
+
+auto log_path() -> std::string
+{
+    return (std::filesystem::temp_directory_path() / "commonlib_async_logger_benchmark.log")
+        .string();
+}
+
+void start_logger(CommonLib::AsyncLogger::OverflowPolicy overflow)
+{
+    CommonLib::AsyncLogger::Config config;
+    config.path = log_path();
+    config.overflow = overflow;
+    config.max_file_size = 256 * 1024 * 1024;
+    config.max_files = 1;
+    CommonLib::AsyncLogger::get_instance().start(config);
+}
+
+void stop_logger()
+{
+    CommonLib::AsyncLogger::get_instance().stop();
+    std::error_code error;
+    std::filesystem::remove(log_path(), error);
+    std::filesystem::remove(log_path() + ".1", error);
+}
+}  // namespace
+
+/**
+ * @brief Caller-side latency of a log() call with three arguments, from concurrent threads.
+ *
+ * Every call is timed with TscClock; the counters report the percentiles of the calling thread,
+ * averaged over the threads. Lines that do not fit into the queue are dropped and counted.
+ */
+static void BM_AsyncLogger_CallerLatency(benchmark::State& state)
+{
+    auto& logger = CommonLib::AsyncLogger::get_instance();
+    if (state.thread_index() == 0)
+    {
+        start_logger(CommonLib::AsyncLogger::OverflowPolicy::Drop);
+    }
+    const std::uint64_t dropped = logger.dropped();
+    CommonLib::LatencyHistogram histogram;
+    std::int64_t value = 0;
+    for (auto _: state)
+    {
+        const auto start = CommonLib::TscClock::now();
+        logger.log(Level::Info, "order {} filled at {} by {}", value++, 101.25, "desk-7");
+        const auto end = CommonLib::TscClock::now();
+        const double elapsed_ns = CommonLib::TscClock::elapsed_ns(start, end);
+        histogram.record(static_cast<std::uint64_t>(elapsed_ns));
+    }
+    state.SetItemsProcessed(state.iterations());
+    const auto average = benchmark::Counter::kAvgThreads;
+    state.counters["p50_ns"] = benchmark::Counter(histogram.percentile(50.0), average);
+    state.counters["p99_ns"] = benchmark::Counter(histogram.percentile(99.0), average);
+    state.counters["p99.9_ns"] = benchmark::Counter(histogram.percentile(99.9), average);
+    if (state.thread_index() == 0)
+    {
+        state.counters["dropped"] = static_cast<double>(logger.dropped() - dropped);
+        stop_logger();
+    }
+}
+BENCHMARK(BM_AsyncLogger_CallerLatency)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Sustained lines per second: every iteration logs a block of lines and waits until
+ *        they are written, so the rate includes formatting and file output.
+ */
+static void BM_AsyncLogger_Throughput(benchmark::State& state)
+{
+    auto& logger = CommonLib::AsyncLogger::get_instance();
+    if (state.thread_index() == 0)
+    {
+        start_logger(CommonLib::AsyncLogger::OverflowPolicy::Block);
+    }
+    std::int64_t value = 0;
+    for (auto _: state)
+    {
+        for (int i = 0; i < k_lines_per_flush; ++i)
+        {
+            logger.log(Level::Info, "order {} filled at {} by {}", value++, 101.25, "desk-7");
+        }
+        logger.flush();
+    }
+    state.SetItemsProcessed(state.iterations() * k_lines_per_flush);
+    if (state.thread_index() == 0)
+    {
+        stop_logger();
+    }
+}
+BENCHMARK(BM_AsyncLogger_Throughput)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Baseline: formatting with DateTimeUtils and writing with fprintf / fflush on the
+ *        calling thread.
+ */
+static void BM_SyncLogger_Fprintf(benchmark::State& state)
+{
+    std::FILE* file = std::fopen(log_path().c_str(), "ab");
+    if (file == nullptr)
+    {
+        state.SkipWithError("Cannot open the log file");
+        return;
+    }
+    std::int64_t value = 0;
+    for (auto _: state)
+    {
+        const std::string stamp = CommonLib::DateTimeUtils::format(
+            std::chrono::system_clock::now(), "%Y-%m-%d %H:%M:%S");
+        std::fprintf(file, "%s [INFO] order %lld filled at %g by %s\n", stamp.c_str(),
+                     static_cast<long long>(value++), 101.25, "desk-7");
+        std::fflush(file);
+    }
+    std::fclose(file);
+    state.SetItemsProcessed(state.iterations());
+    std::error_code error;
+    std::filesystem::remove(log_path(), error);
+}
+BENCHMARK(BM_SyncLogger_Fprintf);
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "CommonLib/Memory/ObjectPool.h"
+
+namespace
+{
+/// The number of messages a thread allocates before handing them over to another thread.
+constexpr std::size_t k_batch = 256;
+
+/// A small message such as a market data update, allocated and freed at a high rate.
+struct Message {
+        Message(std::int64_t sequence, std::int64_t price): sequence(sequence), price(price) {}
+
+        std::int64_t sequence;
+        std::int64_t price;
+        std::array<std::int64_t, 4> payload{};
+};
+
+using Pool = CommonLib::ObjectPool<Message>;
+
+auto pool() -> Pool&
+{
+    static Pool instance(1024, 128);
+    return instance;
+}
+
+/// Swaps batches between threads, so that every batch is freed on another thread than the one
+/// that allocated it whenever more than one thread runs.
+template<typename Batch>
+class Mailbox
+{
+    public:
+        void exchange(Batch& batch)
+        {
+            std::lock_guard lock(m_mutex);
+            m_batch.swap(batch);
+        }
+
+        void clear()
+        {
+            std::lock_guard lock(m_mutex);
+            m_batch.clear();
+        }
+
+    private:
+        std::mutex m_mutex;
+        Batch m_batch;
+};
+
+template<typename Handle, typename Acquire>
+void run_cross_thread(benchmark::State& state, Mailbox<std::vector<Handle>>& mailbox,
+                      Acquire acquire)
+{
+    std::vector<Handle> batch;
+    batch.reserve(k_batch);
+    std::int64_t sequence = 0;
+    for (auto _: state)
+    {
+        for (std::size_t count = 0; count < k_batch; ++count)
+        {
+            batch.push_back(acquire(++sequence));
+        }
+        mailbox.exchange(batch);
+        batch.clear();
+    }
+    if (state.thread_index() == 0)
+    {
+        mailbox.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(k_batch));
+}
+}  // namespace
+
+/**
+ * @brief Allocates and frees one message at a time on the same thread with the global heap.
+ */
+static void BM_ObjectPool_SameThread_MakeUnique(benchmark::State& state)
+{
+    std::int64_t sequence = 0;
+    for (auto _: state)
+    {
+        auto message = std::make_unique<Message>(++sequence, 100);
+        benchmark::DoNotOptimize(message.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ObjectPool_SameThread_MakeUnique)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Allocates and frees one message at a time on the same thread with ObjectPool.
+ */
+static void BM_ObjectPool_SameThread_Pool(benchmark::State& state)
+{
+    std::int64_t sequence = 0;
+    for (auto _: state)
+    {
+        auto message = pool().acquire(++sequence, 100);
+        benchmark::DoNotOptimize(message.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ObjectPool_SameThread_Pool)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Allocates batches of messages with the global heap and frees them on other threads.
+ */
+static void BM_ObjectPool_CrossThreadFree_MakeUnique(benchmark::State& state)
+{
+    static Mailbox<std::vector<std::unique_ptr<Message>>> mailbox;
+    run_cross_thread(state, mailbox, [](std::int64_t sequence) {
+        return std::make_unique<Message>(sequence, 100);
+    });
+}
+BENCHMARK(BM_ObjectPool_CrossThreadFree_MakeUnique)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Allocates batches of messages from ObjectPool and frees them on other threads.
+ */
+static void BM_ObjectPool_CrossThreadFree_Pool(benchmark::State& state)
+{
+    static Mailbox<std::vector<Pool::Handle>> mailbox;
+    run_cross_thread(state, mailbox,
+                     [](std::int64_t sequence) { return pool().acquire(sequence, 100); });
+}
+BENCHMARK(BM_ObjectPool_CrossThreadFree_Pool)->ThreadRange(1, 8)->UseRealTime();
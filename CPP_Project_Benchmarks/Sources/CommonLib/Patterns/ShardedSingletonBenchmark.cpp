@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include "CommonLib/Patterns/ShardedSingleton.h"
+#include "CommonLib/Patterns/Singleton.h"
+
+namespace
+{
+class SharedCounter: public CommonLib::Singleton<SharedCounter>
+{
+        friend class CommonLib::Singleton<SharedCounter>;
+
+    public:
+        void add() noexcept
+        {
+            m_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+    private:
+        SharedCounter() = default;
+
+        std::atomic<std::uint64_t> m_count{0};
+};
+
+class ShardedCounter: public CommonLib::ShardedSingleton<ShardedCounter>
+{
+        friend class CommonLib::ShardedSingleton<ShardedCounter>;
+
+    public:
+        void add() noexcept
+        {
+            m_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto count() const noexcept -> std::uint64_t
+        {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+    private:
+        ShardedCounter() = default;
+        ~ShardedCounter() = default;
+
+        std::atomic<std::uint64_t> m_count{0};
+};
+}  // namespace
+
+/**
+ * @brief Baseline: one process-wide counter incremented with an atomic from all threads.
+ */
+static void BM_SharedSingleton_AtomicIncrement(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        SharedCounter::get_instance().add();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedSingleton_AtomicIncrement)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Incrementing the counter of the current CPU's shard from all threads.
+ */
+static void BM_ShardedSingleton_LocalIncrement(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        ShardedCounter::local().add();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ShardedSingleton_LocalIncrement)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief CpuShard::current() alone.
+ */
+static void BM_CpuShard_Current(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::CpuShard::current());
+    }
+}
+BENCHMARK(BM_CpuShard_Current);
+
+/**
+ * @brief Summing the counters of all shards.
+ */
+static void BM_ShardedSingleton_Aggregate(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(ShardedCounter::aggregate(
+            std::uint64_t{0},
+            [](std::uint64_t sum, const ShardedCounter& shard) { return sum + shard.count(); }));
+    }
+}
+BENCHMARK(BM_ShardedSingleton_Aggregate);
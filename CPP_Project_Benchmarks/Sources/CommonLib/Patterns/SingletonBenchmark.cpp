@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include "CommonLib/Patterns/ManagedSingleton.h"
+#include "CommonLib/Patterns/Singleton.h"
+
+namespace
+{
+class BenchmarkSingleton: public CommonLib::Singleton<BenchmarkSingleton>
+{
+        friend class CommonLib::Singleton<BenchmarkSingleton>;
+
+    public:
+        [[nodiscard]] auto value() const noexcept -> int
+        {
+            return m_value;
+        }
+
+    private:
+        BenchmarkSingleton() = default;
+
+        int m_value = 42;
+};
+
+class ManagedBenchmarkSingleton: public CommonLib::ManagedSingleton<ManagedBenchmarkSingleton>
+{
+        friend class CommonLib::ManagedSingleton<ManagedBenchmarkSingleton>;
+
+    public:
+        [[nodiscard]] auto value() const noexcept -> int
+        {
+            return m_value;
+        }
+
+    private:
+        ManagedBenchmarkSingleton() = default;
+        ~ManagedBenchmarkSingleton() = default;
+
+        int m_value = 42;
+};
+
+/// Baseline: a namespace-scope object, accessed without any initialization check.
+const int g_plain_value = 42;
+}  // namespace
+
+/**
+ * @brief Singleton::get_instance() after the instance has been created.
+ */
+static void BM_Singleton_GetInstance(benchmark::State& state)
+{
+    static_cast<void>(BenchmarkSingleton::get_instance());
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(BenchmarkSingleton::get_instance().value());
+    }
+}
+BENCHMARK(BM_Singleton_GetInstance);
+
+/**
+ * @brief Singleton::get_instance() from several threads at once.
+ */
+static void BM_Singleton_GetInstance_Threads(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(BenchmarkSingleton::get_instance().value());
+    }
+}
+BENCHMARK(BM_Singleton_GetInstance_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief ManagedSingleton::instance(): a plain pointer load, no initialization guard.
+ */
+static void BM_ManagedSingleton_Instance(benchmark::State& state)
+{
+    ManagedBenchmarkSingleton::initialize();
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(ManagedBenchmarkSingleton::instance().value());
+    }
+}
+BENCHMARK(BM_ManagedSingleton_Instance);
+
+/**
+ * @brief ManagedSingleton::instance() from several threads at once.
+ */
+static void BM_ManagedSingleton_Instance_Threads(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        ManagedBenchmarkSingleton::initialize();
+    }
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(ManagedBenchmarkSingleton::instance().value());
+    }
+}
+BENCHMARK(BM_ManagedSingleton_Instance_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Initialization and ordered teardown of a managed singleton.
+ */
+static void BM_ManagedSingleton_InitializeShutdown(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        ManagedBenchmarkSingleton::initialize();
+        CommonLib::SingletonRegistry::shutdown();
+    }
+    ManagedBenchmarkSingleton::initialize();
+}
+BENCHMARK(BM_ManagedSingleton_InitializeShutdown);
+
+/**
+ * @brief Baseline: reading a global object.
+ */
+static void BM_Singleton_PlainGlobal(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(g_plain_value);
+    }
+}
+BENCHMARK(BM_Singleton_PlainGlobal);
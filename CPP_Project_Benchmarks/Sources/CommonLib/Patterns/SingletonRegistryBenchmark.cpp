@@ -0,0 +1,155 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "CommonLib/Patterns/ManagedSingleton.h"
+#include "CommonLib/Patterns/SingletonRegistry.h"
+
+namespace
+{
+/// How long each backing singleton takes to load, e.g. reading a file or opening connections.
+constexpr std::chrono::milliseconds k_load_time{2};
+
+/// A singleton whose construction waits on I/O; Index only tells the instances apart.
+template<int Index>
+class Backend: public CommonLib::ManagedSingleton<Backend<Index>>
+{
+        friend class CommonLib::ManagedSingleton<Backend<Index>>;
+
+    public:
+        [[nodiscard]] auto value() const noexcept -> std::int64_t
+        {
+            return m_value;
+        }
+
+    private:
+        Backend()
+        {
+            std::this_thread::sleep_for(k_load_time);
+        }
+
+        ~Backend() = default;
+
+        std::int64_t m_value = Index;
+};
+
+using Tables = Backend<0>;
+using Zones = Backend<1>;
+using Connections = Backend<2>;
+using Templates = Backend<3>;
+using Translations = Backend<4>;
+using Certificates = Backend<5>;
+
+/// The singleton that serves requests; it needs all backends.
+class RequestHandler
+    : public CommonLib::ManagedSingleton<RequestHandler, Tables, Zones, Connections, Templates,
+                                         Translations, Certificates>
+{
+        friend class CommonLib::ManagedSingleton<RequestHandler, Tables, Zones, Connections,
+                                                 Templates, Translations, Certificates>;
+
+    public:
+        [[nodiscard]] auto handle(std::int64_t request) const noexcept -> std::int64_t
+        {
+            return request + m_sum;
+        }
+
+    private:
+        RequestHandler()
+            : m_sum(Tables::instance().value() + Zones::instance().value() +
+                    Connections::instance().value() + Templates::instance().value() +
+                    Translations::instance().value() + Certificates::instance().value())
+        {
+        }
+
+        ~RequestHandler() = default;
+
+        std::int64_t m_sum;
+};
+}  // namespace
+
+/**
+ * @brief Startup wall time of SingletonRegistry::initialize(): one singleton after another.
+ */
+static void BM_SingletonRegistry_Startup_Initialize(benchmark::State& state)
+{
+    CommonLib::SingletonRegistry::shutdown();
+    for (auto _: state)
+    {
+        CommonLib::SingletonRegistry::initialize();
+        state.PauseTiming();
+        CommonLib::SingletonRegistry::shutdown();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_SingletonRegistry_Startup_Initialize)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * @brief Startup wall time of SingletonRegistry::warm_up() with the given number of threads.
+ */
+static void BM_SingletonRegistry_Startup_WarmUp(benchmark::State& state)
+{
+    CommonLib::SingletonRegistry::shutdown();
+    std::chrono::nanoseconds slowest{0};
+    for (auto _: state)
+    {
+        const auto timings =
+            CommonLib::SingletonRegistry::warm_up(static_cast<std::size_t>(state.range(0)));
+        state.PauseTiming();
+        for (const auto& timing: timings)
+        {
+            slowest = std::max(slowest, timing.duration);
+        }
+        CommonLib::SingletonRegistry::shutdown();
+        state.ResumeTiming();
+    }
+    state.counters["slowest_init_ms"] = std::chrono::duration<double, std::milli>(slowest).count();
+}
+BENCHMARK(BM_SingletonRegistry_Startup_WarmUp)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/**
+ * @brief Latency of the first request when the handler is only built on demand.
+ */
+static void BM_SingletonRegistry_FirstRequest_Lazy(benchmark::State& state)
+{
+    std::int64_t request = 0;
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        CommonLib::SingletonRegistry::shutdown();
+        state.ResumeTiming();
+        RequestHandler::initialize();
+        benchmark::DoNotOptimize(RequestHandler::instance().handle(++request));
+    }
+    CommonLib::SingletonRegistry::shutdown();
+}
+BENCHMARK(BM_SingletonRegistry_FirstRequest_Lazy)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+/**
+ * @brief Latency of the first request after SingletonRegistry::warm_up() at startup.
+ */
+static void BM_SingletonRegistry_FirstRequest_WarmedUp(benchmark::State& state)
+{
+    std::int64_t request = 0;
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        CommonLib::SingletonRegistry::shutdown();
+        static_cast<void>(CommonLib::SingletonRegistry::warm_up());
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(RequestHandler::instance().handle(++request));
+    }
+    CommonLib::SingletonRegistry::shutdown();
+}
+BENCHMARK(BM_SingletonRegistry_FirstRequest_WarmedUp)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include "CommonLib/Patterns/ThreadLocalSingleton.h"
+
+namespace
+{
+class ThreadCounter: public CommonLib::ThreadLocalSingleton<ThreadCounter>
+{
+        friend class CommonLib::ThreadLocalSingleton<ThreadCounter>;
+
+    public:
+        void add() noexcept
+        {
+            // Only the owning thread writes, so a relaxed load and store replace the locked add.
+            m_count.store(m_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto count() const noexcept -> std::uint64_t
+        {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+    private:
+        ThreadCounter() = default;
+        ~ThreadCounter() = default;
+
+        std::atomic<std::uint64_t> m_count{0};
+};
+}  // namespace
+
+/**
+ * @brief Incrementing the calling thread's counter from all threads; compare with
+ *        BM_SharedSingleton_AtomicIncrement.
+ */
+static void BM_ThreadLocalSingleton_Increment(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        ThreadCounter::get_instance().add();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadLocalSingleton_Increment)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Summing the counters of all threads that used the singleton.
+ */
+static void BM_ThreadLocalSingleton_Aggregate(benchmark::State& state)
+{
+    static_cast<void>(ThreadCounter::get_instance());
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(ThreadCounter::aggregate(
+            std::uint64_t{0},
+            [](std::uint64_t sum, const ThreadCounter& counter) { return sum + counter.count(); }));
+    }
+}
+BENCHMARK(BM_ThreadLocalSingleton_Aggregate);
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "CommonLib/Profiling/LatencyHistogram.h"
+
+namespace
+{
+/**
+ * @brief Log-normally distributed latencies, so that the recorded buckets vary.
+ */
+auto make_samples() -> std::vector<std::uint64_t>
+{
+    std::mt19937_64 engine(42);
+    std::lognormal_distribution<double> distribution(10.8, 1.5);
+    std::vector<std::uint64_t> samples(4096);
+    for (auto& sample: samples)
+    {
+        sample = static_cast<std::uint64_t>(distribution(engine));
+    }
+    return samples;
+}
+}  // namespace
+
+/**
+ * @brief LatencyHistogram::record() with the default layout (3 digits, up to one hour).
+ */
+static void BM_LatencyHistogram_Record(benchmark::State& state)
+{
+    const std::vector<std::uint64_t> samples = make_samples();
+    CommonLib::LatencyHistogram histogram;
+    std::size_t i = 0;
+    for (auto _: state)
+    {
+        histogram.record(samples[i++ & (samples.size() - 1)]);
+    }
+    benchmark::DoNotOptimize(histogram.count());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LatencyHistogram_Record);
+
+/**
+ * @brief Baseline: appending to a vector that is sorted for the percentiles later.
+ */
+static void BM_LatencyHistogram_VectorPushBack(benchmark::State& state)
+{
+    const std::vector<std::uint64_t> samples = make_samples();
+    std::vector<std::uint64_t> values;
+    std::size_t i = 0;
+    for (auto _: state)
+    {
+        values.push_back(samples[i++ & (samples.size() - 1)]);
+    }
+    benchmark::DoNotOptimize(values.data());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LatencyHistogram_VectorPushBack);
+
+/**
+ * @brief ConcurrentLatencyHistogram::record() from several threads into one instance.
+ */
+static void BM_LatencyHistogram_ConcurrentRecord_Threads(benchmark::State& state)
+{
+    static CommonLib::ConcurrentLatencyHistogram histogram;
+    const std::vector<std::uint64_t> samples = make_samples();
+    std::size_t i = static_cast<std::size_t>(state.thread_index()) * 997;
+    for (auto _: state)
+    {
+        histogram.record(samples[i++ & (samples.size() - 1)]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LatencyHistogram_ConcurrentRecord_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief percentile(99.9) over a histogram of one million samples.
+ */
+static void BM_LatencyHistogram_Percentile(benchmark::State& state)
+{
+    const std::vector<std::uint64_t> samples = make_samples();
+    CommonLib::LatencyHistogram histogram;
+    for (std::size_t i = 0; i < 1'000'000; ++i)
+    {
+        histogram.record(samples[i & (samples.size() - 1)]);
+    }
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(histogram.percentile(99.9));
+    }
+}
+BENCHMARK(BM_LatencyHistogram_Percentile);
+
+/**
+ * @brief Merging two histograms with the default layout.
+ */
+static void BM_LatencyHistogram_Merge(benchmark::State& state)
+{
+    CommonLib::LatencyHistogram target;
+    CommonLib::LatencyHistogram source;
+    for (const std::uint64_t sample: make_samples())
+    {
+        source.record(sample);
+    }
+    for (auto _: state)
+    {
+        target.merge(source);
+    }
+    benchmark::DoNotOptimize(target.count());
+}
+BENCHMARK(BM_LatencyHistogram_Merge);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include "CommonLib/Profiling/ScopedTimer.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+/**
+ * @brief Baseline: an empty scope timed by hand with DateTimeUtils::timer_now().
+ */
+static void BM_ScopedTimer_ManualTimerNow(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        const auto start = CommonLib::DateTimeUtils::timer_now();
+        benchmark::DoNotOptimize(
+            CommonLib::DateTimeUtils::elapsed_us(start, CommonLib::DateTimeUtils::timer_now()));
+    }
+}
+BENCHMARK(BM_ScopedTimer_ManualTimerNow);
+
+/**
+ * @brief The overhead of COMMONLIB_SCOPED_TIMER around an empty scope.
+ */
+static void BM_ScopedTimer_EmptyScope(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        COMMONLIB_SCOPED_TIMER("BM_ScopedTimer_EmptyScope");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ScopedTimer_EmptyScope);
+
+/**
+ * @brief The macro on several threads recording into the same site.
+ */
+static void BM_ScopedTimer_EmptyScope_Threads(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        COMMONLIB_SCOPED_TIMER("BM_ScopedTimer_EmptyScope_Threads");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ScopedTimer_EmptyScope_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief The cost of merging all threads with TimerRegistry::snapshot().
+ */
+static void BM_ScopedTimer_Snapshot(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::TimerRegistry::snapshot());
+    }
+}
+BENCHMARK(BM_ScopedTimer_Snapshot);
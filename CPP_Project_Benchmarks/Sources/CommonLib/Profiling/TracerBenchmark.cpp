@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+
+#include "CommonLib/Profiling/Tracer.h"
+
+/**
+ * @brief The cost of one Tracer::instant() into the overwriting ring buffer.
+ */
+static void BM_Tracer_Instant(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        CommonLib::Tracer::instant("BM_Tracer_Instant");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Tracer_Instant);
+
+/**
+ * @brief The cost of COMMONLIB_TRACE_SCOPE around an empty scope (two events).
+ */
+static void BM_Tracer_Scope(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        COMMONLIB_TRACE_SCOPE("BM_Tracer_Scope");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Tracer_Scope);
+
+/**
+ * @brief Tracer::instant() on several threads, each with its own buffer.
+ */
+static void BM_Tracer_Instant_Threads(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        CommonLib::Tracer::instant("BM_Tracer_Instant_Threads");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Tracer_Instant_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Draining a full 64K-event buffer and writing it as Chrome JSON.
+ */
+static void BM_Tracer_DrainAndWriteJson(benchmark::State& state)
+{
+    static_cast<void>(CommonLib::Tracer::drain());  // Events of the other benchmarks
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        for (std::size_t i = 0; i < CommonLib::Tracer::k_default_capacity; ++i)
+        {
+            CommonLib::Tracer::instant("BM_Tracer_DrainAndWriteJson");
+        }
+        state.ResumeTiming();
+
+        std::ostringstream out;
+        CommonLib::Tracer::write_chrome_json(out, CommonLib::Tracer::drain());
+        benchmark::DoNotOptimize(out.tellp());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(CommonLib::Tracer::k_default_capacity));
+}
+BENCHMARK(BM_Tracer_DrainAndWriteJson);
@@ -0,0 +1,202 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "CommonLib/Scheduling/TimingWheel.h"
+
+namespace
+{
+using Clock = CommonLib::TimingWheel::Clock;
+using std::chrono::milliseconds;
+
+const Clock::time_point k_start = Clock::time_point(std::chrono::hours(1));
+constexpr std::int64_t k_max_delay_ms = 60'000;
+
+/**
+ * @brief Deadlines spread uniformly over one minute, as for connection idle timeouts.
+ */
+auto make_delays(std::size_t count) -> std::vector<std::int64_t>
+{
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<std::int64_t> distribution(1, k_max_delay_ms);
+    std::vector<std::int64_t> delays(count);
+    for (auto& delay: delays)
+    {
+        delay = distribution(engine);
+    }
+    return delays;
+}
+
+/**
+ * @brief The baseline: a binary heap of deadlines with lazy cancellation by generation.
+ */
+struct HeapEntry {
+        Clock::time_point deadline;
+        std::uint32_t timer;
+        std::uint32_t generation;
+
+        auto operator>(const HeapEntry& other) const noexcept -> bool
+        {
+            return deadline > other.deadline;
+        }
+};
+
+using Heap = std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<>>;
+}  // namespace
+
+/**
+ * @brief Schedules N timers and fires them all, advancing one millisecond at a time.
+ */
+static void BM_TimingWheel_ScheduleAndExpire(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> delays = make_delays(count);
+    const auto nodes = std::make_unique<CommonLib::TimerNode[]>(count);
+    for (auto _: state)
+    {
+        CommonLib::TimingWheel wheel(milliseconds(1), k_start);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            wheel.schedule(nodes[i], k_start + milliseconds(delays[i]));
+        }
+        std::size_t fired = 0;
+        for (std::int64_t now = 1; now <= k_max_delay_ms; ++now)
+        {
+            fired += wheel.advance(k_start + milliseconds(now), [](CommonLib::TimerNode&) {});
+        }
+        benchmark::DoNotOptimize(fired);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimingWheel_ScheduleAndExpire)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Baseline: the same workload with std::priority_queue.
+ */
+static void BM_PriorityQueue_ScheduleAndExpire(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> delays = make_delays(count);
+    for (auto _: state)
+    {
+        Heap heap;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            heap.push({k_start + milliseconds(delays[i]), static_cast<std::uint32_t>(i), 0});
+        }
+        std::size_t fired = 0;
+        for (std::int64_t now = 1; now <= k_max_delay_ms; ++now)
+        {
+            const Clock::time_point time = k_start + milliseconds(now);
+            while (!heap.empty() && heap.top().deadline <= time)
+            {
+                heap.pop();
+                ++fired;
+            }
+        }
+        benchmark::DoNotOptimize(fired);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PriorityQueue_ScheduleAndExpire)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Pushes a random pending timer's deadline back, as on every request of a connection.
+ */
+static void BM_TimingWheel_Reschedule(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> delays = make_delays(count);
+    const auto nodes = std::make_unique<CommonLib::TimerNode[]>(count);
+    CommonLib::TimingWheel wheel(milliseconds(1), k_start);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        wheel.schedule(nodes[i], k_start + milliseconds(delays[i]));
+    }
+
+    std::size_t i = 0;
+    for (auto _: state)
+    {
+        const std::size_t timer = (i * 2654435761U) % count;
+        wheel.schedule(nodes[timer], k_start + milliseconds(delays[i % count] + k_max_delay_ms));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimingWheel_Reschedule)->Arg(1 << 20);
+
+/**
+ * @brief Baseline: rescheduling with std::priority_queue, which cannot remove an entry; the old
+ *        one is invalidated by a generation counter and the heap is compacted when it doubles.
+ */
+static void BM_PriorityQueue_Reschedule(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> delays = make_delays(count);
+    std::vector<std::uint32_t> generations(count, 0);
+    std::vector<HeapEntry> entries;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        entries.push_back({k_start + milliseconds(delays[i]), static_cast<std::uint32_t>(i), 0});
+    }
+    Heap heap(std::greater<>(), std::move(entries));
+
+    std::size_t i = 0;
+    for (auto _: state)
+    {
+        const std::size_t timer = (i * 2654435761U) % count;
+        heap.push({k_start + milliseconds(delays[i % count] + k_max_delay_ms),
+                   static_cast<std::uint32_t>(timer), ++generations[timer]});
+        if (heap.size() >= 2 * count)
+        {
+            std::vector<HeapEntry> live;
+            while (!heap.empty())
+            {
+                if (heap.top().generation == generations[heap.top().timer])
+                {
+                    live.push_back(heap.top());
+                }
+                heap.pop();
+            }
+            heap = Heap(std::greater<>(), std::move(live));
+        }
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PriorityQueue_Reschedule)->Arg(1 << 20);
+
+/**
+ * @brief Cancels and re-adds a random pending timer.
+ */
+static void BM_TimingWheel_Cancel(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::int64_t> delays = make_delays(count);
+    const auto nodes = std::make_unique<CommonLib::TimerNode[]>(count);
+    CommonLib::TimingWheel wheel(milliseconds(1), k_start);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        wheel.schedule(nodes[i], k_start + milliseconds(delays[i]));
+    }
+
+    std::size_t i = 0;
+    for (auto _: state)
+    {
+        const std::size_t timer = (i * 2654435761U) % count;
+        benchmark::DoNotOptimize(wheel.cancel(nodes[timer]));
+        wheel.schedule(nodes[timer], k_start + milliseconds(delays[timer]));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimingWheel_Cancel)->Arg(1 << 20);
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <span>
+#include <string>
+
+#include "CommonLib/Utils/CachedDateTimeFormatter.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+constexpr const char* k_format = "%Y-%m-%d %H:%M:%S.%6N";
+}  // namespace
+
+/**
+ * @brief Uncached rendering of the current time into a stack buffer.
+ */
+static void BM_DateTimeFormatter_Now_Local(benchmark::State& state)
+{
+    const CommonLib::DateTimeFormatter formatter(k_format);
+    std::array<char, 64> buffer{};
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            formatter.format_to(std::span<char>(buffer), std::chrono::system_clock::now()));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_DateTimeFormatter_Now_Local)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Cached rendering of the current time into a stack buffer.
+ */
+static void BM_CachedDateTimeFormatter_Now_Local(benchmark::State& state)
+{
+    CommonLib::CachedDateTimeFormatter formatter(k_format);
+    std::array<char, 64> buffer{};
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            formatter.format_to(std::span<char>(buffer), std::chrono::system_clock::now()));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_CachedDateTimeFormatter_Now_Local)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::now() versus DateTimeUtils::now_cached() under multi-threaded load.
+ */
+static void BM_DateTimeUtils_Now(benchmark::State& state)
+{
+    const std::string format = k_format;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::now(format));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_Now)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_DateTimeUtils_NowCached(benchmark::State& state)
+{
+    const std::string format = k_format;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::now_cached(format));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_NowCached)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::now_utc() versus DateTimeUtils::now_utc_cached() under multi-threaded load.
+ */
+static void BM_DateTimeUtils_NowUtc(benchmark::State& state)
+{
+    const std::string format = k_format;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::now_utc(format));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_NowUtc)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_DateTimeUtils_NowUtcCached(benchmark::State& state)
+{
+    const std::string format = k_format;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::now_utc_cached(format));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_NowUtcCached)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <ctime>
+
+#include "CommonLib/Utils/CivilTime.h"
+
+namespace
+{
+constexpr std::int64_t k_start_seconds = 1672531200;
+}  // namespace
+
+/**
+ * @brief Baseline: gmtime_r / gmtime_s breakdown of Unix seconds.
+ */
+static void BM_Gmtime(benchmark::State& state)
+{
+    std::int64_t seconds = k_start_seconds;
+    for (auto _: state)
+    {
+        const auto t = static_cast<std::time_t>(seconds);
+        std::tm tm_buf{};
+#if defined(_WIN32)
+        gmtime_s(&tm_buf, &t);
+#else
+        gmtime_r(&t, &tm_buf);
+#endif
+        benchmark::DoNotOptimize(tm_buf);
+        seconds += 3607;
+    }
+}
+BENCHMARK(BM_Gmtime)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief CivilTime breakdown of Unix seconds.
+ */
+static void BM_CivilTime_FromUnixSeconds(benchmark::State& state)
+{
+    std::int64_t seconds = k_start_seconds;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::CivilTime::from_unix_seconds(seconds));
+        seconds += 3607;
+    }
+}
+BENCHMARK(BM_CivilTime_FromUnixSeconds)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Baseline: mktime on a broken-down time (local time zone, takes the tz lock).
+ */
+static void BM_Mktime(benchmark::State& state)
+{
+    std::tm tm_buf{};
+    tm_buf.tm_year = 123;
+    tm_buf.tm_mday = 1;
+    for (auto _: state)
+    {
+        std::tm copy = tm_buf;
+        benchmark::DoNotOptimize(std::mktime(&copy));
+        tm_buf.tm_sec = (tm_buf.tm_sec + 1) % 60;
+    }
+}
+BENCHMARK(BM_Mktime)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief CivilTime conversion of calendar fields to Unix seconds.
+ */
+static void BM_CivilTime_ToUnixSeconds(benchmark::State& state)
+{
+    CommonLib::CivilDateTime civil = CommonLib::CivilTime::from_unix_seconds(k_start_seconds);
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::CivilTime::to_unix_seconds(civil));
+        civil.second = (civil.second + 1) % 60;
+    }
+}
+BENCHMARK(BM_CivilTime_ToUnixSeconds)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief CivilTime breakdown of Unix nanoseconds.
+ */
+static void BM_CivilTime_FromUnixNanoseconds(benchmark::State& state)
+{
+    std::int64_t nanoseconds = k_start_seconds * 1000000000;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::CivilTime::from_unix_nanoseconds(nanoseconds));
+        nanoseconds += 3607123456789;
+    }
+}
+BENCHMARK(BM_CivilTime_FromUnixNanoseconds)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+#include "CommonLib/Utils/ClockSource.h"
+#include "CommonLib/Utils/CoarseClock.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+#include "CommonLib/Utils/TscClock.h"
+
+namespace
+{
+/**
+ * @brief Measures one start/stop pair, with the conversion to microseconds per iteration.
+ */
+template<CommonLib::ClockSource Clock>
+void run_interval(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        const auto start = Clock::now();
+        const auto end = Clock::now();
+        benchmark::DoNotOptimize(Clock::elapsed_us(start, end));
+    }
+}
+}  // namespace
+
+/**
+ * @brief Baseline: DateTimeUtils::timer_now() (steady_clock through an out-of-line call).
+ */
+static void BM_Clock_TimerNow(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::timer_now());
+    }
+}
+BENCHMARK(BM_Clock_TimerNow);
+
+/**
+ * @brief SteadyClock::now() (inlined steady_clock).
+ */
+static void BM_Clock_SteadyNow(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::SteadyClock::now());
+    }
+}
+BENCHMARK(BM_Clock_SteadyNow);
+
+/**
+ * @brief TscClock::now() (RDTSC).
+ */
+static void BM_Clock_TscNow(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::TscClock::now());
+    }
+}
+BENCHMARK(BM_Clock_TscNow);
+
+/**
+ * @brief TscClock::now_ordered() (RDTSCP).
+ */
+static void BM_Clock_TscNowOrdered(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::TscClock::now_ordered());
+    }
+}
+BENCHMARK(BM_Clock_TscNowOrdered);
+
+/**
+ * @brief CoarseSteadyClock::now() (CLOCK_MONOTONIC_COARSE).
+ */
+static void BM_Clock_CoarseSteadyNow(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::CoarseSteadyClock::now());
+    }
+}
+BENCHMARK(BM_Clock_CoarseSteadyNow);
+
+/**
+ * @brief CoarseSystemClock::now() (CLOCK_REALTIME_COARSE).
+ */
+static void BM_Clock_CoarseSystemNow(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::CoarseSystemClock::now());
+    }
+}
+BENCHMARK(BM_Clock_CoarseSystemNow);
+
+/**
+ * @brief A full measurement with DateTimeUtils::timer_now() and elapsed_us().
+ */
+static void BM_Clock_TimerNowInterval(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        const auto start = CommonLib::DateTimeUtils::timer_now();
+        const auto end = CommonLib::DateTimeUtils::timer_now();
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::elapsed_us(start, end));
+    }
+}
+BENCHMARK(BM_Clock_TimerNowInterval);
+
+/**
+ * @brief A full measurement with TscClock, including the tick conversion.
+ */
+static void BM_Clock_TscInterval(benchmark::State& state)
+{
+    run_interval<CommonLib::TscClock>(state);
+}
+BENCHMARK(BM_Clock_TscInterval);
+
+/**
+ * @brief A full measurement with CoarseSteadyClock.
+ */
+static void BM_Clock_CoarseSteadyInterval(benchmark::State& state)
+{
+    run_interval<CommonLib::CoarseSteadyClock>(state);
+}
+BENCHMARK(BM_Clock_CoarseSteadyInterval);
+
+/**
+ * @brief TscClock::now() on several threads.
+ */
+static void BM_Clock_TscNow_Threads(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::TscClock::now());
+    }
+}
+BENCHMARK(BM_Clock_TscNow_Threads)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CommonLib/Utils/DateTimeBatchFormatter.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+constexpr std::size_t k_batch_size = 4096;
+
+/**
+ * @brief A column of time points one minute and a bit apart, with millisecond fractions.
+ */
+auto make_column() -> const std::vector<std::chrono::system_clock::time_point>&
+{
+    static const std::vector<std::chrono::system_clock::time_point> column = [] {
+        std::vector<std::chrono::system_clock::time_point> result;
+        for (std::size_t i = 0; i < k_batch_size; ++i)
+        {
+            result.emplace_back(std::chrono::milliseconds(1700000000000 + i * 61007));
+        }
+        return result;
+    }();
+    return column;
+}
+
+void run_batch(benchmark::State& state, CommonLib::SimdLevel level)
+{
+    if (!CommonLib::CpuFeatures::supports(level))
+    {
+        state.SkipWithError("SIMD level not supported by this CPU");
+        return;
+    }
+
+    const auto& column = make_column();
+    const CommonLib::DateTimeBatchFormatter::Format format{3, true};
+    std::vector<char> buffer(
+        CommonLib::DateTimeBatchFormatter::required_size(column.size(), format, "\n"));
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeBatchFormatter::format_many(
+            column, format, buffer, "\n", level));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * column.size()));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+}  // namespace
+
+/**
+ * @brief Baseline: DateTimeUtils::to_string per value, appended to one export string.
+ */
+static void BM_BatchFormat_ToStringPerItem(benchmark::State& state)
+{
+    const auto& column = make_column();
+    for (auto _: state)
+    {
+        std::string text;
+        for (const auto& tp: column)
+        {
+            text += CommonLib::DateTimeUtils::to_string(tp, "%Y-%m-%dT%H:%M:%S");
+            text += '\n';
+        }
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * column.size()));
+}
+BENCHMARK(BM_BatchFormat_ToStringPerItem);
+
+/**
+ * @brief Batch formatting with the scalar kernel.
+ */
+static void BM_BatchFormat_Scalar(benchmark::State& state)
+{
+    run_batch(state, CommonLib::SimdLevel::Scalar);
+}
+BENCHMARK(BM_BatchFormat_Scalar);
+
+/**
+ * @brief Batch formatting with the AVX2 kernel.
+ */
+static void BM_BatchFormat_Avx2(benchmark::State& state)
+{
+    run_batch(state, CommonLib::SimdLevel::Avx2);
+}
+BENCHMARK(BM_BatchFormat_Avx2);
+
+/**
+ * @brief Batch formatting with the AVX2 kernel on several threads (independent buffers).
+ */
+static void BM_BatchFormat_Avx2_Threads(benchmark::State& state)
+{
+    run_batch(state, CommonLib::SimdLevel::Avx2);
+}
+BENCHMARK(BM_BatchFormat_Avx2_Threads)->ThreadRange(1, 8)->UseRealTime();
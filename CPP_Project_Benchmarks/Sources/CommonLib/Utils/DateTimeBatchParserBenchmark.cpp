@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CommonLib/Utils/CivilTime.h"
+#include "CommonLib/Utils/DateTimeBatchParser.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+constexpr std::size_t k_batch_size = 4096;
+
+/**
+ * @brief A column of "YYYY-MM-DDThh:mm:ss.mmm" timestamps one minute and a bit apart.
+ */
+auto make_column() -> const std::vector<std::string>&
+{
+    static const std::vector<std::string> column = [] {
+        std::vector<std::string> result;
+        for (std::size_t i = 0; i < k_batch_size; ++i)
+        {
+            const auto civil =
+                CommonLib::CivilTime::from_unix_milliseconds(1700000000000 + i * 61007);
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02uT%02u:%02u:%02u.%03u", civil.year,
+                          civil.month, civil.day, civil.hour, civil.minute, civil.second,
+                          civil.nanosecond / 1000000);
+            result.emplace_back(buffer);
+        }
+        return result;
+    }();
+    return column;
+}
+
+void run_batch(benchmark::State& state, CommonLib::SimdLevel level)
+{
+    if (!CommonLib::CpuFeatures::supports(level))
+    {
+        state.SkipWithError("SIMD level not supported by this CPU");
+        return;
+    }
+
+    const auto& column = make_column();
+    const std::vector<std::string_view> input(column.begin(), column.end());
+    std::vector<std::int64_t> output(input.size());
+    std::vector<CommonLib::DateTimeBatchParser::Status> status(input.size());
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            CommonLib::DateTimeBatchParser::parse(input, {3, false}, output, status, level));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+}  // namespace
+
+/**
+ * @brief Baseline: DateTimeUtils::from_string per cell (istringstream/get_time + mktime).
+ */
+static void BM_Batch_FromStringPerItem(benchmark::State& state)
+{
+    const auto& column = make_column();
+    std::size_t index = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            CommonLib::DateTimeUtils::from_string(column[index], "%Y-%m-%dT%H:%M:%S"));
+        index = (index + 1) % column.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Batch_FromStringPerItem);
+
+/**
+ * @brief Baseline: DateTimeParser::parse_iso8601 per cell.
+ */
+static void BM_Batch_ParserPerItem(benchmark::State& state)
+{
+    const auto& column = make_column();
+    for (auto _: state)
+    {
+        for (const auto& cell: column)
+        {
+            benchmark::DoNotOptimize(CommonLib::DateTimeParser::parse_iso8601(cell));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * column.size()));
+}
+BENCHMARK(BM_Batch_ParserPerItem);
+
+/**
+ * @brief Batch parse with the scalar kernel.
+ */
+static void BM_Batch_Scalar(benchmark::State& state)
+{
+    run_batch(state, CommonLib::SimdLevel::Scalar);
+}
+BENCHMARK(BM_Batch_Scalar);
+
+/**
+ * @brief Batch parse with the SSSE3 kernel.
+ */
+static void BM_Batch_Ssse3(benchmark::State& state)
+{
+    run_batch(state, CommonLib::SimdLevel::Ssse3);
+}
+BENCHMARK(BM_Batch_Ssse3);
+
+/**
+ * @brief Batch parse with the AVX2 kernel.
+ */
+static void BM_Batch_Avx2(benchmark::State& state)
+{
+    run_batch(state, CommonLib::SimdLevel::Avx2);
+}
+BENCHMARK(BM_Batch_Avx2);
+
+/**
+ * @brief Batch parse with the AVX2 kernel on several threads (independent columns).
+ */
+static void BM_Batch_Avx2_Threads(benchmark::State& state)
+{
+    run_batch(state, CommonLib::SimdLevel::Avx2);
+}
+BENCHMARK(BM_Batch_Avx2_Threads)->ThreadRange(1, 8)->UseRealTime();
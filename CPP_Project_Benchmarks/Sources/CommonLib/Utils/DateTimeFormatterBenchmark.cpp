@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iterator>
+#include <span>
+#include <sstream>
+#include <string>
+
+#include "CommonLib/Utils/DateTimeFormatter.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+constexpr const char* k_format = "%Y-%m-%d %H:%M:%S";
+
+/**
+ * @brief Reference implementation of the former ostringstream/put_time rendering path.
+ */
+auto put_time_format(const std::chrono::system_clock::time_point& tp, const char* format,
+                     bool utc) -> std::string
+{
+    std::time_t time_c = std::chrono::system_clock::to_time_t(tp);
+    std::tm tm_buf{};
+#if defined(_WIN32)
+    utc ? gmtime_s(&tm_buf, &time_c) : localtime_s(&tm_buf, &time_c);
+#else
+    utc ? gmtime_r(&time_c, &tm_buf) : localtime_r(&time_c, &tm_buf);
+#endif
+    std::ostringstream oss;
+    oss << std::put_time(&tm_buf, format);
+    return oss.str();
+}
+}  // namespace
+
+/**
+ * @brief Baseline: ostringstream + std::put_time in local time.
+ */
+static void BM_PutTime_Local(benchmark::State& state)
+{
+    const auto tp = std::chrono::system_clock::now();
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(put_time_format(tp, k_format, false));
+    }
+}
+BENCHMARK(BM_PutTime_Local);
+
+/**
+ * @brief Baseline: ostringstream + std::put_time in UTC.
+ */
+static void BM_PutTime_Utc(benchmark::State& state)
+{
+    const auto tp = std::chrono::system_clock::now();
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(put_time_format(tp, k_format, true));
+    }
+}
+BENCHMARK(BM_PutTime_Utc);
+
+/**
+ * @brief Compiled formatter rendering into a stack buffer in local time.
+ */
+static void BM_DateTimeFormatter_FormatToSpan_Local(benchmark::State& state)
+{
+    const CommonLib::DateTimeFormatter formatter(k_format);
+    const auto tp = std::chrono::system_clock::now();
+    std::array<char, 64> buffer{};
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(formatter.format_to(std::span<char>(buffer), tp));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_DateTimeFormatter_FormatToSpan_Local);
+
+/**
+ * @brief Compiled formatter rendering into a stack buffer in UTC.
+ */
+static void BM_DateTimeFormatter_FormatToSpan_Utc(benchmark::State& state)
+{
+    const CommonLib::DateTimeFormatter formatter(k_format,
+                                                 CommonLib::DateTimeFormatter::Zone::Utc);
+    const auto tp = std::chrono::system_clock::now();
+    std::array<char, 64> buffer{};
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(formatter.format_to(std::span<char>(buffer), tp));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_DateTimeFormatter_FormatToSpan_Utc);
+
+/**
+ * @brief Compiled formatter appending to a reused string through an output iterator.
+ */
+static void BM_DateTimeFormatter_FormatToIterator_Utc(benchmark::State& state)
+{
+    const CommonLib::DateTimeFormatter formatter(k_format,
+                                                 CommonLib::DateTimeFormatter::Zone::Utc);
+    const auto tp = std::chrono::system_clock::now();
+    std::string line;
+    line.reserve(64);
+    for (auto _: state)
+    {
+        line.clear();
+        formatter.format_to(std::back_inserter(line), tp);
+        benchmark::DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(BM_DateTimeFormatter_FormatToIterator_Utc);
+
+/**
+ * @brief Uncompiled one-shot rendering into a stack buffer in UTC.
+ */
+static void BM_DateTimeFormatter_OneShot_Utc(benchmark::State& state)
+{
+    const auto tp = std::chrono::system_clock::now();
+    std::array<char, 64> buffer{};
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeFormatter::format_to(
+            buffer, k_format, tp, CommonLib::DateTimeFormatter::Zone::Utc));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_DateTimeFormatter_OneShot_Utc);
+
+/**
+ * @brief String-returning DateTimeUtils::format, now built on the formatter.
+ */
+static void BM_DateTimeUtils_Format_Local(benchmark::State& state)
+{
+    const auto tp = std::chrono::system_clock::now();
+    const std::string format = k_format;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::format(tp, format));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_Format_Local);
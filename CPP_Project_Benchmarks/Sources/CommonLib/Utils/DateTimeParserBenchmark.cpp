@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include "CommonLib/Utils/DateTimeParser.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+/**
+ * @brief Baseline: std::istringstream + std::get_time + std::mktime, the former from_string path.
+ */
+static void BM_GetTime_Mktime(benchmark::State& state)
+{
+    const std::string text = "2024-07-15 12:34:56";
+    for (auto _: state)
+    {
+        std::tm tm_buf = {};
+        std::istringstream iss(text);
+        iss >> std::get_time(&tm_buf, "%Y-%m-%d %H:%M:%S");
+        benchmark::DoNotOptimize(std::mktime(&tm_buf));
+    }
+}
+BENCHMARK(BM_GetTime_Mktime)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::from_string compatibility wrapper on its fast path.
+ */
+static void BM_DateTimeUtils_FromString(benchmark::State& state)
+{
+    const std::string text = "2024-07-15 12:34:56";
+    const std::string format = "%Y-%m-%d %H:%M:%S";
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::from_string(text, format));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_FromString)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::parse of a local timestamp (resolved through TimeZone).
+ */
+static void BM_DateTimeUtils_ParseLocal(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::parse("2024-07-15 12:34:56"));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_ParseLocal)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief RFC 3339 timestamp with nanoseconds and offset.
+ */
+static void BM_DateTimeParser_Rfc3339(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            CommonLib::DateTimeParser::parse_rfc3339("2024-07-15T12:34:56.123456789+02:00"));
+    }
+}
+BENCHMARK(BM_DateTimeParser_Rfc3339)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief RFC 1123 (HTTP) date.
+ */
+static void BM_DateTimeParser_Rfc1123(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            CommonLib::DateTimeParser::parse_rfc1123("Mon, 15 Jul 2024 12:34:56 GMT"));
+    }
+}
+BENCHMARK(BM_DateTimeParser_Rfc1123)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Rejection of malformed input, which must not be slower than a successful parse.
+ */
+static void BM_DateTimeParser_Invalid(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeParser::parse("2024-13-45T99:99:99Z"));
+    }
+}
+BENCHMARK(BM_DateTimeParser_Invalid)->ThreadRange(1, 8)->UseRealTime();
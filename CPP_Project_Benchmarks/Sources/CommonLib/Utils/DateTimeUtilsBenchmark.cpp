@@ -0,0 +1,194 @@
+/**
+ * @file DateTimeUtilsBenchmark.cpp
+ * @brief One benchmark per public DateTimeUtils function that is not covered elsewhere, with
+ *        multi-threaded variants of the calls that share state between threads.
+ *
+ * now(), now_utc(), now_cached() and now_utc_cached() are measured in
+ * CachedDateTimeFormatterBenchmark.cpp, format() in DateTimeFormatterBenchmark.cpp, from_string()
+ * and parse() in DateTimeParserBenchmark.cpp and timer_now() in ClockSourceBenchmark.cpp. The
+ * Request benchmarks compare the std::string overloads with the std::pmr ones on an arena.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+const auto k_time_point = std::chrono::system_clock::time_point(std::chrono::seconds(1700000000));
+
+/// The timestamps one simulated request renders, e.g. for headers and log lines.
+constexpr std::size_t k_timestamps_per_request = 16;
+}  // namespace
+
+/**
+ * @brief DateTimeUtils::current_date() with the default format.
+ */
+static void BM_DateTimeUtils_CurrentDate(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::current_date());
+    }
+}
+BENCHMARK(BM_DateTimeUtils_CurrentDate)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::current_time() with the default format.
+ */
+static void BM_DateTimeUtils_CurrentTime(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::current_time());
+    }
+}
+BENCHMARK(BM_DateTimeUtils_CurrentTime)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::to_string() of a fixed time point.
+ */
+static void BM_DateTimeUtils_ToString(benchmark::State& state)
+{
+    const std::string format = "%Y-%m-%d %H:%M:%S";
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::to_string(k_time_point, format));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_ToString)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::from_string() on several threads (std::mktime takes a global lock).
+ */
+static void BM_DateTimeUtils_FromString_Threads(benchmark::State& state)
+{
+    const std::string text = "2023-11-14 22:13:20";
+    const std::string format = "%Y-%m-%d %H:%M:%S";
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::from_string(text, format));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_FromString_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::parse() on several threads.
+ */
+static void BM_DateTimeUtils_Parse_Threads(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::parse("2023-11-14T22:13:20.123Z"));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_Parse_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::timer_now() on several threads.
+ */
+static void BM_DateTimeUtils_TimerNow_Threads(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::timer_now());
+    }
+}
+BENCHMARK(BM_DateTimeUtils_TimerNow_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::elapsed_s() of two fixed time points.
+ */
+static void BM_DateTimeUtils_ElapsedS(benchmark::State& state)
+{
+    const auto start = CommonLib::DateTimeUtils::timer_now();
+    auto end = start + std::chrono::milliseconds(1500);
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(end);
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::elapsed_s(start, end));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_ElapsedS);
+
+/**
+ * @brief DateTimeUtils::elapsed_ms() of two fixed time points.
+ */
+static void BM_DateTimeUtils_ElapsedMs(benchmark::State& state)
+{
+    const auto start = CommonLib::DateTimeUtils::timer_now();
+    auto end = start + std::chrono::milliseconds(1500);
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(end);
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::elapsed_ms(start, end));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_ElapsedMs);
+
+/**
+ * @brief DateTimeUtils::elapsed_us() of two fixed time points.
+ */
+static void BM_DateTimeUtils_ElapsedUs(benchmark::State& state)
+{
+    const auto start = CommonLib::DateTimeUtils::timer_now();
+    auto end = start + std::chrono::milliseconds(1500);
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(end);
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::elapsed_us(start, end));
+    }
+}
+BENCHMARK(BM_DateTimeUtils_ElapsedUs);
+
+/**
+ * @brief One request rendering its timestamps into std::string from the global heap.
+ */
+static void BM_DateTimeUtils_Request_GlobalHeap(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        std::vector<std::string> timestamps;
+        timestamps.reserve(k_timestamps_per_request);
+        for (std::size_t index = 0; index < k_timestamps_per_request; ++index)
+        {
+            timestamps.push_back(
+                CommonLib::DateTimeUtils::to_string(k_time_point, "%Y-%m-%d %H:%M:%S"));
+        }
+        benchmark::DoNotOptimize(timestamps.data());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(k_timestamps_per_request));
+}
+BENCHMARK(BM_DateTimeUtils_Request_GlobalHeap)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief The same request with the pmr overloads on a per-request monotonic arena.
+ */
+static void BM_DateTimeUtils_Request_Arena(benchmark::State& state)
+{
+    std::array<std::byte, 4096> storage{};
+    for (auto _: state)
+    {
+        std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size());
+        std::pmr::vector<std::pmr::string> timestamps(&arena);
+        timestamps.reserve(k_timestamps_per_request);
+        for (std::size_t index = 0; index < k_timestamps_per_request; ++index)
+        {
+            timestamps.push_back(
+                CommonLib::DateTimeUtils::to_string(&arena, k_time_point, "%Y-%m-%d %H:%M:%S"));
+        }
+        benchmark::DoNotOptimize(timestamps.data());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(k_timestamps_per_request));
+}
+BENCHMARK(BM_DateTimeUtils_Request_Arena)->ThreadRange(1, 8)->UseRealTime();
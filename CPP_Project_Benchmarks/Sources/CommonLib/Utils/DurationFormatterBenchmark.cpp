@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <sstream>
+#include <string>
+
+#include "CommonLib/Utils/DateTimeUtils.h"
+#include "CommonLib/Utils/DurationFormatter.h"
+
+/**
+ * @brief Baseline: the elapsed time as a double in milliseconds, streamed with a unit.
+ */
+static void BM_Ostringstream_ElapsedMs(benchmark::State& state)
+{
+    const auto start = CommonLib::DateTimeUtils::timer_now();
+    auto end = start;
+    for (auto _: state)
+    {
+        end += std::chrono::nanoseconds(1234567);
+        std::ostringstream stream;
+        stream << CommonLib::DateTimeUtils::elapsed_ms(start, end) << "ms";
+        benchmark::DoNotOptimize(stream.str());
+    }
+}
+BENCHMARK(BM_Ostringstream_ElapsedMs);
+
+/**
+ * @brief Rendering into a caller provided buffer.
+ */
+static void BM_DurationFormatter_FormatTo(benchmark::State& state)
+{
+    std::array<char, CommonLib::DurationFormatter::k_max_size> buffer{};
+    std::chrono::nanoseconds duration(0);
+    for (auto _: state)
+    {
+        duration += std::chrono::nanoseconds(1234567);
+        benchmark::DoNotOptimize(
+            CommonLib::DurationFormatter::format_to(std::span<char>(buffer), duration));
+    }
+}
+BENCHMARK(BM_DurationFormatter_FormatTo);
+
+/**
+ * @brief Rendering into a new string.
+ */
+static void BM_DurationFormatter_Format(benchmark::State& state)
+{
+    std::chrono::nanoseconds duration(0);
+    for (auto _: state)
+    {
+        duration += std::chrono::nanoseconds(1234567);
+        benchmark::DoNotOptimize(CommonLib::DurationFormatter::format(duration));
+    }
+}
+BENCHMARK(BM_DurationFormatter_Format);
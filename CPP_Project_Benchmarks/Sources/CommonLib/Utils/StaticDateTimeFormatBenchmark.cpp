@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <span>
+#include <string>
+
+#include "CommonLib/Utils/DateTimeFormatter.h"
+#include "CommonLib/Utils/DateTimeParser.h"
+#include "CommonLib/Utils/StaticDateTimeFormat.h"
+
+namespace
+{
+using Zone = CommonLib::DateTimeFormatter::Zone;
+using LocalFormat = CommonLib::StaticDateTimeFormat<"%Y-%m-%d %H:%M:%S">;
+using UtcFormat = CommonLib::StaticDateTimeFormat<"%Y-%m-%dT%H:%M:%S.%6NZ", Zone::Utc>;
+
+/**
+ * @brief Distinct time points, so that no rendering can be hoisted out of the loop.
+ */
+auto next_time(std::int64_t& counter) -> std::chrono::system_clock::time_point
+{
+    counter += 1000003;
+    return std::chrono::system_clock::time_point(std::chrono::microseconds(counter)) +
+           std::chrono::hours(24 * 365 * 54);
+}
+}  // namespace
+
+/**
+ * @brief Baseline: a runtime compiled formatter in local time.
+ */
+static void BM_DateTimeFormatter_FormatTo_Local(benchmark::State& state)
+{
+    const CommonLib::DateTimeFormatter formatter(LocalFormat::pattern(), Zone::Local);
+    std::array<char, 64> buffer{};
+    std::int64_t counter = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(formatter.format_to(std::span<char>(buffer), next_time(counter)));
+    }
+}
+BENCHMARK(BM_DateTimeFormatter_FormatTo_Local);
+
+/**
+ * @brief The same format compiled into the code, in local time.
+ */
+static void BM_StaticDateTimeFormat_FormatTo_Local(benchmark::State& state)
+{
+    std::array<char, LocalFormat::k_size> buffer{};
+    std::int64_t counter = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(LocalFormat::format_to(buffer.data(), next_time(counter)));
+    }
+}
+BENCHMARK(BM_StaticDateTimeFormat_FormatTo_Local);
+
+/**
+ * @brief Baseline: a runtime compiled formatter in UTC.
+ */
+static void BM_DateTimeFormatter_FormatTo_Utc(benchmark::State& state)
+{
+    const CommonLib::DateTimeFormatter formatter(UtcFormat::pattern(), Zone::Utc);
+    std::array<char, 64> buffer{};
+    std::int64_t counter = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(formatter.format_to(std::span<char>(buffer), next_time(counter)));
+    }
+}
+BENCHMARK(BM_DateTimeFormatter_FormatTo_Utc);
+
+/**
+ * @brief The same format compiled into the code, in UTC.
+ */
+static void BM_StaticDateTimeFormat_FormatTo_Utc(benchmark::State& state)
+{
+    std::array<char, UtcFormat::k_size> buffer{};
+    std::int64_t counter = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(UtcFormat::format_to(buffer.data(), next_time(counter)));
+    }
+}
+BENCHMARK(BM_StaticDateTimeFormat_FormatTo_Utc);
+
+/**
+ * @brief Baseline: the general ISO 8601 parser.
+ */
+static void BM_DateTimeParser_ParseIso8601(benchmark::State& state)
+{
+    std::int64_t counter = 0;
+    const std::string text = UtcFormat::format(next_time(counter));
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeParser::parse_iso8601(text));
+    }
+}
+BENCHMARK(BM_DateTimeParser_ParseIso8601);
+
+/**
+ * @brief Parsing with the format compiled into the code.
+ */
+static void BM_StaticDateTimeFormat_Parse_Utc(benchmark::State& state)
+{
+    std::int64_t counter = 0;
+    const std::string text = UtcFormat::format(next_time(counter));
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(UtcFormat::parse(text));
+    }
+}
+BENCHMARK(BM_StaticDateTimeFormat_Parse_Utc);
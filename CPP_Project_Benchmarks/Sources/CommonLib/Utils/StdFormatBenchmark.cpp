@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include "CommonLib/Utils/StdFormat.h"
+
+#if defined(__cpp_lib_format)
+
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string>
+
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+constexpr const char* k_format = "%Y-%m-%d %H:%M:%S";
+
+/// Advances the time by about a second, so that every iteration renders another time; the
+/// lines are appended to a reused buffer, as a logger would.
+auto next_time(std::int64_t& counter) -> std::chrono::system_clock::time_point
+{
+    counter += 1000003;
+    return std::chrono::system_clock::time_point(std::chrono::microseconds(counter));
+}
+}  // namespace
+
+/**
+ * @brief Baseline: DateTimeUtils::to_string, then the temporary string is formatted.
+ */
+static void BM_StdFormat_ToStringThenFormat(benchmark::State& state)
+{
+    std::string line;
+    std::int64_t counter = 0;
+    for (auto _: state)
+    {
+        line.clear();
+        std::format_to(std::back_inserter(line), "[{}] request done",
+                       CommonLib::DateTimeUtils::to_string(next_time(counter), k_format));
+        benchmark::DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(BM_StdFormat_ToStringThenFormat);
+
+/**
+ * @brief Baseline: the standard library's chrono formatter.
+ */
+static void BM_StdFormat_Chrono(benchmark::State& state)
+{
+    std::string line;
+    std::int64_t counter = 0;
+    for (auto _: state)
+    {
+        line.clear();
+        std::format_to(std::back_inserter(line), "[{:%Y-%m-%d %H:%M:%S}] request done",
+                       std::chrono::floor<std::chrono::seconds>(next_time(counter)));
+        benchmark::DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(BM_StdFormat_Chrono);
+
+/**
+ * @brief A zoned time point rendered directly into the output.
+ */
+static void BM_StdFormat_ZonedTimePoint(benchmark::State& state)
+{
+    std::string line;
+    std::int64_t counter = 0;
+    for (auto _: state)
+    {
+        line.clear();
+        std::format_to(std::back_inserter(line), "[{}] request done",
+                       CommonLib::as_local(next_time(counter)));
+        benchmark::DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(BM_StdFormat_ZonedTimePoint);
+
+/**
+ * @brief A compile-time format rendered directly into the output.
+ */
+static void BM_StdFormat_StaticFormat(benchmark::State& state)
+{
+    std::string line;
+    std::int64_t counter = 0;
+    for (auto _: state)
+    {
+        line.clear();
+        std::format_to(std::back_inserter(line), "[{}] request done",
+                       CommonLib::as_formatted<"%Y-%m-%d %H:%M:%S">(next_time(counter)));
+        benchmark::DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(BM_StdFormat_StaticFormat);
+
+/**
+ * @brief Baseline: an elapsed time converted to a double and formatted with a unit.
+ */
+static void BM_StdFormat_ElapsedMsDouble(benchmark::State& state)
+{
+    std::string line;
+    std::chrono::nanoseconds duration(0);
+    for (auto _: state)
+    {
+        duration += std::chrono::nanoseconds(1234567);
+        line.clear();
+        std::format_to(std::back_inserter(line), "took {}ms",
+                       std::chrono::duration<double, std::milli>(duration).count());
+        benchmark::DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(BM_StdFormat_ElapsedMsDouble);
+
+/**
+ * @brief A readable duration rendered directly into the output.
+ */
+static void BM_StdFormat_ReadableDuration(benchmark::State& state)
+{
+    std::string line;
+    std::chrono::nanoseconds duration(0);
+    for (auto _: state)
+    {
+        duration += std::chrono::nanoseconds(1234567);
+        line.clear();
+        std::format_to(std::back_inserter(line), "took {}", CommonLib::as_readable(duration));
+        benchmark::DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(BM_StdFormat_ReadableDuration);
+
+#endif
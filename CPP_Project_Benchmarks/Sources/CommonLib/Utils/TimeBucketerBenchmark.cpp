@@ -0,0 +1,203 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CommonLib/Utils/DateTimeUtils.h"
+#include "CommonLib/Utils/TimeBucketer.h"
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace
+{
+using Unit = CommonLib::TimeBucketer::Unit;
+using Resolution = CommonLib::TimeBucketer::Resolution;
+
+constexpr std::size_t k_batch_size = 4096;
+
+/**
+ * @brief A time ordered column of nanosecond timestamps about 1.3 seconds apart.
+ */
+auto make_column() -> const std::vector<std::int64_t>&
+{
+    static const std::vector<std::int64_t> column = [] {
+        std::vector<std::int64_t> result;
+        for (std::size_t i = 0; i < k_batch_size; ++i)
+        {
+            result.push_back(1700000000000000000 + static_cast<std::int64_t>(i) * 1300000007);
+        }
+        return result;
+    }();
+    return column;
+}
+
+/**
+ * @brief The same timestamps in random order.
+ */
+auto make_shuffled_column() -> const std::vector<std::int64_t>&
+{
+    static const std::vector<std::int64_t> column = [] {
+        std::vector<std::int64_t> result = make_column();
+        std::shuffle(result.begin(), result.end(), std::mt19937_64(5));
+        return result;
+    }();
+    return column;
+}
+
+void run_bucketer(benchmark::State& state, const CommonLib::TimeBucketer& bucketer,
+                  CommonLib::SimdLevel level, const std::vector<std::int64_t>& column)
+{
+    if (!CommonLib::CpuFeatures::supports(level))
+    {
+        state.SkipWithError("SIMD level not supported by this CPU");
+        return;
+    }
+
+    std::vector<std::int64_t> buckets(column.size());
+    for (auto _: state)
+    {
+        bucketer.bucket_many(column, buckets, level);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * column.size()));
+}
+}  // namespace
+
+/**
+ * @brief Baseline: groups by the minute rendered with DateTimeUtils::format.
+ */
+static void BM_Bucket_FormatPerItem(benchmark::State& state)
+{
+    const auto& column = make_column();
+    for (auto _: state)
+    {
+        std::map<std::string, std::size_t> groups;
+        for (const std::int64_t value: column)
+        {
+            const std::chrono::system_clock::time_point tp{
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(value))};
+            ++groups[CommonLib::DateTimeUtils::format(tp, "%Y-%m-%d %H:%M")];
+        }
+        benchmark::DoNotOptimize(groups);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * column.size()));
+}
+BENCHMARK(BM_Bucket_FormatPerItem);
+
+/**
+ * @brief Baseline: plain integer division per value.
+ */
+static void BM_Bucket_IntegerDivision(benchmark::State& state)
+{
+    const auto& column = make_column();
+    std::vector<std::int64_t> buckets(column.size());
+    for (auto _: state)
+    {
+        for (std::size_t i = 0; i < column.size(); ++i)
+        {
+            const std::int64_t value = column[i];
+            std::int64_t remainder = value % 60000000000;
+            remainder += remainder < 0 ? 60000000000 : 0;
+            buckets[i] = value - remainder;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * column.size()));
+}
+BENCHMARK(BM_Bucket_IntegerDivision);
+
+/**
+ * @brief Minute buckets in UTC without SIMD.
+ */
+static void BM_Bucket_Minute_Scalar(benchmark::State& state)
+{
+    run_bucketer(state, CommonLib::TimeBucketer(Unit::Minute), CommonLib::SimdLevel::Scalar,
+                 make_column());
+}
+BENCHMARK(BM_Bucket_Minute_Scalar);
+
+/**
+ * @brief Minute buckets in UTC with the AVX2 bucket bounds check.
+ */
+static void BM_Bucket_Minute_Avx2(benchmark::State& state)
+{
+    run_bucketer(state, CommonLib::TimeBucketer(Unit::Minute), CommonLib::SimdLevel::Avx2,
+                 make_column());
+}
+BENCHMARK(BM_Bucket_Minute_Avx2);
+
+/**
+ * @brief Minute buckets in UTC of an unordered column without SIMD.
+ */
+static void BM_Bucket_MinuteShuffled_Scalar(benchmark::State& state)
+{
+    run_bucketer(state, CommonLib::TimeBucketer(Unit::Minute), CommonLib::SimdLevel::Scalar,
+                 make_shuffled_column());
+}
+BENCHMARK(BM_Bucket_MinuteShuffled_Scalar);
+
+/**
+ * @brief Minute buckets in UTC of an unordered column with AVX2 arithmetic flooring.
+ */
+static void BM_Bucket_MinuteShuffled_Avx2(benchmark::State& state)
+{
+    run_bucketer(state, CommonLib::TimeBucketer(Unit::Minute), CommonLib::SimdLevel::Avx2,
+                 make_shuffled_column());
+}
+BENCHMARK(BM_Bucket_MinuteShuffled_Avx2);
+
+/**
+ * @brief Month buckets in UTC without SIMD.
+ */
+static void BM_Bucket_Month_Scalar(benchmark::State& state)
+{
+    run_bucketer(state, CommonLib::TimeBucketer(Unit::Month), CommonLib::SimdLevel::Scalar,
+                 make_column());
+}
+BENCHMARK(BM_Bucket_Month_Scalar);
+
+/**
+ * @brief Month buckets in UTC with the AVX2 bucket bounds check.
+ */
+static void BM_Bucket_Month_Avx2(benchmark::State& state)
+{
+    run_bucketer(state, CommonLib::TimeBucketer(Unit::Month), CommonLib::SimdLevel::Avx2,
+                 make_column());
+}
+BENCHMARK(BM_Bucket_Month_Avx2);
+
+/**
+ * @brief Local day buckets with the AVX2 bucket bounds check.
+ */
+static void BM_Bucket_LocalDay_Avx2(benchmark::State& state)
+{
+    const auto zone = CommonLib::TimeZone::from_posix_rule("CET-1CEST,M3.5.0,M10.5.0/3");
+    run_bucketer(state,
+                 CommonLib::TimeBucketer(Unit::Day, 1, Resolution::Nanoseconds, zone.get()),
+                 CommonLib::SimdLevel::Avx2,
+                 make_column());
+}
+BENCHMARK(BM_Bucket_LocalDay_Avx2);
+
+/**
+ * @brief Run-length grouping of minute bucket ids.
+ */
+static void BM_Bucket_GroupRuns(benchmark::State& state)
+{
+    const auto& column = make_column();
+    std::vector<std::int64_t> buckets(column.size());
+    CommonLib::TimeBucketer(Unit::Minute).bucket_many(column, buckets);
+    std::vector<CommonLib::TimeBucketer::Run> runs(buckets.size());
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::TimeBucketer::group_runs(buckets, runs));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * buckets.size()));
+}
+BENCHMARK(BM_Bucket_GroupRuns);
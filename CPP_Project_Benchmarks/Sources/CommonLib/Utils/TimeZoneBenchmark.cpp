@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+#include "CommonLib/Utils/DateTimeUtils.h"
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace
+{
+constexpr std::int64_t k_start_seconds = 1672531200;
+}  // namespace
+
+/**
+ * @brief Baseline: localtime_r / localtime_s (takes the C library tz lock).
+ */
+static void BM_Localtime(benchmark::State& state)
+{
+    std::int64_t seconds = k_start_seconds;
+    for (auto _: state)
+    {
+        const auto t = static_cast<std::time_t>(seconds);
+        std::tm tm_buf{};
+#if defined(_WIN32)
+        localtime_s(&tm_buf, &t);
+#else
+        localtime_r(&t, &tm_buf);
+#endif
+        benchmark::DoNotOptimize(tm_buf);
+        seconds += 3607;
+    }
+}
+BENCHMARK(BM_Localtime)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Offset lookup through the cached local TimeZone.
+ */
+static void BM_TimeZone_OffsetAt(benchmark::State& state)
+{
+    const CommonLib::TimeZone* zone = CommonLib::TimeZone::local_cached();
+    if (zone == nullptr)
+    {
+        state.SkipWithError("local time zone unavailable");
+        return;
+    }
+
+    std::int64_t seconds = k_start_seconds;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(zone->offset_at(seconds));
+        seconds += 3607;
+    }
+}
+BENCHMARK(BM_TimeZone_OffsetAt)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Full local breakdown through the cached local TimeZone.
+ */
+static void BM_TimeZone_ToLocal(benchmark::State& state)
+{
+    std::int64_t seconds = k_start_seconds;
+    for (auto _: state)
+    {
+        const CommonLib::TimeZone* zone = CommonLib::TimeZone::local_cached();
+        if (zone != nullptr)
+        {
+            benchmark::DoNotOptimize(zone->to_local(seconds));
+        }
+        seconds += 3607;
+    }
+}
+BENCHMARK(BM_TimeZone_ToLocal)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Local time to UTC conversion, the lock-free counterpart of mktime.
+ */
+static void BM_TimeZone_ToUtc(benchmark::State& state)
+{
+    const CommonLib::TimeZone* zone = CommonLib::TimeZone::local_cached();
+    if (zone == nullptr)
+    {
+        state.SkipWithError("local time zone unavailable");
+        return;
+    }
+
+    std::int64_t seconds = k_start_seconds;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(zone->to_utc(seconds));
+        seconds += 3607;
+    }
+}
+BENCHMARK(BM_TimeZone_ToUtc)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief DateTimeUtils::format in local time, which now resolves offsets via TimeZone.
+ */
+static void BM_DateTimeUtils_FormatLocal(benchmark::State& state)
+{
+    auto tp = std::chrono::system_clock::from_time_t(k_start_seconds);
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::format(tp, "%Y-%m-%d %H:%M:%S %Z"));
+        tp += std::chrono::seconds(3607);
+    }
+}
+BENCHMARK(BM_DateTimeUtils_FormatLocal)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include "CommonLib/Utils/CivilTime.h"
+#include "CommonLib/Utils/DateTimeUtils.h"
+#include "CommonLib/Utils/TimeZone.h"
+#include "CommonLib/Utils/TimeZoneDatabase.h"
+
+namespace
+{
+constexpr std::int64_t k_start_seconds = 1672531200;
+constexpr std::array<const char*, 4> k_zones = {"Europe/Berlin", "America/New_York",
+                                                "Asia/Tokyo", "Australia/Lord_Howe"};
+}  // namespace
+
+/**
+ * @brief Cached lookup of a zone by name from concurrent threads.
+ */
+static void BM_TimeZoneDatabase_Locate(benchmark::State& state)
+{
+    auto& database = CommonLib::TimeZoneDatabase::instance();
+    std::size_t index = 0;
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(database.locate(k_zones[index++ % k_zones.size()]));
+    }
+}
+BENCHMARK(BM_TimeZoneDatabase_Locate)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Loading a zone: memory mapped TZif file, parsed into a fresh database.
+ */
+static void BM_TimeZoneDatabase_Load(benchmark::State& state)
+{
+    const std::string directory = CommonLib::TimeZoneDatabase::instance().directory();
+    for (auto _: state)
+    {
+        CommonLib::TimeZoneDatabase database(directory);
+        benchmark::DoNotOptimize(database.locate("Europe/Berlin"));
+    }
+}
+BENCHMARK(BM_TimeZoneDatabase_Load);
+
+/**
+ * @brief Baseline: loading a zone through std::ifstream.
+ */
+static void BM_TimeZone_FromFile(benchmark::State& state)
+{
+    const std::string path =
+        CommonLib::TimeZoneDatabase::instance().directory() + "/Europe/Berlin";
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::TimeZone::from_file(path));
+    }
+}
+BENCHMARK(BM_TimeZone_FromFile);
+
+/**
+ * @brief Wall clock conversion between two named zones from concurrent threads.
+ */
+static void BM_TimeZoneDatabase_Convert(benchmark::State& state)
+{
+    auto& database = CommonLib::TimeZoneDatabase::instance();
+    std::int64_t seconds = k_start_seconds;
+    for (auto _: state)
+    {
+        const auto local = CommonLib::CivilTime::from_unix_seconds(seconds);
+        benchmark::DoNotOptimize(database.convert(local, "America/New_York", "Asia/Tokyo"));
+        seconds += 3607;
+    }
+}
+BENCHMARK(BM_TimeZoneDatabase_Convert)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Baseline: the same conversion by switching TZ and calling mktime / localtime_r.
+ *
+ * Changing the process time zone is not thread safe, so this only runs single threaded.
+ */
+static void BM_Setenv_Convert(benchmark::State& state)
+{
+#if defined(_WIN32)
+    state.SkipWithError("TZ switching is not supported on Windows");
+#else
+    const char* previous = std::getenv("TZ");
+    const std::string saved = previous != nullptr ? previous : "";
+    std::int64_t seconds = k_start_seconds;
+    for (auto _: state)
+    {
+        std::tm tm_buf =
+            CommonLib::CivilTime::to_tm(CommonLib::CivilTime::from_unix_seconds(seconds));
+        tm_buf.tm_isdst = -1;
+        setenv("TZ", "America/New_York", 1);
+        tzset();
+        const std::time_t instant = std::mktime(&tm_buf);
+        setenv("TZ", "Asia/Tokyo", 1);
+        tzset();
+        localtime_r(&instant, &tm_buf);
+        benchmark::DoNotOptimize(tm_buf);
+        seconds += 3607;
+    }
+    if (previous != nullptr)
+    {
+        setenv("TZ", saved.c_str(), 1);
+    }
+    else
+    {
+        unsetenv("TZ");
+    }
+    tzset();
+#endif
+}
+BENCHMARK(BM_Setenv_Convert);
+
+/**
+ * @brief Rendering the current time in a named zone from concurrent threads.
+ */
+static void BM_DateTimeUtils_FormatIn(benchmark::State& state)
+{
+    auto tp = std::chrono::system_clock::from_time_t(k_start_seconds);
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(CommonLib::DateTimeUtils::format_in(tp, "Asia/Tokyo"));
+        tp += std::chrono::seconds(3607);
+    }
+}
+BENCHMARK(BM_DateTimeUtils_FormatIn)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,35 @@
+set(Third_Party_Target "benchmark")
+set(Git_Tag "v1.9.1")
+set(Project_Directory_Name "${Third_Party_Target}_${Git_Tag}")
+set(Third_Party_Target_Directory "${THIRD_PARTY_INCLUDE_DIR}/${Project_Directory_Name}")
+set(benchmark_DIR "")
+
+find_package(benchmark QUIET PATHS ${Third_Party_Target_Directory}/${Third_Party_Target}_install/${CMAKE_BUILD_TYPE}/lib/cmake/benchmark NO_DEFAULT_PATHS)
+
+if(benchmark_FOUND)
+    message("Google Benchmark found")
+else()
+    message("Google Benchmark not found. Downloading and invoking cmake ..")
+    build_third_party_project(
+        false
+        ${Third_Party_Target}
+        https://github.com/google/benchmark.git
+        ${Git_Tag}
+        ${Third_Party_Target_Directory}
+		${CMAKE_BUILD_TYPE}
+        -DBENCHMARK_ENABLE_TESTING=OFF
+        -DBENCHMARK_ENABLE_GTEST_TESTS=OFF
+    )
+
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+    add_subdirectory("${Third_Party_Target_Directory}/${Third_Party_Target}_src"
+                     "${Third_Party_Target_Directory}/${Third_Party_Target}_build")
+
+    set_target_properties(benchmark PROPERTIES FOLDER ThirdParty)
+    set_target_properties(benchmark_main PROPERTIES FOLDER ThirdParty)
+endif()
+
+target_link_libraries(${PROJECT_NAME} PUBLIC benchmark::benchmark)
@@ -0,0 +1,30 @@
+/**
+ * @file main.cpp
+ * @brief Main entry point for the benchmark project using Google Benchmark.
+ */
+
+#include <benchmark/benchmark.h>
+
+/**
+ * @brief Initializes and runs all registered Google Benchmark benchmarks.
+ *
+ * Command-line arguments are forwarded to Google Benchmark, so filters and output options
+ * such as --benchmark_filter or --benchmark_out can be used as usual.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Array of command-line arguments.
+ * @return 0 if all benchmarks ran, 1 if unrecognized arguments were passed.
+ */
+auto main(int argc, char* argv[]) -> int
+{
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Base/CpuFeatures.h"
+
+/**
+ * @file CpuFeaturesTest.h
+ * @brief Test fixture for CommonLib::CpuFeatures.
+ */
+class CpuFeaturesTest: public ::testing::Test
+{
+    protected:
+        CpuFeaturesTest() = default;
+        ~CpuFeaturesTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Base/Expected.h"
+
+/**
+ * @file ExpectedTest.h
+ * @brief Test fixture for CommonLib::Expected.
+ */
+class ExpectedTest: public ::testing::Test
+{
+    protected:
+        ExpectedTest() = default;
+        ~ExpectedTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
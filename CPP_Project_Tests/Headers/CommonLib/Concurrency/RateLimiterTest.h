@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Concurrency/RateLimiter.h"
+
+/**
+ * @file RateLimiterTest.h
+ * @brief Test fixture for CommonLib::RateLimiter.
+ */
+class RateLimiterTest: public ::testing::Test
+{
+    protected:
+        RateLimiterTest() = default;
+        ~RateLimiterTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
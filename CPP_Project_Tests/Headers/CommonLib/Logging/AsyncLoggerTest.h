@@ -0,0 +1,22 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Logging/AsyncLogger.h"
+
+/**
+ * @file AsyncLoggerTest.h
+ * @brief Test fixture for CommonLib::AsyncLogger.
+ */
+class AsyncLoggerTest: public ::testing::Test
+{
+    protected:
+        AsyncLoggerTest() = default;
+        ~AsyncLoggerTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override
+        {
+            CommonLib::AsyncLogger::get_instance().stop();
+        }
+};
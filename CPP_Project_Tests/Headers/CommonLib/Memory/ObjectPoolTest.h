@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Memory/ObjectPool.h"
+
+/**
+ * @file ObjectPoolTest.h
+ * @brief Test fixture for CommonLib::ObjectPool.
+ */
+class ObjectPoolTest: public ::testing::Test
+{
+    protected:
+        ObjectPoolTest() = default;
+        ~ObjectPoolTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Memory/SlotAllocator.h"
+
+/**
+ * @file SlotAllocatorTest.h
+ * @brief Test fixture for CommonLib::SlotAllocator.
+ */
+class SlotAllocatorTest: public ::testing::Test
+{
+    protected:
+        SlotAllocatorTest() = default;
+        ~SlotAllocatorTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Patterns/ManagedSingleton.h"
+
+/**
+ * @file ManagedSingletonTest.h
+ * @brief Test fixture for CommonLib::ManagedSingleton.
+ */
+class ManagedSingletonTest: public ::testing::Test
+{
+    protected:
+        ManagedSingletonTest() = default;
+        ~ManagedSingletonTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
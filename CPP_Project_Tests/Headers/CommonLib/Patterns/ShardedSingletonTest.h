@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Patterns/ShardedSingleton.h"
+
+/**
+ * @file ShardedSingletonTest.h
+ * @brief Test fixture for CommonLib::ShardedSingleton.
+ */
+class ShardedSingletonTest: public ::testing::Test
+{
+    protected:
+        ShardedSingletonTest() = default;
+        ~ShardedSingletonTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
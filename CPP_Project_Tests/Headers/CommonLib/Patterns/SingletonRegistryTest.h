@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Patterns/SingletonRegistry.h"
+
+/**
+ * @file SingletonRegistryTest.h
+ * @brief Test fixture for CommonLib::SingletonRegistry.
+ */
+class SingletonRegistryTest: public ::testing::Test
+{
+    protected:
+        SingletonRegistryTest() = default;
+        ~SingletonRegistryTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
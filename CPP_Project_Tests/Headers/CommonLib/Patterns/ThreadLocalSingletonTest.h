@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Patterns/ThreadLocalSingleton.h"
+
+/**
+ * @file ThreadLocalSingletonTest.h
+ * @brief Test fixture for CommonLib::ThreadLocalSingleton.
+ */
+class ThreadLocalSingletonTest: public ::testing::Test
+{
+    protected:
+        ThreadLocalSingletonTest() = default;
+        ~ThreadLocalSingletonTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Profiling/LatencyHistogram.h"
+
+/**
+ * @file LatencyHistogramTest.h
+ * @brief Test fixture for CommonLib::LatencyHistogram.
+ */
+class LatencyHistogramTest: public ::testing::Test
+{
+    protected:
+        LatencyHistogramTest() = default;
+        ~LatencyHistogramTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Profiling/ScopedTimer.h"
+
+/**
+ * @file ScopedTimerTest.h
+ * @brief Test fixture for CommonLib::ScopedTimer.
+ */
+class ScopedTimerTest: public ::testing::Test
+{
+    protected:
+        ScopedTimerTest() = default;
+        ~ScopedTimerTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
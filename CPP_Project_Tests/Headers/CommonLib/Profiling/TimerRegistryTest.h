@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Profiling/TimerRegistry.h"
+
+/**
+ * @file TimerRegistryTest.h
+ * @brief Test fixture for CommonLib::TimerRegistry.
+ */
+class TimerRegistryTest: public ::testing::Test
+{
+    protected:
+        TimerRegistryTest() = default;
+        ~TimerRegistryTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Profiling/Tracer.h"
+
+/**
+ * @file TracerTest.h
+ * @brief Test fixture for CommonLib::Tracer.
+ */
+class TracerTest: public ::testing::Test
+{
+    protected:
+        TracerTest() = default;
+        ~TracerTest() override = default;
+
+        void SetUp() override
+        {
+            static_cast<void>(CommonLib::Tracer::drain());
+        }
+
+        void TearDown() override
+        {
+            CommonLib::Tracer::set_enabled(true);
+            CommonLib::Tracer::configure(CommonLib::Tracer::k_default_capacity,
+                                         CommonLib::TraceOverflow::Overwrite);
+        }
+};
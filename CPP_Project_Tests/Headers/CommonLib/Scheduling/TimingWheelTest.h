@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Scheduling/TimingWheel.h"
+
+/**
+ * @file TimingWheelTest.h
+ * @brief Test fixture for CommonLib::TimingWheel.
+ */
+class TimingWheelTest: public ::testing::Test
+{
+    protected:
+        TimingWheelTest() = default;
+        ~TimingWheelTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/CachedDateTimeFormatter.h"
+
+/**
+ * @file CachedDateTimeFormatterTest.h
+ * @brief Test fixture for CommonLib::CachedDateTimeFormatter.
+ */
+class CachedDateTimeFormatterTest: public ::testing::Test
+{
+    protected:
+        CachedDateTimeFormatterTest() = default;
+        ~CachedDateTimeFormatterTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/CivilTime.h"
+
+/**
+ * @file CivilTimeTest.h
+ * @brief Test fixture for CommonLib::CivilTime.
+ */
+class CivilTimeTest: public ::testing::Test
+{
+    protected:
+        CivilTimeTest() = default;
+        ~CivilTimeTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/ClockSource.h"
+
+/**
+ * @file ClockSourceTest.h
+ * @brief Test fixture for the CommonLib::ClockSource concept.
+ */
+class ClockSourceTest: public ::testing::Test
+{
+    protected:
+        ClockSourceTest() = default;
+        ~ClockSourceTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/CoarseClock.h"
+
+/**
+ * @file CoarseClockTest.h
+ * @brief Test fixture for CommonLib::CoarseSteadyClock and CommonLib::CoarseSystemClock.
+ */
+class CoarseClockTest: public ::testing::Test
+{
+    protected:
+        CoarseClockTest() = default;
+        ~CoarseClockTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
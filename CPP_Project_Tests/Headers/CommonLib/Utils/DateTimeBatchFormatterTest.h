@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/DateTimeBatchFormatter.h"
+
+/**
+ * @file DateTimeBatchFormatterTest.h
+ * @brief Test fixture for CommonLib::DateTimeBatchFormatter.
+ */
+class DateTimeBatchFormatterTest: public ::testing::Test
+{
+    protected:
+        DateTimeBatchFormatterTest() = default;
+        ~DateTimeBatchFormatterTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
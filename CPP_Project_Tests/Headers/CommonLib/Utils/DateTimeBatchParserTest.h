@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/DateTimeBatchParser.h"
+
+/**
+ * @file DateTimeBatchParserTest.h
+ * @brief Test fixture for CommonLib::DateTimeBatchParser.
+ */
+class DateTimeBatchParserTest: public ::testing::Test
+{
+    protected:
+        DateTimeBatchParserTest() = default;
+        ~DateTimeBatchParserTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/DateTimeFormatter.h"
+
+/**
+ * @file DateTimeFormatterTest.h
+ * @brief Test fixture for CommonLib::DateTimeFormatter.
+ */
+class DateTimeFormatterTest: public ::testing::Test
+{
+    protected:
+        DateTimeFormatterTest() = default;
+        ~DateTimeFormatterTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
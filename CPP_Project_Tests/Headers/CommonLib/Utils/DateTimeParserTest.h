@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/DateTimeParser.h"
+
+/**
+ * @file DateTimeParserTest.h
+ * @brief Test fixture for CommonLib::DateTimeParser.
+ */
+class DateTimeParserTest: public ::testing::Test
+{
+    protected:
+        DateTimeParserTest() = default;
+        ~DateTimeParserTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
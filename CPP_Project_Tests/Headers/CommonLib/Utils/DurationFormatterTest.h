@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/DurationFormatter.h"
+
+/**
+ * @file DurationFormatterTest.h
+ * @brief Test fixture for CommonLib::DurationFormatter.
+ */
+class DurationFormatterTest: public ::testing::Test
+{
+    protected:
+        DurationFormatterTest() = default;
+        ~DurationFormatterTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
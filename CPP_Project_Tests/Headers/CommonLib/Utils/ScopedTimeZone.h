@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdlib>
+#include <ctime>
+#include <optional>
+#include <string>
+
+#include "CommonLib/Utils/TimeZone.h"
+
+/**
+ * @file ScopedTimeZone.h
+ * @brief Test helper that switches the process time zone.
+ */
+
+/**
+ * @brief Switches the process time zone and reloads the local TimeZone while in scope.
+ */
+class ScopedTimeZone
+{
+    public:
+        explicit ScopedTimeZone(const char* zone)
+        {
+            if (const char* previous = std::getenv("TZ"))
+            {
+                m_previous = previous;
+            }
+            apply(zone);
+        }
+
+        ~ScopedTimeZone()
+        {
+            apply(m_previous ? m_previous->c_str() : nullptr);
+        }
+
+        ScopedTimeZone(const ScopedTimeZone&) = delete;
+        auto operator=(const ScopedTimeZone&) -> ScopedTimeZone& = delete;
+
+    private:
+        static void apply(const char* zone)
+        {
+#if defined(_WIN32)
+            _putenv_s("TZ", zone != nullptr ? zone : "");
+            _tzset();
+#else
+            if (zone != nullptr)
+            {
+                setenv("TZ", zone, 1);
+            }
+            else
+            {
+                unsetenv("TZ");
+            }
+            tzset();
+#endif
+            CommonLib::TimeZone::reload_local();
+        }
+
+        std::optional<std::string> m_previous;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/StaticDateTimeFormat.h"
+
+/**
+ * @file StaticDateTimeFormatTest.h
+ * @brief Test fixture for CommonLib::StaticDateTimeFormat.
+ */
+class StaticDateTimeFormatTest: public ::testing::Test
+{
+    protected:
+        StaticDateTimeFormatTest() = default;
+        ~StaticDateTimeFormatTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/StdFormat.h"
+
+/**
+ * @file StdFormatTest.h
+ * @brief Test fixture for CommonLib::StdFormat.
+ */
+class StdFormatTest: public ::testing::Test
+{
+    protected:
+        StdFormatTest() = default;
+        ~StdFormatTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/TimeBucketer.h"
+
+/**
+ * @file TimeBucketerTest.h
+ * @brief Test fixture for CommonLib::TimeBucketer.
+ */
+class TimeBucketerTest: public ::testing::Test
+{
+    protected:
+        TimeBucketerTest() = default;
+        ~TimeBucketerTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
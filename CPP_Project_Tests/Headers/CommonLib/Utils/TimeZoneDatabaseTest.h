@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/TimeZoneDatabase.h"
+
+/**
+ * @file TimeZoneDatabaseTest.h
+ * @brief Test fixture for CommonLib::TimeZoneDatabase.
+ */
+class TimeZoneDatabaseTest: public ::testing::Test
+{
+    protected:
+        TimeZoneDatabaseTest() = default;
+        ~TimeZoneDatabaseTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
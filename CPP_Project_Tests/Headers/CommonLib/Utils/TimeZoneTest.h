@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/TimeZone.h"
+
+/**
+ * @file TimeZoneTest.h
+ * @brief Test fixture for CommonLib::TimeZone.
+ */
+class TimeZoneTest: public ::testing::Test
+{
+    protected:
+        TimeZoneTest() = default;
+        ~TimeZoneTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "CommonLib/Utils/TscClock.h"
+
+/**
+ * @file TscClockTest.h
+ * @brief Test fixture for CommonLib::TscClock.
+ */
+class TscClockTest: public ::testing::Test
+{
+    protected:
+        TscClockTest() = default;
+        ~TscClockTest() override = default;
+
+        void SetUp() override {}
+        void TearDown() override {}
+};
@@ -0,0 +1,19 @@
+#include "CommonLib/Base/CpuFeaturesTest.h"
+
+/**
+ * @brief Tests that the reported SIMD level is consistent with the individual feature flags.
+ */
+TEST_F(CpuFeaturesTest, SimdLevelMatchesFeatures)
+{
+    using namespace CommonLib;
+    const SimdLevel level = CpuFeatures::simd_level();
+
+    EXPECT_TRUE(CpuFeatures::supports(SimdLevel::Scalar));
+    EXPECT_TRUE(CpuFeatures::supports(level));
+    EXPECT_EQ(level == SimdLevel::Avx2, CpuFeatures::has_avx2());
+    if (CpuFeatures::has_avx2())
+    {
+        EXPECT_TRUE(CpuFeatures::has_ssse3());
+    }
+    EXPECT_EQ(CpuFeatures::supports(SimdLevel::Ssse3), CpuFeatures::has_ssse3());
+}
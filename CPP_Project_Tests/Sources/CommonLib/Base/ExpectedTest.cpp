@@ -0,0 +1,46 @@
+#include "CommonLib/Base/ExpectedTest.h"
+
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Tests access to a held value.
+ */
+TEST_F(ExpectedTest, HoldsValue)
+{
+    using namespace CommonLib;
+    const Expected<std::string, int> result(std::string("value"));
+
+    EXPECT_TRUE(result.has_value());
+    EXPECT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ(result.value(), "value");
+    EXPECT_EQ(*result, "value");
+    EXPECT_EQ(result->size(), 5U);
+    EXPECT_EQ(result.value_or("fallback"), "value");
+}
+
+/**
+ * @brief Tests access to a held error, including when value and error types are the same.
+ */
+TEST_F(ExpectedTest, HoldsError)
+{
+    using namespace CommonLib;
+    const Expected<int, int> result(Unexpected(42));
+
+    EXPECT_FALSE(result.has_value());
+    EXPECT_FALSE(static_cast<bool>(result));
+    EXPECT_EQ(result.error(), 42);
+    EXPECT_EQ(result.value_or(7), 7);
+    EXPECT_THROW(static_cast<void>(result.value()), std::logic_error);
+}
+
+/**
+ * @brief Tests that Expected can be used in constant expressions.
+ */
+TEST_F(ExpectedTest, IsConstexpr)
+{
+    using namespace CommonLib;
+    static_assert(Expected<int, char>(5).value_or(0) == 5);
+    static_assert(!Expected<int, char>(Unexpected('e')).has_value());
+    SUCCEED();
+}
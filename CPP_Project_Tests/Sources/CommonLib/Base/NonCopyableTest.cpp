@@ -1,5 +1,6 @@
 #include "CommonLib/Base/NonCopyableTest.h"
 
+#include <cstdint>
 #include <type_traits>
 
 /**
@@ -12,11 +13,18 @@ class DerivedNonCopyable: public CommonLib::NonCopyable
 {
     public:
         DerivedNonCopyable() = default;
-        ~DerivedNonCopyable() override = default;
+        ~DerivedNonCopyable() = default;
         DerivedNonCopyable(DerivedNonCopyable&&) = default;
         DerivedNonCopyable& operator=(DerivedNonCopyable&&) = default;
 };
 
+/**
+ * @brief A small value type derived from NonCopyable, as stored densely in arrays.
+ */
+struct PackedNonCopyable: public CommonLib::NonCopyable {
+        std::int32_t value = 0;
+};
+
 /**
  * @brief Tests that DerivedNonCopyable is not copy constructible.
  *
@@ -64,3 +72,24 @@ TEST_F(NonCopyableTest, IsMoveAssignable)
 {
     EXPECT_TRUE(std::is_move_assignable_v<DerivedNonCopyable>);
 }
+
+/**
+ * @brief Tests that NonCopyable adds nothing to the size or layout of a derived class.
+ *
+ * The base is empty and non-virtual, so it vanishes through the empty base optimization and
+ * the derived class keeps the traits of its members.
+ */
+TEST_F(NonCopyableTest, AddsNoSizeOrLayoutOverhead)
+{
+#if !defined(COMMONLIB_VIRTUAL_POLICY_BASES)
+    static_assert(std::is_empty_v<CommonLib::NonCopyable>);
+    static_assert(!std::has_virtual_destructor_v<CommonLib::NonCopyable>);
+    static_assert(sizeof(PackedNonCopyable) == sizeof(std::int32_t));
+    static_assert(std::is_standard_layout_v<PackedNonCopyable>);
+    static_assert(std::is_trivially_destructible_v<PackedNonCopyable>);
+    static_assert(std::is_trivially_move_constructible_v<PackedNonCopyable>);
+    EXPECT_EQ(sizeof(PackedNonCopyable), sizeof(std::int32_t));
+#else
+    GTEST_SKIP() << "The policy bases are virtual with COMMONLIB_VIRTUAL_POLICY_BASES";
+#endif
+}
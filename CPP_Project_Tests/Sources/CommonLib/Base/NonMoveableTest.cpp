@@ -1,5 +1,6 @@
 #include "CommonLib/Base/NonMoveableTest.h"
 
+#include <cstdint>
 #include <type_traits>
 
 /**
@@ -12,7 +13,14 @@ class DerivedNonMoveable: public CommonLib::NonMoveable
 {
     public:
         DerivedNonMoveable() = default;
-        ~DerivedNonMoveable() override = default;
+        ~DerivedNonMoveable() = default;
+};
+
+/**
+ * @brief A small value type derived from NonMoveable, as stored densely in arrays.
+ */
+struct PackedNonMoveable: public CommonLib::NonMoveable {
+        std::int32_t value = 0;
 };
 
 /**
@@ -40,3 +48,20 @@ TEST_F(NonMoveableTest, IsNotMoveAssignable)
                   "DerivedNonMoveable should not be move assignable");
     EXPECT_FALSE(std::is_move_assignable_v<DerivedNonMoveable>);
 }
+
+/**
+ * @brief Tests that NonMoveable adds nothing to the size or layout of a derived class.
+ */
+TEST_F(NonMoveableTest, AddsNoSizeOrLayoutOverhead)
+{
+#if !defined(COMMONLIB_VIRTUAL_POLICY_BASES)
+    static_assert(std::is_empty_v<CommonLib::NonMoveable>);
+    static_assert(!std::has_virtual_destructor_v<CommonLib::NonMoveable>);
+    static_assert(sizeof(PackedNonMoveable) == sizeof(std::int32_t));
+    static_assert(std::is_standard_layout_v<PackedNonMoveable>);
+    static_assert(std::is_trivially_destructible_v<PackedNonMoveable>);
+    EXPECT_EQ(sizeof(PackedNonMoveable), sizeof(std::int32_t));
+#else
+    GTEST_SKIP() << "The policy bases are virtual with COMMONLIB_VIRTUAL_POLICY_BASES";
+#endif
+}
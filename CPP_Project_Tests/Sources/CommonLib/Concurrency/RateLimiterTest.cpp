@@ -0,0 +1,176 @@
+#include "CommonLib/Concurrency/RateLimiterTest.h"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using std::chrono::milliseconds;
+
+const Clock::time_point k_start = Clock::time_point(std::chrono::hours(1));
+}  // namespace
+
+/**
+ * @brief Tests that a token bucket allows its burst, then refills at its rate.
+ */
+TEST_F(RateLimiterTest, TokenBucketBurstAndRefill)
+{
+    using namespace CommonLib;
+    TokenBucketLimiter limiter(TokenBucketRule(100.0, 5));  // One token every 10 ms
+    EXPECT_EQ(limiter.available(k_start), 5U);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(limiter.try_acquire_at(k_start)) << i;
+    }
+    EXPECT_FALSE(limiter.try_acquire_at(k_start));
+    EXPECT_EQ(limiter.available(k_start), 0U);
+
+    EXPECT_FALSE(limiter.try_acquire_at(k_start + milliseconds(9)));
+    EXPECT_TRUE(limiter.try_acquire_at(k_start + milliseconds(10)));
+    EXPECT_FALSE(limiter.try_acquire_at(k_start + milliseconds(10)));
+
+    // A denied request takes nothing, however large: three tokens are back after 30 ms.
+    EXPECT_FALSE(limiter.try_acquire_at(k_start + milliseconds(40), 4));
+    EXPECT_EQ(limiter.available(k_start + milliseconds(40)), 3U);
+    EXPECT_TRUE(limiter.try_acquire_at(k_start + milliseconds(40), 3));
+
+    // The bucket never holds more than its burst.
+    EXPECT_EQ(limiter.available(k_start + std::chrono::hours(1)), 5U);
+    EXPECT_FALSE(limiter.try_acquire_at(k_start + std::chrono::hours(1), 6));
+    EXPECT_TRUE(limiter.try_acquire_at(k_start + std::chrono::hours(1), 5));
+
+    TokenBucketLimiter live(TokenBucketRule(1.0, 1));
+    EXPECT_TRUE(live.try_acquire());
+    EXPECT_FALSE(live.try_acquire());
+}
+
+/**
+ * @brief Tests that a sliding window weights the previous window by its remaining overlap.
+ */
+TEST_F(RateLimiterTest, SlidingWindowWeightsPreviousWindow)
+{
+    using namespace CommonLib;
+    SlidingWindowLimiter limiter(SlidingWindowRule(10, milliseconds(100)));
+    EXPECT_TRUE(limiter.try_acquire_at(k_start, 10));
+    EXPECT_FALSE(limiter.try_acquire_at(k_start + milliseconds(99)));
+
+    // A quarter into the next window, 3/4 of the previous 10 still count.
+    EXPECT_EQ(limiter.available(k_start + milliseconds(125)), 2U);
+    EXPECT_TRUE(limiter.try_acquire_at(k_start + milliseconds(125), 2));
+    EXPECT_FALSE(limiter.try_acquire_at(k_start + milliseconds(125)));
+
+    // Half-way, 5 of the previous count; 2 were taken in this window.
+    EXPECT_TRUE(limiter.try_acquire_at(k_start + milliseconds(150), 3));
+    EXPECT_FALSE(limiter.try_acquire_at(k_start + milliseconds(150)));
+
+    // One window later only the 5 of the window starting at 100 ms count, fully at its end.
+    EXPECT_EQ(limiter.available(k_start + milliseconds(200)), 5U);
+
+    // After two idle windows nothing counts.
+    EXPECT_EQ(limiter.available(k_start + milliseconds(300)), 10U);
+    EXPECT_FALSE(limiter.try_acquire_at(k_start + milliseconds(300), 11));
+    EXPECT_TRUE(limiter.try_acquire_at(k_start + milliseconds(300), 10));
+}
+
+/**
+ * @brief Tests that contending threads together get exactly the allowed number of tokens.
+ */
+TEST_F(RateLimiterTest, ConcurrentAcquireIsExact)
+{
+    using namespace CommonLib;
+    constexpr int k_threads = 8;
+    constexpr int k_attempts = 20000;
+    TokenBucketLimiter bucket(TokenBucketRule(1.0, 50000));
+    SlidingWindowLimiter window(SlidingWindowRule(50000, std::chrono::seconds(1)));
+
+    std::atomic<int> bucket_allowed{0};
+    std::atomic<int> window_allowed{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < k_threads; ++t)
+    {
+        threads.emplace_back([&] {
+            for (int i = 0; i < k_attempts; ++i)
+            {
+                bucket_allowed += bucket.try_acquire_at(k_start) ? 1 : 0;
+                window_allowed += window.try_acquire_at(k_start) ? 1 : 0;
+            }
+        });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(bucket_allowed.load(), 50000);
+    EXPECT_EQ(window_allowed.load(), 50000);
+}
+
+/**
+ * @brief Tests that a sharded limiter keeps independent limits for many keys, including key 0.
+ */
+TEST_F(RateLimiterTest, ShardedKeysAreIndependent)
+{
+    using namespace CommonLib;
+    ShardedRateLimiter<TokenBucketRule> limiter(TokenBucketRule(1.0, 2), 1 << 16, 16);
+    EXPECT_EQ(limiter.capacity(), 1U << 16);
+
+    for (std::uint64_t key = 0; key < 20000; ++key)
+    {
+        ASSERT_TRUE(limiter.try_acquire_at(key, k_start)) << key;
+        ASSERT_TRUE(limiter.try_acquire_at(key, k_start)) << key;
+    }
+    for (std::uint64_t key = 0; key < 20000; ++key)
+    {
+        ASSERT_FALSE(limiter.try_acquire_at(key, k_start)) << key;
+    }
+    EXPECT_TRUE(limiter.try_acquire_at(7, k_start + std::chrono::seconds(1)));
+    EXPECT_FALSE(limiter.try_acquire_at(8, k_start + std::chrono::milliseconds(999)));
+    EXPECT_EQ(limiter.untracked(), 0U);
+}
+
+/**
+ * @brief Tests that a full table evicts idle keys and denies new keys while all are active.
+ */
+TEST_F(RateLimiterTest, ShardedTableEvictsIdleKeys)
+{
+    using namespace CommonLib;
+    using Limiter = ShardedRateLimiter<SlidingWindowRule>;
+    Limiter limiter(SlidingWindowRule(1, milliseconds(10)), Limiter::k_probe_limit, 1);
+
+    // Fill the only probe window with active keys.
+    std::uint64_t key = 1;
+    for (; limiter.untracked() == 0; ++key)
+    {
+        limiter.try_acquire_at(key, k_start);
+    }
+    EXPECT_EQ(key - 1, Limiter::k_probe_limit + 1);
+    EXPECT_FALSE(limiter.try_acquire_at(key, k_start));
+    EXPECT_EQ(limiter.untracked(), 2U);
+
+    // Two windows later all keys are idle and may be replaced; the new ones are limited again.
+    const Clock::time_point later = k_start + milliseconds(20);
+    for (std::uint64_t other = 1000; other < 1000 + Limiter::k_probe_limit; ++other)
+    {
+        EXPECT_TRUE(limiter.try_acquire_at(other, later)) << other;
+        EXPECT_FALSE(limiter.try_acquire_at(other, later)) << other;
+    }
+    EXPECT_EQ(limiter.untracked(), 2U);
+}
+
+/**
+ * @brief Tests that invalid rule and table parameters are rejected.
+ */
+TEST_F(RateLimiterTest, InvalidParametersThrow)
+{
+    using namespace CommonLib;
+    EXPECT_THROW(TokenBucketRule(0.0, 1), std::invalid_argument);
+    EXPECT_THROW(TokenBucketRule(2e9, 1), std::invalid_argument);
+    EXPECT_THROW(TokenBucketRule(1.0, 0), std::invalid_argument);
+    EXPECT_THROW(SlidingWindowRule(0, milliseconds(1)), std::invalid_argument);
+    EXPECT_THROW(SlidingWindowRule(SlidingWindowRule::k_max_limit + 1, milliseconds(1)),
+                 std::invalid_argument);
+    EXPECT_THROW(SlidingWindowRule(1, milliseconds(0)), std::invalid_argument);
+    EXPECT_THROW(ShardedRateLimiter<TokenBucketRule>(TokenBucketRule(1.0, 1), 64, 64),
+                 std::invalid_argument);
+}
@@ -0,0 +1,274 @@
+#include "CommonLib/Logging/AsyncLoggerTest.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Level = CommonLib::AsyncLogger::Level;
+using OverflowPolicy = CommonLib::AsyncLogger::OverflowPolicy;
+
+/**
+ * @brief A log file path in the temporary directory; removes the file and its rotations.
+ */
+class TempLog
+{
+    public:
+        explicit TempLog(const std::string& name)
+            : m_path((std::filesystem::temp_directory_path() / ("commonlib_" + name + ".log"))
+                         .string())
+        {
+            remove_all();
+        }
+
+        ~TempLog()
+        {
+            CommonLib::AsyncLogger::get_instance().stop();
+            remove_all();
+        }
+
+        TempLog(const TempLog&) = delete;
+        auto operator=(const TempLog&) -> TempLog& = delete;
+        TempLog(TempLog&&) = delete;
+        auto operator=(TempLog&&) -> TempLog& = delete;
+
+        [[nodiscard]] auto path() const -> const std::string&
+        {
+            return m_path;
+        }
+
+        [[nodiscard]] auto config() const -> CommonLib::AsyncLogger::Config
+        {
+            CommonLib::AsyncLogger::Config config;
+            config.path = m_path;
+            config.timestamp_format = "%Y-%m-%dT%H:%M:%S.%3NZ";
+            config.zone = CommonLib::DateTimeFormatter::Zone::Utc;
+            return config;
+        }
+
+    private:
+        void remove_all() const
+        {
+            std::error_code error;
+            std::filesystem::remove(m_path, error);
+            for (int index = 1; index <= 8; ++index)
+            {
+                std::filesystem::remove(m_path + "." + std::to_string(index), error);
+            }
+        }
+
+        std::string m_path;
+};
+
+auto read_lines(const std::string& path) -> std::vector<std::string>
+{
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);)
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+}  // namespace
+
+/**
+ * @brief Tests that captured arguments are rendered into the line on the writer thread.
+ */
+TEST_F(AsyncLoggerTest, WritesFormattedLines)
+{
+    using namespace CommonLib;
+    const TempLog log("async_logger_format");
+    auto& logger = AsyncLogger::get_instance();
+    auto config = log.config();
+    config.level = Level::Debug;
+    logger.start(config);
+    ASSERT_TRUE(logger.running());
+    EXPECT_EQ(logger.level(), Level::Debug);
+
+    const std::string name = "worker";
+    EXPECT_TRUE(logger.log(Level::Info, "int={} uint={} double={} bool={} char={}", -42, 7U, 2.5,
+                           true, 'x'));
+    EXPECT_TRUE(logger.log(Level::Error, "name={} view={} literal={} missing={}", name,
+                           std::string_view("view"), "text"));
+    EXPECT_TRUE(logger.log(Level::Debug, "{{escaped}} {}", Level::Error));
+    EXPECT_FALSE(logger.log(Level::Trace, "filtered"));
+    COMMONLIB_LOG_WARNING("macro {}", 1);
+    EXPECT_TRUE(logger.log(Level::Info, "long {} {}", std::string(1000, 'a'), 5));
+    logger.flush();
+
+    const auto lines = read_lines(log.path());
+    ASSERT_EQ(lines.size(), 5U);
+    ASSERT_GT(lines[0].size(), 24U);
+    EXPECT_EQ(lines[0][10], 'T');
+    EXPECT_EQ(lines[0][23], 'Z');
+    EXPECT_NE(lines[0].find(" [INFO] ["), std::string::npos);
+    EXPECT_NE(lines[0].find("] int=-42 uint=7 double=2.5 bool=true char=x"), std::string::npos);
+    EXPECT_NE(lines[1].find(" [ERROR] "), std::string::npos);
+    EXPECT_NE(lines[1].find("name=worker view=view literal=text missing={}"), std::string::npos);
+    EXPECT_NE(lines[2].find("{escaped} 4"), std::string::npos);
+    EXPECT_NE(lines[3].find(" [WARNING] "), std::string::npos);
+    EXPECT_NE(lines[3].find("macro 1"), std::string::npos);
+    EXPECT_NE(lines[4].find(" aaaa"), std::string::npos);
+    EXPECT_EQ(lines[4].substr(lines[4].size() - 12), " [truncated]");
+    EXPECT_LT(lines[4].size(), AsyncLogger::k_record_size + 64);
+
+    logger.set_level(Level::Error);
+    EXPECT_FALSE(logger.enabled(Level::Warning));
+    EXPECT_TRUE(logger.enabled(Level::Critical));
+    const std::uint64_t written = logger.written();
+    logger.stop();
+    EXPECT_FALSE(logger.running());
+    EXPECT_FALSE(logger.log(Level::Critical, "after stop"));
+    EXPECT_EQ(logger.written(), written);
+}
+
+/**
+ * @brief Tests that files are rotated by size and only max_files rotations are kept.
+ */
+TEST_F(AsyncLoggerTest, RotatesFilesBySize)
+{
+    using namespace CommonLib;
+    const TempLog log("async_logger_rotate");
+    auto& logger = AsyncLogger::get_instance();
+    auto config = log.config();
+    config.max_file_size = 400;
+    config.max_files = 3;
+    logger.start(config);
+
+    for (int i = 0; i < 200; ++i)
+    {
+        ASSERT_TRUE(logger.log(Level::Info, "line {}", i));
+    }
+    logger.stop();
+
+    for (const std::string suffix: {"", ".1", ".2", ".3"})
+    {
+        const std::string path = log.path() + suffix;
+        ASSERT_TRUE(std::filesystem::exists(path)) << path;
+        EXPECT_LE(std::filesystem::file_size(path), config.max_file_size) << path;
+    }
+    EXPECT_FALSE(std::filesystem::exists(log.path() + ".4"));
+
+    // The current file holds the newest lines, ending with the last one.
+    const auto lines = read_lines(log.path());
+    ASSERT_FALSE(lines.empty());
+    EXPECT_NE(lines.back().find("line 199"), std::string::npos);
+    const auto oldest = read_lines(log.path() + ".3");
+    ASSERT_FALSE(oldest.empty());
+    EXPECT_EQ(oldest.back().find("line 199"), std::string::npos);
+}
+
+/**
+ * @brief Tests that no line is lost or reordered per thread with the blocking policy.
+ */
+TEST_F(AsyncLoggerTest, BlockingProducersLoseNoLines)
+{
+    using namespace CommonLib;
+    const TempLog log("async_logger_block");
+    auto& logger = AsyncLogger::get_instance();
+    auto config = log.config();
+    config.overflow = OverflowPolicy::Block;
+    config.queue_capacity = 64;
+    config.buffer_size = 4096;
+    logger.start(config);
+
+    constexpr int k_threads = 4;
+    constexpr int k_lines = 2000;
+    const std::uint64_t dropped = logger.dropped();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < k_threads; ++t)
+    {
+        threads.emplace_back([&logger, t] {
+            for (int i = 0; i < k_lines; ++i)
+            {
+                logger.log(Level::Info, "producer {} line {}", t, i);
+            }
+        });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+    logger.stop();
+    EXPECT_EQ(logger.dropped(), dropped);
+
+    const auto lines = read_lines(log.path());
+    ASSERT_EQ(lines.size(), static_cast<std::size_t>(k_threads * k_lines));
+    std::vector<int> next(k_threads, 0);
+    for (const std::string& line: lines)
+    {
+        const std::size_t at = line.find("producer ");
+        ASSERT_NE(at, std::string::npos);
+        const int producer = std::stoi(line.substr(at + 9));
+        const int index = std::stoi(line.substr(line.find(" line ") + 6));
+        ASSERT_EQ(index, next[producer]) << line;
+        ++next[producer];
+    }
+}
+
+/**
+ * @brief Tests that the drop policy counts every line it does not queue.
+ */
+TEST_F(AsyncLoggerTest, DropPolicyCountsDroppedLines)
+{
+    using namespace CommonLib;
+    const TempLog log("async_logger_drop");
+    auto& logger = AsyncLogger::get_instance();
+    auto config = log.config();
+    config.queue_capacity = 2;
+    logger.start(config);
+
+    constexpr std::uint64_t k_lines = 20000;
+    const std::uint64_t dropped = logger.dropped();
+    std::uint64_t queued = 0;
+    for (std::uint64_t i = 0; i < k_lines; ++i)
+    {
+        queued += logger.log(Level::Info, "line {}", i) ? 1 : 0;
+    }
+    logger.stop();
+    EXPECT_EQ(queued + logger.dropped() - dropped, k_lines);
+    EXPECT_EQ(read_lines(log.path()).size(), queued);
+}
+
+/**
+ * @brief Tests that invalid settings are rejected and restarting appends to the file.
+ */
+TEST_F(AsyncLoggerTest, RejectsInvalidConfigAndRestarts)
+{
+    using namespace CommonLib;
+    const TempLog log("async_logger_config");
+    auto& logger = AsyncLogger::get_instance();
+    auto config = log.config();
+
+    auto invalid = config;
+    invalid.path.clear();
+    EXPECT_THROW(logger.start(invalid), std::invalid_argument);
+    invalid = config;
+    invalid.queue_capacity = 3;
+    EXPECT_THROW(logger.start(invalid), std::invalid_argument);
+    invalid = config;
+    invalid.buffer_size = 0;
+    EXPECT_THROW(logger.start(invalid), std::invalid_argument);
+    invalid = config;
+    invalid.path = log.path() + ".missing/app.log";
+    EXPECT_THROW(logger.start(invalid), std::runtime_error);
+    EXPECT_FALSE(logger.running());
+    logger.flush();
+
+    logger.start(config);
+    logger.log(Level::Info, "first");
+    config.queue_capacity = 128;
+    logger.start(config);
+    logger.log(Level::Info, "second");
+    logger.stop();
+    const auto lines = read_lines(log.path());
+    ASSERT_EQ(lines.size(), 2U);
+    EXPECT_NE(lines[1].find("second"), std::string::npos);
+    EXPECT_EQ(AsyncLogger::level_name(Level::Critical), "CRITICAL");
+}
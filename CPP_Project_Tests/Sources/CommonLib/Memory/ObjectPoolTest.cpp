@@ -0,0 +1,173 @@
+#include "CommonLib/Memory/ObjectPoolTest.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+int g_live_orders = 0;
+
+struct Order {
+        Order(std::string symbol, std::int64_t quantity)
+            : symbol(std::move(symbol)), quantity(quantity)
+        {
+            if (quantity < 0)
+            {
+                throw std::invalid_argument("negative quantity");
+            }
+            ++g_live_orders;
+        }
+
+        ~Order()
+        {
+            --g_live_orders;
+        }
+
+        Order(const Order&) = delete;
+        auto operator=(const Order&) -> Order& = delete;
+        Order(Order&&) = delete;
+        auto operator=(Order&&) -> Order& = delete;
+
+        std::string symbol;
+        std::int64_t quantity;
+};
+}  // namespace
+
+/**
+ * @brief Tests that handles construct, expose and destroy the pooled objects.
+ */
+TEST_F(ObjectPoolTest, HandlesOwnPooledObjects)
+{
+    using namespace CommonLib;
+    ObjectPool<Order> pool(8, 4);
+    {
+        auto order = pool.acquire("AAPL", 100);
+        ASSERT_TRUE(order);
+        EXPECT_EQ(order->symbol, "AAPL");
+        EXPECT_EQ((*order).quantity, 100);
+        EXPECT_EQ(g_live_orders, 1);
+        EXPECT_EQ(pool.capacity(), 8U);
+    }
+    EXPECT_EQ(g_live_orders, 0);
+
+    auto order = pool.acquire("MSFT", 5);
+    order.reset();
+    EXPECT_FALSE(order);
+    EXPECT_EQ(order.get(), nullptr);
+    EXPECT_EQ(g_live_orders, 0);
+}
+
+/**
+ * @brief Tests that released objects' storage is reused instead of growing the pool.
+ */
+TEST_F(ObjectPoolTest, ReusesReleasedStorage)
+{
+    using namespace CommonLib;
+    ObjectPool<Order> pool(4, 4);
+
+    Order* first = nullptr;
+    {
+        auto order = pool.acquire("IBM", 1);
+        first = order.get();
+    }
+    auto order = pool.acquire("IBM", 2);
+    EXPECT_EQ(order.get(), first);
+
+    std::vector<ObjectPool<Order>::Handle> orders;
+    for (std::int64_t quantity = 0; quantity < 11; ++quantity)
+    {
+        orders.push_back(pool.acquire("IBM", quantity));
+    }
+    EXPECT_EQ(pool.capacity(), 4U + 8U);
+    EXPECT_EQ(g_live_orders, 12);
+    orders.clear();
+    EXPECT_EQ(g_live_orders, 1);
+}
+
+/**
+ * @brief Tests that handles are move-only and transfer ownership.
+ */
+TEST_F(ObjectPoolTest, MovesHandles)
+{
+    using namespace CommonLib;
+    static_assert(!std::is_copy_constructible_v<ObjectPool<Order>::Handle>);
+    static_assert(std::is_nothrow_move_constructible_v<ObjectPool<Order>::Handle>);
+
+    ObjectPool<Order> pool(4, 4);
+    auto first = pool.acquire("A", 1);
+    Order* object = first.get();
+
+    ObjectPool<Order>::Handle second(std::move(first));
+    EXPECT_FALSE(first);  // NOLINT(bugprone-use-after-move)
+    EXPECT_EQ(second.get(), object);
+
+    auto third = pool.acquire("B", 2);
+    third = std::move(second);
+    EXPECT_EQ(third.get(), object);
+    EXPECT_EQ(g_live_orders, 1);
+    third = ObjectPool<Order>::Handle();
+    EXPECT_EQ(g_live_orders, 0);
+}
+
+/**
+ * @brief Tests that the slot is returned when the constructor throws.
+ */
+TEST_F(ObjectPoolTest, ReturnsSlotWhenConstructorThrows)
+{
+    using namespace CommonLib;
+    ObjectPool<Order> pool(1, 1);
+    EXPECT_THROW(static_cast<void>(pool.acquire("X", -1)), std::invalid_argument);
+    EXPECT_EQ(g_live_orders, 0);
+
+    auto order = pool.acquire("X", 1);
+    EXPECT_EQ(pool.capacity(), 1U);
+}
+
+/**
+ * @brief Tests that objects can be released on another thread than the acquiring one.
+ */
+TEST_F(ObjectPoolTest, ReleasesObjectsOnOtherThreads)
+{
+    using namespace CommonLib;
+    ObjectPool<Order> pool(32, 8);
+
+    std::vector<ObjectPool<Order>::Handle> orders;
+    for (std::int64_t quantity = 0; quantity < 32; ++quantity)
+    {
+        orders.push_back(pool.acquire("ESZ6", quantity));
+    }
+    std::thread([orders = std::move(orders)]() mutable { orders.clear(); }).join();
+    EXPECT_EQ(g_live_orders, 0);
+
+    for (std::int64_t quantity = 0; quantity < 32; ++quantity)
+    {
+        orders.push_back(pool.acquire("ESZ6", quantity));
+    }
+    EXPECT_EQ(pool.capacity(), 32U);
+    orders.clear();
+}
+
+/**
+ * @brief Tests that released objects are overwritten with the poison byte in debug builds.
+ */
+TEST_F(ObjectPoolTest, PoisonsReleasedObjectsInDebugBuilds)
+{
+    using namespace CommonLib;
+    if (!SlotAllocator::poisoning())
+    {
+        GTEST_SKIP() << "The library was built without poisoning";
+    }
+    ObjectPool<std::int64_t> pool(4, 4);
+    auto value = pool.acquire(-1);
+    const auto* bytes = reinterpret_cast<const unsigned char*>(value.get());
+    value.reset();
+    for (std::size_t offset = 0; offset < sizeof(std::int64_t); ++offset)
+    {
+        EXPECT_EQ(bytes[offset], SlotAllocator::k_poison_byte);
+    }
+}
@@ -0,0 +1,211 @@
+#include "CommonLib/Memory/SlotAllocatorTest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Tests that slots are cache-line aligned, distinct and addressable by index.
+ */
+TEST_F(SlotAllocatorTest, AllocatesAlignedDistinctSlots)
+{
+    using namespace CommonLib;
+    SlotAllocator allocator(24, 8, 16, 4);
+    EXPECT_EQ(allocator.slot_size(), SlotAllocator::k_cache_line);
+    EXPECT_EQ(allocator.capacity(), 0U);
+
+    std::vector<SlotAllocator::Slot> slots;
+    std::set<void*> pointers;
+    for (int count = 0; count < 16; ++count)
+    {
+        const auto slot = allocator.allocate();
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(slot.pointer) % SlotAllocator::k_cache_line, 0U);
+        EXPECT_EQ(allocator.slot(slot.index), slot.pointer);
+        pointers.insert(slot.pointer);
+        slots.push_back(slot);
+    }
+    EXPECT_EQ(pointers.size(), 16U);
+    EXPECT_EQ(allocator.slab_count(), 1U);
+    EXPECT_EQ(allocator.capacity(), 16U);
+
+    for (const auto& slot: slots)
+    {
+        allocator.deallocate(slot.index);
+    }
+}
+
+/**
+ * @brief Tests that slabs double in size and that freed slots are reused before growing.
+ */
+TEST_F(SlotAllocatorTest, GrowsByDoublingSlabsAndReusesFreedSlots)
+{
+    using namespace CommonLib;
+    SlotAllocator allocator(100, 16, 10, 8);
+    EXPECT_EQ(allocator.slot_size(), 2 * SlotAllocator::k_cache_line);
+
+    std::vector<std::uint32_t> indices;
+    for (int count = 0; count < 17; ++count)
+    {
+        indices.push_back(allocator.allocate().index);
+    }
+    // 16 + 32 slots; the first slab size was rounded up to a power of two.
+    EXPECT_EQ(allocator.slab_count(), 2U);
+    EXPECT_EQ(allocator.capacity(), 48U);
+
+    for (const auto index: indices)
+    {
+        allocator.deallocate(index);
+    }
+    for (int count = 0; count < 48; ++count)
+    {
+        indices.push_back(allocator.allocate().index);
+    }
+    EXPECT_EQ(allocator.slab_count(), 2U);
+    indices.erase(indices.begin(), indices.begin() + 17);
+    EXPECT_EQ(std::set<std::uint32_t>(indices.begin(), indices.end()).size(), 48U);
+    for (const auto index: indices)
+    {
+        allocator.deallocate(index);
+    }
+}
+
+/**
+ * @brief Tests that slots freed on other threads return to the shared list and are reused.
+ */
+TEST_F(SlotAllocatorTest, ReusesSlotsFreedOnOtherThreads)
+{
+    using namespace CommonLib;
+    SlotAllocator allocator(64, 8, 64, 8);
+
+    std::vector<std::uint32_t> indices;
+    for (int count = 0; count < 64; ++count)
+    {
+        indices.push_back(allocator.allocate().index);
+    }
+    EXPECT_EQ(allocator.capacity(), 64U);
+
+    // The freeing thread returns its cache to the shared list when it exits.
+    std::thread([&allocator, &indices] {
+        for (const auto index: indices)
+        {
+            allocator.deallocate(index);
+        }
+    }).join();
+
+    indices.clear();
+    for (int count = 0; count < 64; ++count)
+    {
+        indices.push_back(allocator.allocate().index);
+    }
+    EXPECT_EQ(allocator.capacity(), 64U);
+    for (const auto index: indices)
+    {
+        allocator.deallocate(index);
+    }
+}
+
+/**
+ * @brief Tests concurrent allocation and deallocation from several threads.
+ */
+TEST_F(SlotAllocatorTest, SupportsConcurrentAllocationAndDeallocation)
+{
+    using namespace CommonLib;
+    SlotAllocator allocator(sizeof(std::uint64_t), alignof(std::uint64_t), 16, 8);
+
+    std::vector<std::thread> threads;
+    for (std::uint64_t thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&allocator, thread] {
+            std::vector<SlotAllocator::Slot> slots;
+            for (int round = 0; round < 200; ++round)
+            {
+                for (std::uint64_t count = 0; count < 50; ++count)
+                {
+                    const auto slot = allocator.allocate();
+                    *static_cast<std::uint64_t*>(slot.pointer) = thread << 32 | count;
+                    slots.push_back(slot);
+                }
+                for (std::uint64_t count = 0; count < 50; ++count)
+                {
+                    ASSERT_EQ(*static_cast<std::uint64_t*>(slots[count].pointer),
+                              thread << 32 | count);
+                    allocator.deallocate(slots[count].index);
+                }
+                slots.clear();
+            }
+            allocator.flush_thread_cache();
+        });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+    EXPECT_LE(allocator.capacity(), 16U * 63U);
+}
+
+/**
+ * @brief Tests that a slot freed after the thread's caches were destroyed, as static objects do
+ *        after main() returned, goes back to the shared list.
+ */
+TEST_F(SlotAllocatorTest, FreesSlotsAfterThreadCachesAreDestroyed)
+{
+    using namespace CommonLib;
+    SlotAllocator allocator(64, 8, 1, 1);
+
+    struct Holder {
+            SlotAllocator* allocator = nullptr;
+            std::uint32_t index = 0;
+
+            ~Holder()
+            {
+                allocator->deallocate(index);
+            }
+    };
+
+    std::thread([&allocator] {
+        // Constructed before the thread's caches, so destroyed after them.
+        thread_local Holder holder;
+        holder.allocator = &allocator;
+        holder.index = allocator.allocate().index;
+    }).join();
+
+    const auto slot = allocator.allocate();
+    EXPECT_EQ(allocator.capacity(), 1U);
+    allocator.deallocate(slot.index);
+}
+
+/**
+ * @brief Tests that freed slots are poisoned in debug builds.
+ */
+TEST_F(SlotAllocatorTest, PoisonsFreedSlotsInDebugBuilds)
+{
+    using namespace CommonLib;
+    if (!SlotAllocator::poisoning())
+    {
+        GTEST_SKIP() << "The library was built without poisoning";
+    }
+    SlotAllocator allocator(32, 8, 4, 4);
+    const auto slot = allocator.allocate();
+    std::memset(slot.pointer, 0x11, 32);
+    allocator.deallocate(slot.index);
+
+    const auto* bytes = static_cast<const unsigned char*>(slot.pointer);
+    for (std::size_t offset = 0; offset < 32; ++offset)
+    {
+        EXPECT_EQ(bytes[offset], SlotAllocator::k_poison_byte);
+    }
+}
+
+/**
+ * @brief Tests that invalid construction arguments are rejected.
+ */
+TEST_F(SlotAllocatorTest, RejectsInvalidArguments)
+{
+    using namespace CommonLib;
+    EXPECT_THROW(SlotAllocator(16, 3), std::invalid_argument);
+    EXPECT_THROW(SlotAllocator(16, 8, 0), std::invalid_argument);
+    EXPECT_THROW(SlotAllocator(16, 8, 16, 0), std::invalid_argument);
+}
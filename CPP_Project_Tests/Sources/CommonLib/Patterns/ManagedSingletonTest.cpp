@@ -0,0 +1,229 @@
+#include "CommonLib/Patterns/ManagedSingletonTest.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+/// Constructor and destructor calls of the test singletons, in order.
+std::vector<std::string> g_events;
+
+auto position_of(const std::string& event) -> std::ptrdiff_t
+{
+    const auto it = std::find(g_events.begin(), g_events.end(), event);
+    return it == g_events.end() ? -1 : it - g_events.begin();
+}
+
+class Settings: public CommonLib::ManagedSingleton<Settings>
+{
+        friend class CommonLib::ManagedSingleton<Settings>;
+
+    public:
+        int port = 8080;
+
+    private:
+        Settings()
+        {
+            g_events.emplace_back("Settings");
+        }
+
+        ~Settings()
+        {
+            g_events.emplace_back("~Settings");
+        }
+};
+
+class Database: public CommonLib::ManagedSingleton<Database, Settings>
+{
+        friend class CommonLib::ManagedSingleton<Database, Settings>;
+
+    public:
+        int port = 0;
+
+    private:
+        Database(): port(Settings::instance().port)
+        {
+            g_events.emplace_back("Database");
+        }
+
+        ~Database()
+        {
+            // Dependencies are still alive during destruction.
+            g_events.emplace_back(Settings::try_instance() != nullptr ? "~Database" : "!Database");
+        }
+};
+
+class Cache: public CommonLib::ManagedSingleton<Cache, Database, Settings>
+{
+        friend class CommonLib::ManagedSingleton<Cache, Database, Settings>;
+
+    public:
+        int port = 0;
+
+    private:
+        Cache(): port(Database::instance().port + 1)
+        {
+            g_events.emplace_back("Cache");
+        }
+
+        ~Cache()
+        {
+            g_events.emplace_back(Database::try_instance() != nullptr ? "~Cache" : "!Cache");
+        }
+};
+
+class CycleB;
+
+class CycleA: public CommonLib::ManagedSingleton<CycleA, CycleB>
+{
+        friend class CommonLib::ManagedSingleton<CycleA, CycleB>;
+
+    private:
+        CycleA() = default;
+        ~CycleA() = default;
+};
+
+class CycleB: public CommonLib::ManagedSingleton<CycleB, CycleA>
+{
+        friend class CommonLib::ManagedSingleton<CycleB, CycleA>;
+
+    private:
+        CycleB() = default;
+        ~CycleB() = default;
+};
+
+class Connection: public CommonLib::ManagedSingleton<Connection>
+{
+        friend class CommonLib::ManagedSingleton<Connection>;
+
+    private:
+        Connection()
+        {
+            g_events.emplace_back("Connection");
+        }
+
+        ~Connection()
+        {
+            g_events.emplace_back("~Connection");
+        }
+};
+
+class FailingService: public CommonLib::ManagedSingleton<FailingService, Connection>
+{
+        friend class CommonLib::ManagedSingleton<FailingService, Connection>;
+
+    private:
+        FailingService()
+        {
+            throw std::runtime_error("unavailable");
+        }
+
+        ~FailingService() = default;
+};
+}  // namespace
+
+/**
+ * @brief Tests that dependencies are constructed first and destroyed last.
+ */
+TEST_F(ManagedSingletonTest, InitializesInDependencyOrder)
+{
+    using namespace CommonLib;
+    SingletonRegistry::shutdown();
+    g_events.clear();
+
+    SingletonRegistry::initialize();
+    EXPECT_EQ(Cache::instance().port, 8081);
+    ASSERT_GE(position_of("Settings"), 0);
+    EXPECT_LT(position_of("Settings"), position_of("Database"));
+    EXPECT_LT(position_of("Database"), position_of("Cache"));
+
+    // Other singletons registered in the test binary may be constructed in between.
+    const auto order = SingletonRegistry::construction_order();
+    const auto rank = [&order](const std::string& name) {
+        return std::find_if(order.begin(), order.end(), [&name](const std::string& entry) {
+                   return entry.find(name) != std::string::npos;
+               }) -
+               order.begin();
+    };
+    EXPECT_LT(rank("Settings"), rank("Database"));
+    EXPECT_LT(rank("Database"), rank("Cache"));
+    EXPECT_LT(rank("Cache"), static_cast<std::ptrdiff_t>(order.size()));
+
+    // A second call constructs nothing new.
+    SingletonRegistry::initialize();
+    EXPECT_EQ(g_events.size(), 3U);
+
+    SingletonRegistry::shutdown();
+    EXPECT_EQ(g_events, (std::vector<std::string>{"Settings", "Database", "Cache", "~Cache",
+                                                  "~Database", "~Settings"}));
+    EXPECT_TRUE(SingletonRegistry::construction_order().empty());
+}
+
+/**
+ * @brief Tests that the instance only exists between initialization and shutdown.
+ */
+TEST_F(ManagedSingletonTest, InstanceExistsBetweenInitializeAndShutdown)
+{
+    using namespace CommonLib;
+    SingletonRegistry::shutdown();
+    EXPECT_EQ(Cache::try_instance(), nullptr);
+
+    Database::initialize();
+    EXPECT_NE(Settings::try_instance(), nullptr);
+    EXPECT_EQ(Cache::try_instance(), nullptr);
+    EXPECT_EQ(&Database::instance(), Database::try_instance());
+    Database::instance().port = 1;
+    EXPECT_EQ(Database::instance().port, 1);
+
+    SingletonRegistry::shutdown();
+    EXPECT_EQ(Database::try_instance(), nullptr);
+    EXPECT_EQ(Settings::try_instance(), nullptr);
+
+    // A new lifetime starts with a fresh instance.
+    Database::initialize();
+    EXPECT_EQ(Database::instance().port, 8080);
+    SingletonRegistry::shutdown();
+}
+
+/**
+ * @brief Tests that a dependency cycle is rejected without constructing anything.
+ */
+TEST_F(ManagedSingletonTest, RejectsDependencyCycles)
+{
+    using namespace CommonLib;
+    SingletonRegistry::shutdown();
+    // Only types whose instance is used register themselves, so the cycle does not break
+    // SingletonRegistry::initialize() in the other tests.
+    EXPECT_THROW(CycleA::initialize(), std::logic_error);
+    EXPECT_THROW(CycleB::initialize(), std::logic_error);
+    EXPECT_TRUE(SingletonRegistry::construction_order().empty());
+}
+
+/**
+ * @brief Tests that a failing constructor destroys the singletons constructed before it.
+ */
+TEST_F(ManagedSingletonTest, RollsBackFailedInitialization)
+{
+    using namespace CommonLib;
+    SingletonRegistry::shutdown();
+    g_events.clear();
+
+    EXPECT_THROW(FailingService::initialize(), std::runtime_error);
+    EXPECT_EQ(g_events, (std::vector<std::string>{"Connection", "~Connection"}));
+    EXPECT_TRUE(SingletonRegistry::construction_order().empty());
+}
+
+/**
+ * @brief Tests that managed singletons are neither copyable nor moveable.
+ */
+TEST_F(ManagedSingletonTest, IsNotCopyOrMoveable)
+{
+    static_assert(!std::is_copy_constructible_v<Cache>);
+    static_assert(!std::is_copy_assignable_v<Cache>);
+    static_assert(!std::is_move_constructible_v<Cache>);
+    static_assert(!std::is_move_assignable_v<Cache>);
+    EXPECT_FALSE(std::is_default_constructible_v<Cache>);
+}
@@ -0,0 +1,87 @@
+#include "CommonLib/Patterns/ShardedSingletonTest.h"
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+class HitCounter: public CommonLib::ShardedSingleton<HitCounter>
+{
+        friend class CommonLib::ShardedSingleton<HitCounter>;
+
+    public:
+        void add(std::uint64_t count) noexcept
+        {
+            m_count.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto count() const noexcept -> std::uint64_t
+        {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+    private:
+        HitCounter() = default;
+        ~HitCounter() = default;
+
+        std::atomic<std::uint64_t> m_count{0};
+};
+
+auto total() -> std::uint64_t
+{
+    return HitCounter::aggregate(std::uint64_t{0}, [](std::uint64_t sum, const HitCounter& shard) {
+        return sum + shard.count();
+    });
+}
+}  // namespace
+
+/**
+ * @brief Tests the shard count and that every shard has a cache line of its own.
+ */
+TEST_F(ShardedSingletonTest, CreatesOneAlignedShardPerCpu)
+{
+    using namespace CommonLib;
+    const std::size_t count = HitCounter::shard_count();
+    EXPECT_EQ(count, CpuShard::count());
+    EXPECT_TRUE(std::has_single_bit(count));
+    EXPECT_LT(CpuShard::current(), count);
+
+    std::set<const HitCounter*> shards;
+    HitCounter::visit([&shards](HitCounter& shard) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&shard) % 64, 0U);
+        shards.insert(&shard);
+    });
+    EXPECT_EQ(shards.size(), count);
+    EXPECT_EQ(shards.count(&HitCounter::local()), 1U);
+    EXPECT_EQ(shards.count(&HitCounter::shard(count - 1)), 1U);
+    EXPECT_THROW(HitCounter::shard(count), std::out_of_range);
+}
+
+/**
+ * @brief Tests that concurrent updates of the local shards add up exactly.
+ */
+TEST_F(ShardedSingletonTest, AggregatesConcurrentUpdates)
+{
+    using namespace CommonLib;
+    const std::uint64_t before = total();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([] {
+            for (int i = 0; i < 10000; ++i)
+            {
+                HitCounter::local().add(1);
+            }
+        });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(total() - before, 40000U);
+}
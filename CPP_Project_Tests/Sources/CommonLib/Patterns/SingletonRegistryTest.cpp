@@ -0,0 +1,264 @@
+#include "CommonLib/Patterns/SingletonRegistryTest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CommonLib/Patterns/ManagedSingleton.h"
+#include "CommonLib/Patterns/Singleton.h"
+
+namespace
+{
+using namespace std::chrono_literals;
+
+/// How long the slow singletons take to construct, e.g. loading a table from disk.
+constexpr auto k_load_time = 30ms;
+
+std::atomic<int> g_tables_created{0};
+std::atomic<int> g_warm_ups{0};
+std::atomic<bool> g_fail_loader{false};
+
+class ZoneTables: public CommonLib::ManagedSingleton<ZoneTables>
+{
+        friend class CommonLib::ManagedSingleton<ZoneTables>;
+
+    public:
+        int zones = 0;
+
+    private:
+        ZoneTables(): zones(600)
+        {
+            std::this_thread::sleep_for(k_load_time);
+        }
+
+        ~ZoneTables() = default;
+};
+
+class ConnectionPool: public CommonLib::ManagedSingleton<ConnectionPool>
+{
+        friend class CommonLib::ManagedSingleton<ConnectionPool>;
+
+    public:
+        int connections = 0;
+
+    private:
+        ConnectionPool(): connections(8)
+        {
+            std::this_thread::sleep_for(k_load_time);
+        }
+
+        ~ConnectionPool() = default;
+};
+
+class RequestRouter: public CommonLib::ManagedSingleton<RequestRouter, ZoneTables, ConnectionPool>
+{
+        friend class CommonLib::ManagedSingleton<RequestRouter, ZoneTables, ConnectionPool>;
+
+    public:
+        int capacity = 0;
+
+    private:
+        RequestRouter()
+            : capacity(ZoneTables::instance().zones + ConnectionPool::instance().connections)
+        {
+        }
+
+        ~RequestRouter() = default;
+};
+
+/// A singleton whose constructor makes sure its dependency exists, through the registry.
+class Dashboard: public CommonLib::ManagedSingleton<Dashboard, ConnectionPool>
+{
+        friend class CommonLib::ManagedSingleton<Dashboard, ConnectionPool>;
+
+    public:
+        int connections = 0;
+
+    private:
+        Dashboard()
+        {
+            static_cast<void>(CommonLib::SingletonRegistry::add(ConnectionPool::entry()));
+            ConnectionPool::initialize();
+            connections = ConnectionPool::instance().connections;
+        }
+
+        ~Dashboard() = default;
+};
+
+/// A lazily created singleton registered for warm-up, depending on a managed one.
+class RouteTable: public CommonLib::Singleton<RouteTable>
+{
+        friend class CommonLib::Singleton<RouteTable>;
+
+    public:
+        int routes = 0;
+
+    private:
+        RouteTable(): routes(ZoneTables::instance().zones)
+        {
+            ++g_tables_created;
+        }
+};
+
+const bool k_route_table_registered = RouteTable::register_warm_up<ZoneTables>();
+
+/// A singleton with an init routine that uses its own instance.
+class Preloaded: public CommonLib::ManagedSingleton<Preloaded>
+{
+        friend class CommonLib::ManagedSingleton<Preloaded>;
+
+    public:
+        bool ready = false;
+
+    private:
+        Preloaded() = default;
+        ~Preloaded() = default;
+
+        void warm_up()
+        {
+            ++g_warm_ups;
+            instance().ready = true;
+        }
+};
+
+class Loader: public CommonLib::ManagedSingleton<Loader>
+{
+        friend class CommonLib::ManagedSingleton<Loader>;
+
+    private:
+        Loader()
+        {
+            if (g_fail_loader)
+            {
+                throw std::runtime_error("unavailable");
+            }
+        }
+
+        ~Loader() = default;
+};
+
+auto find_timing(const std::vector<CommonLib::SingletonRegistry::InitTiming>& timings,
+                 const std::string& name) -> const CommonLib::SingletonRegistry::InitTiming*
+{
+    const auto it = std::find_if(timings.begin(), timings.end(), [&name](const auto& timing) {
+        return timing.name.find(name) != std::string::npos;
+    });
+    return it == timings.end() ? nullptr : &*it;
+}
+}  // namespace
+
+/**
+ * @brief Tests that warm-up on several threads constructs every singleton after its
+ *        dependencies; which worker takes which singleton is up to the scheduler.
+ */
+TEST_F(SingletonRegistryTest, WarmUpConstructsDependenciesFirst)
+{
+    using namespace CommonLib;
+    SingletonRegistry::shutdown();
+
+    const auto timings = SingletonRegistry::warm_up(4);
+    EXPECT_EQ(RequestRouter::instance().capacity, 608);
+    EXPECT_EQ(timings.size(), SingletonRegistry::construction_order().size());
+
+    const auto* tables = find_timing(timings, "ZoneTables");
+    const auto* pool = find_timing(timings, "ConnectionPool");
+    const auto* router = find_timing(timings, "RequestRouter");
+    ASSERT_NE(tables, nullptr);
+    ASSERT_NE(pool, nullptr);
+    ASSERT_NE(router, nullptr);
+    EXPECT_GE(tables->duration, k_load_time);
+    EXPECT_GE(pool->duration, k_load_time);
+    EXPECT_GE(router->start, tables->start + tables->duration);
+    EXPECT_GE(router->start, pool->start + pool->duration);
+
+    // The timings are in construction order.
+    const auto order = SingletonRegistry::construction_order();
+    for (std::size_t index = 0; index < timings.size(); ++index)
+    {
+        EXPECT_EQ(timings[index].name, order[index]);
+    }
+    SingletonRegistry::shutdown();
+}
+
+/**
+ * @brief Tests that registered Singleton types are created and init routines run once.
+ */
+TEST_F(SingletonRegistryTest, WarmUpCreatesSingletonsAndRunsInitRoutines)
+{
+    using namespace CommonLib;
+    SingletonRegistry::shutdown();
+    ASSERT_TRUE(k_route_table_registered);
+    const int warm_ups = g_warm_ups;
+
+    const auto timings = SingletonRegistry::warm_up(2);
+    EXPECT_NE(find_timing(timings, "RouteTable"), nullptr);
+    EXPECT_EQ(g_tables_created, 1);
+    EXPECT_EQ(RouteTable::get_instance().routes, 600);
+    EXPECT_EQ(g_warm_ups, warm_ups + 1);
+    EXPECT_TRUE(Preloaded::instance().ready);
+
+    // The Singleton instance outlives shutdown and is reused by the next warm-up.
+    SingletonRegistry::shutdown();
+    static_cast<void>(SingletonRegistry::warm_up(2));
+    EXPECT_EQ(g_tables_created, 1);
+    EXPECT_EQ(g_warm_ups, warm_ups + 2);
+    SingletonRegistry::shutdown();
+}
+
+/**
+ * @brief Tests that warm-up skips constructed singletons.
+ */
+TEST_F(SingletonRegistryTest, WarmUpSkipsConstructedSingletons)
+{
+    using namespace CommonLib;
+    SingletonRegistry::shutdown();
+
+    ZoneTables::initialize();
+    const auto timings = SingletonRegistry::warm_up(1);
+    EXPECT_EQ(find_timing(timings, "ZoneTables"), nullptr);
+    EXPECT_NE(find_timing(timings, "RequestRouter"), nullptr);
+    for (const auto& timing: timings)
+    {
+        EXPECT_EQ(timing.worker, 0U);
+    }
+    EXPECT_TRUE(SingletonRegistry::warm_up().empty());
+    SingletonRegistry::shutdown();
+}
+
+/**
+ * @brief Tests that a failing constructor destroys everything the warm-up constructed.
+ */
+TEST_F(SingletonRegistryTest, WarmUpRollsBackOnFailure)
+{
+    using namespace CommonLib;
+    SingletonRegistry::shutdown();
+
+    g_fail_loader = true;
+    EXPECT_THROW(static_cast<void>(SingletonRegistry::warm_up(4)), std::runtime_error);
+    g_fail_loader = false;
+    EXPECT_TRUE(SingletonRegistry::construction_order().empty());
+    EXPECT_EQ(ZoneTables::try_instance(), nullptr);
+    EXPECT_EQ(Loader::try_instance(), nullptr);
+}
+
+/**
+ * @brief Tests that constructors can call into the registry without deadlocking.
+ */
+TEST_F(SingletonRegistryTest, ConstructorsMayUseTheRegistry)
+{
+    using namespace CommonLib;
+    SingletonRegistry::shutdown();
+
+    Dashboard::initialize();
+    EXPECT_EQ(Dashboard::instance().connections, 8);
+    SingletonRegistry::shutdown();
+
+    static_cast<void>(SingletonRegistry::warm_up(2));
+    ASSERT_NE(Dashboard::try_instance(), nullptr);
+    EXPECT_EQ(Dashboard::instance().connections, 8);
+    SingletonRegistry::shutdown();
+}
@@ -14,7 +14,7 @@ class TestSingleton: public CommonLib::Singleton<TestSingleton>
 
     private:
         TestSingleton() = default;
-        ~TestSingleton() override = default;
+        ~TestSingleton() = default;
 
     public:
         int value = 0;
@@ -65,3 +65,22 @@ TEST_F(SingletonTest, IsNotCopyOrMoveable)
     EXPECT_FALSE(std::is_move_constructible_v<TestSingleton>);
     EXPECT_FALSE(std::is_move_assignable_v<TestSingleton>);
 }
+
+/**
+ * @brief Tests that Singleton and its two policy bases add nothing to the derived class.
+ *
+ * This test verifies that the derived class is exactly as large as its members and stays
+ * standard-layout, i.e. neither base adds a vptr or padding.
+ */
+TEST_F(SingletonTest, AddsNoSizeOrLayoutOverhead)
+{
+#if !defined(COMMONLIB_VIRTUAL_POLICY_BASES)
+    static_assert(std::is_empty_v<CommonLib::Singleton<TestSingleton>>);
+    static_assert(!std::is_polymorphic_v<TestSingleton>);
+    static_assert(sizeof(TestSingleton) == sizeof(int));
+    static_assert(std::is_standard_layout_v<TestSingleton>);
+    EXPECT_EQ(sizeof(TestSingleton), sizeof(int));
+#else
+    GTEST_SKIP() << "The policy bases are virtual with COMMONLIB_VIRTUAL_POLICY_BASES";
+#endif
+}
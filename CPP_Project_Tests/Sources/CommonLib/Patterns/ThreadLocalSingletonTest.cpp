@@ -0,0 +1,106 @@
+#include "CommonLib/Patterns/ThreadLocalSingletonTest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+class RequestCounter: public CommonLib::ThreadLocalSingleton<RequestCounter>
+{
+        friend class CommonLib::ThreadLocalSingleton<RequestCounter>;
+
+    public:
+        void add(std::uint64_t count) noexcept
+        {
+            m_count.store(m_count.load(std::memory_order_relaxed) + count,
+                          std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto count() const noexcept -> std::uint64_t
+        {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+    private:
+        RequestCounter() = default;
+        ~RequestCounter() = default;
+
+        std::atomic<std::uint64_t> m_count{0};
+};
+
+auto total() -> std::uint64_t
+{
+    return RequestCounter::aggregate(std::uint64_t{0},
+                                     [](std::uint64_t sum, const RequestCounter& counter) {
+                                         return sum + counter.count();
+                                     });
+}
+}  // namespace
+
+/**
+ * @brief Tests that every thread gets its own instance.
+ */
+TEST_F(ThreadLocalSingletonTest, ReturnsOneInstancePerThread)
+{
+    using namespace CommonLib;
+    RequestCounter& main_instance = RequestCounter::get_instance();
+    EXPECT_EQ(&main_instance, &RequestCounter::get_instance());
+
+    RequestCounter* other = nullptr;
+    std::thread([&other] {
+        other = &RequestCounter::get_instance();
+        EXPECT_EQ(other, &RequestCounter::get_instance());
+    }).join();
+    EXPECT_NE(other, &main_instance);
+}
+
+/**
+ * @brief Tests that aggregate() sums the instances of running and exited threads.
+ */
+TEST_F(ThreadLocalSingletonTest, AggregatesAllThreads)
+{
+    using namespace CommonLib;
+    const std::uint64_t before = total();
+    RequestCounter::get_instance().add(5);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([] {
+            for (int i = 0; i < 1000; ++i)
+            {
+                RequestCounter::get_instance().add(1);
+            }
+        });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(total() - before, 4005U);
+
+    std::size_t visited = 0;
+    RequestCounter::visit([&visited](RequestCounter&) { ++visited; });
+    EXPECT_EQ(visited, RequestCounter::instance_count());
+}
+
+/**
+ * @brief Tests that instances of exited threads are reused instead of piling up.
+ */
+TEST_F(ThreadLocalSingletonTest, RecyclesInstancesOfExitedThreads)
+{
+    using namespace CommonLib;
+    static_cast<void>(RequestCounter::get_instance());
+    std::thread([] { static_cast<void>(RequestCounter::get_instance()); }).join();
+    const std::size_t count = RequestCounter::instance_count();
+    for (int i = 0; i < 10; ++i)
+    {
+        std::thread([] { RequestCounter::get_instance().add(1); }).join();
+    }
+    EXPECT_EQ(RequestCounter::instance_count(), count);
+    EXPECT_FALSE(std::is_copy_constructible_v<RequestCounter>);
+    EXPECT_FALSE(std::is_move_constructible_v<RequestCounter>);
+}
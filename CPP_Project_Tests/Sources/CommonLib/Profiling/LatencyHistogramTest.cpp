@@ -0,0 +1,198 @@
+#include "CommonLib/Profiling/LatencyHistogramTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+/**
+ * @brief Draws log-normally distributed latencies between roughly 1 us and 100 ms.
+ */
+auto make_samples(std::size_t count, unsigned seed) -> std::vector<std::uint64_t>
+{
+    std::mt19937_64 engine(seed);
+    std::lognormal_distribution<double> distribution(std::log(50'000.0), 1.5);
+    std::vector<std::uint64_t> samples(count);
+    for (auto& sample: samples)
+    {
+        sample = static_cast<std::uint64_t>(distribution(engine));
+    }
+    return samples;
+}
+
+auto exact_percentile(const std::vector<std::uint64_t>& sorted, double percentile)
+    -> std::uint64_t
+{
+    const auto rank = static_cast<std::size_t>(
+        std::ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[std::max<std::size_t>(rank, 1) - 1];
+}
+}  // namespace
+
+/**
+ * @brief Tests that the buckets tile the value range and respect the requested precision.
+ */
+TEST_F(LatencyHistogramTest, LayoutBucketsAreContiguous)
+{
+    using namespace CommonLib;
+    for (int digits = 1; digits <= 4; ++digits)
+    {
+        const HistogramLayout layout(1'000'000'000, digits);
+        const double precision = std::pow(10.0, -digits);
+        EXPECT_EQ(layout.index_of(0), 0U);
+        EXPECT_EQ(layout.index_of(1'000'000'000), layout.bucket_count() - 1);
+        EXPECT_EQ(layout.index_of(UINT64_MAX), layout.bucket_count() - 1);
+        for (std::size_t i = 0; i + 1 < layout.bucket_count(); ++i)
+        {
+            const std::uint64_t low = layout.lowest_equivalent(i);
+            const std::uint64_t high = layout.highest_equivalent(i);
+            ASSERT_EQ(layout.index_of(low), i);
+            ASSERT_EQ(layout.index_of(high), i);
+            ASSERT_EQ(layout.lowest_equivalent(i + 1), high + 1);
+            ASSERT_LE(static_cast<double>(high - low), precision * static_cast<double>(low));
+        }
+    }
+}
+
+/**
+ * @brief Tests that percentiles match an exact sort within the configured precision.
+ */
+TEST_F(LatencyHistogramTest, PercentilesMatchExactSort)
+{
+    using namespace CommonLib;
+    std::vector<std::uint64_t> samples = make_samples(1'000'000, 42);
+    LatencyHistogram histogram;
+    for (const std::uint64_t sample: samples)
+    {
+        histogram.record(sample);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    EXPECT_EQ(histogram.count(), samples.size());
+    EXPECT_EQ(histogram.min(), samples.front());
+    EXPECT_EQ(histogram.max(), samples.back());
+    for (const double p: {0.0, 1.0, 10.0, 50.0, 90.0, 99.0, 99.9, 99.99, 100.0})
+    {
+        const std::uint64_t exact = exact_percentile(samples, p);
+        const std::uint64_t approximate = histogram.percentile(p);
+        EXPECT_GE(approximate, exact) << "p" << p;
+        EXPECT_LE(static_cast<double>(approximate - exact), 1e-3 * static_cast<double>(exact))
+            << "p" << p;
+    }
+
+    double sum = 0.0;
+    for (const std::uint64_t sample: samples)
+    {
+        sum += static_cast<double>(sample);
+    }
+    EXPECT_NEAR(histogram.mean(), sum / static_cast<double>(samples.size()), 1.0);
+}
+
+/**
+ * @brief Tests that merging per-thread histograms equals recording into one.
+ */
+TEST_F(LatencyHistogramTest, MergeEqualsCombinedRecording)
+{
+    using namespace CommonLib;
+    const std::vector<std::uint64_t> first = make_samples(10'000, 1);
+    const std::vector<std::uint64_t> second = make_samples(10'000, 2);
+    LatencyHistogram a;
+    LatencyHistogram b;
+    LatencyHistogram combined;
+    for (const std::uint64_t sample: first)
+    {
+        a.record(sample);
+        combined.record(sample);
+    }
+    for (const std::uint64_t sample: second)
+    {
+        b.record(sample);
+        combined.record(sample);
+    }
+
+    a.merge(b);
+    EXPECT_EQ(a.count(), combined.count());
+    EXPECT_EQ(a.min(), combined.min());
+    EXPECT_EQ(a.max(), combined.max());
+    EXPECT_DOUBLE_EQ(a.mean(), combined.mean());
+    for (const double p: {50.0, 99.0, 99.9})
+    {
+        EXPECT_EQ(a.percentile(p), combined.percentile(p));
+    }
+
+    LatencyHistogram other_layout(1'000'000, 2);
+    EXPECT_THROW(a.merge(other_layout), std::invalid_argument);
+}
+
+/**
+ * @brief Tests the recording of steady_clock durations, saturation and reset().
+ */
+TEST_F(LatencyHistogramTest, RecordsDurationsAndSaturates)
+{
+    using namespace CommonLib;
+    LatencyHistogram histogram(1'000'000, 3);
+    EXPECT_EQ(histogram.percentile(50.0), 0U);
+    EXPECT_EQ(histogram.min(), 0U);
+
+    const auto start = DateTimeUtils::timer_now();
+    histogram.record(start, start + std::chrono::microseconds(250));
+    histogram.record(std::chrono::nanoseconds(-5));
+    histogram.record(std::chrono::seconds(10));
+    histogram.record(7, 3);
+
+    EXPECT_EQ(histogram.count(), 6U);
+    EXPECT_EQ(histogram.min(), 0U);
+    EXPECT_EQ(histogram.max(), 1'000'000U);
+    EXPECT_EQ(histogram.percentile(50.0), 7U);
+    EXPECT_EQ(histogram.percentile(100.0), 1'000'000U);
+    EXPECT_THROW(static_cast<void>(histogram.percentile(100.5)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(histogram.percentile(-1.0)), std::invalid_argument);
+    EXPECT_THROW(LatencyHistogram(1, 3), std::invalid_argument);
+    EXPECT_THROW(LatencyHistogram(1000, 6), std::invalid_argument);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0U);
+    EXPECT_EQ(histogram.max(), 0U);
+}
+
+/**
+ * @brief Tests that concurrent recording loses no measurement.
+ */
+TEST_F(LatencyHistogramTest, ConcurrentRecordingIsComplete)
+{
+    using namespace CommonLib;
+    constexpr int k_threads = 4;
+    constexpr std::uint64_t k_records = 50'000;
+    ConcurrentLatencyHistogram histogram;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < k_threads; ++t)
+    {
+        threads.emplace_back([&histogram] {
+            for (std::uint64_t i = 1; i <= k_records; ++i)
+            {
+                histogram.record(i);
+            }
+        });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    const LatencyHistogram snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count(), k_threads * k_records);
+    EXPECT_EQ(snapshot.min(), 1U);
+    EXPECT_EQ(snapshot.max(), k_records);
+    EXPECT_DOUBLE_EQ(snapshot.mean(), (k_records + 1) / 2.0);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(50.0)), k_records / 2.0, k_records * 1e-3);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.snapshot().count(), 0U);
+}
@@ -0,0 +1,79 @@
+#include "CommonLib/Profiling/ScopedTimerTest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+auto find_site(std::string_view name) -> CommonLib::TimerStats
+{
+    const auto stats = CommonLib::TimerRegistry::snapshot();
+    const auto it = std::find_if(stats.begin(), stats.end(),
+                                 [name](const CommonLib::TimerStats& s) { return s.name == name; });
+    return it == stats.end() ? CommonLib::TimerStats{} : *it;
+}
+}  // namespace
+
+/**
+ * @brief Tests that the macro registers its call site once and records every scope.
+ */
+TEST_F(ScopedTimerTest, MacroRecordsEveryScope)
+{
+    using namespace CommonLib;
+    for (int i = 0; i < 10; ++i)
+    {
+        COMMONLIB_SCOPED_TIMER("ScopedTimerTest.MacroRecordsEveryScope");
+    }
+
+    const TimerStats stats = find_site("ScopedTimerTest.MacroRecordsEveryScope");
+    EXPECT_EQ(stats.count, 10U);
+    EXPECT_EQ(stats.line, __LINE__ - 5);
+    EXPECT_NE(stats.file.find("ScopedTimerTest.cpp"), std::string::npos);
+    EXPECT_LE(stats.min_ns, stats.mean_ns());
+    EXPECT_LE(stats.mean_ns(), stats.max_ns);
+}
+
+/**
+ * @brief Tests that the recorded durations cover the time spent in the scope.
+ */
+TEST_F(ScopedTimerTest, MeasuresScopeDuration)
+{
+    using namespace CommonLib;
+    static const TimerSite site("ScopedTimerTest.MeasuresScopeDuration", __FILE__, __LINE__);
+    {
+        const ScopedTimer timer(site);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    {
+        const ScopedTimer timer(site);
+    }
+
+    const TimerStats stats = TimerRegistry::snapshot(site.id());
+    EXPECT_EQ(stats.name, "ScopedTimerTest.MeasuresScopeDuration");
+    EXPECT_EQ(stats.count, 2U);
+    EXPECT_GE(stats.max_ns, 5e6 * 0.9);
+    EXPECT_LT(stats.min_ns, 5e6);
+    EXPECT_DOUBLE_EQ(stats.total_ns, stats.min_ns + stats.max_ns);
+}
+
+/**
+ * @brief Tests that two macros on different lines of one scope are separate sites.
+ */
+TEST_F(ScopedTimerTest, NestedTimersAreSeparateSites)
+{
+    using namespace CommonLib;
+    {
+        COMMONLIB_SCOPED_TIMER("ScopedTimerTest.Outer");
+        for (int i = 0; i < 3; ++i)
+        {
+            COMMONLIB_SCOPED_TIMER("ScopedTimerTest.Inner");
+        }
+    }
+
+    const TimerStats outer = find_site("ScopedTimerTest.Outer");
+    const TimerStats inner = find_site("ScopedTimerTest.Inner");
+    EXPECT_EQ(outer.count, 1U);
+    EXPECT_EQ(inner.count, 3U);
+    EXPECT_GE(outer.max_ns, inner.min_ns);
+}
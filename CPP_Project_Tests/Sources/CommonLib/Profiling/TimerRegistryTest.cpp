@@ -0,0 +1,116 @@
+#include "CommonLib/Profiling/TimerRegistryTest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "CommonLib/Utils/TscClock.h"
+
+/**
+ * @brief Tests that a site without measurements reports zeros.
+ */
+TEST_F(TimerRegistryTest, NewSiteIsEmpty)
+{
+    using namespace CommonLib;
+    const std::uint32_t site = TimerRegistry::register_site("TimerRegistryTest.Empty", "f.cpp", 7);
+
+    const TimerStats stats = TimerRegistry::snapshot(site);
+    EXPECT_EQ(stats.name, "TimerRegistryTest.Empty");
+    EXPECT_EQ(stats.file, "f.cpp");
+    EXPECT_EQ(stats.line, 7);
+    EXPECT_EQ(stats.count, 0U);
+    EXPECT_EQ(stats.total_ns, 0.0);
+    EXPECT_EQ(stats.min_ns, 0.0);
+    EXPECT_EQ(stats.max_ns, 0.0);
+    EXPECT_EQ(stats.mean_ns(), 0.0);
+
+    const auto all = TimerRegistry::snapshot();
+    ASSERT_GT(all.size(), site);
+    EXPECT_EQ(all[site].name, "TimerRegistryTest.Empty");
+}
+
+/**
+ * @brief Tests that count, sum, min and max are accumulated from raw tick values.
+ */
+TEST_F(TimerRegistryTest, AccumulatesTicks)
+{
+    using namespace CommonLib;
+    const std::uint32_t site = TimerRegistry::register_site("TimerRegistryTest.Ticks", "", 0);
+    for (const std::uint64_t ticks: {300U, 100U, 200U})
+    {
+        TimerRegistry::record(site, ticks);
+    }
+
+    const TimerStats stats = TimerRegistry::snapshot(site);
+    EXPECT_EQ(stats.count, 3U);
+    EXPECT_DOUBLE_EQ(stats.total_ns, TscClock::elapsed_ns(0, 600));
+    EXPECT_DOUBLE_EQ(stats.min_ns, TscClock::elapsed_ns(0, 100));
+    EXPECT_DOUBLE_EQ(stats.max_ns, TscClock::elapsed_ns(0, 300));
+    EXPECT_DOUBLE_EQ(stats.mean_ns(), TscClock::elapsed_ns(0, 200));
+}
+
+/**
+ * @brief Tests that measurements of running and exited threads are merged.
+ */
+TEST_F(TimerRegistryTest, MergesAllThreads)
+{
+    using namespace CommonLib;
+    const std::uint32_t site = TimerRegistry::register_site("TimerRegistryTest.Threads", "", 0);
+    constexpr int k_threads = 4;
+    constexpr int k_records = 10000;
+
+    // These threads exit before the snapshot, so their accumulators have been retired.
+    std::vector<std::thread> exited;
+    for (int t = 0; t < k_threads; ++t)
+    {
+        exited.emplace_back([site, t] {
+            for (int i = 0; i < k_records; ++i)
+            {
+                TimerRegistry::record(site, static_cast<std::uint64_t>(t + 1));
+            }
+        });
+    }
+    for (auto& thread: exited)
+    {
+        thread.join();
+    }
+
+    // This thread is still alive while the snapshot is taken.
+    std::atomic<bool> recorded{false};
+    std::atomic<bool> done{false};
+    std::thread running([&] {
+        TimerRegistry::record(site, 1000);
+        recorded.store(true);
+        while (!done.load())
+        {
+            std::this_thread::yield();
+        }
+    });
+    while (!recorded.load())
+    {
+        std::this_thread::yield();
+    }
+
+    const TimerStats stats = TimerRegistry::snapshot(site);
+    const auto all = TimerRegistry::snapshot();
+    done.store(true);
+    running.join();
+
+    EXPECT_EQ(stats.count, static_cast<std::uint64_t>(k_threads * k_records + 1));
+    EXPECT_DOUBLE_EQ(stats.total_ns, TscClock::elapsed_ns(0, 10 * k_records + 1000));
+    EXPECT_DOUBLE_EQ(stats.min_ns, TscClock::elapsed_ns(0, 1));
+    EXPECT_DOUBLE_EQ(stats.max_ns, TscClock::elapsed_ns(0, 1000));
+    EXPECT_EQ(all[site].count, stats.count);
+    EXPECT_EQ(TimerRegistry::snapshot(site).count, stats.count);
+}
+
+/**
+ * @brief Tests that an unregistered site id is rejected by snapshot().
+ */
+TEST_F(TimerRegistryTest, UnknownSiteThrows)
+{
+    using namespace CommonLib;
+    EXPECT_THROW(static_cast<void>(TimerRegistry::snapshot(TimerRegistry::k_max_sites)),
+                 std::out_of_range);
+}
@@ -0,0 +1,238 @@
+#include "CommonLib/Profiling/TracerTest.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+auto events_named(const std::vector<CommonLib::TraceEvent>& events, std::string_view name)
+    -> std::vector<CommonLib::TraceEvent>
+{
+    std::vector<CommonLib::TraceEvent> result;
+    std::copy_if(events.begin(), events.end(), std::back_inserter(result),
+                 [name](const CommonLib::TraceEvent& e) { return e.name == name; });
+    return result;
+}
+
+/**
+ * @brief Records count instant events on a new thread, which picks up the current configuration.
+ */
+void record_on_new_thread(const char* const* names, int count)
+{
+    std::thread([names, count] {
+        for (int i = 0; i < count; ++i)
+        {
+            CommonLib::Tracer::instant(names[i]);
+        }
+    }).join();
+}
+
+constexpr const char* k_numbered[] = {"0",  "1",  "2",  "3",  "4",  "5",  "6",
+                                      "7",  "8",  "9",  "10", "11", "12", "13",
+                                      "14", "15", "16", "17", "18", "19"};
+}  // namespace
+
+/**
+ * @brief Tests that scopes and instants are recorded in order with non-decreasing timestamps.
+ */
+TEST_F(TracerTest, RecordsEventsInOrder)
+{
+    using namespace CommonLib;
+    {
+        COMMONLIB_TRACE_SCOPE("TracerTest.Outer");
+        Tracer::instant("TracerTest.Instant");
+        {
+            COMMONLIB_TRACE_SCOPE("TracerTest.Inner");
+        }
+    }
+
+    const std::vector<TraceEvent> events = Tracer::drain();
+    ASSERT_EQ(events.size(), 5U);
+    const std::pair<std::string_view, TracePhase> expected[] = {
+        {"TracerTest.Outer", TracePhase::Begin}, {"TracerTest.Instant", TracePhase::Instant},
+        {"TracerTest.Inner", TracePhase::Begin}, {"TracerTest.Inner", TracePhase::End},
+        {"TracerTest.Outer", TracePhase::End}};
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+        EXPECT_EQ(events[i].name, expected[i].first);
+        EXPECT_EQ(events[i].phase, expected[i].second);
+        EXPECT_EQ(events[i].thread_id, events[0].thread_id);
+        if (i > 0)
+        {
+            EXPECT_GE(events[i].ticks, events[i - 1].ticks);
+        }
+    }
+    EXPECT_TRUE(Tracer::drain().empty());
+}
+
+/**
+ * @brief Tests that running and exited threads are drained under distinct thread ids.
+ */
+TEST_F(TracerTest, DrainsAllThreads)
+{
+    using namespace CommonLib;
+    Tracer::instant("TracerTest.Main");
+    std::thread([] { Tracer::instant("TracerTest.Exited"); }).join();
+    std::thread([] { Tracer::instant("TracerTest.Exited"); }).join();
+
+    const std::vector<TraceEvent> events = Tracer::drain();
+    const auto main_events = events_named(events, "TracerTest.Main");
+    const auto exited_events = events_named(events, "TracerTest.Exited");
+    ASSERT_EQ(main_events.size(), 1U);
+    ASSERT_EQ(exited_events.size(), 2U);
+    EXPECT_NE(exited_events[0].thread_id, exited_events[1].thread_id);
+    EXPECT_NE(exited_events[0].thread_id, main_events[0].thread_id);
+}
+
+/**
+ * @brief Tests that a thread takes over the buffer of an exited one, keeping its unread events
+ *        under the old thread id until they are overwritten.
+ */
+TEST_F(TracerTest, ReusesBuffersOfExitedThreads)
+{
+    using namespace CommonLib;
+    const std::uint64_t lost_before = Tracer::lost_events();
+
+    Tracer::configure(8, TraceOverflow::Overwrite);
+    record_on_new_thread(k_numbered, 6);
+    record_on_new_thread(k_numbered + 10, 2);
+    std::vector<TraceEvent> events = Tracer::drain();
+    ASSERT_EQ(events.size(), 8U);
+    EXPECT_STREQ(events[5].name, "5");
+    EXPECT_STREQ(events[6].name, "10");
+    EXPECT_NE(events[5].thread_id, events[6].thread_id);
+    EXPECT_EQ(events[6].thread_id, events[7].thread_id);
+
+    // Without a drain in between, the second thread overwrites the oldest events of the first,
+    // as if one thread had recorded them all.
+    record_on_new_thread(k_numbered, 6);
+    record_on_new_thread(k_numbered + 10, 6);
+    events = Tracer::drain();
+    ASSERT_EQ(events.size(), 8U);
+    EXPECT_STREQ(events.front().name, "4");
+    EXPECT_STREQ(events.back().name, "15");
+    EXPECT_EQ(Tracer::lost_events() - lost_before, 4U);
+}
+
+/**
+ * @brief Tests that the overwrite policy keeps the newest and the drop policy the oldest events.
+ */
+TEST_F(TracerTest, OverflowPolicies)
+{
+    using namespace CommonLib;
+    const std::uint64_t lost_before = Tracer::lost_events();
+
+    Tracer::configure(6, TraceOverflow::Overwrite);  // Rounded up to 8
+    record_on_new_thread(k_numbered, 20);
+    std::vector<TraceEvent> events = Tracer::drain();
+    ASSERT_EQ(events.size(), 8U);
+    EXPECT_STREQ(events.front().name, "12");
+    EXPECT_STREQ(events.back().name, "19");
+    EXPECT_EQ(Tracer::lost_events() - lost_before, 12U);
+
+    Tracer::configure(8, TraceOverflow::Drop);
+    record_on_new_thread(k_numbered, 20);
+    events = Tracer::drain();
+    ASSERT_EQ(events.size(), 8U);
+    EXPECT_STREQ(events.front().name, "0");
+    EXPECT_STREQ(events.back().name, "7");
+    EXPECT_EQ(Tracer::lost_events() - lost_before, 24U);
+
+    EXPECT_THROW(Tracer::configure(0, TraceOverflow::Drop), std::invalid_argument);
+}
+
+/**
+ * @brief Tests that nothing is recorded while tracing is disabled.
+ */
+TEST_F(TracerTest, DisabledRecordsNothing)
+{
+    using namespace CommonLib;
+    Tracer::set_enabled(false);
+    EXPECT_FALSE(Tracer::enabled());
+    Tracer::instant("TracerTest.Disabled");
+    Tracer::set_enabled(true);
+    Tracer::instant("TracerTest.Enabled");
+
+    const std::vector<TraceEvent> events = Tracer::drain();
+    EXPECT_TRUE(events_named(events, "TracerTest.Disabled").empty());
+    EXPECT_EQ(events_named(events, "TracerTest.Enabled").size(), 1U);
+}
+
+/**
+ * @brief Tests the Chrome Trace Event JSON output, including string escaping.
+ */
+TEST_F(TracerTest, WritesChromeJson)
+{
+    using namespace CommonLib;
+    const std::vector<TraceEvent> events = {
+        {1000, "request", TracePhase::Begin, 1},
+        {1000 + static_cast<TscClock::Ticks>(TscClock::ticks_per_second() / 1e6 * 2.5),
+         "say \"hi\"\n", TracePhase::Instant, 2},
+        {1000, "request", TracePhase::End, 1},
+    };
+
+    std::ostringstream out;
+    Tracer::write_chrome_json(out, events);
+    const std::string json = out.str();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0U);
+    EXPECT_NE(json.find("{\"name\":\"request\",\"ph\":\"B\",\"ts\":0.000,\"pid\":1,\"tid\":1}"),
+              std::string::npos);
+    EXPECT_NE(json.find("{\"name\":\"say \\\"hi\\\"\\u000a\",\"ph\":\"i\",\"ts\":2.5"),
+              std::string::npos);
+    EXPECT_NE(json.find("\"tid\":2,\"s\":\"t\"}"), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 4), "\n]}\n");
+
+    std::ostringstream empty;
+    Tracer::write_chrome_json(empty, {});
+    EXPECT_EQ(empty.str(), "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n");
+
+    const std::string path = ::testing::TempDir() + "TracerTest.json";
+    Tracer::write_chrome_json(path, events);
+    std::ifstream file(path);
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(file), {}), json);
+    std::remove(path.c_str());
+    EXPECT_THROW(Tracer::write_chrome_json("/nonexistent/dir/trace.json", events),
+                 std::runtime_error);
+}
+
+/**
+ * @brief Tests that draining while another thread records yields complete, ordered events.
+ */
+TEST_F(TracerTest, DrainWhileRecording)
+{
+    using namespace CommonLib;
+    Tracer::configure(64, TraceOverflow::Overwrite);
+    std::atomic<bool> done{false};
+    std::thread producer([&done] {
+        while (!done.load())
+        {
+            Tracer::instant("TracerTest.Concurrent");
+        }
+    });
+
+    std::vector<TraceEvent> events;
+    for (int i = 0; i < 200; ++i)
+    {
+        const std::vector<TraceEvent> batch = Tracer::drain();
+        events.insert(events.end(), batch.begin(), batch.end());
+    }
+    done.store(true);
+    producer.join();
+    const std::vector<TraceEvent> rest = Tracer::drain();
+    events.insert(events.end(), rest.begin(), rest.end());
+
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+        ASSERT_STREQ(events[i].name, "TracerTest.Concurrent");
+        ASSERT_EQ(events[i].phase, TracePhase::Instant);
+        if (i > 0)
+        {
+            ASSERT_GE(events[i].ticks, events[i - 1].ticks);
+        }
+    }
+}
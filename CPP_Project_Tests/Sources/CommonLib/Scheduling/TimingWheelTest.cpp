@@ -0,0 +1,217 @@
+#include "CommonLib/Scheduling/TimingWheelTest.h"
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using Clock = CommonLib::TimingWheel::Clock;
+using std::chrono::milliseconds;
+
+const Clock::time_point k_start = Clock::time_point(std::chrono::hours(1));
+
+struct Connection: CommonLib::TimerNode {
+        int id = 0;
+        int fired = 0;
+        Clock::time_point fired_at;
+};
+}  // namespace
+
+/**
+ * @brief Tests that timers fire once their deadline has passed, and never early.
+ */
+TEST_F(TimingWheelTest, FiresAtDeadline)
+{
+    using namespace CommonLib;
+    TimingWheel wheel(milliseconds(1), k_start);
+    Connection a;
+    Connection b;
+    wheel.schedule(a, k_start + milliseconds(10));
+    wheel.schedule(b, k_start + std::chrono::microseconds(10500));  // Rounded up to 11 ms
+    EXPECT_EQ(wheel.size(), 2U);
+    EXPECT_TRUE(a.scheduled());
+
+    const auto count = [](TimerNode& node) { ++static_cast<Connection&>(node).fired; };
+    EXPECT_EQ(wheel.advance(k_start + std::chrono::microseconds(9999), count), 0U);
+    EXPECT_EQ(wheel.advance(k_start + milliseconds(10), count), 1U);
+    EXPECT_EQ(a.fired, 1);
+    EXPECT_FALSE(a.scheduled());
+    EXPECT_EQ(b.fired, 0);
+    EXPECT_EQ(wheel.advance(k_start + milliseconds(11), count), 1U);
+    EXPECT_EQ(b.fired, 1);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.now(), k_start + milliseconds(11));
+
+    // Going back in time is ignored.
+    EXPECT_EQ(wheel.advance(k_start, count), 0U);
+    EXPECT_EQ(wheel.now(), k_start + milliseconds(11));
+}
+
+/**
+ * @brief Tests cancel, reschedule and the cancellation by the node destructor.
+ */
+TEST_F(TimingWheelTest, CancelAndReschedule)
+{
+    using namespace CommonLib;
+    TimingWheel wheel(milliseconds(1), k_start);
+    Connection a;
+    Connection b;
+    wheel.schedule(a, k_start + milliseconds(5));
+    wheel.schedule(b, k_start + milliseconds(5));
+    {
+        Connection c;
+        wheel.schedule(c, k_start + milliseconds(5));
+        EXPECT_EQ(wheel.size(), 3U);
+    }
+    EXPECT_EQ(wheel.size(), 2U);
+
+    EXPECT_TRUE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.cancel(a));
+    wheel.schedule(b, k_start + milliseconds(300));  // Reschedule to a coarser level
+    EXPECT_EQ(wheel.size(), 1U);
+
+    std::vector<Connection*> fired;
+    const auto collect = [&fired](TimerNode& node) {
+        fired.push_back(&static_cast<Connection&>(node));
+    };
+    EXPECT_EQ(wheel.advance(k_start + milliseconds(299), collect), 0U);
+    EXPECT_EQ(wheel.advance(k_start + milliseconds(300), collect), 1U);
+    ASSERT_EQ(fired.size(), 1U);
+    EXPECT_EQ(fired[0], &b);
+
+    TimingWheel other(milliseconds(1), k_start);
+    wheel.schedule(a, k_start + milliseconds(400));
+    other.schedule(a, k_start + milliseconds(400));
+    EXPECT_EQ(wheel.size(), 0U);
+    EXPECT_EQ(other.size(), 1U);
+    EXPECT_FALSE(wheel.cancel(a));
+    EXPECT_TRUE(other.cancel(a));
+}
+
+/**
+ * @brief Tests that deadlines in the past fire on the next advance, also from a callback.
+ */
+TEST_F(TimingWheelTest, PastDeadlinesFireOnNextAdvance)
+{
+    using namespace CommonLib;
+    TimingWheel wheel(milliseconds(1), k_start);
+    Connection periodic;
+    wheel.schedule(periodic, k_start - milliseconds(5));
+
+    // A callback that reschedules its timer immediately must not loop.
+    const auto reschedule = [&wheel](TimerNode& node) {
+        ++static_cast<Connection&>(node).fired;
+        wheel.schedule(node, wheel.now());
+    };
+    EXPECT_EQ(wheel.advance(k_start, reschedule), 1U);
+    EXPECT_EQ(wheel.advance(k_start, reschedule), 1U);
+    EXPECT_EQ(periodic.fired, 2);
+    EXPECT_TRUE(periodic.scheduled());
+
+    // A callback that schedules another timer within the advanced range fires it as well.
+    Connection follow_up;
+    wheel.cancel(periodic);
+    wheel.schedule_after(periodic, milliseconds(1));
+    const auto chain = [&](TimerNode& node) {
+        ++static_cast<Connection&>(node).fired;
+        if (&node == &periodic)
+        {
+            wheel.schedule_after(follow_up, milliseconds(3));
+        }
+    };
+    EXPECT_EQ(wheel.advance(k_start + milliseconds(10), chain), 2U);
+    EXPECT_EQ(follow_up.fired, 1);
+}
+
+/**
+ * @brief Tests many timers across all levels and the overflow list against a reference.
+ */
+TEST_F(TimingWheelTest, MatchesReferenceAcrossLevels)
+{
+    using namespace CommonLib;
+    constexpr int k_timers = 20000;
+    TimingWheel wheel(milliseconds(1), k_start);
+    std::mt19937_64 engine(7);
+
+    // Delays spread over all magnitudes, from 0 ticks to beyond 2^32 ticks.
+    std::vector<std::unique_ptr<Connection>> timers;
+    std::vector<std::int64_t> deadlines;
+    for (int i = 0; i < k_timers; ++i)
+    {
+        auto timer = std::make_unique<Connection>();
+        timer->id = i;
+        const int magnitude = static_cast<int>(engine() % 35);
+        const auto delay = static_cast<std::int64_t>(engine() % (std::uint64_t{1} << magnitude));
+        deadlines.push_back(delay);
+        wheel.schedule(*timer, k_start + milliseconds(delay));
+        timers.push_back(std::move(timer));
+    }
+
+    std::int64_t now_ms = 0;
+    std::size_t fired_total = 0;
+    const auto check = [&](TimerNode& node) {
+        auto& timer = static_cast<Connection&>(node);
+        ++timer.fired;
+        timer.fired_at = k_start + milliseconds(now_ms);
+    };
+    while (fired_total < k_timers)
+    {
+        // Irregular steps: small ones and jumps of up to 2^33 ticks.
+        const int magnitude = static_cast<int>(engine() % 34);
+        now_ms += 1 + static_cast<std::int64_t>(engine() % (std::uint64_t{1} << magnitude));
+        fired_total += wheel.advance(k_start + milliseconds(now_ms), check);
+
+        for (int i = 0; i < k_timers; ++i)
+        {
+            const Connection& timer = *timers[i];
+            if (deadlines[i] <= now_ms)
+            {
+                ASSERT_EQ(timer.fired, 1) << "timer " << i << " deadline " << deadlines[i];
+                ASSERT_GE(timer.fired_at, k_start + milliseconds(deadlines[i]));
+            }
+            else
+            {
+                ASSERT_EQ(timer.fired, 0) << "timer " << i << " deadline " << deadlines[i];
+            }
+        }
+    }
+    EXPECT_TRUE(wheel.empty());
+}
+
+/**
+ * @brief Tests that timers around the slot boundaries of every level fire in their exact tick.
+ */
+TEST_F(TimingWheelTest, FiresInExactTick)
+{
+    using namespace CommonLib;
+    const std::int64_t delays[] = {1,     255,   256,      257,     65535,
+                                   65536, 65537, 16777215, 16777216, 16777217};
+    TimingWheel wheel(milliseconds(1), k_start);
+    std::vector<std::unique_ptr<Connection>> timers;
+    for (const std::int64_t delay: delays)
+    {
+        timers.push_back(std::make_unique<Connection>());
+        wheel.schedule(*timers.back(), k_start + milliseconds(delay));
+    }
+
+    const auto count = [](TimerNode& node) { ++static_cast<Connection&>(node).fired; };
+    for (std::size_t i = 0; i < timers.size(); ++i)
+    {
+        EXPECT_EQ(wheel.advance(k_start + milliseconds(delays[i] - 1), count), 0U) << delays[i];
+        EXPECT_EQ(wheel.advance(k_start + milliseconds(delays[i]), count), 1U) << delays[i];
+        EXPECT_EQ(timers[i]->fired, 1) << delays[i];
+    }
+    EXPECT_TRUE(wheel.empty());
+}
+
+/**
+ * @brief Tests that a non-positive resolution is rejected.
+ */
+TEST_F(TimingWheelTest, InvalidResolutionThrows)
+{
+    using namespace CommonLib;
+    EXPECT_THROW(TimingWheel(Clock::duration::zero()), std::invalid_argument);
+    EXPECT_THROW(TimingWheel(milliseconds(-1)), std::invalid_argument);
+}
@@ -0,0 +1,105 @@
+#include "CommonLib/Utils/CachedDateTimeFormatterTest.h"
+
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <string>
+
+#include "CommonLib/Utils/ScopedTimeZone.h"
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace
+{
+auto at(std::time_t seconds, std::int64_t nanoseconds) -> std::chrono::system_clock::time_point
+{
+    return std::chrono::system_clock::from_time_t(seconds) +
+           std::chrono::duration_cast<std::chrono::system_clock::duration>(
+               std::chrono::nanoseconds(nanoseconds));
+}
+}  // namespace
+
+/**
+ * @brief Tests that calls within the same second only differ in the patched fraction digits.
+ */
+TEST_F(CachedDateTimeFormatterTest, PatchesFractionWithinSameSecond)
+{
+    using namespace CommonLib;
+    CachedDateTimeFormatter cached("%F %T.%3N|%6N", DateTimeFormatter::Zone::Utc);
+
+    EXPECT_EQ(cached.format(at(1672531200, 100000000)), "2023-01-01 00:00:00.100|100000");
+    EXPECT_EQ(cached.format(at(1672531200, 999999000)), "2023-01-01 00:00:00.999|999999");
+    EXPECT_EQ(cached.format(at(1672531200, 5000)), "2023-01-01 00:00:00.000|000005");
+}
+
+/**
+ * @brief Tests that stepping into a new second (and day) renders the new fields.
+ */
+TEST_F(CachedDateTimeFormatterTest, RerendersOnSecondAndDayBoundary)
+{
+    using namespace CommonLib;
+    CachedDateTimeFormatter cached("%F %T.%3N", DateTimeFormatter::Zone::Utc);
+
+    EXPECT_EQ(cached.format(at(1672531199, 900000000)), "2022-12-31 23:59:59.900");
+    EXPECT_EQ(cached.format(at(1672531200, 100000000)), "2023-01-01 00:00:00.100");
+    EXPECT_EQ(cached.format(at(1672531199, 950000000)), "2022-12-31 23:59:59.950");
+}
+
+/**
+ * @brief Tests that local rendering switches offset and abbreviation at a DST transition.
+ */
+TEST_F(CachedDateTimeFormatterTest, HandlesDstTransition)
+{
+    using namespace CommonLib;
+    const ScopedTimeZone zone("Europe/Berlin");
+    CachedDateTimeFormatter cached("%F %T %z", DateTimeFormatter::Zone::Local);
+
+    // 2024-03-31 00:59:59 UTC is the last second of CET, 01:00:00 UTC the first of CEST.
+    EXPECT_EQ(cached.format(at(1711846799, 500000000)), "2024-03-31 01:59:59 +0100");
+    EXPECT_EQ(cached.format(at(1711846800, 0)), "2024-03-31 03:00:00 +0200");
+}
+
+/**
+ * @brief Tests that the cached output always matches the uncached formatter.
+ */
+TEST_F(CachedDateTimeFormatterTest, MatchesUncachedFormatter)
+{
+    using namespace CommonLib;
+    const std::string format = "%a %d %b %Y %H:%M:%S.%N %Z";
+    CachedDateTimeFormatter cached(format);
+    const DateTimeFormatter uncached(format);
+
+    auto tp = std::chrono::system_clock::now();
+    for (int i = 0; i < 2000; ++i)
+    {
+        EXPECT_EQ(cached.format(tp), uncached.format(tp));
+        tp += std::chrono::milliseconds(7);
+    }
+}
+
+/**
+ * @brief Tests that invalidate() forces a full render and accessors forward to the formatter.
+ */
+TEST_F(CachedDateTimeFormatterTest, InvalidateAndAccessors)
+{
+    using namespace CommonLib;
+    CachedDateTimeFormatter cached("%T", DateTimeFormatter::Zone::Utc);
+
+    EXPECT_EQ(cached.formatter().pattern(), "%T");
+    EXPECT_EQ(cached.max_size(), cached.formatter().max_size());
+    EXPECT_EQ(cached.format(at(0, 0)), "00:00:00");
+
+    cached.invalidate();
+    EXPECT_EQ(cached.format(at(0, 0)), "00:00:00");
+}
+
+/**
+ * @brief Tests that format_to refuses buffers smaller than max_size().
+ */
+TEST_F(CachedDateTimeFormatterTest, FormatToRejectsSmallBuffer)
+{
+    using namespace CommonLib;
+    CachedDateTimeFormatter cached("%F %T");
+    std::array<char, 4> small{};
+
+    EXPECT_EQ(cached.format_to(std::span<char>(small), std::chrono::system_clock::now()), 0U);
+}
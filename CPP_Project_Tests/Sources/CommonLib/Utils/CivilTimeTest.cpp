@@ -0,0 +1,125 @@
+#include "CommonLib/Utils/CivilTimeTest.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+namespace
+{
+auto gmtime_of(std::int64_t seconds) -> std::tm
+{
+    const auto t = static_cast<std::time_t>(seconds);
+    std::tm tm_buf{};
+#if defined(_WIN32)
+    gmtime_s(&tm_buf, &t);
+#else
+    gmtime_r(&t, &tm_buf);
+#endif
+    return tm_buf;
+}
+}  // namespace
+
+/**
+ * @brief Tests that the conversions are usable in constant expressions.
+ */
+TEST_F(CivilTimeTest, IsConstexpr)
+{
+    using CommonLib::CivilTime;
+
+    static_assert(CivilTime::days_from_civil(1970, 1, 1) == 0);
+    static_assert(CivilTime::days_from_civil(2000, 3, 1) == 11017);
+    static_assert(CivilTime::civil_from_days(-1) == CommonLib::CivilDate{1969, 12, 31});
+    static_assert(CivilTime::weekday_from_days(0) == 4);
+    static_assert(CivilTime::from_unix_seconds(1672531200).year == 2023);
+    static_assert(CivilTime::to_unix_seconds(CivilTime::from_unix_seconds(-1)) == -1);
+    static_assert(CivilTime::is_leap_year(2000) && !CivilTime::is_leap_year(1900));
+    static_assert(CivilTime::days_in_month(2024, 2) == 29);
+
+    EXPECT_EQ(CivilTime::days_from_civil(2023, 1, 1), 19358);
+}
+
+/**
+ * @brief Tests that every day between 1900 and 2200 matches gmtime and round-trips.
+ */
+TEST_F(CivilTimeTest, MatchesGmtimeForEveryDay)
+{
+    using CommonLib::CivilTime;
+    const std::int64_t first = CivilTime::days_from_civil(1900, 1, 1);
+    const std::int64_t last = CivilTime::days_from_civil(2200, 1, 1);
+
+    for (std::int64_t days = first; days < last; ++days)
+    {
+        // Sample a different time of day for every date.
+        const std::int64_t seconds = days * CivilTime::k_seconds_per_day + (days * 7919) % 86400;
+        const auto civil = CivilTime::from_unix_seconds(seconds);
+        const std::tm expected = gmtime_of(seconds);
+        const std::tm actual = CivilTime::to_tm(civil);
+
+        ASSERT_EQ(actual.tm_year, expected.tm_year) << seconds;
+        ASSERT_EQ(actual.tm_mon, expected.tm_mon) << seconds;
+        ASSERT_EQ(actual.tm_mday, expected.tm_mday) << seconds;
+        ASSERT_EQ(actual.tm_hour, expected.tm_hour) << seconds;
+        ASSERT_EQ(actual.tm_min, expected.tm_min) << seconds;
+        ASSERT_EQ(actual.tm_sec, expected.tm_sec) << seconds;
+        ASSERT_EQ(actual.tm_wday, expected.tm_wday) << seconds;
+        ASSERT_EQ(actual.tm_yday, expected.tm_yday) << seconds;
+        ASSERT_EQ(CivilTime::to_unix_seconds(civil), seconds);
+    }
+}
+
+/**
+ * @brief Tests the millisecond and nanosecond fast paths, including negative values.
+ */
+TEST_F(CivilTimeTest, MillisecondAndNanosecondPaths)
+{
+    using CommonLib::CivilTime;
+
+    const auto ms = CivilTime::from_unix_milliseconds(1672531200123);
+    EXPECT_EQ(ms.second, 0U);
+    EXPECT_EQ(ms.nanosecond, 123000000U);
+    EXPECT_EQ(CivilTime::to_unix_milliseconds(ms), 1672531200123);
+
+    const auto ns = CivilTime::from_unix_nanoseconds(-1);
+    EXPECT_EQ(ns.year, 1969);
+    EXPECT_EQ(ns.month, 12U);
+    EXPECT_EQ(ns.day, 31U);
+    EXPECT_EQ(ns.hour, 23U);
+    EXPECT_EQ(ns.minute, 59U);
+    EXPECT_EQ(ns.second, 59U);
+    EXPECT_EQ(ns.nanosecond, 999999999U);
+    EXPECT_EQ(CivilTime::to_unix_nanoseconds(ns), -1);
+
+    const auto negative_ms = CivilTime::from_unix_milliseconds(-1500);
+    EXPECT_EQ(negative_ms.second, 58U);
+    EXPECT_EQ(negative_ms.nanosecond, 500000000U);
+    EXPECT_EQ(CivilTime::to_unix_milliseconds(negative_ms), -1500);
+}
+
+/**
+ * @brief Tests the conversions from and to system_clock time points.
+ */
+TEST_F(CivilTimeTest, TimePointRoundTrip)
+{
+    using CommonLib::CivilTime;
+    const auto now = std::chrono::system_clock::now();
+    const auto civil = CivilTime::from_time_point(now);
+
+    EXPECT_EQ(CivilTime::to_time_point(civil), now);
+}
+
+/**
+ * @brief Tests calendar helpers at leap year and month boundaries.
+ */
+TEST_F(CivilTimeTest, CalendarHelpers)
+{
+    using CommonLib::CivilTime;
+
+    EXPECT_TRUE(CivilTime::is_leap_year(2024));
+    EXPECT_FALSE(CivilTime::is_leap_year(2100));
+    EXPECT_EQ(CivilTime::days_in_month(2023, 2), 28U);
+    EXPECT_EQ(CivilTime::days_in_month(2023, 12), 31U);
+    EXPECT_EQ(CivilTime::day_of_year(2024, 12, 31), 365U);
+    EXPECT_EQ(CivilTime::day_of_year(2023, 12, 31), 364U);
+    EXPECT_EQ(CivilTime::civil_from_days(CivilTime::days_from_civil(-4713, 11, 24)),
+              (CommonLib::CivilDate{-4713, 11, 24}));
+}
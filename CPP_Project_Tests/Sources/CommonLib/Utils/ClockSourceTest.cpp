@@ -0,0 +1,39 @@
+#include "CommonLib/Utils/ClockSourceTest.h"
+
+#include <chrono>
+#include <thread>
+
+#include "CommonLib/Utils/CoarseClock.h"
+#include "CommonLib/Utils/TscClock.h"
+
+static_assert(CommonLib::ClockSource<CommonLib::SteadyClock>);
+static_assert(CommonLib::ClockSource<CommonLib::TscClock>);
+static_assert(CommonLib::ClockSource<CommonLib::CoarseSteadyClock>);
+static_assert(!CommonLib::ClockSource<std::chrono::steady_clock>);
+static_assert(std::chrono::is_clock_v<CommonLib::CoarseSteadyClock>);
+static_assert(std::chrono::is_clock_v<CommonLib::CoarseSystemClock>);
+
+namespace
+{
+template<CommonLib::ClockSource Clock>
+auto measure_sleep_ms() -> double
+{
+    const auto start = Clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    return Clock::elapsed_ms(start, Clock::now());
+}
+}  // namespace
+
+/**
+ * @brief Tests that generic code measures the same interval with every clock source.
+ */
+TEST_F(ClockSourceTest, SourcesAreInterchangeable)
+{
+    using namespace CommonLib;
+    EXPECT_GE(measure_sleep_ms<SteadyClock>(), 20.0);
+    EXPECT_GE(measure_sleep_ms<TscClock>(), 20.0 * 0.98);
+
+    const double coarse_resolution_ms =
+        std::chrono::duration<double, std::milli>(CoarseSteadyClock::resolution()).count();
+    EXPECT_GE(measure_sleep_ms<CoarseSteadyClock>(), 20.0 - 2 * coarse_resolution_ms);
+}
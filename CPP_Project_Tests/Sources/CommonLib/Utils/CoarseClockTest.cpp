@@ -0,0 +1,49 @@
+#include "CommonLib/Utils/CoarseClockTest.h"
+
+#include <chrono>
+#include <thread>
+
+/**
+ * @brief Tests that the coarse steady clock is monotonic and follows steady_clock.
+ */
+TEST_F(CoarseClockTest, SteadyClockFollowsSteadyClock)
+{
+    using namespace CommonLib;
+    const auto resolution = CoarseSteadyClock::resolution();
+    EXPECT_GT(resolution.count(), 0);
+    EXPECT_LE(resolution, std::chrono::milliseconds(100));
+
+    const auto start = CoarseSteadyClock::now();
+    const auto steady_start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    const auto end = CoarseSteadyClock::now();
+    const auto steady_end = std::chrono::steady_clock::now();
+
+    EXPECT_GE(end, start);
+    const double elapsed_ms = CoarseSteadyClock::elapsed_ms(start, end);
+    const double expected_ms =
+        std::chrono::duration<double, std::milli>(steady_end - steady_start).count();
+    const double tolerance_ms =
+        2 * std::chrono::duration<double, std::milli>(resolution).count() + 10;
+    EXPECT_NEAR(elapsed_ms, expected_ms, tolerance_ms);
+    EXPECT_DOUBLE_EQ(CoarseSteadyClock::elapsed_s(start, end) * 1000, elapsed_ms);
+    EXPECT_DOUBLE_EQ(CoarseSteadyClock::elapsed_us(start, end) / 1000, elapsed_ms);
+}
+
+/**
+ * @brief Tests that the coarse system clock agrees with system_clock within its resolution.
+ */
+TEST_F(CoarseClockTest, SystemClockMatchesSystemClock)
+{
+    using namespace CommonLib;
+    const auto resolution = CoarseSystemClock::resolution();
+    const auto before = std::chrono::system_clock::now();
+    const auto coarse = CoarseSystemClock::to_sys(CoarseSystemClock::now());
+    const auto after = std::chrono::system_clock::now();
+
+    // The coarse clock lags behind by about one tick, more on tickless kernels; allow the same
+    // slack the other way for frequency adjustments between kernel ticks.
+    const auto slack = 2 * resolution + std::chrono::milliseconds(10);
+    EXPECT_GE(coarse, before - slack);
+    EXPECT_LE(coarse, after + slack);
+}
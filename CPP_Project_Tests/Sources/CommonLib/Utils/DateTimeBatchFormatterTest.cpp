@@ -0,0 +1,164 @@
+#include "CommonLib/Utils/DateTimeBatchFormatterTest.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CommonLib/Utils/CivilTime.h"
+
+namespace
+{
+constexpr std::array<CommonLib::SimdLevel, 3> k_levels = {
+    CommonLib::SimdLevel::Scalar, CommonLib::SimdLevel::Ssse3, CommonLib::SimdLevel::Avx2};
+
+/**
+ * @brief Renders a timestamp with snprintf as the reference for the batch formatter.
+ */
+auto reference(std::int64_t nanoseconds, const CommonLib::DateTimeBatchFormatter::Format& format)
+    -> std::string
+{
+    const auto civil = CommonLib::CivilTime::from_unix_nanoseconds(nanoseconds);
+    char buffer[64];
+    int length = std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02uT%02u:%02u:%02u", civil.year,
+                               civil.month, civil.day, civil.hour, civil.minute, civil.second);
+    if (format.fraction_digits != 0)
+    {
+        length += std::snprintf(buffer + length, sizeof(buffer) - length, ".%09u",
+                                civil.nanosecond);
+        length -= 9 - format.fraction_digits;
+    }
+    if (format.utc_suffix)
+    {
+        buffer[length++] = 'Z';
+    }
+    return {buffer, static_cast<std::size_t>(length)};
+}
+
+auto random_timestamps(std::size_t count) -> std::vector<std::int64_t>
+{
+    std::mt19937_64 engine(7);
+    std::uniform_int_distribution<std::int64_t> distribution;
+    // CivilTime::from_unix_nanoseconds cannot represent the last second before the minimum.
+    std::vector<std::int64_t> result = {0, -1, std::numeric_limits<std::int64_t>::max(),
+                                        std::numeric_limits<std::int64_t>::min() + 1000000000,
+                                        951782400123456789};
+    while (result.size() < count)
+    {
+        result.push_back(distribution(engine));
+    }
+    return result;
+}
+}  // namespace
+
+/**
+ * @brief Tests that every SIMD level renders the same text as snprintf for all formats.
+ */
+TEST_F(DateTimeBatchFormatterTest, MatchesReferenceForAllLevels)
+{
+    using namespace CommonLib;
+    using Format = DateTimeBatchFormatter::Format;
+    const auto input = random_timestamps(1001);
+
+    for (const Format format: {Format{0, false}, Format{3, true}, Format{6, false}, Format{9, true},
+                               Format{1, false}})
+    {
+        std::string expected;
+        for (std::size_t i = 0; i < input.size(); ++i)
+        {
+            expected += (i == 0 ? "" : ",") + reference(input[i], format);
+        }
+
+        for (const SimdLevel level: k_levels)
+        {
+            // Nothing past the batch may be touched, even though the buffer is larger.
+            std::string buffer(expected.size() + 64, '#');
+            EXPECT_EQ(DateTimeBatchFormatter::format_many(input, format, std::span<char>(buffer),
+                                                          ",", level),
+                      expected.size());
+            EXPECT_EQ(buffer.substr(0, expected.size()), expected);
+            EXPECT_EQ(buffer.substr(expected.size()).find_first_not_of('#'), std::string::npos);
+
+            std::string exact(expected.size(), '#');
+            DateTimeBatchFormatter::format_many(input, format, std::span<char>(exact), ",", level);
+            EXPECT_EQ(exact, expected);
+        }
+    }
+}
+
+/**
+ * @brief Tests empty and multi-character separators and the string overloads.
+ */
+TEST_F(DateTimeBatchFormatterTest, HandlesSeparators)
+{
+    using namespace CommonLib;
+    const std::vector<std::int64_t> input = {0, 1500000000, -1};
+
+    EXPECT_EQ(DateTimeBatchFormatter::format_many(input, {1, true}),
+              "1970-01-01T00:00:00.0Z\n1970-01-01T00:00:01.5Z\n1969-12-31T23:59:59.9Z");
+    EXPECT_EQ(DateTimeBatchFormatter::format_many(input, {}, ""),
+              "1970-01-01T00:00:001970-01-01T00:00:011969-12-31T23:59:59");
+    EXPECT_EQ(DateTimeBatchFormatter::format_many(input, {}, " | "),
+              "1970-01-01T00:00:00 | 1970-01-01T00:00:01 | 1969-12-31T23:59:59");
+    EXPECT_EQ(DateTimeBatchFormatter::format_many(std::span<const std::int64_t>(), {}), "");
+    EXPECT_EQ(DateTimeBatchFormatter::required_size(3, {3, true}, ", "), 3 * 24 + 2 * 2U);
+    EXPECT_EQ(DateTimeBatchFormatter::required_size(0, {}, ", "), 0U);
+}
+
+/**
+ * @brief Tests that time points render the same as their nanosecond counts and round trip.
+ */
+TEST_F(DateTimeBatchFormatterTest, FormatsTimePointsAndRoundTrips)
+{
+    using namespace CommonLib;
+    const auto nanoseconds = random_timestamps(200);
+    std::vector<std::chrono::system_clock::time_point> time_points;
+    for (const std::int64_t value: nanoseconds)
+    {
+        // Stay within the range of DateTimeBatchParser and of system_clock on every platform.
+        time_points.emplace_back(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(value / 2000 * 1000)));
+    }
+
+    const DateTimeBatchFormatter::Format format{9, true};
+    const std::string text = DateTimeBatchFormatter::format_many(time_points, format, "\n");
+
+    std::vector<std::string_view> lines;
+    for (std::size_t start = 0; start <= text.size(); start += format.width() + 1)
+    {
+        lines.push_back(std::string_view(text).substr(start, format.width()));
+    }
+    ASSERT_EQ(lines.size(), time_points.size());
+
+    std::vector<std::int64_t> parsed(lines.size());
+    EXPECT_EQ(DateTimeBatchParser::parse(lines, format, parsed), 0U);
+    for (std::size_t i = 0; i < time_points.size(); ++i)
+    {
+        EXPECT_EQ(parsed[i], std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 time_points[i].time_since_epoch())
+                                 .count());
+    }
+}
+
+/**
+ * @brief Tests that undersized buffers and invalid formats are rejected.
+ */
+TEST_F(DateTimeBatchFormatterTest, RejectsInvalidArguments)
+{
+    using namespace CommonLib;
+    const std::vector<std::int64_t> input = {0, 0};
+    std::vector<char> buffer(DateTimeBatchFormatter::required_size(2, {}, ",") - 1);
+
+    EXPECT_THROW(DateTimeBatchFormatter::format_many(input, {}, buffer, ","),
+                 std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(DateTimeBatchFormatter::format_many(input, {10, false})),
+                 std::invalid_argument);
+    buffer.push_back('#');
+    EXPECT_EQ(DateTimeBatchFormatter::format_many(input, {}, buffer, ","), buffer.size());
+}
@@ -0,0 +1,163 @@
+#include "CommonLib/Utils/DateTimeBatchParserTest.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CommonLib/Utils/CivilTime.h"
+
+namespace
+{
+constexpr std::array<CommonLib::SimdLevel, 3> k_levels = {
+    CommonLib::SimdLevel::Scalar, CommonLib::SimdLevel::Ssse3, CommonLib::SimdLevel::Avx2};
+
+/**
+ * @brief Renders random timestamps between 1700 and 2250 in the given format.
+ */
+auto make_timestamps(const CommonLib::DateTimeBatchParser::Format& format, std::size_t count)
+    -> std::vector<std::string>
+{
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<std::int64_t> seconds(-8520336000, 8835840000);
+    std::uniform_int_distribution<std::uint32_t> nanoseconds(0, 999999999);
+    const char separators[] = {'T', ' ', 't'};
+
+    std::vector<std::string> result;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto civil = CommonLib::CivilTime::from_unix_seconds(seconds(engine));
+        char buffer[64];
+        int length = std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u%c%02u:%02u:%02u",
+                                   civil.year, civil.month, civil.day, separators[i % 3],
+                                   civil.hour, civil.minute, civil.second);
+        if (format.fraction_digits != 0)
+        {
+            length += std::snprintf(buffer + length, sizeof(buffer) - length, ".%09u",
+                                    nanoseconds(engine));
+            length -= 9 - format.fraction_digits;
+        }
+        if (format.utc_suffix)
+        {
+            buffer[length++] = 'Z';
+        }
+        result.emplace_back(buffer, static_cast<std::size_t>(length));
+    }
+    return result;
+}
+}  // namespace
+
+/**
+ * @brief Tests that every SIMD level agrees with DateTimeParser on valid input.
+ */
+TEST_F(DateTimeBatchParserTest, MatchesScalarParserForAllLevels)
+{
+    using namespace CommonLib;
+    using Format = DateTimeBatchParser::Format;
+
+    for (const Format format: {Format{0, false}, Format{3, true}, Format{6, false}, Format{9, true},
+                               Format{1, false}})
+    {
+        const auto strings = make_timestamps(format, 1001);
+        const std::vector<std::string_view> input(strings.begin(), strings.end());
+
+        for (const SimdLevel level: k_levels)
+        {
+            std::vector<std::int64_t> output(input.size(), -1);
+            std::vector<DateTimeBatchParser::Status> status(input.size());
+            EXPECT_EQ(DateTimeBatchParser::parse(input, format, output, status, level), 0U);
+
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                const auto expected = DateTimeParser::parse_iso8601(input[i]);
+                ASSERT_TRUE(expected.has_value()) << input[i];
+                ASSERT_EQ(status[i], DateTimeBatchParser::Status::Ok) << input[i];
+                ASSERT_EQ(output[i], expected->time_since_epoch().count()) << input[i];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tests that invalid elements are reported individually without affecting neighbours.
+ */
+TEST_F(DateTimeBatchParserTest, ReportsPerElementErrors)
+{
+    using namespace CommonLib;
+    using Status = DateTimeBatchParser::Status;
+
+    const std::vector<std::string_view> input = {
+        "2024-03-31T02:30:15.250", "2024-03-31T02:30:15",     "2024-03-31X02:30:15.250",
+        "2024-02-30T02:30:15.250", "2024-03-31T24:30:15.250", "2024/03-31T02:30:15.250",
+        "2024-03-31T02:30:1x.250", "2024-03-31T02:30:15,250", "2300-01-01T00:00:00.000",
+        "1970-01-01 00:00:00.001", "",                        "2024-03-31T02:30:15.25a",
+        "2024-13-01T00:00:00.000"};
+    const std::vector<Status> expected = {
+        Status::Ok,            Status::InvalidLength, Status::InvalidSyntax, Status::InvalidDate,
+        Status::InvalidTime,   Status::InvalidSyntax, Status::InvalidSyntax, Status::InvalidSyntax,
+        Status::OutOfRange,    Status::Ok,            Status::InvalidLength, Status::InvalidSyntax,
+        Status::InvalidDate};
+
+    for (const SimdLevel level: k_levels)
+    {
+        std::vector<std::int64_t> output(input.size(), -1);
+        std::vector<Status> status(input.size());
+        EXPECT_EQ(DateTimeBatchParser::parse(input, {3, false}, output, status, level), 11U);
+
+        for (std::size_t i = 0; i < input.size(); ++i)
+        {
+            EXPECT_EQ(status[i], expected[i]) << input[i];
+            if (status[i] != Status::Ok)
+            {
+                EXPECT_EQ(output[i], 0) << input[i];
+            }
+        }
+        EXPECT_EQ(output[0], 1711852215250000000);
+        EXPECT_EQ(output[9], 1000000);
+    }
+}
+
+/**
+ * @brief Tests parsing from a contiguous buffer with offsets and into time points.
+ */
+TEST_F(DateTimeBatchParserTest, ParsesBufferAndTimePoints)
+{
+    using namespace CommonLib;
+    const std::string csv = "1970-01-01T00:00:01Z,2000-01-01T00:00:00Z,2038-01-19T03:14:08Z,1970";
+    const std::vector<std::size_t> offsets = {0, 21, 42, 63};
+    std::vector<std::int64_t> output(offsets.size());
+    std::vector<DateTimeBatchParser::Status> status(offsets.size());
+
+    EXPECT_EQ(DateTimeBatchParser::parse(csv, offsets, {0, true}, output, status), 1U);
+    EXPECT_EQ(output[0], 1000000000);
+    EXPECT_EQ(output[1], 946684800000000000);
+    EXPECT_EQ(output[2], 2147483648000000000);
+    EXPECT_EQ(status[3], DateTimeBatchParser::Status::InvalidLength);
+
+    const std::vector<std::string_view> input = {"1970-01-01T00:00:01.5"};
+    std::vector<DateTimeBatchParser::TimePoint> time_points(1);
+    EXPECT_EQ(DateTimeBatchParser::parse(input, {1, false}, time_points), 0U);
+    EXPECT_EQ(time_points[0].time_since_epoch().count(), 1500000000);
+}
+
+/**
+ * @brief Tests that undersized outputs and invalid formats are rejected.
+ */
+TEST_F(DateTimeBatchParserTest, RejectsInvalidArguments)
+{
+    using namespace CommonLib;
+    const std::vector<std::string_view> input = {"1970-01-01T00:00:00", "1970-01-01T00:00:00"};
+    std::vector<std::int64_t> output(1);
+    std::vector<std::int64_t> large_output(2);
+    std::vector<DateTimeBatchParser::Status> status(1);
+
+    EXPECT_THROW(DateTimeBatchParser::parse(input, {}, output), std::invalid_argument);
+    EXPECT_THROW(DateTimeBatchParser::parse(input, {}, large_output, status), std::invalid_argument);
+    EXPECT_THROW(DateTimeBatchParser::parse(input, {10, false}, large_output),
+                 std::invalid_argument);
+    EXPECT_EQ(DateTimeBatchParser::parse({}, {}, std::span<std::int64_t>()), 0U);
+}
@@ -0,0 +1,200 @@
+#include "CommonLib/Utils/DateTimeFormatterTest.h"
+
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <iterator>
+#include <string>
+
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace
+{
+auto strftime_local(std::time_t t, const char* format) -> std::string
+{
+    std::tm tm_buf{};
+#if defined(_WIN32)
+    localtime_s(&tm_buf, &t);
+#else
+    localtime_r(&t, &tm_buf);
+#endif
+    std::array<char, 256> buf{};
+    const auto length = std::strftime(buf.data(), buf.size(), format, &tm_buf);
+    return {buf.data(), length};
+}
+
+auto strftime_utc(std::time_t t, const char* format) -> std::string
+{
+    std::tm tm_buf{};
+#if defined(_WIN32)
+    gmtime_s(&tm_buf, &t);
+#else
+    gmtime_r(&t, &tm_buf);
+#endif
+    std::array<char, 256> buf{};
+    const auto length = std::strftime(buf.data(), buf.size(), format, &tm_buf);
+    return {buf.data(), length};
+}
+
+constexpr std::array<std::time_t, 6> k_sample_times = {
+    0,           // 1970-01-01 00:00:00
+    951782400,   // 2000-02-29 00:00:00
+    1672531200,  // 2023-01-01 00:00:00
+    1688169599,  // 2023-06-30 23:59:59
+    1711846800,  // 2024-03-31 01:00:00
+    4102444799   // 2099-12-31 23:59:59
+};
+
+constexpr std::array<const char*, 8> k_sample_formats = {
+    "%Y-%m-%d %H:%M:%S",
+    "%F %T",
+    "%a %A %b %B %h %p",
+    "%y %C %e %j %u %w %I",
+    "%D %R %r",
+    "literal text without specifiers",
+    "%% %n %t %c %U %W %V %G %g %x %X",
+    "%-d %_m %Ey %Od %z %Z"};
+}  // namespace
+
+/**
+ * @brief Tests that local rendering matches std::strftime for a range of formats and times.
+ */
+TEST_F(DateTimeFormatterTest, LocalRenderingMatchesStrftime)
+{
+    using namespace CommonLib;
+
+    for (const char* format: k_sample_formats)
+    {
+        const DateTimeFormatter formatter(format);
+        for (const auto t: k_sample_times)
+        {
+            const auto tp = std::chrono::system_clock::from_time_t(t);
+            EXPECT_EQ(formatter.format(tp), strftime_local(t, format)) << format << " @ " << t;
+        }
+    }
+}
+
+/**
+ * @brief Tests that UTC rendering matches std::strftime on gmtime for a range of formats.
+ */
+TEST_F(DateTimeFormatterTest, UtcRenderingMatchesStrftime)
+{
+    using namespace CommonLib;
+
+    for (const char* format: k_sample_formats)
+    {
+        const DateTimeFormatter formatter(format, DateTimeFormatter::Zone::Utc);
+        for (const auto t: k_sample_times)
+        {
+            const auto tp = std::chrono::system_clock::from_time_t(t);
+            EXPECT_EQ(formatter.format(tp), strftime_utc(t, format)) << format << " @ " << t;
+        }
+    }
+}
+
+/**
+ * @brief Tests that the compiled and the uncompiled paths produce identical output.
+ */
+TEST_F(DateTimeFormatterTest, CompiledAndOneShotAgree)
+{
+    using namespace CommonLib;
+    const std::string format = "%Y-%m-%dT%H:%M:%S.%3N%z";
+    const auto tp = std::chrono::system_clock::now();
+    const DateTimeFormatter formatter(format);
+
+    std::array<char, 64> buffer{};
+    const auto length =
+        DateTimeFormatter::format_to(buffer, format, tp, DateTimeFormatter::Zone::Local);
+
+    EXPECT_EQ(std::string(buffer.data(), length), formatter.format(tp));
+    EXPECT_EQ(formatter.max_size(), DateTimeFormatter::max_size(format));
+}
+
+/**
+ * @brief Tests the fractional second extension specifiers.
+ */
+TEST_F(DateTimeFormatterTest, RendersFractionalSeconds)
+{
+    using namespace CommonLib;
+    const auto tp = std::chrono::system_clock::from_time_t(1672531200) +
+                    std::chrono::nanoseconds(123456789);
+
+    const DateTimeFormatter formatter("%S.%3N|%6N|%9N|%N|%1N", DateTimeFormatter::Zone::Utc);
+    EXPECT_EQ(formatter.format(tp), "00.123|123456|123456789|123456789|1");
+}
+
+/**
+ * @brief Tests that format_to refuses buffers smaller than max_size().
+ */
+TEST_F(DateTimeFormatterTest, FormatToRejectsSmallBuffer)
+{
+    using namespace CommonLib;
+    const DateTimeFormatter formatter("%Y-%m-%d");
+    std::array<char, 4> small{};
+
+    EXPECT_GT(formatter.max_size(), small.size());
+    EXPECT_EQ(formatter.format_to(std::span<char>(small), std::chrono::system_clock::now()), 0U);
+}
+
+/**
+ * @brief Tests rendering through an output iterator.
+ */
+TEST_F(DateTimeFormatterTest, FormatToOutputIterator)
+{
+    using namespace CommonLib;
+    const DateTimeFormatter formatter("[%F %T]", DateTimeFormatter::Zone::Utc);
+    const auto tp = std::chrono::system_clock::from_time_t(1688169599);
+
+    std::string result;
+    formatter.format_to(std::back_inserter(result), tp);
+
+    EXPECT_EQ(result, "[2023-06-30 23:59:59]");
+}
+
+/**
+ * @brief Tests the accessors and rendering of an empty pattern.
+ */
+TEST_F(DateTimeFormatterTest, AccessorsAndEmptyPattern)
+{
+    using namespace CommonLib;
+    const DateTimeFormatter formatter("", DateTimeFormatter::Zone::Utc);
+
+    EXPECT_EQ(formatter.pattern(), "");
+    EXPECT_EQ(formatter.zone(), DateTimeFormatter::Zone::Utc);
+    EXPECT_EQ(formatter.max_size(), 0U);
+    EXPECT_EQ(formatter.format(std::chrono::system_clock::now()), "");
+}
+
+/**
+ * @brief Tests that epoch seconds are rendered from the time point itself.
+ */
+TEST_F(DateTimeFormatterTest, RendersEpochSeconds)
+{
+    using namespace CommonLib;
+    const DateTimeFormatter formatter("%s", DateTimeFormatter::Zone::Utc);
+
+    EXPECT_EQ(formatter.format(std::chrono::system_clock::from_time_t(1672531200)), "1672531200");
+    EXPECT_EQ(formatter.format(std::chrono::system_clock::from_time_t(-86400)), "-86400");
+}
+
+/**
+ * @brief Tests rendering in an explicitly given time zone.
+ */
+TEST_F(DateTimeFormatterTest, RendersInGivenTimeZone)
+{
+    using namespace CommonLib;
+    const auto zone = TimeZone::from_posix_rule("CET-1CEST,M3.5.0,M10.5.0/3");
+    ASSERT_NE(zone, nullptr);
+
+    const DateTimeFormatter formatter("%F %T %Z %z", DateTimeFormatter::Zone::Utc);
+    const auto winter = std::chrono::system_clock::from_time_t(1705320000);
+    const auto summer = std::chrono::system_clock::from_time_t(1721044800);
+    EXPECT_EQ(formatter.format(winter, *zone), "2024-01-15 13:00:00 CET +0100");
+    EXPECT_EQ(formatter.format(summer, *zone), "2024-07-15 14:00:00 CEST +0200");
+    EXPECT_EQ(formatter.format(summer, *TimeZone::utc()), "2024-07-15 12:00:00 UTC +0000");
+
+    std::array<char, 64> buffer{};
+    const auto length = DateTimeFormatter::format_to(buffer, "%H:%M %Z", summer, *zone);
+    EXPECT_EQ(std::string(buffer.data(), length), "14:00 CEST");
+    EXPECT_EQ(formatter.format_to(std::span<char>(buffer.data(), 4), summer, *zone), 0U);
+}
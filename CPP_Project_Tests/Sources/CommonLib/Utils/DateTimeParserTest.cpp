@@ -0,0 +1,192 @@
+#include "CommonLib/Utils/DateTimeParserTest.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace
+{
+auto nanoseconds_of(const CommonLib::DateTimeParser::Result& result) -> std::int64_t
+{
+    return result->time_since_epoch().count();
+}
+}  // namespace
+
+/**
+ * @brief Tests ISO 8601 dates, times, fractions and offsets.
+ */
+TEST_F(DateTimeParserTest, ParsesIso8601)
+{
+    using namespace CommonLib;
+    constexpr std::int64_t k_second = 1000000000;
+
+    struct Case {
+            std::string_view text;
+            std::int64_t nanoseconds;
+    };
+    const Case cases[] = {
+        {"2024-03-31", 1711843200 * k_second},
+        {"2024-03-31T02:30", 1711852200 * k_second},
+        {"2024-03-31t02:30:15", 1711852215 * k_second},
+        {"2024-03-31 02:30:15Z", 1711852215 * k_second},
+        {"2024-03-31T02:30:15.5", 1711852215 * k_second + 500000000},
+        {"2024-03-31T02:30:15,123456789", 1711852215 * k_second + 123456789},
+        {"2024-03-31T02:30:15.1234567891234", 1711852215 * k_second + 123456789},
+        {"2024-03-31T02:30:15+02:00", 1711845015 * k_second},
+        {"2024-03-31T02:30:15-0130", 1711857615 * k_second},
+        {"2024-03-31T02:30:15+02", 1711845015 * k_second},
+        {"2016-12-31T23:59:60Z", 1483228800 * k_second},
+        {"1969-12-31T23:59:59.999999999Z", -1},
+        {"1970-01-01T00:00:00Z", 0},
+    };
+
+    for (const auto& test: cases)
+    {
+        const auto result = DateTimeParser::parse_iso8601(test.text);
+        ASSERT_TRUE(result.has_value()) << test.text;
+        EXPECT_EQ(nanoseconds_of(result), test.nanoseconds) << test.text;
+    }
+}
+
+/**
+ * @brief Tests that RFC 3339 requires seconds and an offset.
+ */
+TEST_F(DateTimeParserTest, ParsesRfc3339Strictly)
+{
+    using namespace CommonLib;
+    using Error = DateTimeParser::Error;
+
+    const auto result = DateTimeParser::parse_rfc3339("1985-04-12T23:20:50.52Z");
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(nanoseconds_of(result), 482196050520000000);
+
+    const auto offset = DateTimeParser::parse_rfc3339("1996-12-19T16:39:57-08:00");
+    ASSERT_TRUE(offset.has_value());
+    EXPECT_EQ(nanoseconds_of(offset), 851042397000000000);
+
+    EXPECT_EQ(DateTimeParser::parse_rfc3339("1996-12-19").error(), Error::InvalidSyntax);
+    EXPECT_EQ(DateTimeParser::parse_rfc3339("1996-12-19T16:39Z").error(), Error::InvalidSyntax);
+    EXPECT_EQ(DateTimeParser::parse_rfc3339("1996-12-19T16:39:57").error(), Error::InvalidOffset);
+    EXPECT_EQ(DateTimeParser::parse_rfc3339("1996-12-19T16:39:57-0800").error(),
+              Error::InvalidOffset);
+}
+
+/**
+ * @brief Tests RFC 1123 dates with and without weekday and with numeric zones.
+ */
+TEST_F(DateTimeParserTest, ParsesRfc1123)
+{
+    using namespace CommonLib;
+    using Error = DateTimeParser::Error;
+    constexpr std::int64_t k_expected = 784111777LL * 1000000000;
+
+    for (std::string_view text: {"Sun, 06 Nov 1994 08:49:37 GMT", "sun, 6 nov 1994 08:49:37 UTC",
+                                 "06 Nov 1994 08:49:37 GMT", "Sun, 06 Nov 1994 09:49:37 +0100",
+                                 "Sun, 06 Nov 1994 08:49:37 UT", "Sun, 06 Nov 1994 08:49:37 Z"})
+    {
+        const auto result = DateTimeParser::parse_rfc1123(text);
+        ASSERT_TRUE(result.has_value()) << text;
+        EXPECT_EQ(nanoseconds_of(result), k_expected) << text;
+    }
+
+    EXPECT_EQ(DateTimeParser::parse_rfc1123("Mon, 06 Nov 1994 08:49:37 GMT").error(),
+              Error::InvalidDate);
+    EXPECT_EQ(DateTimeParser::parse_rfc1123("Sun, 06 Foo 1994 08:49:37 GMT").error(),
+              Error::InvalidSyntax);
+    EXPECT_EQ(DateTimeParser::parse_rfc1123("Sun, 06 Nov 1994 08:49:37").error(),
+              Error::InvalidSyntax);
+    EXPECT_EQ(DateTimeParser::parse_rfc1123("Sun, 06 Nov 1994 08:49:37 CET").error(),
+              Error::InvalidOffset);
+}
+
+/**
+ * @brief Tests that parse() dispatches on the first character.
+ */
+TEST_F(DateTimeParserTest, ParseDetectsFormat)
+{
+    using namespace CommonLib;
+    EXPECT_EQ(nanoseconds_of(DateTimeParser::parse("Thu, 01 Jan 1970 00:00:01 GMT")), 1000000000);
+    EXPECT_EQ(nanoseconds_of(DateTimeParser::parse("1970-01-01T00:00:01Z")), 1000000000);
+}
+
+/**
+ * @brief Tests that every kind of malformed input is reported with the matching error.
+ */
+TEST_F(DateTimeParserTest, ReportsErrors)
+{
+    using namespace CommonLib;
+    using Error = DateTimeParser::Error;
+
+    struct Case {
+            std::string_view text;
+            Error error;
+    };
+    const Case cases[] = {
+        {"", Error::Empty},
+        {"2024", Error::InvalidSyntax},
+        {"2024-3-31", Error::InvalidSyntax},
+        {"20240331", Error::InvalidSyntax},
+        {"2024-13-01", Error::InvalidDate},
+        {"2023-02-29", Error::InvalidDate},
+        {"2024-04-31", Error::InvalidDate},
+        {"2024-03-31T24:00", Error::InvalidTime},
+        {"2024-03-31T12:60", Error::InvalidTime},
+        {"2024-03-31T12:00:61", Error::InvalidTime},
+        {"2024-03-31T12", Error::InvalidSyntax},
+        {"2024-03-31T12:00:00.", Error::InvalidSyntax},
+        {"2024-03-31T12:00:00+24:00", Error::InvalidOffset},
+        {"2024-03-31T12:00:00+1", Error::InvalidOffset},
+        {"2024-03-31T12:00:00Zjunk", Error::TrailingCharacters},
+        {"2024-03-31X", Error::TrailingCharacters},
+        {"2262-04-12T00:00:00Z", Error::OutOfRange},
+        {"1677-09-21T00:00:00Z", Error::OutOfRange},
+    };
+
+    for (const auto& test: cases)
+    {
+        const auto result = DateTimeParser::parse_iso8601(test.text);
+        ASSERT_FALSE(result.has_value()) << test.text;
+        EXPECT_EQ(result.error(), test.error) << test.text;
+        EXPECT_FALSE(DateTimeParser::error_message(result.error()).empty());
+    }
+}
+
+/**
+ * @brief Tests that timestamps without offset are resolved in the given zone.
+ */
+TEST_F(DateTimeParserTest, UsesZoneForLocalTimestamps)
+{
+    using namespace CommonLib;
+    const auto zone = TimeZone::from_posix_rule("CET-1CEST,M3.5.0,M10.5.0/3");
+    ASSERT_NE(zone, nullptr);
+
+    EXPECT_EQ(nanoseconds_of(DateTimeParser::parse_iso8601("2024-07-15T12:00:00", *zone)),
+              1721037600LL * 1000000000);
+    EXPECT_EQ(nanoseconds_of(DateTimeParser::parse_iso8601("2024-07-15T12:00:00Z", *zone)),
+              1721044800LL * 1000000000);
+}
+
+/**
+ * @brief Tests that the parsed fields carry the calendar values and derived weekday.
+ */
+TEST_F(DateTimeParserTest, ExposesFields)
+{
+    using namespace CommonLib;
+    const auto fields = DateTimeParser::parse_iso8601_fields("2024-02-29 13:14:15.016+05:30");
+    ASSERT_TRUE(fields.has_value());
+
+    EXPECT_EQ(fields->civil.year, 2024);
+    EXPECT_EQ(fields->civil.month, 2U);
+    EXPECT_EQ(fields->civil.day, 29U);
+    EXPECT_EQ(fields->civil.hour, 13U);
+    EXPECT_EQ(fields->civil.minute, 14U);
+    EXPECT_EQ(fields->civil.second, 15U);
+    EXPECT_EQ(fields->civil.nanosecond, 16000000U);
+    EXPECT_EQ(fields->civil.weekday, 4U);
+    EXPECT_EQ(fields->civil.day_of_year, 59U);
+    EXPECT_TRUE(fields->has_offset);
+    EXPECT_TRUE(fields->has_time);
+    EXPECT_EQ(fields->utc_offset, 5 * 3600 + 30 * 60);
+}
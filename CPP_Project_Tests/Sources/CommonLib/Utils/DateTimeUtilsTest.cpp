@@ -1,11 +1,17 @@
 #include "CommonLib/Utils/DateTimeUtilsTest.h"
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <iomanip>
+#include <memory_resource>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <utility>
+#include <vector>
 
 int get_timezone_offset_seconds()
 {
@@ -74,6 +80,73 @@ TEST_F(DateTimeUtilsTest, NowUtcReturnsUtcTimeString)
     EXPECT_EQ(utc_str, expected);
 }
 
+/**
+ * @brief Tests that DateTimeUtils::now_cached and now_utc_cached match their uncached variants.
+ *
+ * The uncached call is repeated before and after the cached one and the comparison is only
+ * performed when both landed in the same second.
+ */
+TEST_F(DateTimeUtilsTest, NowCachedMatchesNow)
+{
+    using namespace CommonLib;
+    const std::string fmt = "%Y-%m-%d %H:%M:%S";
+    int compared = 0;
+
+    for (int i = 0; i < 1000 && compared < 100; ++i)
+    {
+        const std::string before = DateTimeUtils::now(fmt);
+        const std::string cached = DateTimeUtils::now_cached(fmt);
+        const std::string before_utc = DateTimeUtils::now_utc(fmt);
+        const std::string cached_utc = DateTimeUtils::now_utc_cached(fmt);
+        const std::string after = DateTimeUtils::now(fmt);
+        const std::string after_utc = DateTimeUtils::now_utc(fmt);
+
+        if (before == after && before_utc == after_utc)
+        {
+            EXPECT_EQ(cached, before);
+            EXPECT_EQ(cached_utc, before_utc);
+            ++compared;
+        }
+    }
+
+    EXPECT_GT(compared, 0);
+}
+
+/**
+ * @brief Tests that the per-thread cache handles more formats than it has slots, on many threads.
+ */
+TEST_F(DateTimeUtilsTest, NowCachedIsPerThread)
+{
+    using namespace CommonLib;
+    const std::array<std::string, 6> formats = {"%Y", "%m", "%d", "%F", "%Y-%m", "%j"};
+    std::vector<std::thread> threads;
+    std::atomic<int> empty_results{0};
+
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&formats, &empty_results]() {
+            for (int i = 0; i < 200; ++i)
+            {
+                for (const auto& fmt: formats)
+                {
+                    if (DateTimeUtils::now_utc_cached(fmt).empty())
+                    {
+                        ++empty_results;
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(empty_results.load(), 0);
+    EXPECT_EQ(DateTimeUtils::now_utc_cached("%%"), "%");
+}
+
 /**
  * @brief Tests that DateTimeUtils::current_date returns the current local date as a string.
  */
@@ -152,6 +225,7 @@ TEST_F(DateTimeUtilsTest, FromStringParsesToTimePoint)
     std::tm tm_buf = {};
     std::istringstream iss(date_str);
     iss >> std::get_time(&tm_buf, "%Y-%m-%d %H:%M:%S");
+    tm_buf.tm_isdst = -1;
     std::time_t expected_time = std::mktime(&tm_buf);
     auto expected = std::chrono::system_clock::from_time_t(expected_time);
 
@@ -166,20 +240,14 @@ TEST_F(DateTimeUtilsTest, FromStringParsesToTimePoint)
 TEST_F(DateTimeUtilsTest, ToStringAndFromStringRoundTrip)
 {
     using namespace CommonLib;
-    int tz_offset = get_timezone_offset_seconds();
-
     auto now = std::chrono::system_clock::now();
     std::string fmt = "%Y-%m-%d %H:%M:%S";
     std::string str = DateTimeUtils::to_string(now, fmt);
     auto parsed = DateTimeUtils::from_string(str, fmt);
 
-    std::time_t now_utc = std::chrono::system_clock::to_time_t(now);
-    std::time_t parsed_utc = std::chrono::system_clock::to_time_t(parsed);
-
-    // Adjust parsed_utc to UTC
-    parsed_utc -= tz_offset;
-
-    EXPECT_LE(std::abs(now_utc - parsed_utc), 1);
+    // Both render and read local time, so the round trip holds across DST and any offset.
+    std::time_t expected = std::chrono::system_clock::to_time_t(now);
+    EXPECT_LE(std::abs(std::chrono::system_clock::to_time_t(parsed) - expected), 1);
 }
 
 /**
@@ -223,3 +291,124 @@ TEST_F(DateTimeUtilsTest, TimerNowAndElapsed)
     EXPECT_NEAR(elapsed_ms, elapsed_s * 1000.0, 1.0);
     EXPECT_NEAR(elapsed_us, elapsed_ms * 1000.0, 100.0);
 }
+
+/**
+ * @brief Tests that the fast from_string path agrees with std::get_time + std::mktime, with
+ *        daylight saving time taken from the zone rules.
+ */
+TEST_F(DateTimeUtilsTest, FromStringFastPathMatchesGetTime)
+{
+    using namespace CommonLib;
+    const std::array<std::pair<const char*, const char*>, 4> cases = {{
+        {"2024-07-15 12:34:56", "%Y-%m-%d %H:%M:%S"},
+        {"2024-01-15T01:02:03", "%Y-%m-%dT%H:%M:%S"},
+        {"2024-02-29", "%Y-%m-%d"},
+        {"2024-7-5 1:2:3", "%Y-%m-%d %H:%M:%S"},
+    }};
+
+    for (const auto& [text, format]: cases)
+    {
+        std::tm tm_buf = {};
+        std::istringstream iss(text);
+        iss >> std::get_time(&tm_buf, format);
+        ASSERT_FALSE(iss.fail()) << text;
+        tm_buf.tm_isdst = -1;
+
+        EXPECT_EQ(std::chrono::system_clock::to_time_t(DateTimeUtils::from_string(text, format)),
+                  std::mktime(&tm_buf))
+            << text;
+    }
+}
+
+/**
+ * @brief Tests that parse() returns errors instead of throwing and handles offsets.
+ */
+TEST_F(DateTimeUtilsTest, ParseReturnsExpectedResult)
+{
+    using namespace CommonLib;
+    const auto utc = DateTimeUtils::parse("2024-07-15T12:34:56.789Z");
+    ASSERT_TRUE(utc.has_value());
+    EXPECT_EQ(utc->time_since_epoch().count(), 1721046896789000000);
+
+    const auto http = DateTimeUtils::parse("Mon, 15 Jul 2024 12:34:56 GMT");
+    ASSERT_TRUE(http.has_value());
+    EXPECT_EQ(http->time_since_epoch().count(), 1721046896000000000);
+
+    const auto invalid = DateTimeUtils::parse("not a date");
+    ASSERT_FALSE(invalid.has_value());
+    EXPECT_EQ(invalid.error(), DateTimeParser::Error::InvalidSyntax);
+}
+
+/**
+ * @brief Tests that parse() interprets timestamps without offset as local time.
+ */
+TEST_F(DateTimeUtilsTest, ParseUsesLocalTimeWithoutOffset)
+{
+    using namespace CommonLib;
+    const auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+    const auto parsed = DateTimeUtils::parse(DateTimeUtils::format(now, "%Y-%m-%dT%H:%M:%S"));
+
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::seconds>(parsed->time_since_epoch()),
+              now.time_since_epoch());
+}
+
+/**
+ * @brief Tests that the pmr overloads match the std::string ones and allocate from the arena.
+ */
+TEST_F(DateTimeUtilsTest, PmrOverloadsAllocateFromResource)
+{
+    using namespace CommonLib;
+    // Without an upstream resource, anything not served by the buffer throws std::bad_alloc.
+    std::array<std::byte, 4096> storage{};
+    std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size(),
+                                              std::pmr::null_memory_resource());
+    const auto tp = std::chrono::system_clock::time_point(std::chrono::seconds(1721046896));
+    const std::string format = "%Y-%m-%d %H:%M:%S (%A, %B %d)";
+
+    const std::pmr::string formatted = DateTimeUtils::format(&arena, tp, format);
+    EXPECT_EQ(std::string_view(formatted), DateTimeUtils::format(tp, format));
+    EXPECT_EQ(formatted.get_allocator().resource(), &arena);
+    const auto* begin = reinterpret_cast<const char*>(storage.data());
+    EXPECT_TRUE(formatted.data() >= begin && formatted.data() < begin + storage.size());
+    EXPECT_EQ(std::string_view(DateTimeUtils::to_string(&arena, tp, format)),
+              DateTimeUtils::to_string(tp, format));
+    EXPECT_EQ(std::string_view(DateTimeUtils::format<"%FT%T">(&arena, tp)),
+              DateTimeUtils::format<"%FT%T">(tp));
+
+    EXPECT_EQ(DateTimeUtils::now(&arena, "%Y").size(), 4U);
+    EXPECT_EQ(DateTimeUtils::now<"%F %T">(&arena).size(), 19U);
+    EXPECT_EQ(DateTimeUtils::now_utc(&arena).size(), 19U);
+    EXPECT_EQ(DateTimeUtils::current_date(&arena).size(), 10U);
+    EXPECT_EQ(DateTimeUtils::current_time(&arena).size(), 8U);
+    EXPECT_EQ(DateTimeUtils::now_utc(&arena).get_allocator().resource(), &arena);
+}
+
+/**
+ * @brief Tests that from_string() parses views such as arena strings and substrings in place.
+ */
+TEST_F(DateTimeUtilsTest, FromStringParsesViews)
+{
+    using namespace CommonLib;
+    std::array<std::byte, 1024> storage{};
+    std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size(),
+                                              std::pmr::null_memory_resource());
+    const std::pmr::string line("ts=15/07/2024 12:34 level=info", &arena);
+    const std::string_view text = std::string_view(line).substr(3, 16);
+    const std::string_view format = std::string_view("%d/%m/%Y %H:%M|").substr(0, 14);
+
+    std::tm tm_buf = {};
+    std::istringstream iss("15/07/2024 12:34");
+    iss >> std::get_time(&tm_buf, "%d/%m/%Y %H:%M");
+    ASSERT_FALSE(iss.fail());
+    tm_buf.tm_isdst = -1;
+
+    EXPECT_EQ(std::chrono::system_clock::to_time_t(DateTimeUtils::from_string(text, format)),
+              std::mktime(&tm_buf));
+    EXPECT_EQ(std::chrono::system_clock::to_time_t(
+                  DateTimeUtils::from_string(std::string_view(line).substr(3, 10), "%d/%m/%Y")),
+              std::chrono::system_clock::to_time_t(DateTimeUtils::from_string("15/07/2024",
+                                                                              "%d/%m/%Y")));
+    EXPECT_THROW(DateTimeUtils::from_string(std::string_view(line).substr(0, 10), format),
+                 std::runtime_error);
+}
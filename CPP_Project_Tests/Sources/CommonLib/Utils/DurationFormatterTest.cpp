@@ -0,0 +1,57 @@
+#include "CommonLib/Utils/DurationFormatterTest.h"
+
+#include <array>
+#include <limits>
+
+/**
+ * @brief Tests the automatic choice of the unit and the rounding to three decimals.
+ */
+TEST_F(DurationFormatterTest, AutoUnitAndRounding)
+{
+    using namespace CommonLib;
+    using namespace std::chrono_literals;
+    EXPECT_EQ(DurationFormatter::format(0ns), "0ns");
+    EXPECT_EQ(DurationFormatter::format(999ns), "999ns");
+    EXPECT_EQ(DurationFormatter::format(1000ns), "1us");
+    EXPECT_EQ(DurationFormatter::format(1500ns), "1.5us");
+    EXPECT_EQ(DurationFormatter::format(1234567ns), "1.235ms");
+    EXPECT_EQ(DurationFormatter::format(999999999ns), "1000ms");
+    EXPECT_EQ(DurationFormatter::format(3725s + 500ms), "3725.5s");
+    EXPECT_EQ(DurationFormatter::format(-250ns), "-250ns");
+    EXPECT_EQ(DurationFormatter::format(-2ms), "-2ms");
+}
+
+/**
+ * @brief Tests fixed units and the parsing of unit suffixes.
+ */
+TEST_F(DurationFormatterTest, FixedUnits)
+{
+    using namespace CommonLib;
+    using namespace std::chrono_literals;
+    using Unit = DurationFormatter::Unit;
+    EXPECT_EQ(DurationFormatter::format(1500us, Unit::Nanoseconds), "1500000ns");
+    EXPECT_EQ(DurationFormatter::format(1500us, Unit::Microseconds), "1500us");
+    EXPECT_EQ(DurationFormatter::format(1500us, Unit::Milliseconds), "1.5ms");
+    EXPECT_EQ(DurationFormatter::format(1500us, Unit::Seconds), "0.002s");
+    EXPECT_EQ(DurationFormatter::format(-400ns, Unit::Seconds), "0s");
+
+    EXPECT_EQ(DurationFormatter::parse_unit(""), Unit::Auto);
+    EXPECT_EQ(DurationFormatter::parse_unit("us"), Unit::Microseconds);
+    EXPECT_EQ(DurationFormatter::parse_unit("s"), Unit::Seconds);
+    EXPECT_FALSE(DurationFormatter::parse_unit("min").has_value());
+}
+
+/**
+ * @brief Tests the extreme values and a buffer that is too small.
+ */
+TEST_F(DurationFormatterTest, ExtremesAndSmallBuffer)
+{
+    using namespace CommonLib;
+    using Unit = DurationFormatter::Unit;
+    const auto lowest = std::chrono::nanoseconds(std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(DurationFormatter::format(lowest, Unit::Nanoseconds), "-9223372036854775808ns");
+    EXPECT_EQ(DurationFormatter::format(lowest), "-9223372036.855s");
+
+    std::array<char, DurationFormatter::k_max_size - 1> small{};
+    EXPECT_EQ(DurationFormatter::format_to(std::span<char>(small), lowest), 0U);
+}
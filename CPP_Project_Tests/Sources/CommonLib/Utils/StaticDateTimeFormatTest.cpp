@@ -0,0 +1,178 @@
+#include "CommonLib/Utils/StaticDateTimeFormatTest.h"
+
+#include <array>
+#include <chrono>
+#include <string>
+
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+using TimePoint = std::chrono::system_clock::time_point;
+using Zone = CommonLib::DateTimeFormatter::Zone;
+using namespace CommonLib::literals;
+
+constexpr std::array<std::int64_t, 6> k_sample_nanoseconds = {
+    0,                    // 1970-01-01 00:00:00
+    951782400123456789,   // 2000-02-29 00:00:00.123456789
+    1672531200000000001,  // 2023-01-01 00:00:00.000000001
+    1688169599999999999,  // 2023-06-30 23:59:59.999999999
+    1711846800500000000,  // 2024-03-31 01:00:00.5
+    4102444799000001000   // 2099-12-31 23:59:59.000001
+};
+
+auto sample(std::int64_t nanoseconds) -> TimePoint
+{
+    return TimePoint(std::chrono::duration_cast<TimePoint::duration>(
+        std::chrono::nanoseconds(nanoseconds)));
+}
+
+/**
+ * @brief Renders every sample with a static and a runtime compiled format and compares them.
+ */
+template<CommonLib::FixedString Format, Zone FormatZone>
+void expect_matches_formatter()
+{
+    using Static = CommonLib::StaticDateTimeFormat<Format, FormatZone>;
+    const CommonLib::DateTimeFormatter formatter(Format.view(), FormatZone);
+    for (const std::int64_t nanoseconds: k_sample_nanoseconds)
+    {
+        const std::string expected = formatter.format(sample(nanoseconds));
+        EXPECT_EQ(Static::format(sample(nanoseconds)), expected) << Format.view();
+        EXPECT_EQ(expected.size(), Static::k_size) << Format.view();
+    }
+}
+
+// Everything about a UTC format is known at compile time.
+using IsoUtc = CommonLib::StaticDateTimeFormat<"%Y-%m-%dT%H:%M:%S.%3NZ", Zone::Utc>;
+static_assert(IsoUtc::k_size == 24);
+static_assert(IsoUtc::format_array(TimePoint(std::chrono::milliseconds(1500)))[20] == '5');
+constexpr auto k_parsed = IsoUtc::parse("1970-01-01T00:00:01.500Z");
+static_assert(*k_parsed == TimePoint(std::chrono::milliseconds(1500)));
+static_assert("2024-03-31T02:30:00+02:00"_utc == "2024-03-31T00:30Z"_utc);
+}  // namespace
+
+/**
+ * @brief Tests that local rendering matches DateTimeFormatter for all supported specifiers.
+ */
+TEST_F(StaticDateTimeFormatTest, LocalRenderingMatchesFormatter)
+{
+    expect_matches_formatter<"%Y-%m-%d %H:%M:%S", Zone::Local>();
+    expect_matches_formatter<"%F %T.%N %z", Zone::Local>();
+    expect_matches_formatter<"%a %b %h %p %3N %6N", Zone::Local>();
+    expect_matches_formatter<"%y %C %e %j %u %w %I", Zone::Local>();
+    expect_matches_formatter<"%D %R %r", Zone::Local>();
+    expect_matches_formatter<"literal text without specifiers", Zone::Local>();
+    expect_matches_formatter<"%% %n %t", Zone::Local>();
+}
+
+/**
+ * @brief Tests that UTC rendering matches DateTimeFormatter, including the %:z extension.
+ */
+TEST_F(StaticDateTimeFormatTest, UtcRenderingMatchesFormatter)
+{
+    using namespace CommonLib;
+    expect_matches_formatter<"%Y-%m-%dT%H:%M:%S.%9N%z", Zone::Utc>();
+    expect_matches_formatter<"%a, %d %b %Y %T GMT", Zone::Utc>();
+    EXPECT_EQ((StaticDateTimeFormat<"%F %:z", Zone::Utc>::format(sample(0))), "1970-01-01 +00:00");
+
+    std::array<char, 32> buffer{};
+    char* end = StaticDateTimeFormat<"%T", Zone::Utc>::format_to(buffer.data(), sample(0));
+    EXPECT_EQ(std::string(buffer.data(), end), "00:00:00");
+}
+
+/**
+ * @brief Tests that rendered timestamps parse back to the same instant.
+ */
+TEST_F(StaticDateTimeFormatTest, ParseRoundTrips)
+{
+    using namespace CommonLib;
+    using Precise = StaticDateTimeFormat<"%F %T.%9N %:z">;
+    using Utc = StaticDateTimeFormat<"%a %b %e %I:%M:%S.%6N %p %Y (%j, %u)", Zone::Utc>;
+    using Local = StaticDateTimeFormat<"%Y%m%d-%H%M%S">;
+    for (const std::int64_t nanoseconds: k_sample_nanoseconds)
+    {
+        const TimePoint tp = sample(nanoseconds);
+        const auto micros = std::chrono::floor<std::chrono::microseconds>(tp);
+        const auto seconds = std::chrono::floor<std::chrono::seconds>(tp);
+
+        const auto precise = Precise::parse(Precise::format(tp));
+        ASSERT_TRUE(precise.has_value()) << Precise::format(tp);
+        EXPECT_EQ(*precise, tp);
+
+        const auto utc = Utc::parse(Utc::format(tp));
+        ASSERT_TRUE(utc.has_value()) << Utc::format(tp);
+        EXPECT_EQ(*utc, micros);
+
+        const auto local = Local::parse(Local::format(tp));
+        ASSERT_TRUE(local.has_value()) << Local::format(tp);
+        EXPECT_EQ(*local, seconds);
+    }
+
+    // Fields the format does not contain keep their defaults.
+    const auto fields = StaticDateTimeFormat<"%H:%M", Zone::Utc>::parse_fields("12:34");
+    ASSERT_TRUE(fields.has_value());
+    EXPECT_TRUE(fields->has_time);
+    EXPECT_FALSE(fields->has_offset);
+    EXPECT_EQ(fields->civil.year, 1970);
+    EXPECT_EQ(fields->civil.hour, 12U);
+}
+
+/**
+ * @brief Tests that malformed timestamps report the reason.
+ */
+TEST_F(StaticDateTimeFormatTest, ParseReportsErrors)
+{
+    using namespace CommonLib;
+    using Error = DateTimeParser::Error;
+    using Iso = StaticDateTimeFormat<"%F %T%z", Zone::Utc>;
+    EXPECT_EQ(Iso::parse("").error(), Error::Empty);
+    EXPECT_EQ(Iso::parse("2024-03-31 02:30").error(), Error::InvalidSyntax);
+    EXPECT_EQ(Iso::parse("2024-03-31T02:30:00+0000").error(), Error::InvalidSyntax);
+    EXPECT_EQ(Iso::parse("2024-02-30 02:30:00+0000").error(), Error::InvalidDate);
+    EXPECT_EQ(Iso::parse("2024-13-01 02:30:00+0000").error(), Error::InvalidDate);
+    EXPECT_EQ(Iso::parse("2024-03-31 24:30:00+0000").error(), Error::InvalidTime);
+    EXPECT_EQ(Iso::parse("2024-03-31 02:30:00+2400").error(), Error::InvalidOffset);
+    EXPECT_EQ(Iso::parse("2024-03-31 02:30:00 0000").error(), Error::InvalidOffset);
+    EXPECT_EQ(Iso::parse("2024-03-31 02:30:00+0000 ").error(), Error::TrailingCharacters);
+
+    using Http = StaticDateTimeFormat<"%a, %d %b %Y %T GMT", Zone::Utc>;
+    EXPECT_TRUE(Http::parse("Sun, 06 Nov 1994 08:49:37 GMT").has_value());
+    EXPECT_EQ(Http::parse("Mon, 06 Nov 1994 08:49:37 GMT").error(), Error::InvalidDate);
+    EXPECT_EQ(Http::parse("Sun, 06 nov 1994 08:49:37 GMT").error(), Error::InvalidSyntax);
+
+    using DayOfYear = StaticDateTimeFormat<"%Y %j", Zone::Utc>;
+    EXPECT_EQ(*DayOfYear::parse("2024 366"), "2024-12-31"_utc);
+    EXPECT_EQ(DayOfYear::parse("2023 366").error(), Error::InvalidDate);
+    EXPECT_EQ((StaticDateTimeFormat<"%I %p", Zone::Utc>::parse("13 PM").error()),
+              Error::InvalidTime);
+}
+
+/**
+ * @brief Tests the timestamp literal against DateTimeParser.
+ */
+TEST_F(StaticDateTimeFormatTest, TimestampLiteral)
+{
+    using namespace CommonLib;
+    constexpr auto instant = "2024-03-31T02:30:15.123456789+02:00"_utc;
+    EXPECT_EQ(instant, *DateTimeParser::parse_iso8601("2024-03-31T02:30:15.123456789+02:00"));
+    EXPECT_EQ("2024-03-31"_utc, *DateTimeParser::parse_iso8601("2024-03-31"));
+    EXPECT_EQ("2024-03-31 02:30"_utc, *DateTimeParser::parse_iso8601("2024-03-31 02:30"));
+    EXPECT_EQ("2024-03-31t02:30:15,5Z"_utc,
+              *DateTimeParser::parse_iso8601("2024-03-31T02:30:15.5Z"));
+    EXPECT_EQ("1969-12-31T23:59:59-0100"_utc,
+              *DateTimeParser::parse_iso8601("1970-01-01T00:59:59Z"));
+}
+
+/**
+ * @brief Tests that the DateTimeUtils shortcuts match their runtime format counterparts.
+ */
+TEST_F(StaticDateTimeFormatTest, DateTimeUtilsShortcuts)
+{
+    using namespace CommonLib;
+    const TimePoint tp = sample(k_sample_nanoseconds[4]);
+    EXPECT_EQ(DateTimeUtils::format<"%Y-%m-%d %H:%M:%S">(tp),
+              DateTimeUtils::format(tp, "%Y-%m-%d %H:%M:%S"));
+    EXPECT_EQ(DateTimeUtils::now<"%F">().size(), 10U);
+    EXPECT_EQ(DateTimeUtils::now_utc<"%F %T">().size(), 19U);
+}
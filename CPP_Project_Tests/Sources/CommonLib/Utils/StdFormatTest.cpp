@@ -0,0 +1,55 @@
+#include "CommonLib/Utils/StdFormatTest.h"
+
+#if defined(__cpp_lib_format)
+
+#include <format>
+#include <iterator>
+#include <string>
+
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+using Zone = CommonLib::DateTimeFormatter::Zone;
+
+const auto k_time =
+    std::chrono::system_clock::time_point(std::chrono::nanoseconds(1711846800123456789));
+}  // namespace
+
+/**
+ * @brief Tests that zoned time points render like DateTimeUtils, with and without a spec.
+ */
+TEST_F(StdFormatTest, FormatsZonedTimePoints)
+{
+    using namespace CommonLib;
+    EXPECT_EQ(std::format("{}", as_local(k_time)),
+              DateTimeUtils::to_string(k_time, "%Y-%m-%d %H:%M:%S"));
+    EXPECT_EQ(std::format("{:%F %T.%3N}", as_utc(k_time)), "2024-03-31 01:00:00.123");
+    EXPECT_EQ(std::format("[{:%H}|{:%M}]", as_utc(k_time), as_utc(k_time)), "[01|00]");
+
+    // Specs rendering more than the stack buffer holds are written straight to the output.
+    const std::string dashes(300, '-');
+    const ZonedTimePoint utc = as_utc(k_time);
+    EXPECT_EQ(std::vformat("{:" + dashes + "%Y}", std::make_format_args(utc)), dashes + "2024");
+}
+
+/**
+ * @brief Tests durations and compile-time formats, also through std::format_to.
+ */
+TEST_F(StdFormatTest, FormatsDurationsAndStaticFormats)
+{
+    using namespace CommonLib;
+    using namespace std::chrono_literals;
+    EXPECT_EQ(std::format("{} {:us}", as_readable(1500us), as_readable(2ms)), "1.5ms 2000us");
+    EXPECT_EQ(std::format("{}", as_formatted<"%FT%T", Zone::Utc>(k_time)),
+              "2024-03-31T01:00:00");
+
+    std::string line;
+    std::format_to(std::back_inserter(line), "{} took {}", as_utc(k_time), as_readable(250ns));
+    EXPECT_EQ(line, "2024-03-31 01:00:00 took 250ns");
+    const ReadableDuration second = as_readable(1s);
+    EXPECT_THROW(static_cast<void>(std::vformat("{:min}", std::make_format_args(second))),
+                 std::format_error);
+}
+
+#endif
@@ -0,0 +1,255 @@
+#include "CommonLib/Utils/TimeBucketerTest.h"
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "CommonLib/Utils/CivilTime.h"
+#include "CommonLib/Utils/TimeZone.h"
+
+namespace
+{
+using Unit = CommonLib::TimeBucketer::Unit;
+using Resolution = CommonLib::TimeBucketer::Resolution;
+
+constexpr std::array<CommonLib::SimdLevel, 2> k_levels = {CommonLib::SimdLevel::Scalar,
+                                                          CommonLib::SimdLevel::Avx2};
+
+/**
+ * @brief Random timestamps within +-2^62 followed by a sorted column around 2024.
+ */
+auto sample_values(std::int64_t ticks_per_second) -> std::vector<std::int64_t>
+{
+    std::mt19937_64 engine(11);
+    std::uniform_int_distribution<std::int64_t> distribution(-(std::int64_t{1} << 62),
+                                                             std::int64_t{1} << 62);
+    std::vector<std::int64_t> result = {0, -1, 1};
+    for (int i = 0; i < 2000; ++i)
+    {
+        result.push_back(distribution(engine));
+    }
+    for (std::int64_t i = 0; i < 5000; ++i)
+    {
+        result.push_back((1704067200 + i * 7919) * ticks_per_second + i % ticks_per_second);
+    }
+    return result;
+}
+
+/**
+ * @brief Floors with plain integer division as the reference for fixed-width buckets.
+ */
+auto floor_reference(std::int64_t value, std::int64_t width, std::int64_t origin) -> std::int64_t
+{
+    const std::int64_t offset = value - origin;
+    std::int64_t quotient = offset / width;
+    if (offset % width < 0)
+    {
+        --quotient;
+    }
+    return quotient * width + origin;
+}
+
+auto bucket_all(const CommonLib::TimeBucketer& bucketer, const std::vector<std::int64_t>& values,
+                CommonLib::SimdLevel level) -> std::vector<std::int64_t>
+{
+    std::vector<std::int64_t> buckets(values.size());
+    bucketer.bucket_many(values, buckets, level);
+    return buckets;
+}
+}  // namespace
+
+/**
+ * @brief Tests fixed-width UTC buckets against integer division for every SIMD level.
+ */
+TEST_F(TimeBucketerTest, FixedBucketsMatchIntegerDivision)
+{
+    using namespace CommonLib;
+    struct Case {
+            Unit unit;
+            std::uint32_t count;
+            std::int64_t seconds;
+    };
+    const std::array<Case, 7> cases = {Case{Unit::Second, 1, 1},     Case{Unit::Second, 10, 10},
+                                       Case{Unit::Minute, 1, 60},    Case{Unit::Minute, 15, 900},
+                                       Case{Unit::Hour, 1, 3600},    Case{Unit::Day, 1, 86400},
+                                       Case{Unit::Week, 2, 1209600}};
+    const std::array<std::pair<Resolution, std::int64_t>, 3> resolutions = {
+        std::pair{Resolution::Seconds, 1}, std::pair{Resolution::Milliseconds, 1000},
+        std::pair{Resolution::Nanoseconds, 1000000000}};
+
+    for (const auto& [resolution, ticks]: resolutions)
+    {
+        const std::vector<std::int64_t> values = sample_values(ticks);
+        for (const Case& c: cases)
+        {
+            const TimeBucketer bucketer(c.unit, c.count, resolution);
+            const std::int64_t width = c.seconds * ticks;
+            const std::int64_t origin = c.unit == Unit::Week ? 4 * 86400 * ticks % width : 0;
+            for (const SimdLevel level: k_levels)
+            {
+                const auto buckets = bucket_all(bucketer, values, level);
+                for (std::size_t i = 0; i < values.size(); ++i)
+                {
+                    ASSERT_EQ(buckets[i], floor_reference(values[i], width, origin))
+                        << values[i] << " width " << width;
+                }
+            }
+            EXPECT_EQ(bucketer.bucket_of(values.back()),
+                      floor_reference(values.back(), width, origin));
+        }
+    }
+
+    // 2024-07-17 is a Wednesday; its week starts on Monday, 2024-07-15.
+    const TimeBucketer weeks(Unit::Week, 1, Resolution::Seconds);
+    EXPECT_EQ(weeks.bucket_of(1721221200), 1721001600);
+}
+
+/**
+ * @brief Tests month, quarter and year buckets against the civil calendar.
+ */
+TEST_F(TimeBucketerTest, CalendarBucketsMatchCivilCalendar)
+{
+    using namespace CommonLib;
+    const std::vector<std::int64_t> values = sample_values(1);
+    const TimeBucketer months(Unit::Month, 1, Resolution::Seconds);
+    const TimeBucketer quarters(Unit::Month, 3, Resolution::Seconds);
+    const TimeBucketer decades(Unit::Year, 10, Resolution::Seconds);
+
+    for (const SimdLevel level: k_levels)
+    {
+        const auto month_buckets = bucket_all(months, values, level);
+        const auto quarter_buckets = bucket_all(quarters, values, level);
+        const auto decade_buckets = bucket_all(decades, values, level);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            // Years outside of int32 are not representable by CivilDateTime.
+            if (values[i] < -(std::int64_t{1} << 55) || values[i] > (std::int64_t{1} << 55))
+            {
+                continue;
+            }
+            const CivilDateTime civil = CivilTime::from_unix_seconds(values[i]);
+            const auto month_start = [&](std::int32_t year, std::uint32_t month) {
+                return CivilTime::days_from_civil(year, month, 1) * CivilTime::k_seconds_per_day;
+            };
+            ASSERT_EQ(month_buckets[i], month_start(civil.year, civil.month)) << values[i];
+            ASSERT_EQ(quarter_buckets[i], month_start(civil.year, (civil.month - 1) / 3 * 3 + 1));
+            const std::int32_t decade =
+                civil.year >= 0 ? civil.year / 10 * 10 : (civil.year - 9) / 10 * 10;
+            ASSERT_EQ(decade_buckets[i], month_start(decade, 1)) << values[i];
+        }
+    }
+}
+
+/**
+ * @brief Tests that local buckets start at local midnight, also on 23 and 25 hour days.
+ */
+TEST_F(TimeBucketerTest, LocalBucketsFollowDaylightSavingTime)
+{
+    using namespace CommonLib;
+    const auto berlin = TimeZone::from_posix_rule("CET-1CEST,M3.5.0,M10.5.0/3");
+    const auto lord_howe = TimeZone::from_posix_rule("<+1030>-10:30<+11>-11,M10.1.0,M4.1.0");
+    ASSERT_NE(berlin, nullptr);
+    ASSERT_NE(lord_howe, nullptr);
+
+    const TimeBucketer days(Unit::Day, 1, Resolution::Seconds, berlin.get());
+    EXPECT_EQ(days.zone(), berlin.get());
+    // 2024-03-31 12:00 UTC and 2024-04-01 12:00 UTC: the first day has 23 hours.
+    EXPECT_EQ(days.bucket_of(1711886400), 1711839600);
+    EXPECT_EQ(days.bucket_of(1711972800), 1711922400);
+
+    std::vector<std::int64_t> values;
+    for (std::int64_t seconds = 1704067200; seconds < 1735689600; seconds += 599)
+    {
+        values.push_back(seconds * 1000);
+    }
+
+    for (const auto* zone: {berlin.get(), lord_howe.get()})
+    {
+        for (const Unit unit: {Unit::Hour, Unit::Day, Unit::Week, Unit::Month})
+        {
+            const TimeBucketer bucketer(unit, 1, Resolution::Milliseconds, zone);
+            for (const SimdLevel level: k_levels)
+            {
+                const auto buckets = bucket_all(bucketer, values, level);
+                for (std::size_t i = 0; i < values.size(); ++i)
+                {
+                    ASSERT_EQ(buckets[i], bucketer.bucket_of(values[i])) << values[i];
+                    ASSERT_LE(buckets[i], values[i]);
+                    // Lord Howe skips 02:00 - 02:30, so that hour bucket starts at 02:30.
+                    const CivilDateTime start = zone->to_local(buckets[i] / 1000);
+                    ASSERT_EQ(start.minute % 30, 0U) << buckets[i];
+                    if (unit != Unit::Hour)
+                    {
+                        ASSERT_EQ(start.hour, 0U) << buckets[i];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tests the run-length grouping of bucket ids.
+ */
+TEST_F(TimeBucketerTest, GroupRunsSplitsEqualIds)
+{
+    using namespace CommonLib;
+    const std::vector<std::int64_t> ids = {5, 5, 5, 7, 7, 5, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1};
+    for (const SimdLevel level: k_levels)
+    {
+        std::vector<TimeBucketer::Run> runs(ids.size());
+        ASSERT_EQ(TimeBucketer::group_runs(ids, runs, level), 5U);
+        EXPECT_EQ(runs[0].bucket, 5);
+        EXPECT_EQ(runs[0].count, 3U);
+        EXPECT_EQ(runs[2].begin, 5U);
+        EXPECT_EQ(runs[3].bucket, 9);
+        EXPECT_EQ(runs[3].begin, 6U);
+        EXPECT_EQ(runs[3].count, 9U);
+        EXPECT_EQ(runs[4].begin, 15U);
+        EXPECT_EQ(runs[4].count, 1U);
+    }
+
+    std::mt19937_64 engine(3);
+    std::vector<std::int64_t> column;
+    for (std::int64_t bucket = 0; column.size() < 10000; ++bucket)
+    {
+        column.insert(column.end(), engine() % 20 + 1, bucket);
+    }
+    const auto expected = TimeBucketer::group_runs(column);
+    std::vector<TimeBucketer::Run> scalar(column.size());
+    ASSERT_EQ(TimeBucketer::group_runs(column, scalar, SimdLevel::Scalar), expected.size());
+    std::size_t covered = 0;
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(expected[i].bucket, static_cast<std::int64_t>(i));
+        ASSERT_EQ(expected[i].begin, covered);
+        ASSERT_EQ(scalar[i].count, expected[i].count);
+        covered += expected[i].count;
+    }
+    EXPECT_EQ(covered, column.size());
+    EXPECT_TRUE(TimeBucketer::group_runs({}).empty());
+}
+
+/**
+ * @brief Tests that invalid arguments are rejected.
+ */
+TEST_F(TimeBucketerTest, RejectsInvalidArguments)
+{
+    using namespace CommonLib;
+    EXPECT_THROW(TimeBucketer(Unit::Minute, 0), std::invalid_argument);
+    EXPECT_THROW(TimeBucketer(Unit::Week, 4000000000U), std::invalid_argument);
+    EXPECT_NO_THROW(TimeBucketer(Unit::Year, 4000000000U));
+
+    const TimeBucketer bucketer(Unit::Minute);
+    EXPECT_EQ(bucketer.unit(), Unit::Minute);
+    EXPECT_EQ(bucketer.count(), 1U);
+    EXPECT_EQ(bucketer.zone(), nullptr);
+
+    std::vector<std::int64_t> values(8);
+    std::vector<std::int64_t> buckets(7);
+    EXPECT_THROW(bucketer.bucket_many(values, buckets), std::invalid_argument);
+    std::vector<TimeBucketer::Run> runs(7);
+    EXPECT_THROW(TimeBucketer::group_runs(values, runs), std::invalid_argument);
+}
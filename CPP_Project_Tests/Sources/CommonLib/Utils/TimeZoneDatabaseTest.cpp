@@ -0,0 +1,170 @@
+#include "CommonLib/Utils/TimeZoneDatabaseTest.h"
+
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CommonLib/Utils/DateTimeUtils.h"
+
+namespace
+{
+constexpr const char* k_zoneinfo = "/usr/share/zoneinfo";
+
+auto has_zones(std::initializer_list<const char*> names) -> bool
+{
+    for (const char* name: names)
+    {
+        if (!std::filesystem::exists(std::string(k_zoneinfo) + "/" + name))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+/**
+ * @brief Tests that zones are loaded once and then served from the cache.
+ */
+TEST_F(TimeZoneDatabaseTest, LocatesAndCachesZones)
+{
+    using namespace CommonLib;
+    if (!has_zones({"Europe/Berlin", "Asia/Tokyo"}))
+    {
+        GTEST_SKIP() << "zoneinfo not installed";
+    }
+
+    TimeZoneDatabase database(k_zoneinfo);
+    EXPECT_EQ(database.directory(), k_zoneinfo);
+    EXPECT_EQ(database.size(), 0U);
+
+    const TimeZone* berlin = database.locate("Europe/Berlin");
+    ASSERT_NE(berlin, nullptr);
+    EXPECT_EQ(berlin->name(), "Europe/Berlin");
+    EXPECT_EQ(database.locate("Europe/Berlin"), berlin);
+    EXPECT_EQ(database.find("Europe/Berlin").get(), berlin);
+    EXPECT_EQ(database.size(), 1U);
+
+    // 2024-07-15 12:00:00 UTC.
+    EXPECT_EQ(berlin->offset_at(1721044800).utc_offset, 2 * 3600);
+    EXPECT_EQ(database.locate("Asia/Tokyo")->offset_at(1721044800).utc_offset, 9 * 3600);
+    EXPECT_EQ(database.size(), 2U);
+}
+
+/**
+ * @brief Tests that unknown zones, directories and paths escaping the directory are rejected.
+ */
+TEST_F(TimeZoneDatabaseTest, RejectsInvalidNames)
+{
+    using namespace CommonLib;
+    TimeZoneDatabase database(k_zoneinfo);
+    for (const char* name: {"", "/etc/passwd", "../zoneinfo/UTC", "Europe/../UTC", "Europe",
+                            "No/Such_Zone"})
+    {
+        EXPECT_EQ(database.locate(name), nullptr) << name;
+        EXPECT_EQ(database.locate(name), nullptr) << name;
+    }
+    EXPECT_EQ(database.find("No/Such_Zone"), nullptr);
+    EXPECT_EQ(database.size(), 0U);
+
+    TimeZoneDatabase empty("/nonexistent/zoneinfo");
+    const TimeZone* utc = empty.locate("UTC");
+    ASSERT_NE(utc, nullptr);
+    EXPECT_EQ(utc->offset_at(1721044800).utc_offset, 0);
+}
+
+/**
+ * @brief Tests conversion between named zones.
+ */
+TEST_F(TimeZoneDatabaseTest, ConvertsBetweenNamedZones)
+{
+    using namespace CommonLib;
+    if (!has_zones({"America/New_York", "Asia/Tokyo", "Australia/Lord_Howe"}))
+    {
+        GTEST_SKIP() << "zoneinfo not installed";
+    }
+
+    TimeZoneDatabase database(k_zoneinfo);
+    const auto tokyo = database.convert({2024, 7, 1, 12, 0, 0, 250}, "America/New_York",
+                                        "Asia/Tokyo");
+    ASSERT_TRUE(tokyo.has_value());
+    EXPECT_EQ(tokyo->day, 2U);
+    EXPECT_EQ(tokyo->hour, 1U);
+    EXPECT_EQ(tokyo->nanosecond, 250U);
+
+    // Lord Howe shifts by 30 minutes: +11:00 in January, +10:30 in July.
+    const auto howe = database.convert({2024, 1, 15, 0, 0, 0}, "UTC", "Australia/Lord_Howe");
+    ASSERT_TRUE(howe.has_value());
+    EXPECT_EQ(howe->hour, 11U);
+    EXPECT_EQ(howe->minute, 0U);
+
+    EXPECT_FALSE(database.convert({}, "UTC", "No/Such_Zone").has_value());
+    EXPECT_FALSE(database.convert({}, "No/Such_Zone", "UTC").has_value());
+}
+
+/**
+ * @brief Tests that concurrent lookups agree on a single instance per zone.
+ */
+TEST_F(TimeZoneDatabaseTest, ConcurrentLookupsShareZones)
+{
+    using namespace CommonLib;
+    const std::vector<std::string> names = {"Europe/Berlin", "America/New_York", "Asia/Tokyo",
+                                            "Australia/Lord_Howe", "UTC", "No/Such_Zone"};
+    TimeZoneDatabase database(k_zoneinfo);
+
+    constexpr std::size_t k_threads = 8;
+    std::vector<std::vector<const TimeZone*>> seen(k_threads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < k_threads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (int round = 0; round < 100; ++round)
+            {
+                for (std::size_t i = 0; i < names.size(); ++i)
+                {
+                    const std::string& name = names[(i + t) % names.size()];
+                    const TimeZone* zone = database.locate(name);
+                    if (round == 0 && zone != nullptr)
+                    {
+                        seen[t].push_back(zone);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& zones: seen)
+    {
+        for (const TimeZone* zone: zones)
+        {
+            EXPECT_EQ(database.locate(zone->name()), zone);
+        }
+    }
+    EXPECT_EQ(database.locate("No/Such_Zone"), nullptr);
+}
+
+/**
+ * @brief Tests the DateTimeUtils shortcuts for rendering in a named zone.
+ */
+TEST_F(TimeZoneDatabaseTest, DateTimeUtilsFormatsInNamedZone)
+{
+    using namespace CommonLib;
+    if (!has_zones({"Asia/Tokyo"}))
+    {
+        GTEST_SKIP() << "zoneinfo not installed";
+    }
+
+    const auto tp = std::chrono::system_clock::from_time_t(1721044800);
+    EXPECT_EQ(DateTimeUtils::format_in(tp, "Asia/Tokyo"), "2024-07-15 21:00:00");
+    EXPECT_EQ(DateTimeUtils::format_in(tp, "Asia/Tokyo", "%H:%M %Z %z"), "21:00 JST +0900");
+    EXPECT_EQ(DateTimeUtils::now_in("UTC", "%F").size(), 10U);
+    EXPECT_THROW(DateTimeUtils::format_in(tp, "No/Such_Zone"), std::invalid_argument);
+    EXPECT_THROW(DateTimeUtils::now_in("../etc/passwd"), std::invalid_argument);
+}
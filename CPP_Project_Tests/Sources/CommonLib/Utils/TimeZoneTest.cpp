@@ -0,0 +1,236 @@
+#include "CommonLib/Utils/TimeZoneTest.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "CommonLib/Utils/DateTimeFormatter.h"
+#include "CommonLib/Utils/ScopedTimeZone.h"
+
+namespace
+{
+constexpr const char* k_zoneinfo = "/usr/share/zoneinfo/";
+
+/**
+ * @brief Compares offset_at() and to_local() with localtime_r for the current TZ.
+ */
+void expect_matches_localtime(const CommonLib::TimeZone& zone, std::int64_t from, std::int64_t to,
+                              std::int64_t step)
+{
+#if !defined(_WIN32)
+    for (std::int64_t seconds = from; seconds < to; seconds += step)
+    {
+        const auto time_c = static_cast<std::time_t>(seconds);
+        std::tm expected{};
+        localtime_r(&time_c, &expected);
+
+        const auto offset = zone.offset_at(seconds);
+        const auto local = zone.to_local(seconds);
+        ASSERT_EQ(offset.utc_offset, expected.tm_gmtoff) << "at " << seconds;
+        ASSERT_EQ(offset.is_dst, expected.tm_isdst > 0) << "at " << seconds;
+        ASSERT_STREQ(offset.abbreviation, expected.tm_zone) << "at " << seconds;
+        ASSERT_EQ(local.year, expected.tm_year + 1900) << "at " << seconds;
+        ASSERT_EQ(local.hour, static_cast<std::uint32_t>(expected.tm_hour)) << "at " << seconds;
+        ASSERT_EQ(local.day_of_year, static_cast<std::uint32_t>(expected.tm_yday))
+            << "at " << seconds;
+    }
+#endif
+}
+}  // namespace
+
+/**
+ * @brief Tests that TZif files agree with the C library between 1970 and 2100.
+ */
+TEST_F(TimeZoneTest, TzifFileMatchesLocaltime)
+{
+    using namespace CommonLib;
+    for (const char* name: {"Europe/Berlin", "America/New_York", "Australia/Lord_Howe"})
+    {
+        const std::string path = std::string(k_zoneinfo) + name;
+        if (!std::filesystem::exists(path))
+        {
+            continue;
+        }
+
+        const auto zone = TimeZone::from_file(path);
+        ASSERT_NE(zone, nullptr) << name;
+        EXPECT_EQ(zone->name(), path);
+
+        const ScopedTimeZone scoped(name);
+        expect_matches_localtime(*zone, 0, 4102444800, 10799);
+    }
+}
+
+/**
+ * @brief Tests POSIX rules, including a southern hemisphere rule with a 30 minute DST shift.
+ */
+TEST_F(TimeZoneTest, PosixRulesMatchLocaltime)
+{
+    using namespace CommonLib;
+    for (const char* rule: {"EST5EDT,M3.2.0,M11.1.0", "CET-1CEST,M3.5.0,M10.5.0/3",
+                            "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0", "UTC0"})
+    {
+        const auto zone = TimeZone::from_posix_rule(rule);
+        ASSERT_NE(zone, nullptr) << rule;
+
+        const ScopedTimeZone scoped(rule);
+        expect_matches_localtime(*zone, 946684800, 1893456000, 3599);
+    }
+}
+
+/**
+ * @brief Tests offsets, abbreviations and the default DST rule of POSIX strings.
+ */
+TEST_F(TimeZoneTest, PosixRuleOffsets)
+{
+    using namespace CommonLib;
+    const auto zone = TimeZone::from_posix_rule("EST5EDT");
+    ASSERT_NE(zone, nullptr);
+
+    // 2024-01-15 12:00:00 UTC and 2024-07-15 12:00:00 UTC.
+    EXPECT_EQ(zone->offset_at(1705320000).utc_offset, -5 * 3600);
+    EXPECT_STREQ(zone->offset_at(1705320000).abbreviation, "EST");
+    EXPECT_EQ(zone->offset_at(1721044800).utc_offset, -4 * 3600);
+    EXPECT_TRUE(zone->offset_at(1721044800).is_dst);
+    EXPECT_STREQ(zone->offset_at(1721044800).abbreviation, "EDT");
+
+    // Beyond the materialized range the rule is evaluated arithmetically: 2200-07-01 12:00 UTC.
+    EXPECT_EQ(zone->offset_at(7273800000).utc_offset, -4 * 3600);
+
+    const auto utc = TimeZone::utc();
+    EXPECT_EQ(utc->offset_at(1721044800).utc_offset, 0);
+    EXPECT_STREQ(utc->offset_at(1721044800).abbreviation, "UTC");
+}
+
+/**
+ * @brief Tests local to UTC conversion for regular, skipped and repeated wall clock times.
+ */
+TEST_F(TimeZoneTest, ToUtcResolvesGapsAndFolds)
+{
+    using namespace CommonLib;
+    const auto zone = TimeZone::from_posix_rule("CET-1CEST,M3.5.0,M10.5.0/3");
+    ASSERT_NE(zone, nullptr);
+
+    const auto local = [](std::int32_t year, std::uint32_t month, std::uint32_t day,
+                          std::uint32_t hour, std::uint32_t minute) {
+        return CivilTime::to_unix_seconds({year, month, day, hour, minute, 0});
+    };
+
+    // Regular winter and summer times.
+    EXPECT_EQ(zone->to_utc(local(2024, 1, 15, 12, 0)), 1705316400);
+    EXPECT_EQ(zone->to_utc(local(2024, 7, 15, 12, 0)), 1721037600);
+
+    // 2024-03-31 02:30 does not exist; like mktime it is read with the CET offset (01:30 UTC).
+    EXPECT_EQ(zone->to_utc(local(2024, 3, 31, 2, 30)), 1711848600);
+
+    // 2024-10-27 02:30 happens twice; the earlier instant (CEST, 00:30 UTC) is returned.
+    EXPECT_EQ(zone->to_utc(local(2024, 10, 27, 2, 30)), 1729989000);
+
+    for (std::int64_t seconds = 1704067200; seconds < 1735689600; seconds += 3599)
+    {
+        const auto civil = zone->to_local(seconds);
+        const auto round_trip = zone->to_utc(CivilTime::to_unix_seconds(civil));
+        ASSERT_TRUE(round_trip == seconds || round_trip == seconds - 3600) << seconds;
+    }
+}
+
+/**
+ * @brief Tests converting wall clock times between two zones.
+ */
+TEST_F(TimeZoneTest, ConvertsBetweenZones)
+{
+    using namespace CommonLib;
+    const auto berlin = TimeZone::from_posix_rule("CET-1CEST,M3.5.0,M10.5.0/3");
+    const auto new_york = TimeZone::from_posix_rule("EST5EDT,M3.2.0,M11.1.0");
+    ASSERT_NE(berlin, nullptr);
+    ASSERT_NE(new_york, nullptr);
+
+    const CivilDateTime summer{2024, 7, 15, 14, 0, 0, 500000000};
+    const CivilDateTime converted = berlin->convert(summer, *new_york);
+    EXPECT_EQ(converted.day, 15U);
+    EXPECT_EQ(converted.hour, 8U);
+    EXPECT_EQ(converted.nanosecond, 500000000U);
+    CivilDateTime round_trip = new_york->convert(converted, *berlin);
+    EXPECT_EQ(round_trip.nanosecond, 500000000U);
+    round_trip.nanosecond = 0;
+    EXPECT_EQ(round_trip, berlin->to_local(1721044800));
+
+    // 2024-03-15: New York already switched to DST, Berlin not yet.
+    const CivilDateTime spring = new_york->convert({2024, 3, 15, 20, 30, 0}, *berlin);
+    EXPECT_EQ(spring.day, 16U);
+    EXPECT_EQ(spring.hour, 1U);
+    EXPECT_EQ(spring.minute, 30U);
+}
+
+/**
+ * @brief Tests that malformed TZif data and POSIX strings are rejected.
+ */
+TEST_F(TimeZoneTest, RejectsMalformedInput)
+{
+    using namespace CommonLib;
+    EXPECT_EQ(TimeZone::from_tzif({}, "empty"), nullptr);
+
+    const std::vector<std::uint8_t> garbage(64, 'x');
+    EXPECT_EQ(TimeZone::from_tzif(garbage, "garbage"), nullptr);
+
+    const std::string berlin = std::string(k_zoneinfo) + "Europe/Berlin";
+    if (std::filesystem::exists(berlin))
+    {
+        std::vector<std::uint8_t> data(std::filesystem::file_size(berlin));
+        std::FILE* file = std::fopen(berlin.c_str(), "rb");
+        ASSERT_NE(file, nullptr);
+        ASSERT_EQ(std::fread(data.data(), 1, data.size(), file), data.size());
+        std::fclose(file);
+
+        EXPECT_NE(TimeZone::from_tzif(data, "Europe/Berlin"), nullptr);
+        for (std::size_t length: {std::size_t{10}, std::size_t{44}, data.size() / 2})
+        {
+            const std::vector<std::uint8_t> truncated(data.begin(),
+                                                      data.begin() + static_cast<long>(length));
+            EXPECT_EQ(TimeZone::from_tzif(truncated, "truncated"), nullptr) << length;
+        }
+    }
+
+    EXPECT_EQ(TimeZone::from_file("/nonexistent/zone"), nullptr);
+    for (const char* rule: {"", "X1", "EST", "EST5EDT,M3.2.0", "EST5EDT,M13.1.0,M11.1.0",
+                            "<EST5", "EST5EDT,M3.2.0,M11.1.0/200", "EST5 trailing"})
+    {
+        EXPECT_EQ(TimeZone::from_posix_rule(rule), nullptr) << rule;
+    }
+}
+
+/**
+ * @brief Tests that reload_local() picks up a changed TZ and invalidates per-thread caches.
+ */
+TEST_F(TimeZoneTest, ReloadLocalFollowsTzChanges)
+{
+    using namespace CommonLib;
+#if defined(_WIN32)
+    GTEST_SKIP() << "The local zone is provided by the C runtime on Windows";
+#else
+    const DateTimeFormatter formatter("%H:%M %Z", DateTimeFormatter::Zone::Local);
+    const auto tp = std::chrono::system_clock::from_time_t(1721044800);
+
+    {
+        const ScopedTimeZone scoped("EST5EDT,M3.2.0,M11.1.0");
+        const auto generation = TimeZone::local_generation();
+        ASSERT_NE(TimeZone::local_cached(), nullptr);
+        EXPECT_EQ(TimeZone::local_cached()->offset_at(1721044800).utc_offset, -4 * 3600);
+        EXPECT_EQ(formatter.format(tp), "08:00 EDT");
+
+        setenv("TZ", "UTC0", 1);
+        EXPECT_EQ(formatter.format(tp), "08:00 EDT");
+        EXPECT_TRUE(TimeZone::reload_local());
+        EXPECT_GT(TimeZone::local_generation(), generation);
+        EXPECT_EQ(formatter.format(tp), "12:00 UTC");
+    }
+
+    {
+        const ScopedTimeZone scoped("");
+        EXPECT_EQ(TimeZone::local()->offset_at(1721044800).utc_offset, 0);
+    }
+#endif
+}
@@ -0,0 +1,67 @@
+#include "CommonLib/Utils/TscClockTest.h"
+
+#include <chrono>
+#include <thread>
+
+#include "CommonLib/Base/CpuFeatures.h"
+
+/**
+ * @brief Tests that the TSC is used exactly when the CPU reports an invariant TSC and RDTSCP.
+ */
+TEST_F(TscClockTest, UsesTscOnlyWhenInvariant)
+{
+    using namespace CommonLib;
+#if COMMONLIB_HAS_TSC
+    EXPECT_EQ(TscClock::uses_tsc(),
+              CpuFeatures::has_invariant_tsc() && CpuFeatures::has_rdtscp());
+#else
+    EXPECT_FALSE(TscClock::uses_tsc());
+#endif
+    if (!TscClock::uses_tsc())
+    {
+        EXPECT_EQ(TscClock::ticks_per_second(), 1e9);
+    }
+}
+
+/**
+ * @brief Tests that readings are monotonic and that the calibrated rate is plausible.
+ */
+TEST_F(TscClockTest, ReadingsAreMonotonic)
+{
+    using namespace CommonLib;
+    TscClock::Ticks previous = TscClock::now();
+    for (int i = 0; i < 1000; ++i)
+    {
+        const TscClock::Ticks current = i % 2 == 0 ? TscClock::now() : TscClock::now_ordered();
+        EXPECT_GE(current, previous);
+        previous = current;
+    }
+
+    // Every x86 CPU with an invariant TSC ticks between 100 MHz and 10 GHz.
+    const double rate = TscClock::calibrate(std::chrono::milliseconds(20));
+    EXPECT_GT(rate, 1e8);
+    EXPECT_LT(rate, 1e10);
+    EXPECT_EQ(TscClock::ticks_per_second(), rate);
+}
+
+/**
+ * @brief Tests that elapsed times agree with steady_clock.
+ */
+TEST_F(TscClockTest, ElapsedMatchesSteadyClock)
+{
+    using namespace CommonLib;
+    const auto steady_start = std::chrono::steady_clock::now();
+    const TscClock::Ticks start = TscClock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    const TscClock::Ticks end = TscClock::now_ordered();
+    const auto steady_end = std::chrono::steady_clock::now();
+
+    const double expected_ms =
+        std::chrono::duration<double, std::milli>(steady_end - steady_start).count();
+    const double elapsed_ms = TscClock::elapsed_ms(start, end);
+    EXPECT_GE(elapsed_ms, 30.0 * 0.98);
+    EXPECT_LE(elapsed_ms, expected_ms * 1.02);
+    EXPECT_DOUBLE_EQ(TscClock::elapsed_s(start, end) * 1000, elapsed_ms);
+    EXPECT_DOUBLE_EQ(TscClock::elapsed_us(start, end) / 1000, elapsed_ms);
+    EXPECT_LT(TscClock::elapsed_ns(end, start), 0.0);
+}